@@ -0,0 +1,79 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+
+#include <dnp3decode/BinaryLogReader.h>
+#include <opendnp3/LogLevels.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+using namespace std;
+using namespace opendnp3;
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		cerr << "usage: binlog-decoder <capture file> [--location]" << endl;
+		return -1;
+	}
+
+	const bool printLocation = (argc > 2) && (strcmp(argv[2], "--location") == 0);
+
+	ifstream file(argv[1], ios::binary);
+	if (!file)
+	{
+		cerr << "unable to open: " << argv[1] << endl;
+		return -1;
+	}
+
+	BinaryLogReader reader(file);
+	if (!reader.ReadHeader())
+	{
+		cerr << "not a binary log capture: " << argv[1] << endl;
+		return -1;
+	}
+
+	BinaryLogRecord record;
+	while (reader.Read(record))
+	{
+		for (auto& line : record.lines)
+		{
+			// same layout as ConsoleLogger
+			printf("ms(%lld) %s %s", static_cast<long long>(record.milliseconds), LogFlagToString(record.filters), record.loggerid.c_str());
+			if (printLocation)
+			{
+				printf(" - %s", record.location.c_str());
+			}
+			printf(" - %s\n", line.c_str());
+		}
+	}
+
+	if (reader.IsCorrupt())
+	{
+		cerr << "capture is truncated or corrupt" << endl;
+		return -1;
+	}
+
+	return 0;
+}
@@ -23,9 +23,15 @@
 #include <openpal/container/Buffer.h>
 
 #include <dnp3decode/Decoder.h>
+#include <dnp3decode/CaptureDecoder.h>
 #include <opendnp3/LogLevels.h>
 #include <asiodnp3/ConsoleLogger.h>
 
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
 using namespace std;
 using namespace openpal;
 using namespace opendnp3;
@@ -54,8 +60,103 @@ Mode GetMode(const std::string& mode)
 	}
 }
 
+class PrintingCaptureHandler final : public ICaptureHandler
+{
+public:
+
+	virtual void OnLine(const CaptureLine& line) override
+	{
+		// capture time with microsecond resolution, then the same layout as ConsoleLogger
+		const auto microseconds = line.nanoseconds / 1000;
+		printf("%lld.%06lld %s %s - %s\n",
+		       static_cast<long long>(microseconds / 1000000),
+		       static_cast<long long>(microseconds % 1000000),
+		       LogFlagToString(line.filters),
+		       line.stream,
+		       line.message);
+	}
+};
+
+int DecodeCapture(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		cerr << "usage: decoder pcap <capture file> [--threads <n>] [--port <n>]... [--packets-per-pass <n>]" << endl;
+		return -1;
+	}
+
+	CaptureDecoderConfig config;
+
+	for (int i = 3; i < argc; ++i)
+	{
+		const bool hasValue = (i + 1) < argc;
+
+		if (strcmp(argv[i], "--threads") == 0 && hasValue)
+		{
+			config.numThreads = static_cast<uint32_t>(atoi(argv[++i]));
+		}
+		else if (strcmp(argv[i], "--port") == 0 && hasValue)
+		{
+			config.ports.push_back(static_cast<uint16_t>(atoi(argv[++i])));
+		}
+		else if (strcmp(argv[i], "--packets-per-pass") == 0 && hasValue)
+		{
+			config.packetsPerPass = static_cast<uint32_t>(atoi(argv[++i]));
+		}
+		else
+		{
+			cerr << "unknown option: " << argv[i] << endl;
+			return -1;
+		}
+	}
+
+	PrintingCaptureHandler handler;
+	CaptureDecoder decoder(config, handler);
+
+	std::error_code ec;
+	const auto stats = decoder.Decode(argv[2], ec);
+	fflush(stdout);
+
+	if (ec)
+	{
+		if (ec == std::errc::invalid_argument)
+		{
+			cerr << "not a pcap or pcapng capture: " << argv[2] << endl;
+		}
+		else
+		{
+			cerr << "unable to open " << argv[2] << ": " << ec.message() << endl;
+		}
+		return -1;
+	}
+
+	cerr << stats.numPackets << " packets (" << stats.numIgnoredPackets << " ignored), "
+	     << stats.numStreams << " streams, "
+	     << stats.numPayloadBytes << " payload bytes ("
+	     << stats.numDuplicateBytes << " duplicate, "
+	     << stats.numGaps << " gaps), "
+	     << stats.numLines << " lines" << endl;
+
+	cerr << stats.numBytes << " bytes in "
+	     << std::chrono::duration_cast<std::chrono::milliseconds>(stats.elapsed).count() << " ms on "
+	     << stats.numThreads << " threads == " << stats.MegabytesPerSecond() << " MB/s" << endl;
+
+	if (stats.truncated)
+	{
+		cerr << "capture is truncated or corrupt" << endl;
+		return -1;
+	}
+
+	return 0;
+}
+
 int main(int argc, char* argv[])
 {
+	if (argc > 1 && strcmp(argv[1], "pcap") == 0)
+	{
+		return DecodeCapture(argc, argv);
+	}
+
 	openpal::Logger logger(ConsoleLogger::Create(), "decoder", LogFilters(~0));
 	IDecoderCallbacks callback;
 	Decoder decoder(callback, logger);
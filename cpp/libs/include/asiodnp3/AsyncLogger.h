@@ -0,0 +1,153 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_ASYNCLOGGER_H
+#define ASIODNP3_ASYNCLOGGER_H
+
+#include <openpal/logging/ILogHandler.h>
+#include <openpal/util/Uncopyable.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+
+namespace asiodnp3
+{
+
+class LogRing;
+
+/**
+* What a producer does when the log ring is full
+*/
+enum class LogOverflowPolicy : uint8_t
+{
+	/// discard the new entry and increment the drop counter (never blocks the caller)
+	DropNewest,
+	/// yield until the writer thread frees a slot (no entries are lost)
+	Block
+};
+
+/**
+* Configuration of an AsyncLogger
+*/
+struct AsyncLoggerConfig
+{
+	/// Number of entries in the ring, rounded up to the next power of 2
+	uint32_t capacity = 8192;
+
+	/// What to do when the ring is full
+	LogOverflowPolicy overflowPolicy = LogOverflowPolicy::DropNewest;
+
+	/// Maximum number of entries the writer thread formats before each write to the output
+	uint32_t maxBatchSize = 256;
+
+	/// Include the source location of each entry in the output
+	bool printLocation = false;
+};
+
+/**
+* Counters maintained by an AsyncLogger
+*/
+struct AsyncLoggerStatistics
+{
+	/// Entries accepted into the ring
+	uint64_t numQueued = 0;
+
+	/// Entries discarded because the ring was full
+	uint64_t numDropped = 0;
+
+	/// Entries formatted and written to the output
+	uint64_t numWritten = 0;
+
+	/// Number of batched writes to the output
+	uint64_t numBatches = 0;
+};
+
+/**
+* LogHandler that copies entries into a lock-free multi-producer ring and
+* defers all formatting and I/O to a dedicated writer thread.
+*
+* The calling thread only pays for a timestamp and a bounded copy of the entry,
+* so verbose filters can be enabled on busy channels without stalling the strands.
+*/
+class AsyncLogger final : public openpal::ILogHandler, private openpal::Uncopyable
+{
+
+public:
+
+	/**
+	* Create a logger that writes to stdout
+	*/
+	static std::shared_ptr<AsyncLogger> CreateConsole(const AsyncLoggerConfig& config = AsyncLoggerConfig());
+
+	/**
+	* Create a logger that appends to a file
+	*
+	* @param path path of the file to open in append mode
+	* @param config configuration of the ring and writer
+	* @param ec An error code. If set, a nullptr will be returned
+	*/
+	static std::shared_ptr<AsyncLogger> CreateFile(const std::string& path, const AsyncLoggerConfig& config, std::error_code& ec);
+
+	AsyncLogger(FILE* output, bool closeOutput, const AsyncLoggerConfig& config);
+
+	~AsyncLogger();
+
+	virtual void Log(const openpal::LogEntry& entry) override;
+
+	/**
+	* Drain all queued entries, stop the writer thread and close the output. Entries logged afterwards are dropped.
+	*/
+	void Shutdown();
+
+	AsyncLoggerStatistics GetStatistics() const;
+
+private:
+
+	void Run();
+	bool WriteBatch(std::string& buffer);
+	void WakeWriter();
+
+	const AsyncLoggerConfig config;
+	FILE* const output;
+	const bool closeOutput;
+
+	std::unique_ptr<LogRing> ring;
+
+	std::atomic<bool> running;
+	std::atomic<bool> writerSleeping;
+	std::atomic<uint64_t> numDropped;
+	std::atomic<uint64_t> numWritten;
+	std::atomic<uint64_t> numBatches;
+
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::thread writer;
+};
+
+}
+
+#endif
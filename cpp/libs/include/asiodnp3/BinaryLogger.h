@@ -0,0 +1,102 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_BINARYLOGGER_H
+#define ASIODNP3_BINARYLOGGER_H
+
+#include <openpal/logging/ILogHandler.h>
+#include <openpal/util/Uncopyable.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+namespace asiodnp3
+{
+
+/**
+* LogHandler that captures entries to a compact binary file instead of formatting them.
+*
+* Format strings, source locations and logger ids are written once and then referred to by id.
+* Arguments and hex dumps are stored raw, so the hot path never calls snprintf. Use the
+* binlog-decoder example (or dnp3decode::BinaryLogReader) to render the capture as text offline.
+*/
+class BinaryLogger final : public openpal::ILogHandler, private openpal::Uncopyable
+{
+
+public:
+
+	/**
+	* Create a binary logger that writes a new capture file
+	*
+	* @param path path of the file to create (truncated if it exists)
+	* @param ec An error code. If set, a nullptr will be returned
+	*/
+	static std::shared_ptr<BinaryLogger> Create(const std::string& path, std::error_code& ec);
+
+	explicit BinaryLogger(FILE* file);
+
+	~BinaryLogger();
+
+	virtual void Log(const openpal::LogEntry& entry) override;
+
+	virtual void LogBinary(const openpal::BinaryLogEntry& entry) override;
+
+	virtual bool IsBinary() const override
+	{
+		return true;
+	}
+
+	/**
+	* Flush buffered records to the file
+	*/
+	void Flush();
+
+private:
+
+	static const size_t FILE_BUFFER_SIZE = 64 * 1024;
+
+	uint32_t GetLiteralId(const char* value);
+	uint32_t GetStringId(const char* value);
+	uint32_t DefineString(const char* value);
+
+	void BeginRecord(uint8_t type, const char* loggerid, int32_t filters, const char* location);
+	void Commit();
+
+	std::mutex mutex;
+	FILE* const file;
+	std::vector<char> fileBuffer;
+
+	// string literals (formats and locations) are identified by address, logger ids by value
+	std::unordered_map<const char*, uint32_t> literals;
+	std::unordered_map<std::string, uint32_t> strings;
+	uint32_t nextId = 0;
+
+	std::vector<uint8_t> record;
+};
+
+}
+
+#endif
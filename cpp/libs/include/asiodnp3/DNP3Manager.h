@@ -30,9 +30,12 @@
 #include <asiodnp3/IChannel.h>
 #include <asiodnp3/IChannelListener.h>
 #include <asiodnp3/IListenCallbacks.h>
+#include <asiodnp3/MasterSessionPoolTypes.h>
 
 #include <asiopal/SerialTypes.h>
 #include <asiopal/ChannelRetry.h>
+#include <asiopal/ConnectionThrottleTypes.h>
+#include <asiopal/LoopbackTypes.h>
 #include <asiopal/TLSConfig.h>
 #include <asiopal/IListener.h>
 #include <asiopal/IPEndpoint.h>
@@ -62,12 +65,20 @@ public:
 	*	@param handler Callback interface for log messages
 	*	@param onThreadStart Action to run when a thread pool thread starts
 	*	@param onThreadExit Action to run just before a thread pool thread exits
+	*	@param tlsHandshakeThreads Number of additional threads dedicated to TLS handshakes. 0 (default) performs
+	*							   handshakes in the main thread pool, each on its own strand.
+	*	@param tlsMaxConcurrentHandshakes Maximum number of TLS handshakes in progress at once across all of the
+	*									  channels and listeners of the manager, 0 (default) is unlimited.
+	*									  Handshakes beyond it wait in FIFO order, so that a reconnect storm cannot
+	*									  monopolize the threads that carry traffic on established sessions.
 	*/
 	DNP3Manager(
 		uint32_t concurrencyHint,
 		std::shared_ptr<openpal::ILogHandler> handler = std::shared_ptr<openpal::ILogHandler>(),
 		std::function<void()> onThreadStart = []() {},
-		std::function<void()> onThreadExit = []() {}
+		std::function<void()> onThreadExit = []() {},
+		uint32_t tlsHandshakeThreads = 0,
+		uint32_t tlsMaxConcurrentHandshakes = 0
 	);
 
 	~DNP3Manager();
@@ -79,6 +90,34 @@ public:
 	*/
 	void Shutdown();
 
+	/**
+	* Limit how quickly the client channels of this manager (TCP and TLS) may open connections.
+	* Attempts beyond the limits are queued and started in the order they were requested.
+	* The default configuration is unlimited.
+	*
+	* @param config concurrency and rate limits applied to all client connection attempts
+	*/
+	void SetConnectionThrottle(const asiopal::ConnectionThrottleConfig& config);
+
+	/**
+	* @return a snapshot of the connection throttle counters
+	*/
+	asiopal::ConnectionThrottleStatistics GetConnectionThrottleStatistics() const;
+
+	/**
+	* Keep fragment buffers for master sessions accepted by listeners allocated between sessions.
+	* Sessions whose MasterParams fragment sizes match the configuration check out a set of buffers
+	* when they are accepted and return it when they close. Disabled by default.
+	*
+	* @param config number of sessions to pre-allocate and the fragment sizes they use
+	*/
+	void SetMasterSessionPool(const MasterSessionPoolConfig& config);
+
+	/**
+	* @return a snapshot of the master session pool counters
+	*/
+	MasterSessionPoolStatistics GetMasterSessionPoolStatistics() const;
+
 	/**
 	* Add a persistent TCP client channel. Automatically attempts to reconnect.
 	*
@@ -156,6 +195,25 @@ public:
 	    asiopal::SerialSettings settings,
 	    std::shared_ptr<IChannelListener> listener);
 
+	/**
+	* Add an in-memory loopback channel. Two loopback channels with the same name connect to each other
+	* without any sockets, e.g. to run a master and an outstation in the same process. If either end is
+	* shut down, the other waits for a new channel with the same name.
+	*
+	* @param id Alias that will be used for logging purposes with this channel
+	* @param levels Bitfield that describes the logging level for this channel and associated sessions
+	* @param name Name that identifies the link
+	* @param config Buffer size and optional rate / latency shaping of the data written by this channel
+	* @param listener optional callback interface (can be nullptr) for info about the running channel
+	* @return shared_ptr to a channel interface
+	*/
+	std::shared_ptr<IChannel> AddLoopback(
+	    const std::string& id,
+	    int32_t levels,
+	    const std::string& name,
+	    const asiopal::LoopbackConfig& config,
+	    std::shared_ptr<IChannelListener> listener);
+
 	/**
 	* Add a TLS client channel
 	*
@@ -245,6 +303,23 @@ public:
 	    std::error_code& ec
 	);
 
+	/**
+	* Create a TCP listener that accepts incoming connections on several acceptors bound to the same
+	* port with SO_REUSEPORT. The operating system balances new connections across the acceptors,
+	* which lets reconnect storms from large numbers of outstations be accepted in parallel.
+	*
+	* @param numAcceptors number of acceptors, a value of 0 or 1 is equivalent to the single acceptor overload
+	* @param ec An error code. If set, a nullptr will be returned. Fails on platforms without SO_REUSEPORT.
+	*/
+	std::shared_ptr<asiopal::IListener> CreateListener(
+	    std::string loggerid,
+	    openpal::LogFilters loglevel,
+	    asiopal::IPEndpoint endpoint,
+	    uint32_t numAcceptors,
+	    std::shared_ptr<IListenCallbacks> callbacks,
+	    std::error_code& ec
+	);
+
 	/**
 	* Create a TLS listener that will be used to accept incoming connections
 	*/
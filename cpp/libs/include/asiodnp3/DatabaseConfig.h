@@ -27,6 +27,8 @@
 
 #include "openpal/container/Array.h"
 
+#include <vector>
+
 namespace asiodnp3
 {
 
@@ -69,6 +71,10 @@ public:
 	openpal::Array<opendnp3::TimeAndIntervalConfig, uint16_t> timeAndInterval;
 	openpal::Array<opendnp3::OctetStringConfig, uint16_t> octetString;
 
+	/// Points that have a chatter filter, by point index. Other points carry no filter state.
+	/// Entries for points that don't exist in the database are ignored with a warning.
+	std::vector<opendnp3::ChatterFilterPoint> chatterFilters;
+
 private:
 
 	template <class T>
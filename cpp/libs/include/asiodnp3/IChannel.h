@@ -36,6 +36,7 @@
 #include "asiopal/IResourceManager.h"
 
 #include "IMaster.h"
+#include "PacketCapture.h"
 #include "IOutstation.h"
 #include "MasterStackConfig.h"
 #include "OutstationStackConfig.h"
@@ -69,6 +70,14 @@ public:
 	*/
 	virtual void SetLogFilters(const openpal::LogFilters& filters) = 0;
 
+	/**
+	*  Begin copying all bytes read from and written to this channel into a packet capture.
+	*  Takes effect immediately, even if the channel is already open.
+	*
+	*  @param capture The capture to record into, or nullptr to stop capturing
+	*/
+	virtual void SetPacketCapture(std::shared_ptr<PacketCapture> capture) = 0;
+
 	/**
 	* Add a master to the channel
 	*
@@ -22,6 +22,7 @@
 #define ASIODNP3_IMASTERSESSION_H
 
 #include "asiodnp3/IMasterOperations.h"
+#include "asiodnp3/PacketCapture.h"
 
 namespace asiodnp3
 {
@@ -39,6 +40,13 @@ public:
 
 	virtual void BeginShutdown() = 0;
 
+	/**
+	*  Begin copying all bytes read from and written to this session's connection into a packet capture.
+	*
+	*  @param capture The capture to record into, or nullptr to stop capturing
+	*/
+	virtual void SetPacketCapture(std::shared_ptr<PacketCapture> capture) = 0;
+
 };
 
 }
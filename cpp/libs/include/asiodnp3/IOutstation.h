@@ -24,6 +24,8 @@
 #include "asiodnp3/IStack.h"
 #include "asiodnp3/Updates.h"
 
+#include <opendnp3/outstation/ChatterFilterStatistics.h>
+
 #include <openpal/logging/LogFilters.h>
 
 namespace asiodnp3
@@ -55,6 +57,16 @@ public:
 	*/
 	virtual void Apply(const Updates& updates) = 0;
 
+	/**
+	* Synchronously read the counters of the per-point chatter filters. The default implementation reports no filters.
+	*
+	* @param maxPoints maximum number of points to include in the list of top offenders
+	*/
+	virtual opendnp3::ChatterFilterStatistics GetChatterFilterStatistics(uint16_t maxPoints = 10)
+	{
+		return opendnp3::ChatterFilterStatistics();
+	}
+
 };
 
 }
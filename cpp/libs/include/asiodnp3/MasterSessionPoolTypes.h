@@ -0,0 +1,66 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_MASTERSESSIONPOOLTYPES_H
+#define ASIODNP3_MASTERSESSIONPOOLTYPES_H
+
+#include "opendnp3/app/AppConstants.h"
+
+#include <cstdint>
+
+namespace asiodnp3
+{
+
+/**
+* Configuration of the pool of fragment buffers recycled between the master sessions of listeners
+*/
+struct MasterSessionPoolConfig
+{
+	/// Number of sessions worth of buffers allocated up front and retained when sessions close, 0 == disabled
+	uint32_t numSessions = 0;
+
+	/// Sessions accepted with this MasterParams::maxRxFragSize use pooled receive buffers
+	uint32_t maxRxFragSize = opendnp3::DEFAULT_MAX_APDU_SIZE;
+
+	/// Sessions accepted with this MasterParams::maxTxFragSize use pooled transmit buffers
+	uint32_t maxTxFragSize = opendnp3::DEFAULT_MAX_APDU_SIZE;
+};
+
+/**
+* Counters of the master session pool
+*/
+struct MasterSessionPoolStatistics
+{
+	/// Sessions worth of buffers waiting in the pool
+	uint32_t numAvailable = 0;
+
+	/// Sessions currently using pooled buffers
+	uint32_t numCheckedOut = 0;
+
+	/// Total number of sessions served from buffers that were already in the pool
+	uint64_t numReused = 0;
+
+	/// Total number of sessions that needed new buffers because the pool was empty
+	uint64_t numAllocated = 0;
+};
+
+}
+
+#endif
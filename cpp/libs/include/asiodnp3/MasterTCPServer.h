@@ -32,6 +32,9 @@
 
 namespace asiodnp3
 {
+
+class MasterSessionPool;
+
 /**
 * Binds and listens on an IPv4 TCP port
 *
@@ -46,8 +49,10 @@ public:
 	    const openpal::Logger& logger,
 	    const std::shared_ptr<asiopal::Executor>& executor,
 	    const asiopal::IPEndpoint& endpoint,
+	    const asiopal::AcceptorShard& shard,
 	    const std::shared_ptr<IListenCallbacks>& callbacks,
 	    const std::shared_ptr<asiopal::ResourceManager>& manager,
+	    const std::shared_ptr<MasterSessionPool>& pool,
 	    std::error_code& ec
 	);
 
@@ -59,7 +64,20 @@ public:
 	    const std::shared_ptr<asiopal::ResourceManager>& manager,
 	    std::error_code& ec)
 	{
-		auto server = std::make_shared<MasterTCPServer>(logger, executor, endpoint, callbacks, manager, ec);
+		return Create(logger, executor, endpoint, asiopal::AcceptorShard(), callbacks, manager, nullptr, ec);
+	}
+
+	static std::shared_ptr<MasterTCPServer> Create(
+	    const openpal::Logger& logger,
+	    const std::shared_ptr<asiopal::Executor>& executor,
+	    const asiopal::IPEndpoint& endpoint,
+	    const asiopal::AcceptorShard& shard,
+	    const std::shared_ptr<IListenCallbacks>& callbacks,
+	    const std::shared_ptr<asiopal::ResourceManager>& manager,
+	    const std::shared_ptr<MasterSessionPool>& pool,
+	    std::error_code& ec)
+	{
+		auto server = std::make_shared<MasterTCPServer>(logger, executor, endpoint, shard, callbacks, manager, pool, ec);
 
 		if (!ec)
 		{
@@ -74,14 +92,14 @@ private:
 
 	std::shared_ptr<IListenCallbacks> callbacks;
 	std::shared_ptr<asiopal::ResourceManager> manager;
-
-	static std::string SessionIdToString(uint64_t sessionid);
+	std::shared_ptr<MasterSessionPool> pool;
+	const bool isGroupMember;
 
 	// implement the virutal methods from TCPServer
 
 	virtual void OnShutdown() override;
 
-	virtual void AcceptConnection(uint64_t sessionid, const std::shared_ptr<asiopal::Executor>& executor, asio::ip::tcp::socket) override;
+	virtual void AcceptConnection(uint64_t sessionid, const std::shared_ptr<asiopal::Executor>& executor, asio::ip::tcp::socket, const asio::ip::tcp::endpoint& remote) override;
 };
 
 }
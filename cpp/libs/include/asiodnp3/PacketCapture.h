@@ -0,0 +1,150 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_PACKETCAPTURE_H
+#define ASIODNP3_PACKETCAPTURE_H
+
+#include <openpal/container/RSlice.h>
+#include <openpal/util/Uncopyable.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+
+namespace asiodnp3
+{
+
+class CaptureRing;
+
+enum class CaptureDirection : uint8_t
+{
+	Rx,
+	Tx
+};
+
+/**
+* Configuration of a PacketCapture
+*/
+struct PacketCaptureConfig
+{
+	/// Number of preallocated packet slots, rounded up to the next power of 2
+	uint32_t capacity = 4096;
+
+	/// Maximum number of packets the writer thread writes before each flush
+	uint32_t maxBatchSize = 256;
+};
+
+/**
+* Counters maintained by a PacketCapture
+*/
+struct PacketCaptureStatistics
+{
+	/// Packets copied into the ring
+	uint64_t numCaptured = 0;
+
+	/// Packets discarded because the ring was full
+	uint64_t numDropped = 0;
+
+	/// Packets written to the file
+	uint64_t numWritten = 0;
+};
+
+/**
+* Writes the raw bytes read from and written to channels into a pcap file.
+*
+* Each channel is presented as a synthetic IPv4/TCP stream to DNP3's well-known port so that Wireshark
+* reassembles and dissects it, regardless of the underlying transport (TCP, TLS plaintext, serial).
+* Recording only copies the bytes into a preallocated ring and never blocks; a background thread
+* formats the records and writes them to the file. Packets are dropped and counted if the ring is full.
+*
+* A single capture can be shared by any number of channels, see IChannel::SetPacketCapture(..)
+*/
+class PacketCapture final : private openpal::Uncopyable
+{
+
+public:
+
+	/**
+	* Create a capture that writes a new pcap file
+	*
+	* @param path path of the file to create (truncated if it exists)
+	* @param config configuration of the ring and writer
+	* @param ec An error code. If set, a nullptr will be returned
+	*/
+	static std::shared_ptr<PacketCapture> Create(const std::string& path, const PacketCaptureConfig& config, std::error_code& ec);
+
+	PacketCapture(FILE* file, const PacketCaptureConfig& config);
+
+	~PacketCapture();
+
+	/**
+	* Allocate an identifier used to give a channel its own synthetic address pair
+	*/
+	uint16_t NextStreamId();
+
+	/**
+	* Copy a segment of a stream into the ring. Callable from any thread.
+	*
+	* @param streamId identifier from NextStreamId()
+	* @param direction whether the bytes were read or written
+	* @param seq stream offset of the first byte in this direction
+	* @param ack stream offset in the opposite direction
+	* @param bytes the data read or written
+	*/
+	void Record(uint16_t streamId, CaptureDirection direction, uint32_t seq, uint32_t ack, const openpal::RSlice& bytes);
+
+	/**
+	* Write all queued packets, stop the writer thread and close the file. Packets recorded afterwards are dropped.
+	*/
+	void Shutdown();
+
+	PacketCaptureStatistics GetStatistics() const;
+
+private:
+
+	void Run();
+	bool WriteBatch();
+	void WakeWriter();
+
+	const PacketCaptureConfig config;
+	FILE* const file;
+
+	std::unique_ptr<CaptureRing> ring;
+
+	std::atomic<bool> running;
+	std::atomic<bool> writerSleeping;
+	std::atomic<uint16_t> nextStreamId;
+	std::atomic<uint64_t> numDropped;
+	std::atomic<uint64_t> numWritten;
+
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::thread writer;
+};
+
+}
+
+#endif
@@ -23,6 +23,8 @@
 
 #include "asiodnp3/Updates.h"
 
+#include "opendnp3/app/Indexed.h"
+
 namespace asiodnp3
 {
 
@@ -42,6 +44,15 @@ public:
 	UpdateBuilder& Update(const opendnp3::TimeAndInterval& meas, uint16_t index);
 	UpdateBuilder& Modify(opendnp3::FlagsType type, uint16_t start, uint16_t stop, uint8_t flags);
 
+	// Batches of one type are stored contiguously and applied in order by a single update
+	UpdateBuilder& Update(std::vector<opendnp3::Indexed<opendnp3::Binary>> values, opendnp3::EventMode mode = opendnp3::EventMode::Detect);
+	UpdateBuilder& Update(std::vector<opendnp3::Indexed<opendnp3::DoubleBitBinary>> values, opendnp3::EventMode mode = opendnp3::EventMode::Detect);
+	UpdateBuilder& Update(std::vector<opendnp3::Indexed<opendnp3::Analog>> values, opendnp3::EventMode mode = opendnp3::EventMode::Detect);
+	UpdateBuilder& Update(std::vector<opendnp3::Indexed<opendnp3::Counter>> values, opendnp3::EventMode mode = opendnp3::EventMode::Detect);
+	UpdateBuilder& Update(std::vector<opendnp3::Indexed<opendnp3::FrozenCounter>> values, opendnp3::EventMode mode = opendnp3::EventMode::Detect);
+	UpdateBuilder& Update(std::vector<opendnp3::Indexed<opendnp3::BinaryOutputStatus>> values, opendnp3::EventMode mode = opendnp3::EventMode::Detect);
+	UpdateBuilder& Update(std::vector<opendnp3::Indexed<opendnp3::AnalogOutputStatus>> values, opendnp3::EventMode mode = opendnp3::EventMode::Detect);
+
 	Updates Build();
 
 private:
@@ -49,6 +60,9 @@ private:
 	template <class T>
 	UpdateBuilder& AddMeas(const T& meas, uint16_t index, opendnp3::EventMode mode);
 
+	template <class T>
+	UpdateBuilder& AddBatch(std::vector<opendnp3::Indexed<T>> values, opendnp3::EventMode mode);
+
 	void Add(const update_func_t& fun);
 
 	std::shared_ptr<shared_updates_t> updates;
@@ -26,12 +26,17 @@
 
 #include "SerialTypes.h"
 
+#include <chrono>
+
 namespace asiopal
 {
 
 // Serial port configuration functions "free" to keep the classes simple.
 bool Configure(const SerialSettings& settings, asio::serial_port& port, std::error_code& ec);
 
+// Time to shift a single character onto the wire including start, parity, and stop bits
+std::chrono::nanoseconds GetCharacterTime(const SerialSettings& settings);
+
 }
 
 #endif
@@ -40,6 +40,7 @@ public:
 	*
 	* @param minOpenRetry minimum connection retry interval on failure
 	* @param maxOpenRetry maximum connection retry interval on failure
+	* @param strategy how the retry interval grows, e.g. ExponentialBackoffStrategy, FullJitterBackoffStrategy, or DecorrelatedJitterStrategy
 	*/
 	ChannelRetry(
 	    openpal::TimeDuration minOpenRetry,
@@ -55,9 +56,27 @@ public:
 	/// maximum connection retry interval on failure
 	openpal::TimeDuration maxOpenRetry;
 
+	/**
+	* When greater than zero, TCP clients with several remote endpoints race connections to them
+	* instead of trying one endpoint at a time. The attempt to the next endpoint starts when the
+	* previous attempt fails or after this delay, and the first connection to succeed is used.
+	*
+	* Defaults to zero (sequential attempts).
+	*/
+	openpal::TimeDuration connectAttemptDelay = openpal::TimeDuration::Zero();
+
+	/// When greater than zero, TCP clients remember resolved host names for this long. Defaults to zero (resolve on every attempt).
+	openpal::TimeDuration resolverCacheTTL = openpal::TimeDuration::Zero();
+
 	openpal::TimeDuration NextDelay(const openpal::TimeDuration& current) const
 	{
-		return strategy.GetNextDelay(current, maxOpenRetry);
+		return strategy.GetNextDelay(current, minOpenRetry, maxOpenRetry);
+	}
+
+	/// How long to wait before retrying given the current delay, which may be randomized by the strategy
+	openpal::TimeDuration WaitTime(const openpal::TimeDuration& delay) const
+	{
+		return strategy.GetWaitTime(delay);
 	}
 
 private:
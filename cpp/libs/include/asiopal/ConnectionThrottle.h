@@ -0,0 +1,136 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_CONNECTIONTHROTTLE_H
+#define ASIOPAL_CONNECTIONTHROTTLE_H
+
+#include "asiopal/ConnectionThrottleTypes.h"
+#include "asiopal/Executor.h"
+#include "asiopal/SteadyClock.h"
+
+#include <openpal/util/Uncopyable.h>
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace asiopal
+{
+
+/**
+* Token bucket shared by client channels that limits how many connection attempts
+* are in progress at once and how many start per second.
+*
+* Thread-safe: channels request permission from their own strands.
+*/
+class ConnectionThrottle final : public std::enable_shared_from_this<ConnectionThrottle>, private openpal::Uncopyable
+{
+
+public:
+
+	/**
+	* Held for the duration of a connection attempt. The slot is returned when Release()
+	* is called or the permit is destroyed, whichever comes first.
+	*/
+	class Permit final : private openpal::Uncopyable
+	{
+		friend class ConnectionThrottle;
+
+	public:
+
+		explicit Permit(const std::weak_ptr<ConnectionThrottle>& throttle) : throttle(throttle)
+		{}
+
+		~Permit()
+		{
+			this->Release();
+		}
+
+		void Release();
+
+	private:
+
+		std::weak_ptr<ConnectionThrottle> throttle;
+		std::atomic<bool> released{ false };
+	};
+
+	typedef std::function<void(const std::shared_ptr<Permit>& permit)> start_attempt_t;
+
+	static std::shared_ptr<ConnectionThrottle> Create(const std::shared_ptr<IO>& io)
+	{
+		return std::make_shared<ConnectionThrottle>(io);
+	}
+
+	explicit ConnectionThrottle(const std::shared_ptr<IO>& io);
+
+	/// Change the limits, takes effect for attempts that have not started yet
+	void Configure(const ConnectionThrottleConfig& config);
+
+	/// Start the attempt on the executor's strand when the limits allow it, otherwise queue it in FIFO order
+	void Request(const std::shared_ptr<Executor>& executor, const start_attempt_t& start);
+
+	/// Discard the queued attempts that would start on this executor, called when a channel shuts down
+	void Cancel(const std::shared_ptr<Executor>& executor);
+
+	ConnectionThrottleStatistics GetStatistics() const;
+
+	/// Discard all queued attempts
+	void Shutdown();
+
+private:
+
+	struct Pending
+	{
+		std::shared_ptr<Executor> executor;
+		start_attempt_t start;
+	};
+
+	void OnRelease();
+
+	// Start all the queued attempts that the limits allow, must be called without holding the lock
+	void Dispatch();
+
+	// Returns false if the token bucket is empty
+	bool TryTakeToken(const steady_clock_t::time_point& now);
+
+	bool CanStart() const;
+
+	void StartTimer(const steady_clock_t::time_point& now);
+
+	mutable std::mutex mutex;
+
+	ConnectionThrottleConfig config;
+	ConnectionThrottleStatistics statistics;
+
+	bool isShutdown = false;
+	double tokens = 0;
+	steady_clock_t::time_point lastRefill;
+
+	std::deque<Pending> queue;
+
+	bool timerActive = false;
+	asio::basic_waitable_timer<steady_clock_t> timer;
+};
+
+}
+
+#endif
@@ -0,0 +1,64 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_CONNECTIONTHROTTLETYPES_H
+#define ASIOPAL_CONNECTIONTHROTTLETYPES_H
+
+#include <cstdint>
+
+namespace asiopal
+{
+
+/**
+* Limits on the outgoing connection attempts of all the client channels of a manager
+*/
+struct ConnectionThrottleConfig
+{
+	/// Maximum number of connection attempts in progress at once, 0 == unlimited
+	uint32_t maxConcurrentAttempts = 0;
+
+	/// Maximum number of connection attempts started per second, 0 == unlimited
+	uint32_t maxAttemptsPerSecond = 0;
+
+	/// Number of attempts that may start back-to-back before maxAttemptsPerSecond applies (minimum of 1)
+	uint32_t burstSize = 1;
+};
+
+/**
+* Counters of a connection throttle
+*/
+struct ConnectionThrottleStatistics
+{
+	/// Attempts waiting for permission to start
+	uint32_t numQueued = 0;
+
+	/// Attempts that have started and not yet completed
+	uint32_t numActive = 0;
+
+	/// Total number of attempts that had to wait
+	uint64_t numDelayed = 0;
+
+	/// Total number of attempts that were started
+	uint64_t numStarted = 0;
+};
+
+}
+
+#endif
@@ -42,6 +42,22 @@ public:
 	* The the next delay based on the current and the maximum.
 	*/
 	virtual openpal::TimeDuration GetNextDelay(const openpal::TimeDuration& current, const openpal::TimeDuration& max) const = 0;
+
+	/**
+	* The next delay based on the current, the minimum, and the maximum. Defaults to ignoring the minimum.
+	*/
+	virtual openpal::TimeDuration GetNextDelay(const openpal::TimeDuration& current, const openpal::TimeDuration& min, const openpal::TimeDuration& max) const
+	{
+		return this->GetNextDelay(current, max);
+	}
+
+	/**
+	* How long to actually wait before the next attempt given the current delay. Defaults to the delay itself.
+	*/
+	virtual openpal::TimeDuration GetWaitTime(const openpal::TimeDuration& delay) const
+	{
+		return delay;
+	}
 };
 
 /**
@@ -51,11 +67,51 @@ class ExponentialBackoffStrategy : public IOpenDelayStrategy, private openpal::U
 {
 	static ExponentialBackoffStrategy instance;
 
+public:
+
+	static IOpenDelayStrategy& Instance();
+
+	// keep the overload that takes a minimum visible
+	using IOpenDelayStrategy::GetNextDelay;
+
+	virtual openpal::TimeDuration GetNextDelay(const openpal::TimeDuration& current, const openpal::TimeDuration& max) const override final;
+};
+
+/**
+* Exponential-backoff where each wait is drawn uniformly from [0, delay] ("full jitter").
+*
+* Spreads out the retries of many clients that lost their connections at the same time.
+*/
+class FullJitterBackoffStrategy : public IOpenDelayStrategy, private openpal::Uncopyable
+{
+	static FullJitterBackoffStrategy instance;
+
+public:
+
+	static IOpenDelayStrategy& Instance();
+
+	// keep the overload that takes a minimum visible
+	using IOpenDelayStrategy::GetNextDelay;
+
+	virtual openpal::TimeDuration GetNextDelay(const openpal::TimeDuration& current, const openpal::TimeDuration& max) const override final;
+
+	virtual openpal::TimeDuration GetWaitTime(const openpal::TimeDuration& delay) const override final;
+};
+
+/**
+* Each delay is drawn uniformly from [min, 3 * current] and capped at the maximum ("decorrelated jitter").
+*/
+class DecorrelatedJitterStrategy : public IOpenDelayStrategy, private openpal::Uncopyable
+{
+	static DecorrelatedJitterStrategy instance;
+
 public:
 
 	static IOpenDelayStrategy& Instance();
 
 	virtual openpal::TimeDuration GetNextDelay(const openpal::TimeDuration& current, const openpal::TimeDuration& max) const override final;
+
+	virtual openpal::TimeDuration GetNextDelay(const openpal::TimeDuration& current, const openpal::TimeDuration& min, const openpal::TimeDuration& max) const override final;
 };
 
 }
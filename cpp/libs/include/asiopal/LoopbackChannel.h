@@ -0,0 +1,121 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_LOOPBACKCHANNEL_H
+#define ASIOPAL_LOOPBACKCHANNEL_H
+
+#include "asiopal/IAsyncChannel.h"
+#include "asiopal/LoopbackTypes.h"
+#include "asiopal/SteadyClock.h"
+
+#include <memory>
+#include <utility>
+
+namespace asiopal
+{
+
+class LoopbackPipe;
+
+/**
+* IAsyncChannel that exchanges data with a peer channel in the same process through a pair of
+* ring buffers. Each end completes its operations on its own executor, so the two ends of a pair
+* may be serviced by different threads.
+*
+* With the default configuration data is readable by the peer as soon as it is written. A LoopbackConfig
+* with a rate and/or latency shapes the link so that it behaves like a slower physical layer.
+*/
+class LoopbackChannel final : public IAsyncChannel
+{
+
+public:
+
+	typedef std::pair<std::shared_ptr<LoopbackChannel>, std::shared_ptr<LoopbackChannel>> pair_t;
+
+	/**
+	* Create two connected channels
+	*
+	* @param first executor of the first channel
+	* @param second executor of the second channel
+	* @param config buffer size and shaping of the link in both directions
+	*/
+	static pair_t CreatePair(const std::shared_ptr<Executor>& first, const std::shared_ptr<Executor>& second, const LoopbackConfig& config = LoopbackConfig());
+
+	/**
+	* Create two connected channels with different shaping in each direction
+	*
+	* @param first executor of the first channel
+	* @param firstConfig buffer size and shaping of the data written by the first channel
+	* @param second executor of the second channel
+	* @param secondConfig buffer size and shaping of the data written by the second channel
+	*/
+	static pair_t CreatePair(const std::shared_ptr<Executor>& first, const LoopbackConfig& firstConfig, const std::shared_ptr<Executor>& second, const LoopbackConfig& secondConfig);
+
+	LoopbackChannel(const std::shared_ptr<Executor>& executor, const std::shared_ptr<LoopbackPipe>& rx, const std::shared_ptr<LoopbackPipe>& tx, const LoopbackConfig& config);
+
+private:
+
+	virtual void BeginReadImpl(openpal::WSlice buffer) override;
+	virtual void BeginWriteImpl(const openpal::RSlice& buffer)  override;
+	virtual void ShutdownImpl()  override;
+
+	// called on the strand whenever the state of the pipes may have changed
+	void TryRead();
+	void TryWrite();
+
+	void CompleteRead(const std::error_code& ec, size_t num);
+	void CompleteWrite(const std::error_code& ec, size_t num);
+
+	void NotifyPeerReadable();
+	void NotifyPeerWritable();
+
+	std::shared_ptr<LoopbackChannel> Self()
+	{
+		return std::static_pointer_cast<LoopbackChannel>(this->shared_from_this());
+	}
+
+	// shaping of the data written by this end
+	const LoopbackConfig config;
+	const std::shared_ptr<LoopbackPipe> rx;
+	const std::shared_ptr<LoopbackPipe> tx;
+
+	std::weak_ptr<LoopbackChannel> peer;
+
+	bool closed = false;
+
+	// the current read, if any
+	bool readPending = false;
+	openpal::WSlice readBuffer;
+
+	// the current write, if any, and the number of bytes already placed in the pipe
+	bool writePending = false;
+	bool writeClocking = false;
+	openpal::RSlice writeBuffer;
+	size_t numWritten = 0;
+
+	// time at which the link finishes clocking out the bytes already written, used for rate limiting
+	steady_clock_t::time_point txIdle;
+
+	asio::basic_waitable_timer<steady_clock_t> readTimer;
+	asio::basic_waitable_timer<steady_clock_t> writeTimer;
+};
+
+}
+
+#endif
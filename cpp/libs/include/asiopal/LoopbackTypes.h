@@ -0,0 +1,53 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_LOOPBACKTYPES_H
+#define ASIOPAL_LOOPBACKTYPES_H
+
+#include <openpal/executor/TimeDuration.h>
+
+#include <cstdint>
+
+namespace asiopal
+{
+
+/**
+* Shaping of the data written by one end of an in-memory loopback link
+*/
+struct LoopbackConfig
+{
+	/// Capacity of the ring buffer in bytes, rounded up to the next power of 2
+	uint32_t bufferSize = 8192;
+
+	/// Rate at which bytes are written into the link, 0 == unlimited
+	uint64_t bytesPerSecond = 0;
+
+	/// Delay between a byte being written and it becoming readable on the other end
+	openpal::TimeDuration latency = openpal::TimeDuration::Zero();
+
+	bool IsShaped() const
+	{
+		return (bytesPerSecond > 0) || latency.IsPostive();
+	}
+};
+
+}
+
+#endif
@@ -0,0 +1,83 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_RESOLVERCACHE_H
+#define ASIOPAL_RESOLVERCACHE_H
+
+#include "asiopal/SteadyClock.h"
+
+#include <openpal/executor/TimeDuration.h>
+#include <openpal/util/Uncopyable.h>
+
+#include <asio.hpp>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace asiopal
+{
+
+/**
+* Thread-safe cache of resolved host names whose entries expire after a fixed time-to-live
+*/
+class ResolverCache final : private openpal::Uncopyable
+{
+
+public:
+
+	typedef std::vector<asio::ip::tcp::endpoint> endpoints_t;
+
+	explicit ResolverCache(const openpal::TimeDuration& ttl);
+
+	/// Retrieve the unexpired addresses of a host, returns false if there are none
+	bool Lookup(const std::string& host, uint16_t port, endpoints_t& endpoints);
+
+	bool Lookup(const std::string& host, uint16_t port, const steady_clock_t::time_point& now, endpoints_t& endpoints);
+
+	void Store(const std::string& host, uint16_t port, const endpoints_t& endpoints);
+
+	void Store(const std::string& host, uint16_t port, const endpoints_t& endpoints, const steady_clock_t::time_point& now);
+
+	/// Forget the addresses of a host, e.g. after none of them could be reached
+	void Remove(const std::string& host, uint16_t port);
+
+	size_t Size() const;
+
+private:
+
+	struct Entry
+	{
+		endpoints_t endpoints;
+		steady_clock_t::time_point expiration;
+	};
+
+	static std::string GetKey(const std::string& host, uint16_t port);
+
+	const steady_clock_t::duration ttl;
+
+	mutable std::mutex mutex;
+	std::map<std::string, Entry> entries;
+};
+
+}
+
+#endif
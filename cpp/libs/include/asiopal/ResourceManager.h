@@ -23,13 +23,29 @@
 
 #include "IResourceManager.h"
 
-#include <set>
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <mutex>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace asiopal
 {
 
+/**
+* Tracks every channel, listener and session so that they can be shut down together.
+*
+* Resources are spread across lock-striped shards by address, so Bind / Detach on different
+* connections rarely contend and Detach is an O(1) hash removal. Bind never takes a global lock;
+* it registers itself as in-flight so that Shutdown can wait for it before sweeping the shards.
+*
+* create() runs without a lock, so a resource can detach before Bind records it. Detach remembers
+* such a resource in its shard so that Bind does not track it afterwards. The entry is weak, so one
+* left behind by a repeated or late Detach never matches a new resource at the same address.
+*/
 class ResourceManager final : public IResourceManager
 {
 
@@ -44,31 +60,99 @@ public:
 
 	void Shutdown();
 
+	/// Number of resources currently tracked
+	size_t Size();
+
 	template <class R, class T>
 	std::shared_ptr<R> Bind(const T& create)
 	{
-		std::lock_guard <std::mutex> lock(this->mutex);
+		InFlightBind bind(*this);
 
-		if (this->is_shutting_down)
+		if (!bind.IsAllowed())
 		{
 			return nullptr;
 		}
-		else
+
+		auto item = create();
+		if (item)
 		{
-			auto item = create();
-			if (item)
+			auto& shard = this->GetShard(item.get());
+			std::lock_guard <std::mutex> lock(shard.mutex);
+
+			// the resource may already have failed and detached from another thread
+			auto detached = shard.detached.find(item.get());
+			const bool early = (detached != shard.detached.end()) && (detached->second.lock() == item);
+
+			if (detached != shard.detached.end())
 			{
-				this->resources.insert(item);
+				shard.detached.erase(detached);
+			}
+
+			if (!early)
+			{
+				shard.resources.insert(item);
 			}
-			return item;
 		}
+		return item;
 	}
 
 private:
 
-	std::mutex mutex;
-	bool is_shutting_down = false;
-	std::set<std::shared_ptr<asiopal::IResource>> resources;
+	static const size_t NUM_SHARDS = 16;
+
+	struct Shard
+	{
+		std::mutex mutex;
+		std::unordered_set<std::shared_ptr<asiopal::IResource>> resources;
+		// resources that detached before their Bind recorded them, by address
+		std::unordered_map<const asiopal::IResource*, std::weak_ptr<asiopal::IResource>> detached;
+
+		// keep neighboring shards off the same cache line
+		char padding[64];
+	};
+
+	// striped by thread so that concurrent binds do not write the same cache line
+	struct BindCounter
+	{
+		std::atomic<uint32_t> value{ 0 };
+		char padding[64];
+	};
+
+	// Counts a Bind for the lifetime of the object unless the manager is shutting down
+	class InFlightBind
+	{
+
+	public:
+
+		explicit InFlightBind(ResourceManager& manager) : counter(manager.GetBindCounter())
+		{
+			counter.value.fetch_add(1);
+			this->allowed = !manager.is_shutting_down.load();
+		}
+
+		~InFlightBind()
+		{
+			counter.value.fetch_sub(1);
+		}
+
+		bool IsAllowed() const
+		{
+			return allowed;
+		}
+
+	private:
+
+		BindCounter& counter;
+		bool allowed;
+	};
+
+	Shard& GetShard(const IResource* resource);
+
+	BindCounter& GetBindCounter();
+
+	std::atomic<bool> is_shutting_down{ false };
+	std::array<BindCounter, NUM_SHARDS> binds_in_flight;
+	std::array<Shard, NUM_SHARDS> shards;
 
 };
 
@@ -24,6 +24,7 @@
 #include "IAsyncChannel.h"
 
 #include "asiopal/SerialTypes.h"
+#include "asiopal/SteadyClock.h"
 
 #include <asio/serial_port.hpp>
 
@@ -50,8 +51,26 @@ private:
 	virtual void BeginWriteImpl(const openpal::RSlice& buffer)  override;
 	virtual void ShutdownImpl()  override;
 
+	bool IsPaced() const
+	{
+		return minInterFrameGap.count() > 0 || turnaroundDelay.count() > 0;
+	}
+
+	void StartWrite(const openpal::RSlice& buffer);
+
 	asio::serial_port port;
 
+	// inter-frame timing, only enforced when either delay is non-zero
+	std::chrono::nanoseconds characterTime;
+	std::chrono::nanoseconds minInterFrameGap;
+	std::chrono::nanoseconds turnaroundDelay;
+
+	// time the last byte was received and the estimated time the last transmitted byte left the wire
+	steady_clock_t::time_point lastRx;
+	steady_clock_t::time_point lastTxEnd;
+
+	asio::basic_waitable_timer<steady_clock_t> paceTimer;
+
 };
 
 }
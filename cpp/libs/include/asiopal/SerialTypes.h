@@ -43,7 +43,10 @@ struct SerialSettings
 		stopBits(opendnp3::StopBits::One),
 		parity(opendnp3::Parity::None),
 		flowType(opendnp3::FlowControl::None),
-		asyncOpenDelay(openpal::TimeDuration::Milliseconds(500))
+		asyncOpenDelay(openpal::TimeDuration::Milliseconds(500)),
+		lowLatency(false),
+		minInterFrameGap(openpal::TimeDuration::Zero()),
+		turnaroundDelay(openpal::TimeDuration::Zero())
 	{}
 
 	/// name of the port, i.e. "COM1" or "/dev/tty0"
@@ -66,6 +69,18 @@ struct SerialSettings
 
 	/// Some physical layers need time to "settle" so that the first tx isn't lost
 	openpal::TimeDuration asyncOpenDelay;
+
+	/// Request the low latency profile of the driver (ASYNC_LOW_LATENCY on Linux) so that received
+	/// characters are pushed to the reader without waiting for the driver's flush timer
+	bool lowLatency;
+
+	/// Minimum idle time on the line between the end of one transmitted frame and the start of the next.
+	/// The end of a frame is estimated from the baud rate and character format.
+	openpal::TimeDuration minInterFrameGap;
+
+	/// Minimum delay between the last received byte and the start of a transmission, e.g. to give
+	/// the remote RS-485 transceiver time to release the bus
+	openpal::TimeDuration turnaroundDelay;
 };
 
 }
@@ -24,6 +24,12 @@
 #include "asiopal/Executor.h"
 #include "asiopal/IPEndpoint.h"
 #include "asiopal/LoggingConnectionCondition.h"
+#include "asiopal/ResolverCache.h"
+#include "asiopal/SteadyClock.h"
+
+#include <openpal/executor/TimeDuration.h>
+
+#include <vector>
 
 namespace asiopal
 {
@@ -38,29 +44,78 @@ public:
 	static std::shared_ptr<TCPClient> Create(
 	    const openpal::Logger& logger,
 	    const std::shared_ptr<Executor>& executor,
-	    const std::string& adapter)
+	    const std::string& adapter,
+	    const std::shared_ptr<ResolverCache>& cache = nullptr)
 	{
-		return std::make_shared<TCPClient>(logger, executor, adapter);
+		return std::make_shared<TCPClient>(logger, executor, adapter, cache);
 	}
 
+	/**
+	* @param cache optional cache of resolved host names, may be shared between clients
+	*/
 	TCPClient(
 	    const openpal::Logger& logger,
 	    const std::shared_ptr<Executor>& executor,
-	    const std::string& adapter
+	    const std::string& adapter,
+	    const std::shared_ptr<ResolverCache>& cache = nullptr
 	);
 
 	bool Cancel();
 
+	/// Connect to the addresses of a single remote one at a time
 	bool BeginConnect(const IPEndpoint& remote, const connect_callback_t& callback);
 
+	/**
+	* Race connections to several remotes. An attempt to the next remote starts when the previous
+	* attempt fails or after attemptDelay, whichever comes first. The first connection to succeed
+	* is returned and all the other attempts are canceled.
+	*/
+	bool BeginConnect(const std::vector<IPEndpoint>& remotes, const openpal::TimeDuration& attemptDelay, const connect_callback_t& callback);
+
 private:
 
+	typedef std::function<void(const std::error_code& ec, const ResolverCache::endpoints_t& endpoints)> resolve_callback_t;
+
+	// state of a staggered connection to multiple remotes
+	struct Race
+	{
+		Race(asio::io_context& context, const std::vector<IPEndpoint>& remotes, const openpal::TimeDuration& attemptDelay, const connect_callback_t& callback) :
+			remotes(remotes),
+			attemptDelay(std::chrono::milliseconds(attemptDelay.GetMilliseconds())),
+			callback(callback),
+			timer(context)
+		{}
+
+		const std::vector<IPEndpoint> remotes;
+		const std::chrono::milliseconds attemptDelay;
+		const connect_callback_t callback;
+
+		size_t next = 0;
+		size_t numPending = 0;
+		bool complete = false;
+		std::error_code lastError;
+
+		asio::basic_waitable_timer<steady_clock_t> timer;
+		std::vector<std::unique_ptr<asio::ip::tcp::socket>> sockets;
+	};
+
+	// invokes the callback immediately for IP addresses and cached host names
+	void Resolve(const IPEndpoint& remote, const resolve_callback_t& callback);
+
+	void AsyncConnect(asio::ip::tcp::socket& socket, const ResolverCache::endpoints_t& endpoints, const std::function<void(const std::error_code&)>& callback);
+
 	void HandleResolveResult(
 	    const connect_callback_t& callback,
-	    const asio::ip::tcp::resolver::iterator& endpoints,
+	    const IPEndpoint& remote,
+	    const ResolverCache::endpoints_t& endpoints,
 	    const std::error_code& ec
 	);
 
+	void StartNextAttempt(const std::shared_ptr<Race>& race);
+	void OnAttemptResolved(const std::shared_ptr<Race>& race, const IPEndpoint& remote, const ResolverCache::endpoints_t& endpoints);
+	void OnAttemptFailed(const std::shared_ptr<Race>& race, const std::error_code& ec);
+	void OnAttemptConnected(const std::shared_ptr<Race>& race, asio::ip::tcp::socket& socket);
+
 	bool PostConnectError(const connect_callback_t& callback, const std::error_code& ec);
 
 	bool connecting = false;
@@ -72,6 +127,8 @@ private:
 	asio::ip::tcp::socket socket;
 	asio::ip::tcp::endpoint localEndpoint;
 	asio::ip::tcp::resolver resolver;
+	const std::shared_ptr<ResolverCache> cache;
+	std::shared_ptr<Race> race;
 };
 
 
@@ -33,6 +33,26 @@
 namespace asiopal
 {
 
+/**
+* Position of a TCPServer within a group of servers that share the same port via SO_REUSEPORT
+*/
+struct AcceptorShard
+{
+	AcceptorShard() = default;
+
+	AcceptorShard(uint32_t index, uint32_t count) : index(index), count(count)
+	{}
+
+	/// More than one acceptor shares the port
+	bool IsShared() const
+	{
+		return count > 1;
+	}
+
+	uint32_t index = 0;
+	uint32_t count = 1;
+};
+
 /**
 * Binds and listens on an IPv4 TCP port
 *
@@ -53,6 +73,18 @@ public:
 	    std::error_code& ec
 	);
 
+	/**
+	* Construct one of several servers that listen on the same port. The kernel balances new
+	* connections across the acceptors and session ids are interleaved so that they remain unique.
+	*/
+	TCPServer(
+	    const openpal::Logger& logger,
+	    const std::shared_ptr<Executor>& executor,
+	    const IPEndpoint& endpoint,
+	    const AcceptorShard& shard,
+	    std::error_code& ec
+	);
+
 	/// Implement IListener
 	void Shutdown() override final;
 
@@ -62,7 +94,7 @@ protected:
 
 	virtual void OnShutdown() = 0;
 
-	virtual void AcceptConnection(uint64_t sessionid, const std::shared_ptr<Executor>& executor, asio::ip::tcp::socket) = 0;
+	virtual void AcceptConnection(uint64_t sessionid, const std::shared_ptr<Executor>& executor, asio::ip::tcp::socket, const asio::ip::tcp::endpoint& remote) = 0;
 
 	/// Start asynchronously accepting connections on the strand
 	void StartAccept();
@@ -72,13 +104,14 @@ protected:
 
 private:
 
-	void Configure(const std::string& adapter, std::error_code& ec);
+	void Configure(const std::string& adapter, bool reusePort, std::error_code& ec);
 
 	asio::ip::tcp::endpoint endpoint;
 	asio::ip::tcp::acceptor acceptor;
 	asio::ip::tcp::socket socket;
 	asio::ip::tcp::endpoint remote_endpoint;
-	uint64_t session_id = 0;
+	uint64_t session_id;
+	const uint64_t session_id_stride;
 };
 
 }
@@ -22,6 +22,7 @@
 #ifndef ASIOPAL_TLS_CONFIG_H
 #define ASIOPAL_TLS_CONFIG_H
 
+#include <cstdint>
 #include <string>
 
 namespace asiopal
@@ -91,6 +92,37 @@ struct TLSConfig
 	/// openssl format cipher list
 	std::string cipherList;
 
+	/**
+	* Allow abbreviated handshakes that resume a previously negotiated session (default false).
+	*
+	* Servers keep a cache of recent sessions, and clients remember the last session negotiated
+	* with each remote endpoint, so that reconnects skip certificate verification and key exchange.
+	*/
+	bool allowSessionResumption = false;
+
+	/// Maximum number of sessions kept in the server-side session cache
+	uint32_t sessionCacheSize = 1024;
+
+	/// Lifetime of a cached session or session ticket in seconds
+	uint32_t sessionTimeoutSeconds = 300;
+
+	/**
+	* Use stateless session tickets (RFC 5077) in addition to the server-side cache (default false).
+	* Only takes effect if allowSessionResumption is true.
+	*/
+	bool allowSessionTickets = false;
+
+	/// Interval in seconds after which a server generates a new ticket key. Tickets sealed with the previous key are still accepted and renewed.
+	uint32_t ticketKeyRotationSeconds = 3600;
+
+	/**
+	* Time in seconds a handshake may take once it has started (default 10, 0 == no limit).
+	*
+	* A handshake that exceeds it is aborted, which frees its slot when the manager limits the number
+	* of concurrent handshakes.
+	*/
+	uint32_t handshakeTimeoutSeconds = 10;
+
 };
 
 }
@@ -0,0 +1,84 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+
+#ifndef ASIOPAL_TLS_STATISTICS_H
+#define ASIOPAL_TLS_STATISTICS_H
+
+#include <cstdint>
+
+namespace asiopal
+{
+
+/**
+* Counters for the TLS handshakes performed by a client or server
+*/
+struct TLSStatistics
+{
+	/// Number of handshakes that negotiated a new session
+	uint64_t numFullHandshake = 0;
+
+	/// Number of handshakes that resumed a cached session or ticket
+	uint64_t numResumedHandshake = 0;
+
+	/// Number of handshakes that failed
+	uint64_t numHandshakeFail = 0;
+
+	/// Cumulative duration of all full handshakes in microseconds
+	uint64_t fullHandshakeMicroseconds = 0;
+
+	/// Cumulative duration of all resumed handshakes in microseconds
+	uint64_t resumedHandshakeMicroseconds = 0;
+
+	/// Duration of the longest handshake in microseconds
+	uint64_t maxHandshakeMicroseconds = 0;
+
+	/// Whether the most recent successful handshake resumed a session
+	bool lastHandshakeResumed = false;
+
+	/// Duration of the most recent successful handshake in microseconds
+	uint64_t lastHandshakeMicroseconds = 0;
+
+	void OnHandshake(bool resumed, uint64_t microseconds)
+	{
+		if (resumed)
+		{
+			++numResumedHandshake;
+			resumedHandshakeMicroseconds += microseconds;
+		}
+		else
+		{
+			++numFullHandshake;
+			fullHandshakeMicroseconds += microseconds;
+		}
+
+		if (microseconds > maxHandshakeMicroseconds)
+		{
+			maxHandshakeMicroseconds = microseconds;
+		}
+
+		lastHandshakeResumed = resumed;
+		lastHandshakeMicroseconds = microseconds;
+	}
+};
+
+}
+
+#endif
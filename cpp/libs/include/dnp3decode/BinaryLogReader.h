@@ -0,0 +1,94 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_BINARYLOGREADER_H
+#define OPENDNP3_BINARYLOGREADER_H
+
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+* A rendered entry from a binary log capture
+*/
+struct BinaryLogRecord
+{
+	int64_t milliseconds = 0;
+	int32_t filters = 0;
+	std::string loggerid;
+	std::string location;
+
+	/// one line for text and format entries, one line per row for hex dumps
+	std::vector<std::string> lines;
+};
+
+/**
+* Reads a capture written by asiodnp3::BinaryLogger and renders each entry as text
+*/
+class BinaryLogReader
+{
+public:
+
+	explicit BinaryLogReader(std::istream& input);
+
+	/**
+	* Read the file header. Must be called once before Read(..)
+	*
+	* @return false if the input is not a supported binary log
+	*/
+	bool ReadHeader();
+
+	/**
+	* Read and render the next entry
+	*
+	* @return false at the end of the input, or if the input is corrupt (see IsCorrupt())
+	*/
+	bool Read(BinaryLogRecord& record);
+
+	bool IsCorrupt() const
+	{
+		return corrupt;
+	}
+
+private:
+
+	bool ReadBytes(void* dest, size_t count);
+	bool ReadString(size_t length, std::string& output);
+	bool ReadCommon(BinaryLogRecord& record);
+
+	template <class T>
+	bool ReadInt(T& value);
+
+	const std::string& Lookup(uint32_t id);
+
+	std::istream& input;
+	bool corrupt = false;
+	std::unordered_map<uint32_t, std::string> strings;
+	std::vector<uint8_t> payload;
+};
+
+}
+
+#endif
@@ -0,0 +1,162 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_CAPTUREDECODER_H
+#define OPENDNP3_CAPTUREDECODER_H
+
+#include <openpal/logging/LogFilters.h>
+#include <openpal/util/Uncopyable.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+* Configuration of a CaptureDecoder
+*/
+struct CaptureDecoderConfig
+{
+	/// Worker threads that decode streams in parallel, 0 uses one per hardware thread
+	uint32_t numThreads = 0;
+
+	/// Only decode TCP and UDP flows with one of these ports at either end. All flows are decoded if empty.
+	std::vector<uint16_t> ports;
+
+	/// Levels logged by the decoder of each stream
+	openpal::LogFilters filters = openpal::LogFilters(~0);
+
+	/// Packets demultiplexed between decoding passes. Bounds the decoded output held in memory, and is how long a hole in a TCP stream waits for a retransmission.
+	uint32_t packetsPerPass = 65536;
+};
+
+/**
+* Counters for a decoded capture
+*/
+struct CaptureDecoderStatistics
+{
+	/// Size of the capture file
+	uint64_t numBytes = 0;
+
+	uint64_t numPackets = 0;
+
+	/// Packets that weren't TCP/UDP over IPv4/IPv6, were fragmented, or didn't match the port filter
+	uint64_t numIgnoredPackets = 0;
+
+	/// One per direction of each TCP connection or UDP flow
+	uint64_t numStreams = 0;
+
+	/// Most streams held in memory at once. A TCP stream is released a pass after it closes, once everything it buffered has been decoded.
+	uint64_t maxActiveStreams = 0;
+
+	/// Payload bytes passed to the decoders
+	uint64_t numPayloadBytes = 0;
+
+	/// TCP payload bytes discarded because they had already been decoded, e.g. retransmissions
+	uint64_t numDuplicateBytes = 0;
+
+	/// Holes in TCP streams that were skipped because the missing segments were never captured
+	uint64_t numGaps = 0;
+
+	uint64_t numLines = 0;
+
+	uint32_t numThreads = 0;
+
+	/// The file ended in the middle of a record, or a pcapng block was malformed
+	bool truncated = false;
+
+	std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::duration::zero();
+
+	/// Size of the capture file divided by the time it took to decode
+	double MegabytesPerSecond() const
+	{
+		const auto seconds = std::chrono::duration<double>(elapsed).count();
+		return (seconds > 0) ? (numBytes / 1000000.0) / seconds : 0;
+	}
+};
+
+/**
+* A line of decoder output
+*/
+struct CaptureLine
+{
+	/// Capture time of the packet containing the decoded bytes, in nanoseconds since the epoch
+	int64_t nanoseconds;
+
+	/// Identifies the stream, e.g. "tcp 10.0.0.1:20000 > 10.0.0.2:50123"
+	const char* stream;
+
+	int32_t filters;
+
+	const char* message;
+};
+
+/**
+* Receives the output of a CaptureDecoder
+*/
+class ICaptureHandler
+{
+public:
+
+	virtual ~ICaptureHandler() {}
+
+	/**
+	* Called on the thread that called Decode(..), ordered by capture time.
+	* Lines from the same packet are in the order they were decoded.
+	*/
+	virtual void OnLine(const CaptureLine& line) = 0;
+};
+
+/**
+* Decodes every DNP3 stream in a pcap or pcapng file.
+*
+* The file is memory mapped and read by one thread, which splits TCP and UDP flows into one stream
+* per direction and reassembles TCP segments by sequence number. Each stream has its own link and
+* transport layer state, so streams are decoded in parallel by a pool of workers. The output of
+* each pass is sorted by capture time and packet number, so it doesn't depend on the number of threads.
+*/
+class CaptureDecoder : private openpal::Uncopyable
+{
+public:
+
+	CaptureDecoder(const CaptureDecoderConfig& config, ICaptureHandler& handler);
+
+	/**
+	* Decode a capture file
+	*
+	* @param path pcap or pcapng file to decode
+	* @param ec An error code. Set if the file can't be mapped, or isn't a pcap or pcapng capture (std::errc::invalid_argument)
+	* @return counters describing the capture and the time it took to decode
+	*/
+	CaptureDecoderStatistics Decode(const std::string& path, std::error_code& ec);
+
+private:
+
+	const CaptureDecoderConfig config;
+	ICaptureHandler* handler;
+};
+
+}
+
+#endif
@@ -0,0 +1,109 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_LATENCYHISTOGRAM_H
+#define OPENDNP3_LATENCYHISTOGRAM_H
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+* Fixed-memory, log-linear histogram of latencies. The owner chooses the unit, usually milliseconds.
+*
+* Values below 32 are counted exactly. Larger values are grouped into 16 buckets
+* per power of two, so any reported percentile is within 1/16 (6.25%) of the
+* recorded value. Values above 2^32 - 1 are clamped. Recording is O(1) and never
+* allocates, so a histogram can be updated on every message.
+*/
+class LatencyHistogram
+{
+
+public:
+
+	/// number of bits of precision kept for each power of two
+	static const uint32_t SUB_BUCKET_BITS = 4;
+	static const uint32_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+
+	/// the largest value that is tracked without clamping is 2^MAX_VALUE_BITS - 1
+	static const uint32_t MAX_VALUE_BITS = 32;
+	static const uint32_t NUM_BUCKETS = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+	LatencyHistogram();
+
+	/// Record a single latency. Negative values are recorded as zero.
+	void Record(int64_t latency);
+
+	/// Discard all recorded values
+	void Reset();
+
+	/// @return the number of recorded values
+	uint64_t Count() const
+	{
+		return count;
+	}
+
+	/// @return the smallest recorded value, or 0 if empty
+	uint64_t Min() const
+	{
+		return (count == 0) ? 0 : min;
+	}
+
+	/// @return the largest recorded value, or 0 if empty
+	uint64_t Max() const
+	{
+		return max;
+	}
+
+	/// @return the arithmetic mean of the recorded values, or 0 if empty
+	double Mean() const;
+
+	/**
+	* @param percentile a value in the range [0, 100], e.g. 99.9
+	* @return the highest value equivalent to the one at the requested percentile, or 0 if empty
+	*/
+	uint64_t ValueAtPercentile(double percentile) const;
+
+	/// @return the number of values counted by the bucket at the specified index
+	uint32_t CountAt(uint32_t index) const
+	{
+		return (index < NUM_BUCKETS) ? buckets[index] : 0;
+	}
+
+	/// @return the bucket index used to count a value
+	static uint32_t GetIndex(uint64_t value);
+
+	/// @return the largest value counted by the bucket at the specified index
+	static uint64_t HighestEquivalentValue(uint32_t index);
+
+private:
+
+	uint64_t count;
+	uint64_t sum;
+	uint64_t min;
+	uint64_t max;
+
+	uint32_t buckets[NUM_BUCKETS];
+};
+
+}
+
+#endif
@@ -21,6 +21,8 @@
 #ifndef OPENDNP3_STACKSTATISTICS_H
 #define OPENDNP3_STACKSTATISTICS_H
 
+#include "opendnp3/LatencyHistogram.h"
+
 #include <cstdint>
 
 namespace opendnp3
@@ -79,6 +81,54 @@ struct StackStatistics
 		Tx tx;
 	};
 
+	/// Latency histograms of the application layer, all values in milliseconds
+	struct Latency
+	{
+		/// master: time from the transmission of a request (or the previous fragment) to each response fragment
+		LatencyHistogram requestToResponse;
+
+		/// outstation: time from a database update to the transmission of the confirmed fragment carrying the event
+		LatencyHistogram eventToTransmit;
+
+		/// outstation: time from the transmission of a fragment requesting confirmation to the matching confirm
+		LatencyHistogram confirmRoundTrip;
+	};
+
+	/// Outstation unsolicited responses that carried events
+	struct Unsolicited
+	{
+		/// number of unsolicited fragments carrying events, retries included
+		uint32_t numFragments = 0;
+
+		/// number of events written into those fragments
+		uint32_t numEvents = 0;
+
+		/// number of times a hold time expired before the event count threshold was reached
+		uint32_t numHoldTimeExpired = 0;
+
+		/// number of times an event count threshold ended a hold time early
+		uint32_t numEventThresholdReached = 0;
+
+		/// distribution of the number of events in each fragment
+		LatencyHistogram eventsPerFragment;
+	};
+
+	/// Outstation responses written with OutstationParams::compactEncoding
+	struct Compaction
+	{
+		/// number of static headers written with a narrower variation or qualifier than configured
+		uint32_t numStaticHeaders = 0;
+
+		/// object and qualifier bytes saved by those headers
+		uint64_t numStaticBytesSaved = 0;
+
+		/// number of events recorded with a narrower variation than configured
+		uint32_t numEvents = 0;
+
+		/// object bytes saved by those events, counted when the event is recorded
+		uint64_t numEventBytesSaved = 0;
+	};
+
 	StackStatistics() = default;
 
 	StackStatistics(const Link& link, const Transport& transport) :
@@ -88,8 +138,38 @@ struct StackStatistics
 
 	}
 
+	StackStatistics(const Link& link, const Transport& transport, const Latency& latency) :
+		link(link),
+		transport(transport),
+		latency(latency)
+	{
+
+	}
+
+	StackStatistics(const Link& link, const Transport& transport, const Latency& latency, const Unsolicited& unsolicited) :
+		link(link),
+		transport(transport),
+		latency(latency),
+		unsolicited(unsolicited)
+	{
+
+	}
+
+	StackStatistics(const Link& link, const Transport& transport, const Latency& latency, const Unsolicited& unsolicited, const Compaction& compaction) :
+		link(link),
+		transport(transport),
+		latency(latency),
+		unsolicited(unsolicited),
+		compaction(compaction)
+	{
+
+	}
+
 	Link link;
 	Transport transport;
+	Latency latency;
+	Unsolicited unsolicited;
+	Compaction compaction;
 };
 
 }
@@ -24,13 +24,17 @@
 #include <cstdint>
 
 #include <openpal/container/RSlice.h>
-#include <openpal/container/StaticBuffer.h>
 
 namespace opendnp3
 {
 
+class OctetBlock;
+
 /**
 * A base-class for bitstrings containing up to 255 bytes
+*
+* Short values are stored inline. Longer values are kept in immutable, reference counted
+* blocks from a shared slab allocator, so copies of a value share the same storage.
 */
 class OctetData
 {
@@ -38,6 +42,9 @@ public:
 
 	const static uint8_t MAX_SIZE = 255;
 
+	/// Values up to this size are stored inside the object itself
+	const static uint8_t INLINE_SIZE = 16;
+
 	/**
 	* Construct with a default value of [0x00] (length == 1)
 	*/
@@ -66,6 +73,19 @@ public:
 	*/
 	OctetData(const openpal::RSlice& input);
 
+	/**
+	* Copies share the storage of values that are not stored inline
+	*/
+	OctetData(const OctetData& other);
+
+	OctetData(OctetData&& other) noexcept;
+
+	OctetData& operator=(const OctetData& other);
+
+	OctetData& operator=(OctetData&& other) noexcept;
+
+	~OctetData();
+
 	inline uint8_t Size() const
 	{
 		return size;
@@ -104,7 +124,21 @@ private:
 
 	static openpal::RSlice ToSlice(const char* input);
 
-	openpal::StaticBuffer<MAX_SIZE> buffer;
+	inline bool IsInline() const
+	{
+		return size <= INLINE_SIZE;
+	}
+
+	// replace the contents with input of at most MAX_SIZE bytes, which may refer to the current contents
+	void Assign(const openpal::RSlice& input);
+
+	union Storage
+	{
+		uint8_t bytes[INLINE_SIZE];
+		OctetBlock* block;
+	};
+
+	Storage storage;
 	uint8_t size;
 };
 
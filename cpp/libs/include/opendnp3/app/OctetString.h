@@ -23,6 +23,8 @@
 
 #include "OctetData.h"
 
+#include <utility>
+
 namespace opendnp3
 {
 
@@ -45,6 +47,13 @@ public:
 	OctetString(const OctetString& data) : OctetData(data)
 	{}
 
+	OctetString(OctetString&& data) noexcept : OctetData(std::move(data))
+	{}
+
+	OctetString& operator=(const OctetString& data) = default;
+
+	OctetString& operator=(OctetString&& data) noexcept = default;
+
 	/**
 	* Construct from a c-style string
 	*
@@ -0,0 +1,89 @@
+//
+//  _   _         ______    _ _ _   _             _ _ _
+// | \ | |       |  ____|  | (_) | (_)           | | | |
+// |  \| | ___   | |__   __| |_| |_ _ _ __   __ _| | | |
+// | . ` |/ _ \  |  __| / _` | | __| | '_ \ / _` | | | |
+// | |\  | (_) | | |___| (_| | | |_| | | | | (_| |_|_|_|
+// |_| \_|\___/  |______\__,_|_|\__|_|_| |_|\__, (_|_|_)
+//                                           __/ |
+//                                          |___/
+// 
+// This file is auto-generated. Do not edit manually
+// 
+// Copyright 2013 Automatak LLC
+// 
+// Automatak LLC (www.automatak.com) licenses this file
+// to you under the the Apache License Version 2.0 (the "License"):
+// 
+// http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef OPENDNP3_GROUPVARIATIONTABLE_H
+#define OPENDNP3_GROUPVARIATIONTABLE_H
+
+#include <cstdint>
+
+#include "opendnp3/gen/GroupVariation.h"
+
+namespace opendnp3 {
+
+/**
+  Properties of a known group/variation
+*/
+struct GroupVariationInfo
+{
+  GroupVariation enumeration;
+  uint16_t size;
+  uint8_t attributes;
+  uint8_t qualifiers;
+  uint8_t handler;
+  char const* name;
+};
+
+/**
+  Dense lookup of group/variation properties
+*/
+class GroupVariationTable
+{
+  public:
+
+    static const uint8_t ABSOLUTE_TIME = 0x01;
+    static const uint8_t RELATIVE_TIME = 0x02;
+    static const uint8_t FLAGS = 0x04;
+    static const uint8_t EVENT = 0x08;
+
+    static const uint8_t RANGE = 0x01;
+    static const uint8_t COUNT = 0x02;
+    static const uint8_t COUNT_AND_PREFIX = 0x04;
+    static const uint8_t FREE_FORMAT = 0x08;
+
+    static const uint8_t NUM_HANDLERS = 134;
+
+    static const GroupVariationInfo& Lookup(uint8_t group, uint8_t variation)
+    {
+      const Row& row = rows[groups[group]];
+      return entries[(variation < row.count) ? (row.offset + variation) : 0];
+    }
+
+    static const GroupVariationInfo& Lookup(GroupVariation gv)
+    {
+      const auto value = GroupVariationToType(gv);
+      return Lookup(static_cast<uint8_t>(value >> 8), static_cast<uint8_t>(value & 0xFF));
+    }
+
+  private:
+
+    struct Row
+    {
+      uint16_t offset;
+      uint16_t count;
+    };
+
+    static const uint8_t groups[256];
+    static const Row rows[32];
+    static const GroupVariationInfo entries[154];
+};
+
+}
+
+#endif
@@ -21,6 +21,8 @@
 #ifndef OPENDNP3_LINKSTATISTICS_H
 #define OPENDNP3_LINKSTATISTICS_H
 
+#include "opendnp3/LatencyHistogram.h"
+
 #include <cstdint>
 
 namespace opendnp3
@@ -74,6 +76,25 @@ struct LinkStatistics
 
 		/// Number of frames transmitted
 		uint32_t numLinkFrameTx = 0;
+
+		/// Number of TLS handshakes that negotiated a new session
+		uint32_t numTLSFullHandshake = 0;
+
+		/// Number of TLS handshakes that resumed a previous session
+		uint32_t numTLSResumedHandshake = 0;
+	};
+
+	/// Latency histograms shared by all the sessions on the channel, values in milliseconds unless noted otherwise
+	struct Latency
+	{
+		/// time from when a master task becomes runnable until the scheduler starts it
+		LatencyHistogram taskQueueDelay;
+
+		/// duration of successful TLS handshakes
+		LatencyHistogram tlsHandshake;
+
+		/// time from the read that delivered the first byte of a link frame until the read that completed it, in microseconds
+		LatencyHistogram frameRx;
 	};
 
 	LinkStatistics() = default;
@@ -81,12 +102,18 @@ struct LinkStatistics
 	LinkStatistics(const Channel& channel, const Parser& parser) : channel(channel), parser(parser)
 	{}
 
+	LinkStatistics(const Channel& channel, const Parser& parser, const Latency& latency) : channel(channel), parser(parser), latency(latency)
+	{}
+
 	/// statistics for the communicaiton channel
 	Channel channel;
 
 	/// statistics for the link parser
 	Parser parser;
 
+	/// latency of the master task scheduler
+	Latency latency;
+
 };
 
 }
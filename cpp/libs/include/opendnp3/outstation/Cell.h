@@ -30,10 +30,11 @@ namespace opendnp3
 template <class Spec>
 struct SelectedValue
 {
-	SelectedValue() : selected(false), value(), variation(Spec::DefaultStaticVariation)
+	SelectedValue() : selected(false), compact(false), value(), variation(Spec::DefaultStaticVariation)
 	{}
 
 	bool selected;
+	bool compact;	// the variation may be narrowed to fit the values when written
 	typename Spec::meas_t value;
 	typename Spec::static_variation_t variation;
 };
@@ -0,0 +1,67 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_CHATTERFILTERSTATISTICS_H
+#define OPENDNP3_CHATTERFILTERSTATISTICS_H
+
+#include "opendnp3/app/EventType.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+* Counters maintained by the chatter filters of an outstation database
+*/
+struct ChatterFilterStatistics
+{
+	static const uint16_t NUM_EVENT_TYPES = 8;
+
+	/// A point that has had events suppressed
+	struct Point
+	{
+		EventType type;
+		uint16_t index;
+		uint32_t numSuppressed;
+		bool filtered;
+	};
+
+	/// @return the number of suppressed events of a type
+	uint32_t NumSuppressed(EventType type) const
+	{
+		const auto i = static_cast<uint16_t>(type);
+		return (i < NUM_EVENT_TYPES) ? numSuppressed[i] : 0;
+	}
+
+	/// suppressed events indexed by EventType
+	uint32_t numSuppressed[NUM_EVENT_TYPES] = {};
+
+	/// number of points that are currently filtered
+	uint32_t numFiltered = 0;
+
+	/// points with the most suppressed events in descending order
+	std::vector<Point> topPoints;
+};
+
+}
+
+#endif
@@ -22,9 +22,12 @@
 #ifndef OPENDNP3_MEASUREMENTCONFIG_H
 #define OPENDNP3_MEASUREMENTCONFIG_H
 
+#include "opendnp3/app/EventType.h"
 #include "opendnp3/app/MeasurementInfo.h"
 #include "opendnp3/gen/PointClass.h"
 
+#include <openpal/executor/TimeDuration.h>
+
 namespace opendnp3
 {
 
@@ -42,6 +45,35 @@ struct StaticConfig : IndexConfig
 	typename Info::static_variation_t svariation = Info::DefaultStaticVariation;
 };
 
+/**
+* Limits the rate of events generated by a single point. Once more than maxEvents are generated within
+* a window, further events are suppressed and binary types report the CHATTER_FILTER flag. The point
+* resumes reporting with an event carrying its current value after it has not changed for quietPeriod.
+*/
+struct ChatterFilterConfig
+{
+	/// Number of events allowed within a window, 0 disables the filter
+	uint16_t maxEvents = 0;
+
+	/// Length of the window in which events are counted
+	openpal::TimeDuration window = openpal::TimeDuration::Seconds(1);
+
+	/// How long the point must be unchanged before the filter is removed
+	openpal::TimeDuration quietPeriod = openpal::TimeDuration::Seconds(5);
+};
+
+/// Assigns a chatter filter to a single point
+struct ChatterFilterPoint
+{
+	ChatterFilterPoint(EventType type, uint16_t index, const ChatterFilterConfig& config) :
+		type(type), index(index), config(config)
+	{}
+
+	EventType type;
+	uint16_t index;
+	ChatterFilterConfig config;
+};
+
 template <class Info>
 struct EventConfig : StaticConfig<Info>
 {
@@ -29,6 +29,7 @@
 #include "opendnp3/app/AppConstants.h"
 
 #include "opendnp3/outstation/StaticTypeBitfield.h"
+#include "opendnp3/outstation/UnsolicitedTrigger.h"
 
 namespace opendnp3
 {
@@ -71,6 +72,19 @@ struct OutstationParams
 	/// Class mask for unsolicted, default to 0 as unsolicited has to be enabled
 	ClassField unsolClassMask = ClassField::None();
 
+	/// Hold time and event count threshold for unsolicited class 1 events, defaults to reporting immediately
+	UnsolicitedTrigger unsolClass1Trigger;
+
+	/// Hold time and event count threshold for unsolicited class 2 events, defaults to reporting immediately
+	UnsolicitedTrigger unsolClass2Trigger;
+
+	/// Hold time and event count threshold for unsolicited class 3 events, defaults to reporting immediately
+	UnsolicitedTrigger unsolClass3Trigger;
+
+	/// If true, static values and events reported in their default variation use the smallest variation and qualifier that encodes them exactly,
+	/// e.g. Group30Var4 for analogs with nominal flags and 16-bit integer values. Variations requested explicitly by the master are always honored.
+	bool compactEncoding = false;
+
 	/// If true, the outstation processes responds to any request/confirmation as if it came from the expected master address
 	bool respondToAnyMaster = false;
 };
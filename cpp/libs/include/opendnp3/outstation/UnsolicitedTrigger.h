@@ -0,0 +1,57 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_UNSOLICITEDTRIGGER_H
+#define OPENDNP3_UNSOLICITEDTRIGGER_H
+
+#include <openpal/executor/TimeDuration.h>
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+* Controls when the unreported events of a single class are reported by an unsolicited response.
+*
+* When the first unreported event of the class is observed, the outstation starts a hold timer. The
+* events are reported when the hold time expires or when the number of unreported events reaches
+* the threshold, whichever comes first. Events of all classes enabled for unsolicited reporting are
+* then packed into as few fragments as possible.
+*/
+struct UnsolicitedTrigger
+{
+	UnsolicitedTrigger() = default;
+
+	UnsolicitedTrigger(openpal::TimeDuration holdTime, uint32_t maxEvents) :
+		holdTime(holdTime),
+		maxEvents(maxEvents)
+	{}
+
+	/// Time to wait after the first unreported event before sending an unsolicited response. Zero reports events immediately
+	openpal::TimeDuration holdTime = openpal::TimeDuration::Zero();
+
+	/// Number of unreported events that ends the hold time early. 0 disables the threshold
+	uint32_t maxEvents = 0;
+};
+
+}
+
+#endif
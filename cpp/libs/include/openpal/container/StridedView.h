@@ -0,0 +1,63 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENPAL_STRIDEDVIEW_H
+#define OPENPAL_STRIDEDVIEW_H
+
+#include <cstdint>
+
+namespace openpal
+{
+
+/**
+* Read-only view of values of type T that are spaced a fixed number of bytes apart,
+* e.g. one member of each element in an array of structs
+*/
+template <class T>
+class StridedView
+{
+
+public:
+
+	StridedView(const T* start, uint32_t stride) :
+		start(reinterpret_cast<const uint8_t*>(start)),
+		stride(stride)
+	{}
+
+	/**
+	* View over a contiguous array
+	*/
+	explicit StridedView(const T* start) : StridedView(start, sizeof(T))
+	{}
+
+	inline const T& operator[](uint32_t index) const
+	{
+		return *reinterpret_cast<const T*>(start + index * stride);
+	}
+
+private:
+
+	const uint8_t* start;
+	uint32_t stride;
+};
+
+}
+
+#endif
@@ -0,0 +1,86 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENPAL_BINARYLOGENTRY_H
+#define OPENPAL_BINARYLOGENTRY_H
+
+#include <cstdint>
+
+#include "LogFilters.h"
+#include "openpal/container/RSlice.h"
+#include "openpal/util/Uncopyable.h"
+
+namespace openpal
+{
+
+/**
+* An unformatted event recorded by the logging framework. Either a format string
+* and its encoded arguments, or the raw bytes of a hex dump.
+*/
+class BinaryLogEntry : openpal::Uncopyable
+{
+
+public:
+
+	BinaryLogEntry() = delete;
+
+	BinaryLogEntry(const char* loggerid, const LogFilters& filters, const char* location, const char* format, const RSlice& arguments) :
+		loggerid(loggerid),
+		filters(filters),
+		location(location),
+		format(format),
+		payload(arguments),
+		firstRowSize(0),
+		otherRowSize(0)
+	{}
+
+	BinaryLogEntry(const char* loggerid, const LogFilters& filters, const char* location, const RSlice& bytes, uint32_t firstRowSize, uint32_t otherRowSize) :
+		loggerid(loggerid),
+		filters(filters),
+		location(location),
+		format(nullptr),
+		payload(bytes),
+		firstRowSize(firstRowSize),
+		otherRowSize(otherRowSize)
+	{}
+
+	bool IsHex() const
+	{
+		return format == nullptr;
+	}
+
+	const char* loggerid;
+	LogFilters filters;
+	const char* location;
+
+	/// printf-style format string literal, or nullptr for a hex dump
+	const char* format;
+
+	/// arguments encoded by LogArguments, or the raw bytes of a hex dump
+	RSlice payload;
+
+	/// hex dump row sizes, see LogHex(..)
+	uint32_t firstRowSize;
+	uint32_t otherRowSize;
+};
+
+}
+
+#endif
@@ -0,0 +1,65 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENPAL_BINARYLOGFORMAT_H
+#define OPENPAL_BINARYLOGFORMAT_H
+
+#include "openpal/util/Uncopyable.h"
+
+#include <cstdint>
+
+namespace openpal
+{
+
+/**
+* Layout of binary log capture files. All integers are little endian.
+*
+* The file starts with MAGIC followed by a 1-byte VERSION, then a sequence of records
+* that each start with a 1-byte RecordType:
+*
+*   String:  u32 id, u16 length, bytes                         (defines a string before its first use)
+*   Text:    i64 ms, i32 filters, u32 id, u32 loc, u16 length, bytes
+*   Format:  i64 ms, i32 filters, u32 id, u32 loc, u32 format, u16 length, encoded arguments
+*   Hex:     i64 ms, i32 filters, u32 id, u32 loc, u16 first, u16 other, u32 length, bytes
+*
+* where id, loc and format refer to previously defined strings (the logger id, the source location and the format string)
+*/
+struct BinaryLogFormat : private StaticOnly
+{
+	enum class RecordType : uint8_t
+	{
+		String = 0,
+		Text = 1,
+		Format = 2,
+		Hex = 3
+	};
+
+	static const uint32_t MAGIC_SIZE = 8;
+	static const uint8_t VERSION = 1;
+
+	static const char* Magic()
+	{
+		return "DNP3BLOG";
+	}
+};
+
+}
+
+#endif
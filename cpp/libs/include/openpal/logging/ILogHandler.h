@@ -22,6 +22,7 @@
 #define OPENPAL_ILOGHANDLER_H
 
 #include "LogEntry.h"
+#include "BinaryLogEntry.h"
 
 namespace openpal
 {
@@ -40,6 +41,21 @@ public:
 	* @param entry the log message to handle
 	*/
 	virtual void Log( const LogEntry& entry ) = 0;
+
+	/**
+	* Callback method for unformatted log messages. Only invoked if IsBinary() returns true.
+	*
+	* @param entry the unformatted log message to handle
+	*/
+	virtual void LogBinary( const BinaryLogEntry& entry ) {}
+
+	/**
+	* @return true if the handler prefers to receive format strings and raw arguments instead of formatted text
+	*/
+	virtual bool IsBinary() const
+	{
+		return false;
+	}
 };
 
 }
@@ -0,0 +1,137 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENPAL_LOGARGUMENTS_H
+#define OPENPAL_LOGARGUMENTS_H
+
+#include "openpal/container/RSlice.h"
+#include "openpal/container/WSlice.h"
+#include "openpal/util/Uncopyable.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace openpal
+{
+
+const uint32_t MAX_LOG_ARGS_SIZE = 128;
+
+/**
+* Kind of a recorded argument. Stored in the high nibble of each tag byte, the low nibble is the size in bytes.
+*/
+enum class LogArgKind : uint8_t
+{
+	Signed = 1,
+	Unsigned = 2,
+	Float = 3,
+	String = 4,
+	Pointer = 5
+};
+
+/**
+* Records printf-style arguments in a compact tagged binary form and renders them back to text
+*
+* The arguments of a single entry are written as a sequence of [tag][value] pairs. Integers keep their
+* native width so that conversions like %u of a negative int render exactly like snprintf would.
+*/
+class LogArguments : private StaticOnly
+{
+
+public:
+
+	/**
+	* Encode arguments into a buffer, silently omitting any that do not fit
+	*
+	* @return the encoded portion of the buffer
+	*/
+	template <typename... Args>
+	static RSlice Encode(WSlice dest, const Args& ... args)
+	{
+		const auto start = dest.ToRSlice();
+		EncodeMany(dest, args...);
+		return start.Take(start.Size() - dest.Size());
+	}
+
+	/**
+	* Render a format string using previously encoded arguments. Missing or mismatched arguments are rendered as <?>
+	*/
+	static void Render(const char* format, RSlice arguments, std::string& output);
+
+private:
+
+	static bool EncodeMany(WSlice& dest)
+	{
+		return true;
+	}
+
+	template <typename T, typename... Args>
+	static bool EncodeMany(WSlice& dest, const T& value, const Args& ... args)
+	{
+		return EncodeValue<typename std::decay<T>::type>(dest, value) && EncodeMany(dest, args...);
+	}
+
+	template <class D, class T>
+	static typename std::enable_if<std::is_integral<D>::value, bool>::type EncodeValue(WSlice& dest, const T& value)
+	{
+		return WriteInteger(dest, std::is_signed<D>::value ? LogArgKind::Signed : LogArgKind::Unsigned, static_cast<uint64_t>(value), sizeof(D));
+	}
+
+	template <class D, class T>
+	static typename std::enable_if<std::is_enum<D>::value, bool>::type EncodeValue(WSlice& dest, const T& value)
+	{
+		using U = typename std::underlying_type<D>::type;
+		return EncodeValue<U>(dest, static_cast<U>(value));
+	}
+
+	template <class D, class T>
+	static typename std::enable_if<std::is_floating_point<D>::value, bool>::type EncodeValue(WSlice& dest, const T& value)
+	{
+		const double converted = static_cast<double>(value);
+		uint64_t bits;
+		memcpy(&bits, &converted, sizeof(bits));
+		return WriteInteger(dest, LogArgKind::Float, bits, sizeof(bits));
+	}
+
+	template <class D, class T>
+	static typename std::enable_if<std::is_pointer<D>::value, bool>::type EncodeValue(WSlice& dest, const T& value)
+	{
+		return EncodePointer(dest, value);
+	}
+
+	static bool EncodePointer(WSlice& dest, const char* value)
+	{
+		return WriteString(dest, value);
+	}
+
+	static bool EncodePointer(WSlice& dest, const void* value)
+	{
+		return WriteInteger(dest, LogArgKind::Pointer, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)), sizeof(uint64_t));
+	}
+
+	static bool WriteInteger(WSlice& dest, LogArgKind kind, uint64_t value, uint8_t size);
+
+	static bool WriteString(WSlice& dest, const char* value);
+};
+
+}
+
+#endif
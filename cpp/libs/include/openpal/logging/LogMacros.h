@@ -53,21 +53,33 @@
 
 #define FORMAT_LOG_BLOCK(logger, filters, format, ...) \
 	if(logger.IsEnabled(filters)){ \
-		char format_message_buffer[openpal::MAX_LOG_ENTRY_SIZE]; \
-		SAFE_STRING_FORMAT(format_message_buffer, openpal::MAX_LOG_ENTRY_SIZE, format, ##__VA_ARGS__); \
-		logger.Log(filters, LOCATION, format_message_buffer); \
+		if(logger.IsBinary()){ \
+			logger.LogBinary(filters, LOCATION, format, ##__VA_ARGS__); \
+		} else { \
+			char format_message_buffer[openpal::MAX_LOG_ENTRY_SIZE]; \
+			SAFE_STRING_FORMAT(format_message_buffer, openpal::MAX_LOG_ENTRY_SIZE, format, ##__VA_ARGS__); \
+			logger.Log(filters, LOCATION, format_message_buffer); \
+		} \
 	}
 
 #define FORMAT_LOGGER_BLOCK(pLogger, filters, format, ...) \
 	if(pLogger && pLogger->IsEnabled(filters)){ \
-		char format_message_buffer[openpal::MAX_LOG_ENTRY_SIZE]; \
-		SAFE_STRING_FORMAT(format_message_buffer, openpal::MAX_LOG_ENTRY_SIZE, format, ##__VA_ARGS__); \
-		pLogger->Log(filters, LOCATION, format_message_buffer); \
+		if(pLogger->IsBinary()){ \
+			pLogger->LogBinary(filters, LOCATION, format, ##__VA_ARGS__); \
+		} else { \
+			char format_message_buffer[openpal::MAX_LOG_ENTRY_SIZE]; \
+			SAFE_STRING_FORMAT(format_message_buffer, openpal::MAX_LOG_ENTRY_SIZE, format, ##__VA_ARGS__); \
+			pLogger->Log(filters, LOCATION, format_message_buffer); \
+		} \
 	}
 
 #define FORMAT_HEX_BLOCK(logger, filters, buffer, firstSize, otherSize) \
 	if(logger.IsEnabled(filters)){ \
-		LogHex(logger, filters, buffer, firstSize, otherSize); \
+		if(logger.IsBinary()){ \
+			logger.LogBinaryHex(filters, LOCATION, buffer, firstSize, otherSize); \
+		} else { \
+			LogHex(logger, filters, buffer, firstSize, otherSize); \
+		} \
 	}
 
 #endif
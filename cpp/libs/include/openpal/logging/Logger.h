@@ -22,6 +22,7 @@
 #define OPENPAL_LOGGER_H
 
 #include "openpal/logging/ILogHandler.h"
+#include "openpal/logging/LogArguments.h"
 
 #include <memory>
 #include <string>
@@ -56,6 +57,22 @@ public:
 
 	void Log(const LogFilters& filters, const char* location, const char* message);
 
+	/**
+	* Record a format string and its arguments without formatting them. Only valid if IsBinary() is true.
+	*/
+	template <typename... Args>
+	void LogBinary(const LogFilters& filters, const char* location, const char* format, const Args& ... args)
+	{
+		uint8_t buffer[MAX_LOG_ARGS_SIZE];
+		const auto arguments = LogArguments::Encode(WSlice(buffer, MAX_LOG_ARGS_SIZE), args...);
+		backend->LogBinary(BinaryLogEntry(this->settings->id.c_str(), filters, location, format, arguments));
+	}
+
+	/**
+	* Record raw bytes that would otherwise be logged with LogHex(..). Only valid if IsBinary() is true.
+	*/
+	void LogBinaryHex(const LogFilters& filters, const char* location, const RSlice& bytes, uint32_t firstRowSize, uint32_t otherRowSize);
+
 	Logger Detach(const std::string& id) const
 	{
 		return Logger(this->backend, std::make_shared<Settings>(id, this->settings->levels));
@@ -73,6 +90,11 @@ public:
 
 	bool IsEnabled(const LogFilters& filters) const;
 
+	bool IsBinary() const
+	{
+		return binary;
+	}
+
 	LogFilters GetFilters() const
 	{
 		return this->settings->levels;
@@ -92,7 +114,8 @@ private:
 
 	Logger(const std::shared_ptr<ILogHandler>& backend, const std::shared_ptr<Settings>& settings) :
 		backend(backend),
-		settings(settings)
+		settings(settings),
+		binary(backend && backend->IsBinary())
 	{}
 
 	Logger() = delete;
@@ -100,6 +123,7 @@ private:
 
 	const std::shared_ptr<ILogHandler> backend;
 	const std::shared_ptr<Settings> settings;
+	const bool binary;
 };
 
 }
@@ -25,6 +25,8 @@
 
 #include "openpal/container/RSlice.h"
 #include "openpal/container/WSlice.h"
+#include "openpal/container/StridedView.h"
+#include "openpal/serialization/Serialization.h"
 
 namespace openpal
 {
@@ -36,12 +38,13 @@ public:
 
 	typedef bool (*ReadFunc)(RSlice& buffer, T& output);
 	typedef bool (*WriteFunc)(const T& value, WSlice& buffer);
+	typedef uint32_t (*WriteManyFunc)(const StridedView<T>& values, const uint16_t* indices, uint32_t count, WSlice& buffer);
 
-	Serializer() : size(0), pReadFunc(nullptr), pWriteFunc(nullptr)
+	Serializer() : size(0), pReadFunc(nullptr), pWriteFunc(nullptr), pWriteManyFunc(nullptr)
 	{}
 
-	Serializer(uint32_t size_, ReadFunc pReadFunc_, WriteFunc pWriteFunc_) :
-		size(size_), pReadFunc(pReadFunc_), pWriteFunc(pWriteFunc_)
+	Serializer(uint32_t size_, ReadFunc pReadFunc_, WriteFunc pWriteFunc_, WriteManyFunc pWriteManyFunc_ = nullptr) :
+		size(size_), pReadFunc(pReadFunc_), pWriteFunc(pWriteFunc_), pWriteManyFunc(pWriteManyFunc_)
 	{}
 
 	/**
@@ -68,11 +71,42 @@ public:
 		return (*pWriteFunc)(value, buffer);
 	}
 
+	/**
+	* writes as many of the values as fit in the buffer and advances it
+	*
+	* @param values the values to write
+	* @param indices if not null, a UInt16 index is written before each value
+	* @param count the number of values (and indices) available
+	* @return the number of values written
+	*/
+	uint32_t WriteMany(const StridedView<T>& values, const uint16_t* indices, uint32_t count, WSlice& buffer) const
+	{
+		if (pWriteManyFunc)
+		{
+			return (*pWriteManyFunc)(values, indices, count, buffer);
+		}
+
+		const uint32_t sizeWithIndex = indices ? size + static_cast<uint32_t>(UInt16::SIZE) : size;
+
+		uint32_t num = 0;
+		while (num < count && buffer.Size() >= sizeWithIndex)
+		{
+			if (indices)
+			{
+				UInt16::WriteBuffer(buffer, indices[num]);
+			}
+			(*pWriteFunc)(values[num], buffer);
+			++num;
+		}
+		return num;
+	}
+
 private:
 
 	uint32_t size;
 	ReadFunc pReadFunc;
 	WriteFunc pWriteFunc;
+	WriteManyFunc pWriteManyFunc;
 
 };
 
@@ -0,0 +1,225 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiodnp3/AsyncLogger.h"
+
+#include "asiodnp3/LogRing.h"
+
+#include <opendnp3/LogLevels.h>
+
+#include <cerrno>
+#include <chrono>
+
+using namespace openpal;
+using namespace opendnp3;
+using namespace std::chrono;
+
+namespace asiodnp3
+{
+
+std::shared_ptr<AsyncLogger> AsyncLogger::CreateConsole(const AsyncLoggerConfig& config)
+{
+	return std::make_shared<AsyncLogger>(stdout, false, config);
+}
+
+std::shared_ptr<AsyncLogger> AsyncLogger::CreateFile(const std::string& path, const AsyncLoggerConfig& config, std::error_code& ec)
+{
+	FILE* file = fopen(path.c_str(), "a");
+	if (!file)
+	{
+		ec = std::error_code(errno, std::generic_category());
+		return nullptr;
+	}
+
+	return std::make_shared<AsyncLogger>(file, true, config);
+}
+
+AsyncLogger::AsyncLogger(FILE* output, bool closeOutput, const AsyncLoggerConfig& config) :
+	config(config),
+	output(output),
+	closeOutput(closeOutput),
+	ring(new LogRing(config.capacity)),
+	running(true),
+	writerSleeping(false),
+	numDropped(0),
+	numWritten(0),
+	numBatches(0)
+{
+	this->writer = std::thread([this]()
+	{
+		this->Run();
+	});
+}
+
+AsyncLogger::~AsyncLogger()
+{
+	this->Shutdown();
+}
+
+void AsyncLogger::Log(const LogEntry& entry)
+{
+	// nothing drains the ring once the writer has stopped
+	if (!running.load(std::memory_order_relaxed))
+	{
+		numDropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	const auto milliseconds = duration_cast<std::chrono::milliseconds>(high_resolution_clock::now().time_since_epoch()).count();
+
+	while (!ring->TryPush(entry, milliseconds, config.printLocation))
+	{
+		if (config.overflowPolicy == LogOverflowPolicy::DropNewest || !running.load(std::memory_order_relaxed))
+		{
+			numDropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		this->WakeWriter();
+		std::this_thread::yield();
+	}
+
+	// pairs with the fence in Run() so that either we see the writer asleep or it sees our entry
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (writerSleeping.load(std::memory_order_relaxed))
+	{
+		this->WakeWriter();
+	}
+}
+
+void AsyncLogger::Shutdown()
+{
+	if (!running.exchange(false))
+	{
+		return;
+	}
+
+	this->WakeWriter();
+	writer.join();
+
+	if (closeOutput)
+	{
+		fclose(output);
+	}
+	else
+	{
+		fflush(output);
+	}
+}
+
+AsyncLoggerStatistics AsyncLogger::GetStatistics() const
+{
+	AsyncLoggerStatistics stats;
+	stats.numQueued = ring->NumProduced();
+	stats.numDropped = numDropped.load(std::memory_order_relaxed);
+	stats.numWritten = numWritten.load(std::memory_order_relaxed);
+	stats.numBatches = numBatches.load(std::memory_order_relaxed);
+	return stats;
+}
+
+void AsyncLogger::WakeWriter()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	condition.notify_one();
+}
+
+void AsyncLogger::Run()
+{
+	std::string buffer;
+	buffer.reserve(config.maxBatchSize * (LogRecord::MAX_MESSAGE_SIZE / 2));
+
+	while (true)
+	{
+		if (this->WriteBatch(buffer))
+		{
+			continue;
+		}
+
+		if (!running.load())
+		{
+			// producers may still have been mid-push when running was cleared
+			if (!this->WriteBatch(buffer))
+			{
+				return;
+			}
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(mutex);
+		writerSleeping.store(true, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (ring->IsEmpty() && running.load())
+		{
+			// the timeout bounds latency if a wakeup is ever missed
+			condition.wait_for(lock, std::chrono::milliseconds(100));
+		}
+		writerSleeping.store(false, std::memory_order_relaxed);
+	}
+}
+
+bool AsyncLogger::WriteBatch(std::string& buffer)
+{
+	buffer.clear();
+
+	uint32_t count = 0;
+	char line[LogRecord::MAX_ID_SIZE + LogRecord::MAX_LOCATION_SIZE + LogRecord::MAX_MESSAGE_SIZE + 64];
+
+	auto format = [&](const LogRecord & record)
+	{
+		const int size = config.printLocation ?
+		                 snprintf(line, sizeof(line), "ms(%lld) %s %s - %s - %s\n", static_cast<long long>(record.milliseconds), LogFlagToString(record.filters), record.loggerid, record.location, record.message) :
+		                 snprintf(line, sizeof(line), "ms(%lld) %s %s - %s\n", static_cast<long long>(record.milliseconds), LogFlagToString(record.filters), record.loggerid, record.message);
+
+		if (size <= 0)
+		{
+			return;
+		}
+
+		if (static_cast<size_t>(size) < sizeof(line))
+		{
+			buffer.append(line, size);
+		}
+		else
+		{
+			// truncated, but keep one entry per line
+			line[sizeof(line) - 2] = '\n';
+			buffer.append(line, sizeof(line) - 1);
+		}
+	};
+
+	while (count < config.maxBatchSize && ring->TryConsume(format))
+	{
+		++count;
+	}
+
+	if (count == 0)
+	{
+		return false;
+	}
+
+	fwrite(buffer.data(), 1, buffer.size(), output);
+	fflush(output);
+
+	numWritten.fetch_add(count, std::memory_order_relaxed);
+	numBatches.fetch_add(1, std::memory_order_relaxed);
+	return true;
+}
+
+}
@@ -0,0 +1,184 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiodnp3/BinaryLogger.h"
+
+#include <openpal/logging/BinaryLogFormat.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+using namespace openpal;
+using namespace std::chrono;
+
+namespace asiodnp3
+{
+
+namespace
+{
+
+template <class T>
+void Put(std::vector<uint8_t>& dest, T value)
+{
+	for (size_t i = 0; i < sizeof(T); ++i)
+	{
+		dest.push_back(static_cast<uint8_t>(static_cast<uint64_t>(value) >> (8 * i)));
+	}
+}
+
+void PutBytes(std::vector<uint8_t>& dest, const uint8_t* bytes, size_t length)
+{
+	dest.insert(dest.end(), bytes, bytes + length);
+}
+
+}
+
+std::shared_ptr<BinaryLogger> BinaryLogger::Create(const std::string& path, std::error_code& ec)
+{
+	FILE* file = fopen(path.c_str(), "wb");
+	if (!file)
+	{
+		ec = std::error_code(errno, std::generic_category());
+		return nullptr;
+	}
+
+	return std::make_shared<BinaryLogger>(file);
+}
+
+BinaryLogger::BinaryLogger(FILE* file) :
+	file(file),
+	fileBuffer(FILE_BUFFER_SIZE)
+{
+	setvbuf(file, fileBuffer.data(), _IOFBF, fileBuffer.size());
+
+	fwrite(BinaryLogFormat::Magic(), 1, BinaryLogFormat::MAGIC_SIZE, file);
+	fputc(BinaryLogFormat::VERSION, file);
+}
+
+BinaryLogger::~BinaryLogger()
+{
+	fclose(file);
+}
+
+void BinaryLogger::Log(const LogEntry& entry)
+{
+	const auto length = static_cast<uint16_t>(strnlen(entry.message, UINT16_MAX));
+
+	std::lock_guard<std::mutex> lock(mutex);
+	this->BeginRecord(static_cast<uint8_t>(BinaryLogFormat::RecordType::Text), entry.loggerid, entry.filters.GetBitfield(), entry.location);
+	Put<uint16_t>(record, length);
+	PutBytes(record, reinterpret_cast<const uint8_t*>(entry.message), length);
+	this->Commit();
+}
+
+void BinaryLogger::LogBinary(const BinaryLogEntry& entry)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	if (entry.IsHex())
+	{
+		this->BeginRecord(static_cast<uint8_t>(BinaryLogFormat::RecordType::Hex), entry.loggerid, entry.filters.GetBitfield(), entry.location);
+		Put<uint16_t>(record, static_cast<uint16_t>(entry.firstRowSize));
+		Put<uint16_t>(record, static_cast<uint16_t>(entry.otherRowSize));
+		Put<uint32_t>(record, entry.payload.Size());
+	}
+	else
+	{
+		// the format must be defined before the record that references it
+		const auto format = this->GetLiteralId(entry.format);
+		this->BeginRecord(static_cast<uint8_t>(BinaryLogFormat::RecordType::Format), entry.loggerid, entry.filters.GetBitfield(), entry.location);
+		Put<uint32_t>(record, format);
+		Put<uint16_t>(record, static_cast<uint16_t>(entry.payload.Size()));
+	}
+
+	PutBytes(record, entry.payload, entry.payload.Size());
+	this->Commit();
+}
+
+void BinaryLogger::Flush()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	fflush(file);
+}
+
+uint32_t BinaryLogger::GetLiteralId(const char* value)
+{
+	const auto iter = literals.find(value);
+	if (iter != literals.end())
+	{
+		return iter->second;
+	}
+
+	const auto id = this->DefineString(value);
+	literals[value] = id;
+	return id;
+}
+
+uint32_t BinaryLogger::GetStringId(const char* value)
+{
+	const auto iter = strings.find(value);
+	if (iter != strings.end())
+	{
+		return iter->second;
+	}
+
+	const auto id = this->DefineString(value);
+	strings[value] = id;
+	return id;
+}
+
+uint32_t BinaryLogger::DefineString(const char* value)
+{
+	const auto id = nextId++;
+	const auto length = static_cast<uint16_t>(strnlen(value, UINT16_MAX));
+
+	record.clear();
+	record.push_back(static_cast<uint8_t>(BinaryLogFormat::RecordType::String));
+	Put<uint32_t>(record, id);
+	Put<uint16_t>(record, length);
+	PutBytes(record, reinterpret_cast<const uint8_t*>(value), length);
+	this->Commit();
+
+	return id;
+}
+
+void BinaryLogger::BeginRecord(uint8_t type, const char* loggerid, int32_t filters, const char* location)
+{
+	const auto milliseconds = duration_cast<std::chrono::milliseconds>(high_resolution_clock::now().time_since_epoch()).count();
+
+	// definitions are written as their own records, so resolve ids before starting this one
+	const auto id = this->GetStringId(loggerid);
+	const auto loc = this->GetLiteralId(location ? location : "");
+
+	record.clear();
+	record.push_back(type);
+	Put<int64_t>(record, milliseconds);
+	Put<int32_t>(record, filters);
+	Put<uint32_t>(record, id);
+	Put<uint32_t>(record, loc);
+}
+
+void BinaryLogger::Commit()
+{
+	fwrite(record.data(), 1, record.size(), file);
+}
+
+}
@@ -0,0 +1,59 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_CAPTURERING_H
+#define ASIODNP3_CAPTURERING_H
+
+#include "opendnp3/link/LinkLayerConstants.h"
+
+#include "asiodnp3/SlotRing.h"
+
+#include <cstdint>
+
+namespace asiodnp3
+{
+
+/**
+* A pcap record with the synthetic IPv4/TCP headers already built
+*/
+struct CaptureRecord
+{
+	static const uint32_t HEADER_SIZE = 40;
+	static const uint32_t MAX_SIZE = HEADER_SIZE + opendnp3::LPDU_MAX_FRAME_SIZE;
+
+	uint32_t seconds;
+	uint32_t microseconds;
+	uint32_t length;
+	uint32_t originalLength;
+	uint8_t data[MAX_SIZE];
+};
+
+class CaptureRing final : public SlotRing<CaptureRecord>
+{
+
+public:
+
+	explicit CaptureRing(uint32_t capacity) : SlotRing<CaptureRecord>(capacity)
+	{}
+};
+
+}
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_CAPTURETAP_H
+#define ASIODNP3_CAPTURETAP_H
+
+#include "asiodnp3/PacketCapture.h"
+
+#include <memory>
+
+namespace asiodnp3
+{
+
+/**
+* Per-channel view of a PacketCapture that tracks the synthetic stream offsets.
+*
+* Only accessed from the owner's strand, so the stream state requires no synchronization.
+*/
+class CaptureTap
+{
+
+public:
+
+	void Set(const std::shared_ptr<PacketCapture>& capture)
+	{
+		this->capture = capture;
+		this->streamId = capture ? capture->NextStreamId() : 0;
+	}
+
+	inline void OnRx(const openpal::RSlice& bytes)
+	{
+		if (capture)
+		{
+			capture->Record(streamId, CaptureDirection::Rx, rxOffset, txOffset, bytes);
+			rxOffset += bytes.Size();
+		}
+	}
+
+	inline void OnTx(const openpal::RSlice& bytes)
+	{
+		if (capture)
+		{
+			capture->Record(streamId, CaptureDirection::Tx, txOffset, rxOffset, bytes);
+			txOffset += bytes.Size();
+		}
+	}
+
+private:
+
+	std::shared_ptr<PacketCapture> capture;
+	uint16_t streamId = 0;
+	uint32_t rxOffset = 0;
+	uint32_t txOffset = 0;
+};
+
+}
+
+#endif
@@ -97,7 +97,12 @@ LinkStatistics DNP3Channel::GetStatistics()
 {
 	auto get = [this]()
 	{
-		return this->iohandler->Statistics();
+		auto statistics = this->iohandler->Statistics();
+		if (this->scheduler)
+		{
+			statistics.latency.taskQueueDelay = this->scheduler->GetQueueLatency();
+		}
+		return statistics;
 	};
 	return this->executor->ReturnFrom<LinkStatistics>(get);
 }
@@ -120,6 +125,18 @@ void DNP3Channel::SetLogFilters(const LogFilters& filters)
 	this->executor->strand.post(set);
 }
 
+void DNP3Channel::SetPacketCapture(std::shared_ptr<PacketCapture> capture)
+{
+	auto set = [self = this->shared_from_this(), capture]()
+	{
+		if (self->iohandler)
+		{
+			self->iohandler->SetPacketCapture(capture);
+		}
+	};
+	this->executor->strand.post(set);
+}
+
 std::shared_ptr<IMaster> DNP3Channel::AddMaster(const std::string& id, std::shared_ptr<ISOEHandler> SOEHandler, std::shared_ptr<IMasterApplication> application, const MasterStackConfig& config)
 {
 	auto stack = MasterStack::Create(this->logger.Detach(id), this->executor, SOEHandler, application, this->scheduler, this->iohandler, this->resources, config);
@@ -25,7 +25,7 @@
 #include "asiodnp3/IChannel.h"
 #include "asiodnp3/IOHandler.h"
 #include "asiopal/ResourceManager.h"
-#include "opendnp3/master/IMasterScheduler.h"
+#include "opendnp3/master/MasterSchedulerBackend.h"
 
 namespace asiodnp3
 {
@@ -63,6 +63,8 @@ public:
 
 	virtual void SetLogFilters(const openpal::LogFilters& filters) override;
 
+	virtual void SetPacketCapture(std::shared_ptr<PacketCapture> capture) override;
+
 	virtual std::shared_ptr<IMaster> AddMaster(const std::string& id,
 	        std::shared_ptr<opendnp3::ISOEHandler> SOEHandler,
 	        std::shared_ptr<opendnp3::IMasterApplication> application,
@@ -84,7 +86,7 @@ private:
 
 	openpal::Logger logger;
 	const std::shared_ptr<asiopal::Executor> executor;
-	std::shared_ptr<opendnp3::IMasterScheduler> scheduler;
+	std::shared_ptr<opendnp3::MasterSchedulerBackend> scheduler;
 
 	std::shared_ptr<IOHandler> iohandler;
 	std::shared_ptr<asiopal::IResourceManager> manager;
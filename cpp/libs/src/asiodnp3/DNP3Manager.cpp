@@ -29,8 +29,10 @@ DNP3Manager::DNP3Manager(
     uint32_t concurrencyHint,
     std::shared_ptr<openpal::ILogHandler> handler,
     std::function<void()> onThreadStart,
-    std::function<void()> onThreadExit) :
-	impl(std::make_unique<DNP3ManagerImpl>(concurrencyHint, handler, onThreadStart, onThreadExit))
+    std::function<void()> onThreadExit,
+    uint32_t tlsHandshakeThreads,
+    uint32_t tlsMaxConcurrentHandshakes) :
+	impl(std::make_unique<DNP3ManagerImpl>(concurrencyHint, handler, onThreadStart, onThreadExit, tlsHandshakeThreads, tlsMaxConcurrentHandshakes))
 {
 
 }
@@ -43,6 +45,26 @@ void DNP3Manager::Shutdown()
 	impl->Shutdown();
 }
 
+void DNP3Manager::SetConnectionThrottle(const asiopal::ConnectionThrottleConfig& config)
+{
+	impl->SetConnectionThrottle(config);
+}
+
+asiopal::ConnectionThrottleStatistics DNP3Manager::GetConnectionThrottleStatistics() const
+{
+	return impl->GetConnectionThrottleStatistics();
+}
+
+void DNP3Manager::SetMasterSessionPool(const MasterSessionPoolConfig& config)
+{
+	impl->SetMasterSessionPool(config);
+}
+
+MasterSessionPoolStatistics DNP3Manager::GetMasterSessionPoolStatistics() const
+{
+	return impl->GetMasterSessionPoolStatistics();
+}
+
 std::shared_ptr<IChannel> DNP3Manager::AddTCPClient(
     const std::string& id,
     int32_t levels,
@@ -87,6 +109,16 @@ std::shared_ptr<IChannel> DNP3Manager::AddSerial(
 	return this->impl->AddSerial(id, levels, retry, settings, listener);
 }
 
+std::shared_ptr<IChannel> DNP3Manager::AddLoopback(
+    const std::string& id,
+    int32_t levels,
+    const std::string& name,
+    const asiopal::LoopbackConfig& config,
+    std::shared_ptr<IChannelListener> listener)
+{
+	return this->impl->AddLoopback(id, levels, name, config, listener);
+}
+
 std::shared_ptr<IChannel> DNP3Manager::AddTLSClient(
     const std::string& id,
     int32_t levels,
@@ -138,6 +170,18 @@ std::shared_ptr<asiopal::IListener> DNP3Manager::CreateListener(
 	return impl->CreateListener(loggerid, loglevel, endpoint, callbacks, ec);
 }
 
+std::shared_ptr<asiopal::IListener> DNP3Manager::CreateListener(
+    std::string loggerid,
+    openpal::LogFilters loglevel,
+    asiopal::IPEndpoint endpoint,
+    uint32_t numAcceptors,
+    std::shared_ptr<IListenCallbacks> callbacks,
+    std::error_code& ec
+)
+{
+	return impl->CreateListener(loggerid, loglevel, endpoint, numAcceptors, callbacks, ec);
+}
+
 std::shared_ptr<asiopal::IListener> DNP3Manager::CreateListener(
     std::string loggerid,
     openpal::LogFilters loglevel,
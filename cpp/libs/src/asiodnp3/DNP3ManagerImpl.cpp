@@ -32,9 +32,11 @@
 #include "asiodnp3/ErrorCodes.h"
 #include "asiodnp3/DNP3Channel.h"
 #include "asiodnp3/MasterTCPServer.h"
+#include "asiodnp3/MasterTCPServerGroup.h"
 #include "asiodnp3/TCPClientIOHandler.h"
 #include "asiodnp3/TCPServerIOHandler.h"
 #include "asiodnp3/SerialIOHandler.h"
+#include "asiodnp3/LoopbackIOHandler.h"
 
 using namespace openpal;
 using namespace asiopal;
@@ -47,11 +49,21 @@ DNP3ManagerImpl::DNP3ManagerImpl(
     uint32_t concurrencyHint,
     std::shared_ptr<openpal::ILogHandler> handler,
     std::function<void()> onThreadStart,
-    std::function<void()> onThreadExit
+    std::function<void()> onThreadExit,
+    uint32_t tlsHandshakeThreads,
+    uint32_t tlsMaxConcurrentHandshakes
 ) :
 	logger(handler, "manager", opendnp3::levels::ALL),
 	io(std::make_shared<asiopal::IO>()),
 	threadpool(logger, io, concurrencyHint, onThreadStart, onThreadExit),
+	handshakeIO(tlsHandshakeThreads ? std::make_shared<asiopal::IO>() : nullptr),
+	handshakeThreads(tlsHandshakeThreads ? std::make_unique<asiopal::ThreadPool>(logger, handshakeIO, tlsHandshakeThreads, onThreadStart, onThreadExit) : nullptr),
+#ifdef OPENDNP3_USE_TLS
+	handshakeGate(asiopal::TLSHandshakeGate::Create(handshakeIO, tlsMaxConcurrentHandshakes)),
+#endif
+	throttle(ConnectionThrottle::Create(io)),
+	sessionPool(MasterSessionPool::Create()),
+	loopbacks(LoopbackRegistry::Create()),
 	resources(ResourceManager::Create())
 {}
 
@@ -64,11 +76,33 @@ void DNP3ManagerImpl::Shutdown()
 {
 	if (resources)
 	{
+		// release any attempts still waiting for a slot before the channels are destroyed
+		throttle->Shutdown();
 		resources->Shutdown();
 		resources.reset();
 	}
 }
 
+void DNP3ManagerImpl::SetConnectionThrottle(const asiopal::ConnectionThrottleConfig& config)
+{
+	this->throttle->Configure(config);
+}
+
+asiopal::ConnectionThrottleStatistics DNP3ManagerImpl::GetConnectionThrottleStatistics() const
+{
+	return this->throttle->GetStatistics();
+}
+
+void DNP3ManagerImpl::SetMasterSessionPool(const MasterSessionPoolConfig& config)
+{
+	this->sessionPool->Configure(config);
+}
+
+MasterSessionPoolStatistics DNP3ManagerImpl::GetMasterSessionPoolStatistics() const
+{
+	return this->sessionPool->GetStatistics();
+}
+
 std::shared_ptr<IChannel> DNP3ManagerImpl::AddTCPClient(
     const std::string& id,
 	int32_t levels,
@@ -81,7 +115,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddTCPClient(
 	{
 		auto clogger = this->logger.Detach(id, levels);
 		auto executor = Executor::Create(this->io);
-		auto iohandler = TCPClientIOHandler::Create(clogger, listener, executor, retry, IPEndpointsList(hosts), local);
+		auto iohandler = TCPClientIOHandler::Create(clogger, listener, executor, retry, IPEndpointsList(hosts), local, this->throttle);
 		return DNP3Channel::Create(clogger, executor, iohandler, this->resources);
 	};
 
@@ -126,6 +160,24 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddSerial(
 	return this->resources->Bind<IChannel>(create);
 }
 
+std::shared_ptr<IChannel> DNP3ManagerImpl::AddLoopback(
+    const std::string& id,
+    int32_t levels,
+    const std::string& name,
+    const LoopbackConfig& config,
+    std::shared_ptr<IChannelListener> listener)
+{
+	auto create = [&]() -> std::shared_ptr<IChannel>
+	{
+		auto clogger = this->logger.Detach(id, levels);
+		auto executor = Executor::Create(this->io);
+		auto iohandler = LoopbackIOHandler::Create(clogger, listener, executor, this->loopbacks, name, config);
+		return DNP3Channel::Create(clogger, executor, iohandler, this->resources);
+	};
+
+	return this->resources->Bind<IChannel>(create);
+}
+
 std::shared_ptr<IChannel> DNP3ManagerImpl::AddTLSClient(
     const std::string& id,
     int32_t levels,
@@ -142,7 +194,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddTLSClient(
 	{
 		auto clogger = this->logger.Detach(id, levels);
 		auto executor = Executor::Create(this->io);
-		auto iohandler = TLSClientIOHandler::Create(clogger, listener, executor, config, retry, hosts, local);
+		auto iohandler = TLSClientIOHandler::Create(clogger, listener, executor, this->handshakeGate, config, retry, hosts, local, this->throttle);
 		return DNP3Channel::Create(clogger, executor, iohandler, this->resources);
 	};
 
@@ -178,7 +230,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddTLSServer(
 		std::error_code ec;
 		auto clogger = this->logger.Detach(id, levels);
 		auto executor = Executor::Create(this->io);
-		auto iohandler = TLSServerIOHandler::Create(clogger, mode, listener, executor, IPEndpoint(endpoint, port), config, ec);
+		auto iohandler = TLSServerIOHandler::Create(clogger, mode, listener, executor, this->handshakeGate, IPEndpoint(endpoint, port), config, ec);
 		return ec ? nullptr : DNP3Channel::Create(clogger, executor, iohandler, this->resources);
 	};
 
@@ -211,8 +263,10 @@ std::shared_ptr<asiopal::IListener> DNP3ManagerImpl::CreateListener(
 		    this->logger.Detach(loggerid, levels),
 		    asiopal::Executor::Create(this->io),
 		    endpoint,
+		    asiopal::AcceptorShard(),
 		    callbacks,
 		    this->resources,
+		    this->sessionPool,
 		    ec
 		);
 	};
@@ -227,6 +281,43 @@ std::shared_ptr<asiopal::IListener> DNP3ManagerImpl::CreateListener(
 	return listener;
 }
 
+std::shared_ptr<asiopal::IListener> DNP3ManagerImpl::CreateListener(
+    std::string loggerid,
+    openpal::LogFilters levels,
+    asiopal::IPEndpoint endpoint,
+    uint32_t numAcceptors,
+    const std::shared_ptr<IListenCallbacks>& callbacks,
+    std::error_code& ec)
+{
+	if (numAcceptors <= 1)
+	{
+		return this->CreateListener(loggerid, levels, endpoint, callbacks, ec);
+	}
+
+	auto create = [&]() -> std::shared_ptr<asiopal::IListener>
+	{
+		return MasterTCPServerGroup::Create(
+		    this->logger.Detach(loggerid, levels),
+		    this->io,
+		    endpoint,
+		    numAcceptors,
+		    callbacks,
+		    this->resources,
+		    this->sessionPool,
+		    ec
+		);
+	};
+
+	auto listener = this->resources->Bind<asiopal::IListener>(create);
+
+	if (!listener && !ec)
+	{
+		ec = Error::SHUTTING_DOWN;
+	}
+
+	return listener;
+}
+
 std::shared_ptr<asiopal::IListener> DNP3ManagerImpl::CreateListener(
     std::string loggerid,
     openpal::LogFilters levels,
@@ -243,10 +334,12 @@ std::shared_ptr<asiopal::IListener> DNP3ManagerImpl::CreateListener(
 		return asiodnp3::MasterTLSServer::Create(
 		    this->logger.Detach(loggerid, levels),
 		    asiopal::Executor::Create(this->io),
+		    this->handshakeGate,
 		    endpoint,
 		    config,
 		    callbacks,
 		    this->resources,
+		    this->sessionPool,
 		    ec
 		);
 	};
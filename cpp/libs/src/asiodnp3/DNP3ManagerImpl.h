@@ -26,6 +26,10 @@
 #include "openpal/util/Uncopyable.h"
 
 #include "asiopal/ThreadPool.h"
+#include "asiopal/ConnectionThrottle.h"
+
+#include "asiodnp3/LoopbackRegistry.h"
+#include "asiodnp3/MasterSessionPool.h"
 #include "asiopal/SerialTypes.h"
 #include "asiopal/TLSConfig.h"
 #include "asiopal/ChannelRetry.h"
@@ -40,6 +44,11 @@
 #include "asiodnp3/IChannelListener.h"
 #include "asiodnp3/IListenCallbacks.h"
 
+namespace asiopal
+{
+// only defined when built with TLS support
+class TLSHandshakeGate;
+}
 
 namespace asiodnp3
 {
@@ -53,13 +62,23 @@ public:
 	    uint32_t concurrencyHint,
 	    std::shared_ptr<openpal::ILogHandler> handler,
 	    std::function<void()> onThreadStart,
-	    std::function<void()> onThreadExit
+	    std::function<void()> onThreadExit,
+	    uint32_t tlsHandshakeThreads,
+	    uint32_t tlsMaxConcurrentHandshakes
 	);
 
 	~DNP3ManagerImpl();
 
 	void Shutdown();
 
+	void SetConnectionThrottle(const asiopal::ConnectionThrottleConfig& config);
+
+	asiopal::ConnectionThrottleStatistics GetConnectionThrottleStatistics() const;
+
+	void SetMasterSessionPool(const MasterSessionPoolConfig& config);
+
+	MasterSessionPoolStatistics GetMasterSessionPoolStatistics() const;
+
 	std::shared_ptr<IChannel> AddTCPClient(
 	    const std::string& id,
 	    int32_t levels,
@@ -83,6 +102,13 @@ public:
 	    asiopal::SerialSettings settings,
 	    std::shared_ptr<IChannelListener> listener);
 
+	std::shared_ptr<IChannel> AddLoopback(
+	    const std::string& id,
+	    int32_t levels,
+	    const std::string& name,
+	    const asiopal::LoopbackConfig& config,
+	    std::shared_ptr<IChannelListener> listener);
+
 	std::shared_ptr<IChannel> AddTLSClient(
 	    const std::string& id,
 		int32_t levels,
@@ -111,6 +137,15 @@ public:
 	    std::error_code& ec
 	);
 
+	std::shared_ptr<asiopal::IListener> CreateListener(
+	    std::string loggerid,
+	    openpal::LogFilters loglevel,
+	    asiopal::IPEndpoint endpoint,
+	    uint32_t numAcceptors,
+	    const std::shared_ptr<IListenCallbacks>& callbacks,
+	    std::error_code& ec
+	);
+
 	std::shared_ptr<asiopal::IListener> CreateListener(
 	    std::string loggerid,
 	    openpal::LogFilters loglevel,
@@ -124,6 +159,23 @@ private:
 	openpal::Logger logger;
 	const std::shared_ptr<asiopal::IO> io;
 	asiopal::ThreadPool threadpool;
+
+	// optional io_context and threads dedicated to TLS handshakes
+	const std::shared_ptr<asiopal::IO> handshakeIO;
+	std::unique_ptr<asiopal::ThreadPool> handshakeThreads;
+
+	// admission control shared by every TLS client and server, nullptr without TLS support
+	const std::shared_ptr<asiopal::TLSHandshakeGate> handshakeGate;
+
+	// shared by all of the client channels
+	const std::shared_ptr<asiopal::ConnectionThrottle> throttle;
+
+	// shared by the sessions of all of the master listeners
+	const std::shared_ptr<MasterSessionPool> sessionPool;
+
+	// pairs up loopback channels by name
+	const std::shared_ptr<LoopbackRegistry> loopbacks;
+
 	std::shared_ptr<asiopal::ResourceManager> resources;
 
 };
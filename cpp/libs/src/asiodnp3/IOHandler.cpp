@@ -72,6 +72,14 @@ void IOHandler::OnReadComplete(const std::error_code& ec, size_t num)
 	{
 		this->statistics.numBytesRx += static_cast<uint32_t>(num);
 
+		this->tap.OnRx(this->parser.WriteBuff().ToRSlice().Take(static_cast<uint32_t>(num)));
+
+		this->readTime = asiopal::steady_clock_t::now();
+		if (!this->parser.HasPartialFrame())
+		{
+			this->frameRxStart = this->readTime;
+		}
+
 		this->parser.OnRead(static_cast<uint32_t>(num), *this);
 		this->BeginRead();
 	}
@@ -253,6 +261,10 @@ void IOHandler::OnNewChannel(const std::shared_ptr<asiopal::IAsyncChannel>& chan
 
 bool IOHandler::OnFrame(const LinkHeaderFields& header, const openpal::RSlice& userdata)
 {
+	this->latency.frameRx.Record(std::chrono::duration_cast<std::chrono::microseconds>(this->readTime - this->frameRxStart).count());
+	// any frame that follows in the same read started arriving with it
+	this->frameRxStart = this->readTime;
+
 	if (this->SendToSession(Route(header.src, header.dest), header, userdata))
 	{
 		return true;
@@ -274,6 +286,7 @@ void IOHandler::CheckForSend()
 	if (this->txQueue.empty() || !this->channel || !this->channel->CanWrite()) return;
 
 	++statistics.numLinkFrameTx;
+	this->tap.OnTx(this->txQueue.front().txdata);
 	this->channel->BeginWrite(this->txQueue.front().txdata);
 }
 
@@ -26,10 +26,12 @@
 #include "opendnp3/link/LinkLayerParser.h"
 
 #include "asiodnp3/IChannelListener.h"
+#include "asiodnp3/CaptureTap.h"
 
 #include "openpal/logging/Logger.h"
 
 #include "asiopal/IAsyncChannel.h"
+#include "asiopal/SteadyClock.h"
 
 #include <vector>
 #include <deque>
@@ -57,11 +59,17 @@ public:
 
 	opendnp3::LinkStatistics Statistics() const
 	{
-		return opendnp3::LinkStatistics(this->statistics, this->parser.Statistics());
+		return opendnp3::LinkStatistics(this->statistics, this->parser.Statistics(), this->latency);
 	}
 
 	void Shutdown();
 
+	// Begin or stop (nullptr) copying the raw bytes of the channel into a packet capture
+	void SetPacketCapture(const std::shared_ptr<PacketCapture>& capture)
+	{
+		this->tap.Set(capture);
+	}
+
 	/// --- implement ILinkTx ---
 
 	void BeginTransmit(const std::shared_ptr<opendnp3::ILinkSession>& session, const openpal::RSlice& data);
@@ -110,6 +118,7 @@ protected:
 	openpal::Logger logger;
 	const std::shared_ptr<IChannelListener> listener;
 	opendnp3::LinkStatistics::Channel statistics;
+	opendnp3::LinkStatistics::Latency latency;
 
 private:
 
@@ -210,6 +219,11 @@ private:
 	std::deque<Transmission>  txQueue;
 
 	opendnp3::LinkLayerParser parser;
+	CaptureTap tap;
+
+	// completion time of the current read and of the read that started the frame being parsed
+	asiopal::steady_clock_t::time_point readTime;
+	asiopal::steady_clock_t::time_point frameRxStart;
 
 	// current value of the channel, may be empty
 	std::shared_ptr<asiopal::IAsyncChannel> channel;
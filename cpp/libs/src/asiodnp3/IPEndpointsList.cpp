@@ -44,6 +44,11 @@ const asiopal::IPEndpoint& IPEndpointsList::GetCurrentEndpoint()
 	return *this->currentEndpoint;
 }
 
+const std::vector<asiopal::IPEndpoint>& IPEndpointsList::GetEndpoints() const
+{
+	return this->endpoints;
+}
+
 void IPEndpointsList::Next()
 {
 	++this->currentEndpoint;
@@ -36,6 +36,7 @@ public:
 	~IPEndpointsList() = default;
 
 	const asiopal::IPEndpoint& GetCurrentEndpoint();
+	const std::vector<asiopal::IPEndpoint>& GetEndpoints() const;
 	void Next();
 	void Reset();
 
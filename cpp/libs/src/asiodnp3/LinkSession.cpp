@@ -39,11 +39,13 @@ LinkSession::LinkSession(
     uint64_t sessionid,
     const std::shared_ptr<IResourceManager>& manager,
     const std::shared_ptr<IListenCallbacks>& callbacks,
-    const std::shared_ptr<asiopal::IAsyncChannel>& channel) :
+    const std::shared_ptr<asiopal::IAsyncChannel>& channel,
+    const std::shared_ptr<MasterSessionPool>& pool) :
 	logger(logger),
 	session_id(sessionid),
 	manager(manager),
 	callbacks(callbacks),
+	pool(pool),
 	channel(channel),
 	parser(logger),
 	first_frame_timer(*channel->executor)
@@ -92,6 +94,11 @@ void LinkSession::SetLogFilters(openpal::LogFilters filters)
 	this->logger.SetFilters(filters);
 }
 
+void LinkSession::SetPacketCapture(const std::shared_ptr<PacketCapture>& capture)
+{
+	this->tap.Set(capture);
+}
+
 void LinkSession::OnReadComplete(const std::error_code& ec, size_t num)
 {
 	if (ec)
@@ -101,6 +108,7 @@ void LinkSession::OnReadComplete(const std::error_code& ec, size_t num)
 	}
 	else
 	{
+		this->tap.OnRx(this->parser.WriteBuff().ToRSlice().Take(static_cast<uint32_t>(num)));
 		this->parser.OnRead(static_cast<uint32_t>(num), *this);
 		this->BeginReceive();
 	}
@@ -121,6 +129,7 @@ void LinkSession::OnWriteComplete(const std::error_code& ec, size_t num)
 
 void LinkSession::BeginTransmit(const openpal::RSlice& buffer, opendnp3::ILinkSession& session)
 {
+	this->tap.OnTx(buffer);
 	this->channel->BeginWrite(buffer);
 }
 
@@ -168,6 +177,9 @@ std::shared_ptr<IMasterSession> LinkSession::AcceptSession(
 	// rename the logger id to something meaningful
 	this->logger.Rename(loggerid);
 
+	// recycled fragment buffers if the pool is enabled for this configuration
+	const auto buffers = this->pool ? this->pool->CheckOut(config.master.maxRxFragSize, config.master.maxTxFragSize) : MasterSessionPool::Buffers();
+
 	this->stack = MasterSessionStack::Create(
 	                  this->logger,
 	                  this->channel->executor,
@@ -176,7 +188,8 @@ std::shared_ptr<IMasterSession> LinkSession::AcceptSession(
 	                  std::make_shared<MasterSchedulerBackend>(this->channel->executor),
 	                  shared_from_this(),
 	                  *this,
-	                  config
+	                  config,
+	                  buffers
 	              );
 
 	return stack;
@@ -36,6 +36,7 @@
 
 #include "asiodnp3/MasterSessionStack.h"
 #include "asiodnp3/IListenCallbacks.h"
+#include "asiodnp3/CaptureTap.h"
 
 namespace asiodnp3
 {
@@ -55,9 +56,10 @@ public:
 	    uint64_t sessionid,
 	    const std::shared_ptr<asiopal::IResourceManager>& manager,
 	    const std::shared_ptr<IListenCallbacks>& callbacks,
-	    const std::shared_ptr<asiopal::IAsyncChannel>& channel)
+	    const std::shared_ptr<asiopal::IAsyncChannel>& channel,
+	    const std::shared_ptr<MasterSessionPool>& pool = nullptr)
 	{
-		auto session = std::make_shared<LinkSession>(logger, sessionid, manager, callbacks, channel);
+		auto session = std::make_shared<LinkSession>(logger, sessionid, manager, callbacks, channel, pool);
 
 		session->Start();
 
@@ -69,7 +71,8 @@ public:
 	    uint64_t sessionid,
 	    const std::shared_ptr<asiopal::IResourceManager>& manager,
 	    const std::shared_ptr<IListenCallbacks>& callbacks,
-	    const std::shared_ptr<asiopal::IAsyncChannel>& channel
+	    const std::shared_ptr<asiopal::IAsyncChannel>& channel,
+	    const std::shared_ptr<MasterSessionPool>& pool
 	);
 
 	// override IResource
@@ -77,6 +80,8 @@ public:
 
 	void SetLogFilters(openpal::LogFilters filters);
 
+	void SetPacketCapture(const std::shared_ptr<PacketCapture>& capture);
+
 private:
 
 	void ShutdownImpl();
@@ -109,9 +114,11 @@ private:
 
 	const std::shared_ptr<asiopal::IResourceManager> manager;
 	const std::shared_ptr<IListenCallbacks> callbacks;
+	const std::shared_ptr<MasterSessionPool> pool;
 	const std::shared_ptr<asiopal::IAsyncChannel> channel;
 
 	opendnp3::LinkLayerParser parser;
+	CaptureTap tap;
 	openpal::TimerRef first_frame_timer;
 	opendnp3::Route route;
 
@@ -0,0 +1,57 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiodnp3/LogRing.h"
+
+#include <cstring>
+
+using namespace openpal;
+
+namespace asiodnp3
+{
+
+bool LogRing::TryPush(const LogEntry& entry, int64_t milliseconds, bool copyLocation)
+{
+	auto fill = [&](LogRecord & record)
+	{
+		record.milliseconds = milliseconds;
+		record.filters = entry.filters.GetBitfield();
+		CopyTruncated(record.loggerid, LogRecord::MAX_ID_SIZE, entry.loggerid);
+		CopyTruncated(record.location, LogRecord::MAX_LOCATION_SIZE, copyLocation ? entry.location : nullptr);
+		CopyTruncated(record.message, LogRecord::MAX_MESSAGE_SIZE, entry.message);
+	};
+
+	return this->TryProduce(fill);
+}
+
+void LogRing::CopyTruncated(char* dest, size_t size, const char* src)
+{
+	if (!src)
+	{
+		dest[0] = '\0';
+		return;
+	}
+
+	const auto length = strnlen(src, size - 1);
+	memcpy(dest, src, length);
+	dest[length] = '\0';
+}
+
+}
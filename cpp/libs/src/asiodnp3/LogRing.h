@@ -0,0 +1,75 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_LOGRING_H
+#define ASIODNP3_LOGRING_H
+
+#include "openpal/logging/LogEntry.h"
+
+#include "asiodnp3/SlotRing.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace asiodnp3
+{
+
+/**
+* A log entry copied out of the caller's stack frame so that it can be formatted later
+*/
+struct LogRecord
+{
+	static const size_t MAX_ID_SIZE = 64;
+	static const size_t MAX_LOCATION_SIZE = 128;
+	static const size_t MAX_MESSAGE_SIZE = 256;
+
+	int64_t milliseconds;
+	int32_t filters;
+	char loggerid[MAX_ID_SIZE];
+	char location[MAX_LOCATION_SIZE];
+	char message[MAX_MESSAGE_SIZE];
+};
+
+/**
+* Ring of log records shared by all threads that log to an AsyncLogger
+*/
+class LogRing final : public SlotRing<LogRecord>
+{
+
+public:
+
+	explicit LogRing(uint32_t capacity) : SlotRing<LogRecord>(capacity)
+	{}
+
+	/**
+	* Copy an entry into the next free slot. Callable from any thread.
+	*
+	* @return false if the ring is full
+	*/
+	bool TryPush(const openpal::LogEntry& entry, int64_t milliseconds, bool copyLocation);
+
+private:
+
+	static void CopyTruncated(char* dest, size_t size, const char* src);
+};
+
+}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiodnp3/LoopbackIOHandler.h"
+
+#include "openpal/logging/LogMacros.h"
+#include "opendnp3/LogLevels.h"
+
+namespace asiodnp3
+{
+
+LoopbackIOHandler::LoopbackIOHandler(
+    const openpal::Logger& logger,
+    const std::shared_ptr<IChannelListener>& listener,
+    const std::shared_ptr<asiopal::Executor>& executor,
+    const std::shared_ptr<LoopbackRegistry>& registry,
+    const std::string& name,
+    const asiopal::LoopbackConfig& config
+) :
+	IOHandler(logger, false, listener),
+	executor(executor),
+	registry(registry),
+	name(name),
+	config(config)
+{}
+
+void LoopbackIOHandler::ShutdownImpl()
+{
+	this->SuspendChannelAccept();
+}
+
+void LoopbackIOHandler::BeginChannelAccept()
+{
+	if (this->accepting) return;
+
+	this->accepting = true;
+	const auto offer = ++this->offer;
+
+	FORMAT_LOG_BLOCK(this->logger, openpal::logflags::INFO, "Waiting for loopback peer: %s", this->name.c_str());
+
+	auto callback = [self = std::static_pointer_cast<LoopbackIOHandler>(shared_from_this()), offer](const std::shared_ptr<asiopal::IAsyncChannel>& channel)
+	{
+		self->OnPeerConnected(offer, channel);
+	};
+
+	this->registry->Connect(this->name, this, this->executor, this->config, callback);
+}
+
+void LoopbackIOHandler::SuspendChannelAccept()
+{
+	this->accepting = false;
+	this->registry->Cancel(this->name, this);
+}
+
+void LoopbackIOHandler::OnChannelShutdown()
+{
+	this->accepting = false;
+	this->BeginChannelAccept();
+}
+
+void LoopbackIOHandler::OnPeerConnected(uint32_t offer, const std::shared_ptr<asiopal::IAsyncChannel>& channel)
+{
+	if (!this->accepting || offer != this->offer)
+	{
+		// the offer was withdrawn after the peer connected, the peer will see the link close
+		channel->Shutdown();
+		return;
+	}
+
+	this->accepting = false;
+
+	FORMAT_LOG_BLOCK(this->logger, openpal::logflags::INFO, "Connected to loopback peer: %s", this->name.c_str());
+
+	this->OnNewChannel(channel);
+}
+
+}
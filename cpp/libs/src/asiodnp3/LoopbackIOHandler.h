@@ -0,0 +1,82 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_LOOPBACKIOHANDLER_H
+#define ASIODNP3_LOOPBACKIOHANDLER_H
+
+#include "asiodnp3/IOHandler.h"
+#include "asiodnp3/LoopbackRegistry.h"
+
+#include "asiopal/LoopbackTypes.h"
+
+namespace asiodnp3
+{
+
+class LoopbackIOHandler final : public IOHandler
+{
+
+public:
+
+	static std::shared_ptr<LoopbackIOHandler> Create(
+	    const openpal::Logger& logger,
+	    const std::shared_ptr<IChannelListener>& listener,
+	    const std::shared_ptr<asiopal::Executor>& executor,
+	    const std::shared_ptr<LoopbackRegistry>& registry,
+	    const std::string& name,
+	    const asiopal::LoopbackConfig& config)
+	{
+		return std::make_shared<LoopbackIOHandler>(logger, listener, executor, registry, name, config);
+	}
+
+	LoopbackIOHandler(
+	    const openpal::Logger& logger,
+	    const std::shared_ptr<IChannelListener>& listener,
+	    const std::shared_ptr<asiopal::Executor>& executor,
+	    const std::shared_ptr<LoopbackRegistry>& registry,
+	    const std::string& name,
+	    const asiopal::LoopbackConfig& config
+	);
+
+protected:
+
+	virtual void ShutdownImpl() override;
+	virtual void BeginChannelAccept() override;
+	virtual void SuspendChannelAccept() override;
+	virtual void OnChannelShutdown() override;
+
+private:
+
+	void OnPeerConnected(uint32_t offer, const std::shared_ptr<asiopal::IAsyncChannel>& channel);
+
+	const std::shared_ptr<asiopal::Executor> executor;
+	const std::shared_ptr<LoopbackRegistry> registry;
+	const std::string name;
+	const asiopal::LoopbackConfig config;
+
+	// true while an offer is registered and the handler wants a channel
+	bool accepting = false;
+
+	// identifies the current offer so that a peer matched to a withdrawn offer is ignored
+	uint32_t offer = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,74 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiodnp3/LoopbackRegistry.h"
+
+#include "asiopal/LoopbackChannel.h"
+
+using namespace asiopal;
+
+namespace asiodnp3
+{
+
+void LoopbackRegistry::Connect(const std::string& name, const void* owner, const std::shared_ptr<Executor>& executor, const LoopbackConfig& config, const callback_t& callback)
+{
+	Waiter peer;
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		auto iter = this->waiters.find(name);
+		if (iter == this->waiters.end() || iter->second.owner == owner)
+		{
+			this->waiters[name] = Waiter{ owner, executor, config, callback };
+			return;
+		}
+
+		peer = iter->second;
+		this->waiters.erase(iter);
+	}
+
+	auto channels = LoopbackChannel::CreatePair(peer.executor, peer.config, executor, config);
+
+	auto first = channels.first;
+	auto onFirst = peer.callback;
+	peer.executor->strand.post([first, onFirst]()
+	{
+		onFirst(first);
+	});
+
+	auto second = channels.second;
+	executor->strand.post([second, callback]()
+	{
+		callback(second);
+	});
+}
+
+void LoopbackRegistry::Cancel(const std::string& name, const void* owner)
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	auto iter = this->waiters.find(name);
+	if (iter != this->waiters.end() && iter->second.owner == owner)
+	{
+		this->waiters.erase(iter);
+	}
+}
+
+}
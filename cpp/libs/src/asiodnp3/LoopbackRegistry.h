@@ -0,0 +1,87 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_LOOPBACKREGISTRY_H
+#define ASIODNP3_LOOPBACKREGISTRY_H
+
+#include "asiopal/Executor.h"
+#include "asiopal/IAsyncChannel.h"
+#include "asiopal/LoopbackTypes.h"
+
+#include <openpal/util/Uncopyable.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace asiodnp3
+{
+
+/**
+* Pairs up loopback channels by name. The first end to connect waits until a second end with
+* the same name connects, after which each receives its side of a new loopback link.
+*/
+class LoopbackRegistry final : private openpal::Uncopyable
+{
+
+public:
+
+	typedef std::function<void(const std::shared_ptr<asiopal::IAsyncChannel>&)> callback_t;
+
+	static std::shared_ptr<LoopbackRegistry> Create()
+	{
+		return std::make_shared<LoopbackRegistry>();
+	}
+
+	/**
+	* Offer one end of a named link
+	*
+	* @param name name shared by both ends of the link
+	* @param owner identifies the end so that the offer can be cancelled
+	* @param executor executor on which the callback is invoked and the channel completes its operations
+	* @param config shaping of the data written by this end
+	* @param callback receives the channel once the other end connects
+	*/
+	void Connect(const std::string& name, const void* owner, const std::shared_ptr<asiopal::Executor>& executor, const asiopal::LoopbackConfig& config, const callback_t& callback);
+
+	/**
+	* Withdraw a pending offer, if any
+	*/
+	void Cancel(const std::string& name, const void* owner);
+
+private:
+
+	struct Waiter
+	{
+		const void* owner = nullptr;
+		std::shared_ptr<asiopal::Executor> executor;
+		asiopal::LoopbackConfig config;
+		callback_t callback;
+	};
+
+	std::mutex mutex;
+	std::map<std::string, Waiter> waiters;
+};
+
+}
+
+#endif
@@ -0,0 +1,143 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiodnp3/MasterSessionPool.h"
+
+#include <algorithm>
+
+namespace asiodnp3
+{
+
+void MasterSessionPool::Configure(const MasterSessionPoolConfig& config)
+{
+	std::vector<std::unique_ptr<openpal::Buffer>> released;
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	this->config = config;
+
+	for (auto direction : { Direction::Rx, Direction::Tx })
+	{
+		auto& free = this->GetFree(direction);
+		const auto size = this->GetSize(direction);
+
+		// buffers of the old size are released outside the lock
+		auto stale = std::stable_partition(free.begin(), free.end(), [size](const std::unique_ptr<openpal::Buffer>& buffer)
+		{
+			return buffer->Size() == size;
+		});
+		std::move(stale, free.end(), std::back_inserter(released));
+		free.erase(stale, free.end());
+
+		while (free.size() > config.numSessions)
+		{
+			released.push_back(std::move(free.back()));
+			free.pop_back();
+		}
+
+		while (free.size() < config.numSessions)
+		{
+			free.push_back(std::make_unique<openpal::Buffer>(size));
+		}
+	}
+}
+
+MasterSessionPool::Buffers MasterSessionPool::CheckOut(uint32_t maxRxFragSize, uint32_t maxTxFragSize)
+{
+	std::unique_ptr<openpal::Buffer> rx;
+	std::unique_ptr<openpal::Buffer> tx;
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		if (this->config.numSessions == 0 || maxRxFragSize != this->config.maxRxFragSize || maxTxFragSize != this->config.maxTxFragSize)
+		{
+			return Buffers();
+		}
+
+		if (!this->rxFree.empty() && !this->txFree.empty())
+		{
+			rx = std::move(this->rxFree.back());
+			this->rxFree.pop_back();
+			tx = std::move(this->txFree.back());
+			this->txFree.pop_back();
+			++this->statistics.numReused;
+		}
+		else
+		{
+			++this->statistics.numAllocated;
+		}
+
+		++this->statistics.numCheckedOut;
+	}
+
+	// the pool grows to the demand, the extra buffers are released when they return to a full pool
+	if (!rx)
+	{
+		rx = std::make_unique<openpal::Buffer>(maxRxFragSize);
+		tx = std::make_unique<openpal::Buffer>(maxTxFragSize);
+	}
+
+	return Buffers { this->Lease(std::move(rx), Direction::Rx), this->Lease(std::move(tx), Direction::Tx) };
+}
+
+MasterSessionPoolStatistics MasterSessionPool::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+	auto statistics = this->statistics;
+	statistics.numAvailable = static_cast<uint32_t>(std::min(this->rxFree.size(), this->txFree.size()));
+	return statistics;
+}
+
+std::shared_ptr<openpal::Buffer> MasterSessionPool::Lease(std::unique_ptr<openpal::Buffer> buffer, Direction direction)
+{
+	std::weak_ptr<MasterSessionPool> weak = this->shared_from_this();
+
+	return std::shared_ptr<openpal::Buffer>(buffer.release(), [weak, direction](openpal::Buffer * buffer)
+	{
+		std::unique_ptr<openpal::Buffer> owned(buffer);
+
+		auto pool = weak.lock();
+		if (pool)
+		{
+			pool->Return(std::move(owned), direction);
+		}
+	});
+}
+
+void MasterSessionPool::Return(std::unique_ptr<openpal::Buffer> buffer, Direction direction)
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	// a session holds one buffer of each direction
+	if (direction == Direction::Rx && this->statistics.numCheckedOut > 0)
+	{
+		--this->statistics.numCheckedOut;
+	}
+
+	auto& free = this->GetFree(direction);
+
+	if (buffer->Size() == this->GetSize(direction) && free.size() < this->config.numSessions)
+	{
+		free.push_back(std::move(buffer));
+	}
+}
+
+}
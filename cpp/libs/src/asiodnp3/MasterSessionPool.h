@@ -0,0 +1,99 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_MASTERSESSIONPOOL_H
+#define ASIODNP3_MASTERSESSIONPOOL_H
+
+#include "asiodnp3/MasterSessionPoolTypes.h"
+
+#include <openpal/container/Buffer.h>
+#include <openpal/util/Uncopyable.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace asiodnp3
+{
+
+/**
+* Pre-allocated receive / transmit fragment buffers that master sessions check out when they
+* are accepted and that return to the pool when the session stack is destroyed.
+*
+* Thread-safe: sessions on different strands check out and return buffers concurrently.
+*/
+class MasterSessionPool final : public std::enable_shared_from_this<MasterSessionPool>, private openpal::Uncopyable
+{
+
+public:
+
+	struct Buffers
+	{
+		std::shared_ptr<openpal::Buffer> rx;
+		std::shared_ptr<openpal::Buffer> tx;
+	};
+
+	static std::shared_ptr<MasterSessionPool> Create()
+	{
+		return std::make_shared<MasterSessionPool>();
+	}
+
+	/// Change the configuration, allocating buffers up front and releasing any of a different size
+	void Configure(const MasterSessionPoolConfig& config);
+
+	/// Returns empty buffers if the pool is disabled or the sizes differ from the configuration
+	Buffers CheckOut(uint32_t maxRxFragSize, uint32_t maxTxFragSize);
+
+	MasterSessionPoolStatistics GetStatistics() const;
+
+private:
+
+	enum class Direction
+	{
+		Rx,
+		Tx
+	};
+
+	std::shared_ptr<openpal::Buffer> Lease(std::unique_ptr<openpal::Buffer> buffer, Direction direction);
+
+	void Return(std::unique_ptr<openpal::Buffer> buffer, Direction direction);
+
+	std::vector<std::unique_ptr<openpal::Buffer>>& GetFree(Direction direction)
+	{
+		return (direction == Direction::Rx) ? rxFree : txFree;
+	}
+
+	uint32_t GetSize(Direction direction) const
+	{
+		return (direction == Direction::Rx) ? config.maxRxFragSize : config.maxTxFragSize;
+	}
+
+	mutable std::mutex mutex;
+
+	MasterSessionPoolConfig config;
+	MasterSessionPoolStatistics statistics;
+
+	std::vector<std::unique_ptr<openpal::Buffer>> rxFree;
+	std::vector<std::unique_ptr<openpal::Buffer>> txFree;
+};
+
+}
+
+#endif
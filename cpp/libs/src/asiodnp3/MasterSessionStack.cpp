@@ -37,10 +37,11 @@ std::shared_ptr<MasterSessionStack> MasterSessionStack::Create(
     const std::shared_ptr<opendnp3::IMasterScheduler>& scheduler,
     const std::shared_ptr<LinkSession>& session,
     opendnp3::ILinkTx& linktx,
-    const MasterStackConfig& config
+    const MasterStackConfig& config,
+    const MasterSessionPool::Buffers& buffers
 )
 {
-	return std::make_shared<MasterSessionStack>(logger, executor, SOEHandler, application, scheduler, session, linktx, config);
+	return std::make_shared<MasterSessionStack>(logger, executor, SOEHandler, application, scheduler, session, linktx, config, buffers);
 }
 
 MasterSessionStack::MasterSessionStack(
@@ -51,13 +52,14 @@ MasterSessionStack::MasterSessionStack(
     const std::shared_ptr<opendnp3::IMasterScheduler>& scheduler,
     const std::shared_ptr<LinkSession>& session,
     opendnp3::ILinkTx& linktx,
-    const MasterStackConfig& config
+    const MasterStackConfig& config,
+    const MasterSessionPool::Buffers& buffers
 ) :
 	executor(executor),
 	scheduler(scheduler),
 	session(session),
-	stack(logger, executor, application, config.master.maxRxFragSize, LinkLayerConfig(config.link, false)),
-	context(Addresses(config.link.LocalAddr, config.link.RemoteAddr), logger, executor, stack.transport, SOEHandler, application, scheduler, config.master)
+	stack(logger, executor, application, buffers.rx ? buffers.rx : std::make_shared<openpal::Buffer>(config.master.maxRxFragSize), LinkLayerConfig(config.link, false)),
+	context(Addresses(config.link.LocalAddr, config.link.RemoteAddr), logger, executor, stack.transport, SOEHandler, application, scheduler, config.master, buffers.tx)
 {
 	stack.link->SetRouter(linktx);
 	stack.transport->SetAppLayer(context);
@@ -93,6 +95,19 @@ void MasterSessionStack::SetLogFilters(const openpal::LogFilters& filters)
 	this->executor->strand.post(set);
 }
 
+void MasterSessionStack::SetPacketCapture(std::shared_ptr<PacketCapture> capture)
+{
+	auto set = [this, capture]()
+	{
+		if (this->session)
+		{
+			this->session->SetPacketCapture(capture);
+		}
+	};
+
+	this->executor->strand.post(set);
+}
+
 void MasterSessionStack::BeginShutdown()
 {
 	auto shutdown = [this]()
@@ -223,7 +238,7 @@ void MasterSessionStack::DirectOperate(CommandSet&& commands, const CommandCallb
 
 opendnp3::StackStatistics MasterSessionStack::CreateStatistics() const
 {
-	return opendnp3::StackStatistics(this->stack.link->GetStatistics(), this->stack.transport->GetStatistics());
+	return opendnp3::StackStatistics(this->stack.link->GetStatistics(), this->stack.transport->GetStatistics(), this->context.latency);
 }
 
 }
@@ -27,6 +27,7 @@
 #include "asiodnp3/IMasterSession.h"
 #include "asiodnp3/MasterStackConfig.h"
 #include "asiodnp3/MasterScan.h"
+#include "asiodnp3/MasterSessionPool.h"
 
 namespace asiopal
 {
@@ -53,7 +54,8 @@ public:
 	    const std::shared_ptr<opendnp3::IMasterScheduler>& scheduler,
 	    const std::shared_ptr<LinkSession>& session,
 	    opendnp3::ILinkTx& linktx,
-	    const MasterStackConfig& config
+	    const MasterStackConfig& config,
+	    const MasterSessionPool::Buffers& buffers = MasterSessionPool::Buffers()
 	);
 
 	void OnLowerLayerUp();
@@ -71,6 +73,8 @@ public:
 
 	virtual void BeginShutdown() override;
 
+	virtual void SetPacketCapture(std::shared_ptr<PacketCapture> capture) override;
+
 	/// --- ICommandOperations ---
 
 	virtual opendnp3::StackStatistics GetStackStatistics() override;
@@ -99,7 +103,8 @@ public:
 	    const std::shared_ptr<opendnp3::IMasterScheduler>& scheduler,
 	    const std::shared_ptr<LinkSession>& session,
 	    opendnp3::ILinkTx& linktx,
-	    const MasterStackConfig& config
+	    const MasterStackConfig& config,
+	    const MasterSessionPool::Buffers& buffers
 	);
 
 private:
@@ -70,7 +70,7 @@ StackStatistics MasterStack::GetStackStatistics()
 {
 	auto get = [self = shared_from_this()]() -> StackStatistics
 	{
-		return self->CreateStatistics();
+		return self->CreateStatistics(self->mcontext.latency);
 	};
 	return this->executor->ReturnFrom<StackStatistics>(get);
 }
@@ -28,8 +28,6 @@
 
 #include "asiopal/SocketChannel.h"
 
-#include <sstream>
-
 using namespace opendnp3;
 using namespace openpal;
 using namespace asiopal;
@@ -41,41 +39,50 @@ MasterTCPServer::MasterTCPServer(
     const openpal::Logger& logger,
     const std::shared_ptr<asiopal::Executor>& executor,
     const asiopal::IPEndpoint& endpoint,
+    const asiopal::AcceptorShard& shard,
     const std::shared_ptr<IListenCallbacks>& callbacks,
     const std::shared_ptr<asiopal::ResourceManager>& manager,
+    const std::shared_ptr<MasterSessionPool>& pool,
     std::error_code& ec
 ) :
-	TCPServer(logger, executor, endpoint, ec),
+	TCPServer(logger, executor, endpoint, shard, ec),
 	callbacks(callbacks),
-	manager(manager)
+	manager(manager),
+	pool(pool),
+	isGroupMember(shard.IsShared())
 {
 
 }
 
 void MasterTCPServer::OnShutdown()
 {
-	this->manager->Detach(this->shared_from_this());
+	// acceptors in a group were never bound to the manager, the group detaches itself
+	if (!this->isGroupMember)
+	{
+		this->manager->Detach(this->shared_from_this());
+	}
 }
 
-void MasterTCPServer::AcceptConnection(uint64_t sessionid, const std::shared_ptr<asiopal::Executor>& executor, asio::ip::tcp::socket socket)
+void MasterTCPServer::AcceptConnection(uint64_t sessionid, const std::shared_ptr<asiopal::Executor>& executor, asio::ip::tcp::socket socket, const asio::ip::tcp::endpoint& remote)
 {
-	std::ostringstream oss;
-	oss << socket.remote_endpoint();
+	// the endpoint was captured by the accept, so no further system calls or stream formatting are required
+	const auto address = remote.address().to_string();
 
-	if (this->callbacks->AcceptConnection(sessionid, socket.remote_endpoint().address().to_string()))
+	if (this->callbacks->AcceptConnection(sessionid, address))
 	{
-		FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Accepted connection from: %s", oss.str().c_str());
+		FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Accepted connection from: %s:%u", address.c_str(), remote.port());
 
 		auto channel = SocketChannel::Create(executor->Fork(), std::move(socket));	// run the link session in its own strand
 
 		auto create = [&]() -> std::shared_ptr<LinkSession>
 		{
 			return LinkSession::Create(
-			    this->logger.Detach(SessionIdToString(sessionid)),
+			    this->logger.Detach("session-" + std::to_string(sessionid)),
 			    sessionid,
 			    this->manager,
 			    this->callbacks,
-			    channel
+			    channel,
+			    this->pool
 			);
 		};
 
@@ -86,18 +93,10 @@ void MasterTCPServer::AcceptConnection(uint64_t sessionid, const std::shared_ptr
 	}
 	else
 	{
-		socket.close();
-		FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Rejected connection from: %s", oss.str().c_str());
+		std::error_code ec;
+		socket.close(ec);
+		FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Rejected connection from: %s:%u", address.c_str(), remote.port());
 	}
 }
 
-std::string MasterTCPServer::SessionIdToString(uint64_t sessionid)
-{
-	std::ostringstream oss;
-	oss << "session-" << sessionid;
-	return oss.str();
-}
-
 }
-
-
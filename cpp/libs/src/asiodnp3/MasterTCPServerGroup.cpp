@@ -0,0 +1,89 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiodnp3/MasterTCPServerGroup.h"
+
+namespace asiodnp3
+{
+
+std::shared_ptr<MasterTCPServerGroup> MasterTCPServerGroup::Create(
+    const openpal::Logger& logger,
+    const std::shared_ptr<asiopal::IO>& io,
+    const asiopal::IPEndpoint& endpoint,
+    uint32_t numAcceptors,
+    const std::shared_ptr<IListenCallbacks>& callbacks,
+    const std::shared_ptr<asiopal::ResourceManager>& manager,
+    const std::shared_ptr<MasterSessionPool>& pool,
+    std::error_code& ec)
+{
+	auto group = std::make_shared<MasterTCPServerGroup>(manager);
+
+	for (uint32_t i = 0; i < numAcceptors; ++i)
+	{
+		auto acceptor = MasterTCPServer::Create(
+		                    logger,
+		                    asiopal::Executor::Create(io),
+		                    endpoint,
+		                    asiopal::AcceptorShard(i, numAcceptors),
+		                    callbacks,
+		                    manager,
+		                    pool,
+		                    ec
+		                );
+
+		if (ec)
+		{
+			// close any acceptors that already bound the port
+			group->ShutdownAcceptors();
+			return nullptr;
+		}
+
+		group->acceptors.push_back(acceptor);
+	}
+
+	return group;
+}
+
+MasterTCPServerGroup::MasterTCPServerGroup(const std::shared_ptr<asiopal::ResourceManager>& manager) :
+	manager(manager)
+{}
+
+void MasterTCPServerGroup::Shutdown()
+{
+	this->ShutdownAcceptors();
+	this->manager->Detach(this->shared_from_this());
+}
+
+void MasterTCPServerGroup::ShutdownAcceptors()
+{
+	std::vector<std::shared_ptr<MasterTCPServer>> acceptors;
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		acceptors.swap(this->acceptors);
+	}
+
+	for (auto& acceptor : acceptors)
+	{
+		acceptor->Shutdown();
+	}
+}
+
+}
@@ -0,0 +1,77 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_MASTERTCPSERVERGROUP_H
+#define ASIODNP3_MASTERTCPSERVERGROUP_H
+
+#include "asiodnp3/MasterTCPServer.h"
+
+#include <openpal/util/Uncopyable.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace asiodnp3
+{
+
+/**
+* A listener made up of several MasterTCPServer acceptors bound to the same port via SO_REUSEPORT.
+*
+* Each acceptor runs on its own strand so that accepts proceed in parallel on the thread pool.
+* Registered with the resource manager as a single resource.
+*/
+class MasterTCPServerGroup final :
+	public asiopal::IListener,
+	public std::enable_shared_from_this<MasterTCPServerGroup>,
+	private openpal::Uncopyable
+{
+
+public:
+
+	static std::shared_ptr<MasterTCPServerGroup> Create(
+	    const openpal::Logger& logger,
+	    const std::shared_ptr<asiopal::IO>& io,
+	    const asiopal::IPEndpoint& endpoint,
+	    uint32_t numAcceptors,
+	    const std::shared_ptr<IListenCallbacks>& callbacks,
+	    const std::shared_ptr<asiopal::ResourceManager>& manager,
+	    const std::shared_ptr<MasterSessionPool>& pool,
+	    std::error_code& ec
+	);
+
+	explicit MasterTCPServerGroup(const std::shared_ptr<asiopal::ResourceManager>& manager);
+
+	/// Implement IListener
+	virtual void Shutdown() override;
+
+private:
+
+	void ShutdownAcceptors();
+
+	const std::shared_ptr<asiopal::ResourceManager> manager;
+
+	std::mutex mutex;
+	std::vector<std::shared_ptr<MasterTCPServer>> acceptors;
+};
+
+}
+
+#endif
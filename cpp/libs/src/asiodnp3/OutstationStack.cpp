@@ -20,6 +20,9 @@
  */
 #include "OutstationStack.h"
 
+#include "openpal/logging/LogMacros.h"
+#include "opendnp3/LogLevels.h"
+
 using namespace openpal;
 using namespace asiopal;
 using namespace opendnp3;
@@ -62,6 +65,14 @@ OutstationStack::OutstationStack(
 	assign(config.dbConfig.aoStatus, view.analogOutputStatii);
 	assign(config.dbConfig.timeAndInterval, view.timeAndIntervals);
 	assign(config.dbConfig.octetString, view.octetStrings);
+
+	for (auto& filter : config.dbConfig.chatterFilters)
+	{
+		if (!ocontext.ConfigureChatterFilter(filter.type, filter.index, filter.config))
+		{
+			FORMAT_LOG_BLOCK(this->logger, flags::WARN, "Ignoring chatter filter for non-existent point, type: %u, index: %u", static_cast<unsigned>(filter.type), filter.index);
+		}
+	}
 }
 
 
@@ -86,7 +97,7 @@ StackStatistics OutstationStack::GetStackStatistics()
 {
 	auto get = [self = shared_from_this()]
 	{
-		return self->CreateStatistics();
+		return self->CreateStatistics(self->ocontext.GetLatencyStatistics(), self->ocontext.GetUnsolicitedStatistics(), self->ocontext.GetCompactionStatistics());
 	};
 	return this->executor->ReturnFrom<StackStatistics>(get);
 }
@@ -110,6 +121,15 @@ void OutstationStack::SetRestartIIN()
 	this->executor->strand.post(set);
 }
 
+ChatterFilterStatistics OutstationStack::GetChatterFilterStatistics(uint16_t maxPoints)
+{
+	auto get = [self = shared_from_this(), maxPoints]
+	{
+		return self->ocontext.GetChatterStatistics(maxPoints);
+	};
+	return this->executor->ReturnFrom<ChatterFilterStatistics>(get);
+}
+
 void OutstationStack::Apply(const Updates& updates)
 {
 	if (updates.IsEmpty()) return;
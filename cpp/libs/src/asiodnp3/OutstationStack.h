@@ -110,6 +110,8 @@ public:
 
 	void SetRestartIIN() override;
 
+	opendnp3::ChatterFilterStatistics GetChatterFilterStatistics(uint16_t maxPoints) override;
+
 	void Apply(const Updates& updates) override;
 
 private:
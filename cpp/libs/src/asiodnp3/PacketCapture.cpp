@@ -0,0 +1,284 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiodnp3/PacketCapture.h"
+
+#include "asiodnp3/CaptureRing.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+using namespace openpal;
+using namespace std::chrono;
+
+namespace asiodnp3
+{
+
+namespace
+{
+
+// pcap link type for raw IPv4/IPv6 packets
+const uint32_t LINKTYPE_RAW = 101;
+const uint16_t DNP3_PORT = 20000;
+
+void WriteBE16(uint8_t* dest, uint16_t value)
+{
+	dest[0] = static_cast<uint8_t>(value >> 8);
+	dest[1] = static_cast<uint8_t>(value);
+}
+
+void WriteBE32(uint8_t* dest, uint32_t value)
+{
+	dest[0] = static_cast<uint8_t>(value >> 24);
+	dest[1] = static_cast<uint8_t>(value >> 16);
+	dest[2] = static_cast<uint8_t>(value >> 8);
+	dest[3] = static_cast<uint8_t>(value);
+}
+
+// channels are 10.x.y.1 (local) <-> 10.x.y.2 (remote) where x.y is the stream id
+uint32_t Address(uint16_t streamId, bool local)
+{
+	return (10u << 24) | (static_cast<uint32_t>(streamId) << 8) | (local ? 1u : 2u);
+}
+
+void WriteHeaders(uint8_t* dest, uint16_t streamId, CaptureDirection direction, uint32_t seq, uint32_t ack, uint32_t payloadLength)
+{
+	const bool tx = (direction == CaptureDirection::Tx);
+	const uint32_t src = Address(streamId, tx);
+	const uint32_t dst = Address(streamId, !tx);
+
+	// IPv4
+	uint8_t* ip = dest;
+	ip[0] = 0x45;
+	ip[1] = 0;
+	WriteBE16(ip + 2, static_cast<uint16_t>(CaptureRecord::HEADER_SIZE + payloadLength));
+	WriteBE16(ip + 4, 0);
+	WriteBE16(ip + 6, 0x4000); // don't fragment
+	ip[8] = 64;
+	ip[9] = 6; // TCP
+	WriteBE16(ip + 10, 0);
+	WriteBE32(ip + 12, src);
+	WriteBE32(ip + 16, dst);
+
+	uint32_t sum = 0;
+	for (int i = 0; i < 20; i += 2)
+	{
+		sum += (static_cast<uint32_t>(ip[i]) << 8) | ip[i + 1];
+	}
+	while (sum >> 16)
+	{
+		sum = (sum & 0xFFFF) + (sum >> 16);
+	}
+	WriteBE16(ip + 10, static_cast<uint16_t>(~sum));
+
+	// TCP, checksum left as zero
+	uint8_t* tcp = dest + 20;
+	WriteBE16(tcp, tx ? DNP3_PORT + 1 : DNP3_PORT);
+	WriteBE16(tcp + 2, tx ? DNP3_PORT : DNP3_PORT + 1);
+	WriteBE32(tcp + 4, seq);
+	WriteBE32(tcp + 8, ack);
+	tcp[12] = 5 << 4;
+	tcp[13] = 0x18; // PSH | ACK
+	WriteBE16(tcp + 14, 0xFFFF);
+	WriteBE16(tcp + 16, 0);
+	WriteBE16(tcp + 18, 0);
+}
+
+}
+
+std::shared_ptr<PacketCapture> PacketCapture::Create(const std::string& path, const PacketCaptureConfig& config, std::error_code& ec)
+{
+	FILE* file = fopen(path.c_str(), "wb");
+	if (!file)
+	{
+		ec = std::error_code(errno, std::generic_category());
+		return nullptr;
+	}
+
+	return std::make_shared<PacketCapture>(file, config);
+}
+
+PacketCapture::PacketCapture(FILE* file, const PacketCaptureConfig& config) :
+	config(config),
+	file(file),
+	ring(new CaptureRing(config.capacity)),
+	running(true),
+	writerSleeping(false),
+	nextStreamId(1),
+	numDropped(0),
+	numWritten(0)
+{
+	// pcap global header in native byte order, readers detect it from the magic number
+	const uint32_t magic = 0xa1b2c3d4;
+	const uint16_t major = 2;
+	const uint16_t minor = 4;
+	const int32_t zone = 0;
+	const uint32_t sigfigs = 0;
+	const uint32_t snaplen = CaptureRecord::MAX_SIZE;
+	const uint32_t network = LINKTYPE_RAW;
+
+	fwrite(&magic, sizeof(magic), 1, file);
+	fwrite(&major, sizeof(major), 1, file);
+	fwrite(&minor, sizeof(minor), 1, file);
+	fwrite(&zone, sizeof(zone), 1, file);
+	fwrite(&sigfigs, sizeof(sigfigs), 1, file);
+	fwrite(&snaplen, sizeof(snaplen), 1, file);
+	fwrite(&network, sizeof(network), 1, file);
+	fflush(file);
+
+	this->writer = std::thread([this]()
+	{
+		this->Run();
+	});
+}
+
+PacketCapture::~PacketCapture()
+{
+	this->Shutdown();
+}
+
+uint16_t PacketCapture::NextStreamId()
+{
+	return nextStreamId.fetch_add(1, std::memory_order_relaxed);
+}
+
+void PacketCapture::Record(uint16_t streamId, CaptureDirection direction, uint32_t seq, uint32_t ack, const RSlice& bytes)
+{
+	if (!running.load(std::memory_order_relaxed))
+	{
+		numDropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	const auto now = duration_cast<microseconds>(system_clock::now().time_since_epoch()).count();
+
+	auto fill = [&](CaptureRecord & record)
+	{
+		const uint32_t captured = (bytes.Size() < (CaptureRecord::MAX_SIZE - CaptureRecord::HEADER_SIZE)) ? bytes.Size() : (CaptureRecord::MAX_SIZE - CaptureRecord::HEADER_SIZE);
+
+		record.seconds = static_cast<uint32_t>(now / 1000000);
+		record.microseconds = static_cast<uint32_t>(now % 1000000);
+		record.length = CaptureRecord::HEADER_SIZE + captured;
+		record.originalLength = CaptureRecord::HEADER_SIZE + bytes.Size();
+
+		WriteHeaders(record.data, streamId, direction, seq, ack, bytes.Size());
+		memcpy(record.data + CaptureRecord::HEADER_SIZE, bytes, captured);
+	};
+
+	if (!ring->TryProduce(fill))
+	{
+		numDropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	// pairs with the fence in Run() so that either we see the writer asleep or it sees our record
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (writerSleeping.load(std::memory_order_relaxed))
+	{
+		this->WakeWriter();
+	}
+}
+
+void PacketCapture::Shutdown()
+{
+	if (!running.exchange(false))
+	{
+		return;
+	}
+
+	this->WakeWriter();
+	writer.join();
+	fclose(file);
+}
+
+PacketCaptureStatistics PacketCapture::GetStatistics() const
+{
+	PacketCaptureStatistics stats;
+	stats.numCaptured = ring->NumProduced();
+	stats.numDropped = numDropped.load(std::memory_order_relaxed);
+	stats.numWritten = numWritten.load(std::memory_order_relaxed);
+	return stats;
+}
+
+void PacketCapture::WakeWriter()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	condition.notify_one();
+}
+
+void PacketCapture::Run()
+{
+	while (true)
+	{
+		if (this->WriteBatch())
+		{
+			continue;
+		}
+
+		if (!running.load())
+		{
+			// producers may still have been mid-record when running was cleared
+			if (!this->WriteBatch())
+			{
+				return;
+			}
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(mutex);
+		writerSleeping.store(true, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (ring->IsEmpty() && running.load())
+		{
+			// the timeout bounds latency if a wakeup is ever missed
+			condition.wait_for(lock, std::chrono::milliseconds(100));
+		}
+		writerSleeping.store(false, std::memory_order_relaxed);
+	}
+}
+
+bool PacketCapture::WriteBatch()
+{
+	uint32_t count = 0;
+
+	auto write = [this](const CaptureRecord & record)
+	{
+		const uint32_t header[4] = { record.seconds, record.microseconds, record.length, record.originalLength };
+		fwrite(header, sizeof(header), 1, file);
+		fwrite(record.data, 1, record.length, file);
+	};
+
+	while (count < config.maxBatchSize && ring->TryConsume(write))
+	{
+		++count;
+	}
+
+	if (count == 0)
+	{
+		return false;
+	}
+
+	fflush(file);
+	numWritten.fetch_add(count, std::memory_order_relaxed);
+	return true;
+}
+
+}
@@ -79,7 +79,7 @@ void SerialIOHandler::TryOpen(const openpal::TimeDuration& timeout)
 			this->TryOpen(this->retry.NextDelay(timeout));
 		};
 
-		this->retrytimer.Start(timeout, callback);
+		this->retrytimer.Start(this->retry.WaitTime(timeout), callback);
 	}
 	else
 	{
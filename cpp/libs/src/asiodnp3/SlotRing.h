@@ -0,0 +1,169 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_SLOTRING_H
+#define ASIODNP3_SLOTRING_H
+
+#include "openpal/util/Uncopyable.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace asiodnp3
+{
+
+/**
+* Bounded, lock-free, multi-producer / single-consumer ring of preallocated slots.
+*
+* Each slot carries a sequence number that tells producers and the consumer whose turn it is,
+* so producers only contend on a single compare-and-swap of the tail and never on a mutex.
+* Values are filled and consumed in place, so nothing is allocated after construction.
+*/
+template <class T>
+class SlotRing : private openpal::Uncopyable
+{
+	struct Slot
+	{
+		std::atomic<uint64_t> sequence;
+		T value;
+	};
+
+public:
+
+	explicit SlotRing(uint32_t capacity) :
+		mask(RoundUpToPowerOf2(capacity) - 1),
+		slots(new Slot[mask + 1]),
+		tail(0),
+		head(0)
+	{
+		for (uint64_t i = 0; i <= mask; ++i)
+		{
+			slots[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	* Claim the next free slot and fill it in place. Callable from any thread.
+	*
+	* @return false if the ring is full
+	*/
+	template <class Fun>
+	bool TryProduce(const Fun& fill)
+	{
+		auto position = tail.load(std::memory_order_relaxed);
+		Slot* slot = nullptr;
+
+		while (true)
+		{
+			slot = &slots[position & mask];
+			const auto sequence = slot->sequence.load(std::memory_order_acquire);
+			const auto diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+
+			if (diff == 0)
+			{
+				// the slot is free for this lap, try to claim it
+				if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (diff < 0)
+			{
+				// the consumer hasn't released this slot from the previous lap
+				return false;
+			}
+			else
+			{
+				// another producer claimed it first
+				position = tail.load(std::memory_order_relaxed);
+			}
+		}
+
+		fill(slot->value);
+
+		// publish the value to the consumer
+		slot->sequence.store(position + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	* Invoke a function on the oldest value and release its slot. Only callable from the consumer thread.
+	*
+	* @return false if the ring is empty
+	*/
+	template <class Fun>
+	bool TryConsume(const Fun& fun)
+	{
+		auto& slot = slots[head & mask];
+
+		if (slot.sequence.load(std::memory_order_acquire) != (head + 1))
+		{
+			return false;
+		}
+
+		fun(slot.value);
+
+		// hand the slot back to producers for the next lap around the ring
+		slot.sequence.store(head + mask + 1, std::memory_order_release);
+		++head;
+		return true;
+	}
+
+	bool IsEmpty() const
+	{
+		return slots[head & mask].sequence.load(std::memory_order_acquire) != (head + 1);
+	}
+
+	uint64_t NumProduced() const
+	{
+		return tail.load(std::memory_order_relaxed);
+	}
+
+	uint32_t Capacity() const
+	{
+		return static_cast<uint32_t>(mask + 1);
+	}
+
+private:
+
+	static uint32_t RoundUpToPowerOf2(uint32_t value)
+	{
+		uint32_t result = 2;
+		while (result < value && result < (1u << 31))
+		{
+			result <<= 1;
+		}
+		return result;
+	}
+
+	const uint64_t mask;
+	std::unique_ptr<Slot[]> slots;
+
+	// padding keeps the producer and consumer indices on different cache lines
+	uint8_t padding1[64];
+	std::atomic<uint64_t> tail;
+	uint8_t padding2[64];
+	uint64_t head;
+};
+
+}
+
+#endif
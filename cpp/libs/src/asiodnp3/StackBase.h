@@ -55,9 +55,19 @@ protected:
 
 	}
 
-	opendnp3::StackStatistics CreateStatistics() const
+	opendnp3::StackStatistics CreateStatistics(const opendnp3::StackStatistics::Latency& latency) const
 	{
-		return opendnp3::StackStatistics(tstack.link->GetStatistics(), tstack.transport->GetStatistics());
+		return opendnp3::StackStatistics(tstack.link->GetStatistics(), tstack.transport->GetStatistics(), latency);
+	}
+
+	opendnp3::StackStatistics CreateStatistics(const opendnp3::StackStatistics::Latency& latency, const opendnp3::StackStatistics::Unsolicited& unsolicited) const
+	{
+		return opendnp3::StackStatistics(tstack.link->GetStatistics(), tstack.transport->GetStatistics(), latency, unsolicited);
+	}
+
+	opendnp3::StackStatistics CreateStatistics(const opendnp3::StackStatistics::Latency& latency, const opendnp3::StackStatistics::Unsolicited& unsolicited, const opendnp3::StackStatistics::Compaction& compaction) const
+	{
+		return opendnp3::StackStatistics(tstack.link->GetStatistics(), tstack.transport->GetStatistics(), latency, unsolicited, compaction);
 	}
 
 	template <class T>
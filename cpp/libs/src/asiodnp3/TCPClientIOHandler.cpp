@@ -34,13 +34,16 @@ TCPClientIOHandler::TCPClientIOHandler(
     const std::shared_ptr<asiopal::Executor>& executor,
     const asiopal::ChannelRetry& retry,
     const asiodnp3::IPEndpointsList& remotes,
-    const std::string& adapter
+    const std::string& adapter,
+    const std::shared_ptr<asiopal::ConnectionThrottle>& throttle
 ) :
 	IOHandler(logger, false, listener),
 	executor(executor),
 	retry(retry),
 	remotes(remotes),
 	adapter(adapter),
+	throttle(throttle),
+	resolverCache(retry.resolverCacheTTL.IsPostive() ? std::make_shared<ResolverCache>(retry.resolverCacheTTL) : nullptr),
 	retrytimer(*executor)
 {}
 
@@ -51,7 +54,7 @@ void TCPClientIOHandler::ShutdownImpl()
 
 void TCPClientIOHandler::BeginChannelAccept()
 {
-	this->client = TCPClient::Create(logger, executor, adapter);
+	this->client = TCPClient::Create(logger, executor, adapter, resolverCache);
 	this->StartConnect(this->retry.minOpenRetry);
 }
 
@@ -72,8 +75,38 @@ bool TCPClientIOHandler::StartConnect(const openpal::TimeDuration& delay)
 		return false;
 	}
 
+	auto attempt = [self = shared_from_this(), this, delay, client = this->client](const std::shared_ptr<ConnectionThrottle::Permit>& permit)
+	{
+		// the channel may have been shut down while the attempt was queued
+		if (this->client == client)
+		{
+			this->BeginConnect(delay, permit);
+		}
+	};
+
+	if (this->throttle)
+	{
+		this->throttle->Request(this->executor, attempt);
+	}
+	else
+	{
+		attempt(nullptr);
+	}
+
+	return true;
+}
+
+void TCPClientIOHandler::BeginConnect(const openpal::TimeDuration& delay, const std::shared_ptr<ConnectionThrottle::Permit>& permit)
+{
+	const bool race = this->retry.connectAttemptDelay.IsPostive() && (this->remotes.GetEndpoints().size() > 1);
+
 	auto cb = [=, self = shared_from_this()](const std::shared_ptr<Executor>& executor, asio::ip::tcp::socket socket, const std::error_code & ec) -> void
 	{
+		if (permit)
+		{
+			permit->Release();
+		}
+
 		if (ec)
 		{
 			FORMAT_LOG_BLOCK(this->logger, openpal::logflags::WARN, "Error Connecting: %s", ec.message().c_str());
@@ -84,20 +117,26 @@ bool TCPClientIOHandler::StartConnect(const openpal::TimeDuration& delay)
 
 			if (client)
 			{
-				auto retry_cb = [self, newDelay, this]()
+				auto retry_cb = [self, newDelay, race, this]()
 				{
-					this->remotes.Next();
+					if (!race)
+					{
+						this->remotes.Next();
+					}
 					this->StartConnect(newDelay);
 				};
 
-				this->retrytimer.Start(delay, retry_cb);
+				this->retrytimer.Start(this->retry.WaitTime(delay), retry_cb);
 			}
 		}
 		else
 		{
+			std::error_code ignored;
+			const auto remote = socket.remote_endpoint(ignored);
+
 			FORMAT_LOG_BLOCK(this->logger, openpal::logflags::INFO, "Connected to: %s, port %u",
-				this->remotes.GetCurrentEndpoint().address.c_str(),
-				this->remotes.GetCurrentEndpoint().port);
+				remote.address().to_string().c_str(),
+				remote.port());
 
 			if (client)
 			{
@@ -107,13 +146,22 @@ bool TCPClientIOHandler::StartConnect(const openpal::TimeDuration& delay)
 
 	};
 
-	FORMAT_LOG_BLOCK(this->logger, openpal::logflags::INFO, "Connecting to: %s, port %u",
-		this->remotes.GetCurrentEndpoint().address.c_str(),
-		this->remotes.GetCurrentEndpoint().port);
+	if (race)
+	{
+		FORMAT_LOG_BLOCK(this->logger, openpal::logflags::INFO, "Connecting to %u endpoints, %lld ms apart",
+			static_cast<unsigned int>(this->remotes.GetEndpoints().size()),
+			static_cast<long long>(this->retry.connectAttemptDelay.GetMilliseconds()));
 
-	this->client->BeginConnect(this->remotes.GetCurrentEndpoint(), cb);
+		this->client->BeginConnect(this->remotes.GetEndpoints(), this->retry.connectAttemptDelay, cb);
+	}
+	else
+	{
+		FORMAT_LOG_BLOCK(this->logger, openpal::logflags::INFO, "Connecting to: %s, port %u",
+			this->remotes.GetCurrentEndpoint().address.c_str(),
+			this->remotes.GetCurrentEndpoint().port);
 
-	return true;
+		this->client->BeginConnect(this->remotes.GetCurrentEndpoint(), cb);
+	}
 }
 
 void TCPClientIOHandler::ResetState()
@@ -127,6 +175,12 @@ void TCPClientIOHandler::ResetState()
 	this->remotes.Reset();
 
 	retrytimer.Cancel();
+
+	if (this->throttle)
+	{
+		// queued attempts hold a reference to this handler
+		this->throttle->Cancel(this->executor);
+	}
 }
 
 }
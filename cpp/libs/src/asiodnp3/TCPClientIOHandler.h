@@ -27,6 +27,7 @@
 #include "asiopal/ChannelRetry.h"
 #include "asiopal/IPEndpoint.h"
 #include "asiopal/TCPClient.h"
+#include "asiopal/ConnectionThrottle.h"
 
 #include "openpal/executor/TimerRef.h"
 
@@ -44,9 +45,10 @@ public:
 	    const std::shared_ptr<asiopal::Executor>& executor,
 	    const asiopal::ChannelRetry& retry,
 	    const asiodnp3::IPEndpointsList& remotes,
-	    const std::string& adapter)
+	    const std::string& adapter,
+	    const std::shared_ptr<asiopal::ConnectionThrottle>& throttle = nullptr)
 	{
-		return std::make_shared<TCPClientIOHandler>(logger, listener, executor, retry, remotes, adapter);
+		return std::make_shared<TCPClientIOHandler>(logger, listener, executor, retry, remotes, adapter, throttle);
 	}
 
 	TCPClientIOHandler(
@@ -55,7 +57,8 @@ public:
 	    const std::shared_ptr<asiopal::Executor>& executor,
 	    const asiopal::ChannelRetry& retry,
 	    const asiodnp3::IPEndpointsList& remotes,
-	    const std::string& adapter
+	    const std::string& adapter,
+	    const std::shared_ptr<asiopal::ConnectionThrottle>& throttle = nullptr
 	);
 
 protected:
@@ -69,12 +72,18 @@ private:
 
 	bool StartConnect(const openpal::TimeDuration& delay);
 
+	void BeginConnect(const openpal::TimeDuration& delay, const std::shared_ptr<asiopal::ConnectionThrottle::Permit>& permit);
+
 	void ResetState();
 
 	const std::shared_ptr<asiopal::Executor> executor;
 	const asiopal::ChannelRetry retry;
 	asiodnp3::IPEndpointsList remotes;
 	const std::string adapter;
+	const std::shared_ptr<asiopal::ConnectionThrottle> throttle;
+
+	// resolved host names, outlives the individual clients
+	const std::shared_ptr<asiopal::ResolverCache> resolverCache;
 
 	// current value of the client
 	std::shared_ptr<asiopal::TCPClient> client;
@@ -34,8 +34,10 @@ namespace asiodnp3
 {
 
 
-void TCPServerIOHandler::Server::AcceptConnection(uint64_t sessionid, const std::shared_ptr<asiopal::Executor>& executor, asio::ip::tcp::socket socket)
+void TCPServerIOHandler::Server::AcceptConnection(uint64_t sessionid, const std::shared_ptr<asiopal::Executor>& executor, asio::ip::tcp::socket socket, const asio::ip::tcp::endpoint& remote)
 {
+	FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Accepted connection from: %s:%u", remote.address().to_string().c_str(), remote.port());
+
 	this->callback(executor, std::move(socket));
 }
 
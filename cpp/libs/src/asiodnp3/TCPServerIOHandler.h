@@ -63,7 +63,7 @@ class TCPServerIOHandler final : public IOHandler
 
 		virtual void OnShutdown() override {}
 
-		virtual void AcceptConnection(uint64_t sessionid, const std::shared_ptr<asiopal::Executor>& executor, asio::ip::tcp::socket) override;
+		virtual void AcceptConnection(uint64_t sessionid, const std::shared_ptr<asiopal::Executor>& executor, asio::ip::tcp::socket, const asio::ip::tcp::endpoint& remote) override;
 	};
 
 public:
@@ -89,6 +89,41 @@ UpdateBuilder& UpdateBuilder::Modify(FlagsType type, uint16_t start, uint16_t st
 	return *this;
 }
 
+UpdateBuilder& UpdateBuilder::Update(std::vector<Indexed<Binary>> values, EventMode mode)
+{
+	return this->AddBatch(std::move(values), mode);
+}
+
+UpdateBuilder& UpdateBuilder::Update(std::vector<Indexed<DoubleBitBinary>> values, EventMode mode)
+{
+	return this->AddBatch(std::move(values), mode);
+}
+
+UpdateBuilder& UpdateBuilder::Update(std::vector<Indexed<Analog>> values, EventMode mode)
+{
+	return this->AddBatch(std::move(values), mode);
+}
+
+UpdateBuilder& UpdateBuilder::Update(std::vector<Indexed<Counter>> values, EventMode mode)
+{
+	return this->AddBatch(std::move(values), mode);
+}
+
+UpdateBuilder& UpdateBuilder::Update(std::vector<Indexed<FrozenCounter>> values, EventMode mode)
+{
+	return this->AddBatch(std::move(values), mode);
+}
+
+UpdateBuilder& UpdateBuilder::Update(std::vector<Indexed<BinaryOutputStatus>> values, EventMode mode)
+{
+	return this->AddBatch(std::move(values), mode);
+}
+
+UpdateBuilder& UpdateBuilder::Update(std::vector<Indexed<AnalogOutputStatus>> values, EventMode mode)
+{
+	return this->AddBatch(std::move(values), mode);
+}
+
 template <class T>
 UpdateBuilder& UpdateBuilder::AddMeas(const T& meas, uint16_t index, opendnp3::EventMode mode)
 {
@@ -99,6 +134,24 @@ UpdateBuilder& UpdateBuilder::AddMeas(const T& meas, uint16_t index, opendnp3::E
 	return *this;
 }
 
+template <class T>
+UpdateBuilder& UpdateBuilder::AddBatch(std::vector<Indexed<T>> values, opendnp3::EventMode mode)
+{
+	if (values.empty()) return *this;
+
+	// shared so that copying the update function doesn't copy the values
+	const auto batch = std::make_shared<const std::vector<Indexed<T>>>(std::move(values));
+
+	this->Add([batch, mode](IUpdateHandler & handler)
+	{
+		for (auto& value : *batch)
+		{
+			handler.Update(value.value, value.index, mode);
+		}
+	});
+	return *this;
+}
+
 void UpdateBuilder::Add(const update_func_t& fun)
 {
 	if (!this->updates)
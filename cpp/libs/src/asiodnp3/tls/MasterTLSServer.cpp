@@ -38,15 +38,18 @@ namespace asiodnp3
 MasterTLSServer::MasterTLSServer(
     const openpal::Logger& logger,
     const std::shared_ptr<asiopal::Executor>& executor,
+    const std::shared_ptr<asiopal::TLSHandshakeGate>& handshakeGate,
     const asiopal::IPEndpoint& endpoint,
     const asiopal::TLSConfig& config,
     const std::shared_ptr<IListenCallbacks>& callbacks,
     const std::shared_ptr<asiopal::ResourceManager>& manager,
+    const std::shared_ptr<MasterSessionPool>& pool,
     std::error_code& ec
 ) :
-	TLSServer(logger, executor, endpoint, config, ec),
+	TLSServer(logger, executor, handshakeGate, endpoint, config, ec),
 	callbacks(callbacks),
-	manager(manager)
+	manager(manager),
+	pool(pool)
 {
 
 }
@@ -117,7 +120,8 @@ void MasterTLSServer::AcceptStream(uint64_t sessionid, const std::shared_ptr<Exe
 		    sessionid,
 		    this->manager,
 		    callbacks,
-		    channel
+		    channel,
+		    this->pool
 		);
 	};
 
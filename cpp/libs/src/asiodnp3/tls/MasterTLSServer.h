@@ -34,6 +34,8 @@
 namespace asiodnp3
 {
 
+class MasterSessionPool;
+
 class MasterTLSServer final : public asiopal::TLSServer
 {
 
@@ -42,23 +44,27 @@ public:
 	MasterTLSServer(
 	    const openpal::Logger& logger,
 	    const std::shared_ptr<asiopal::Executor>& executor,
+	    const std::shared_ptr<asiopal::TLSHandshakeGate>& handshakeGate,
 	    const asiopal::IPEndpoint& endpoint,
 	    const asiopal::TLSConfig& tlsConfig,
 	    const std::shared_ptr<IListenCallbacks>& callbacks,
 	    const std::shared_ptr<asiopal::ResourceManager>& manager,
+	    const std::shared_ptr<MasterSessionPool>& pool,
 	    std::error_code& ec
 	);
 
 	static std::shared_ptr<MasterTLSServer> Create(
 	    const openpal::Logger& logger,
 	    const std::shared_ptr<asiopal::Executor> executor,
+	    const std::shared_ptr<asiopal::TLSHandshakeGate>& handshakeGate,
 	    const asiopal::IPEndpoint endpoint,
 	    const asiopal::TLSConfig& tlsConfig,
 	    const std::shared_ptr<IListenCallbacks> callbacks,
 	    const std::shared_ptr<asiopal::ResourceManager>& manager,
+	    const std::shared_ptr<MasterSessionPool>& pool,
 	    std::error_code& ec)
 	{
-		auto ret = std::make_shared<MasterTLSServer>(logger, executor, endpoint, tlsConfig, callbacks, manager, ec);
+		auto ret = std::make_shared<MasterTLSServer>(logger, executor, handshakeGate, endpoint, tlsConfig, callbacks, manager, pool, ec);
 
 		if (ec) return nullptr;
 
@@ -88,6 +94,7 @@ private:
 
 	std::shared_ptr<IListenCallbacks> callbacks;
 	std::shared_ptr<asiopal::ResourceManager> manager;
+	std::shared_ptr<MasterSessionPool> pool;
 
 	static std::string SessionIdToString(uint64_t sessionid);
 
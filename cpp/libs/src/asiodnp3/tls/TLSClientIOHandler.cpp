@@ -33,17 +33,22 @@ TLSClientIOHandler::TLSClientIOHandler(
     const openpal::Logger& logger,
     const std::shared_ptr<IChannelListener>& listener,
     const std::shared_ptr<asiopal::Executor>& executor,
+    const std::shared_ptr<asiopal::TLSHandshakeGate>& handshakeGate,
     const asiopal::TLSConfig& config,
     const asiopal::ChannelRetry& retry,
     const asiodnp3::IPEndpointsList& remotes,
-    const std::string& adapter
+    const std::string& adapter,
+    const std::shared_ptr<asiopal::ConnectionThrottle>& throttle
 ) :
 	IOHandler(logger, false, listener),
 	executor(executor),
+	handshakeGate(handshakeGate),
 	config(config),
 	retry(retry),
 	remotes(remotes),
 	adapter(adapter),
+	throttle(throttle),
+	sessions(config.allowSessionResumption ? std::make_shared<TLSSessionCache>() : nullptr),
 	retrytimer(*executor)
 {}
 
@@ -56,7 +61,7 @@ void TLSClientIOHandler::BeginChannelAccept()
 {
 	std::error_code ec;
 
-	this->client = TLSClient::Create(logger, executor, adapter, config, ec);
+	this->client = TLSClient::Create(logger, executor, handshakeGate, adapter, config, sessions, ec);
 
 	if (ec)
 	{
@@ -79,9 +84,35 @@ void TLSClientIOHandler::OnChannelShutdown()
 }
 
 void TLSClientIOHandler::StartConnect(const std::shared_ptr<asiopal::TLSClient>& client, const openpal::TimeDuration& delay)
+{
+	auto attempt = [self = shared_from_this(), this, client, delay](const std::shared_ptr<ConnectionThrottle::Permit>& permit)
+	{
+		// the channel may have been shut down while the attempt was queued
+		if (this->client == client)
+		{
+			this->BeginConnect(client, delay, permit);
+		}
+	};
+
+	if (this->throttle)
+	{
+		this->throttle->Request(this->executor, attempt);
+	}
+	else
+	{
+		attempt(nullptr);
+	}
+}
+
+void TLSClientIOHandler::BeginConnect(const std::shared_ptr<asiopal::TLSClient>& client, const openpal::TimeDuration& delay, const std::shared_ptr<ConnectionThrottle::Permit>& permit)
 {
 	auto cb = [ =, self = shared_from_this()](const std::shared_ptr<Executor>& executor, const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream, const std::error_code & ec) -> void
 	{
+		if (permit)
+		{
+			permit->Release();
+		}
+
 		if (ec)
 		{
 			FORMAT_LOG_BLOCK(this->logger, openpal::logflags::WARN, "Error Connecting: %s", ec.message().c_str());
@@ -96,7 +127,7 @@ void TLSClientIOHandler::StartConnect(const std::shared_ptr<asiopal::TLSClient>&
 				this->StartConnect(client, newDelay);
 			};
 
-			this->retrytimer.Start(delay, cb);
+			this->retrytimer.Start(this->retry.WaitTime(delay), cb);
 		}
 		else
 		{
@@ -104,6 +135,17 @@ void TLSClientIOHandler::StartConnect(const std::shared_ptr<asiopal::TLSClient>&
 				this->remotes.GetCurrentEndpoint().address.c_str(),
 				this->remotes.GetCurrentEndpoint().port);
 
+			const auto& tls = client->GetStatistics();
+			if (tls.lastHandshakeResumed)
+			{
+				++this->statistics.numTLSResumedHandshake;
+			}
+			else
+			{
+				++this->statistics.numTLSFullHandshake;
+			}
+			this->latency.tlsHandshake.Record(static_cast<int64_t>(tls.lastHandshakeMicroseconds / 1000));
+
 			this->OnNewChannel(TLSStreamChannel::Create(executor, stream));
 		}
 
@@ -127,6 +169,12 @@ void TLSClientIOHandler::ResetState()
 	this->remotes.Reset();
 
 	retrytimer.Cancel();
+
+	if (this->throttle)
+	{
+		// queued attempts hold a reference to this handler
+		this->throttle->Cancel(this->executor);
+	}
 }
 
 }
@@ -29,6 +29,7 @@
 #include "asiopal/TCPClient.h"
 #include "asiopal/TLSConfig.h"
 #include "asiopal/tls/TLSClient.h"
+#include "asiopal/ConnectionThrottle.h"
 
 #include "openpal/executor/TimerRef.h"
 
@@ -44,22 +45,26 @@ public:
 	    const openpal::Logger& logger,
 	    const std::shared_ptr<IChannelListener>& listener,
 	    const std::shared_ptr<asiopal::Executor>& executor,
+	    const std::shared_ptr<asiopal::TLSHandshakeGate>& handshakeGate,
 	    const asiopal::TLSConfig& config,
 	    const asiopal::ChannelRetry& retry,
 	    const asiodnp3::IPEndpointsList& remotes,
-	    const std::string& adapter)
+	    const std::string& adapter,
+	    const std::shared_ptr<asiopal::ConnectionThrottle>& throttle = nullptr)
 	{
-		return std::make_shared<TLSClientIOHandler>(logger, listener, executor, config, retry, remotes, adapter);
+		return std::make_shared<TLSClientIOHandler>(logger, listener, executor, handshakeGate, config, retry, remotes, adapter, throttle);
 	}
 
 	TLSClientIOHandler(
 	    const openpal::Logger& logger,
 	    const std::shared_ptr<IChannelListener>& listener,
 	    const std::shared_ptr<asiopal::Executor>& executor,
+	    const std::shared_ptr<asiopal::TLSHandshakeGate>& handshakeGate,
 	    const asiopal::TLSConfig& config,
 	    const asiopal::ChannelRetry& retry,
 	    const asiodnp3::IPEndpointsList& remotes,
-	    const std::string& adapter
+	    const std::string& adapter,
+	    const std::shared_ptr<asiopal::ConnectionThrottle>& throttle = nullptr
 	);
 
 protected:
@@ -73,13 +78,20 @@ private:
 
 	void StartConnect(const std::shared_ptr<asiopal::TLSClient>& client, const openpal::TimeDuration& delay);
 
+	void BeginConnect(const std::shared_ptr<asiopal::TLSClient>& client, const openpal::TimeDuration& delay, const std::shared_ptr<asiopal::ConnectionThrottle::Permit>& permit);
+
 	void ResetState();
 
 	const std::shared_ptr<asiopal::Executor> executor;
+	const std::shared_ptr<asiopal::TLSHandshakeGate> handshakeGate;
 	const asiopal::TLSConfig config;
 	const asiopal::ChannelRetry retry;
 	asiodnp3::IPEndpointsList remotes;
 	const std::string adapter;
+	const std::shared_ptr<asiopal::ConnectionThrottle> throttle;
+
+	// TLS sessions for resumption, outlives the individual clients
+	const std::shared_ptr<asiopal::TLSSessionCache> sessions;
 
 	// current value of the client
 	std::shared_ptr<asiopal::TLSClient> client;
@@ -43,12 +43,14 @@ TLSServerIOHandler::TLSServerIOHandler(
     ServerAcceptMode mode,
     const std::shared_ptr<IChannelListener>& listener,
     const std::shared_ptr<asiopal::Executor>& executor,
+    const std::shared_ptr<asiopal::TLSHandshakeGate>& handshakeGate,
     const asiopal::IPEndpoint& endpoint,
     const asiopal::TLSConfig& config,
     std::error_code& ec
 ) :
 	IOHandler(logger, mode == ServerAcceptMode::CloseExisting, listener),
 	executor(executor),
+	handshakeGate(handshakeGate),
 	endpoint(endpoint),
 	config(config)
 {}
@@ -71,7 +73,7 @@ void TLSServerIOHandler::BeginChannelAccept()
 	};
 
 	std::error_code ec;
-	this->server = std::make_shared<Server>(this->logger, this->executor, this->endpoint, this->config, ec);
+	this->server = std::make_shared<Server>(this->logger, this->executor, this->handshakeGate, this->endpoint, this->config, ec);
 
 	if (ec)
 	{
@@ -45,11 +45,12 @@ class TLSServerIOHandler final : public IOHandler
 		Server(
 		    const openpal::Logger& logger,
 		    const std::shared_ptr<asiopal::Executor>& executor,
+		    const std::shared_ptr<asiopal::TLSHandshakeGate>& handshakeGate,
 		    const asiopal::IPEndpoint& endpoint,
 		    const asiopal::TLSConfig& config,
 		    std::error_code& ec
 		) :
-			TLSServer(logger, executor, endpoint, config, ec)
+			TLSServer(logger, executor, handshakeGate, endpoint, config, ec)
 		{}
 
 		void StartAcceptingConnection(const callback_t& callback, std::error_code& ec)
@@ -82,11 +83,12 @@ public:
 	    opendnp3::ServerAcceptMode mode,
 	    const std::shared_ptr<IChannelListener>& listener,
 	    const std::shared_ptr<asiopal::Executor>& executor,
+	    const std::shared_ptr<asiopal::TLSHandshakeGate>& handshakeGate,
 	    const asiopal::IPEndpoint& endpoint,
 	    const asiopal::TLSConfig& config,
 	    std::error_code& ec)
 	{
-		return std::make_shared<TLSServerIOHandler>(logger, mode, listener, executor, endpoint, config, ec);
+		return std::make_shared<TLSServerIOHandler>(logger, mode, listener, executor, handshakeGate, endpoint, config, ec);
 	}
 
 	TLSServerIOHandler(
@@ -94,6 +96,7 @@ public:
 	    opendnp3::ServerAcceptMode mode,
 	    const std::shared_ptr<IChannelListener>& listener,
 	    const std::shared_ptr<asiopal::Executor>& executor,
+	    const std::shared_ptr<asiopal::TLSHandshakeGate>& handshakeGate,
 	    const asiopal::IPEndpoint& endpoint,
 	    const asiopal::TLSConfig& config,
 	    std::error_code& ec
@@ -109,6 +112,7 @@ protected:
 private:
 
 	const std::shared_ptr<asiopal::Executor> executor;
+	const std::shared_ptr<asiopal::TLSHandshakeGate> handshakeGate;
 	const asiopal::IPEndpoint endpoint;
 	const asiopal::TLSConfig config;
 	std::shared_ptr<Server> server;
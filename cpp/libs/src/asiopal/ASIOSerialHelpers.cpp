@@ -27,6 +27,12 @@
 
 #include <asio.hpp>
 
+#ifdef __linux__
+	#include <linux/serial.h>
+	#include <sys/ioctl.h>
+	#include <cerrno>
+#endif
+
 using namespace asio;
 using namespace opendnp3;
 
@@ -109,6 +115,35 @@ serial_port_base::parity ConvertParity(opendnp3::Parity parity)
 	return serial_port_base::parity(t);
 }
 
+#ifdef __linux__
+
+bool ConfigureLowLatency(asio::serial_port& port, error_code& ec)
+{
+	const auto fd = port.native_handle();
+
+	// ask the driver to push received characters to the line discipline immediately. Devices that
+	// don't implement the serial ioctls (ptys, some USB adapters) report ENOTTY or EINVAL and are left as-is
+	struct serial_struct serial;
+	if (ioctl(fd, TIOCGSERIAL, &serial) == 0)
+	{
+		serial.flags |= ASYNC_LOW_LATENCY;
+		if (ioctl(fd, TIOCSSERIAL, &serial) < 0 && errno != ENOTTY && errno != EINVAL)
+		{
+			ec = error_code(errno, std::system_category());
+			return false;
+		}
+	}
+	else if (errno != ENOTTY && errno != EINVAL)
+	{
+		ec = error_code(errno, std::system_category());
+		return false;
+	}
+
+	return true;
+}
+
+#endif
+
 bool Configure(const SerialSettings& settings, asio::serial_port& port, error_code& ec)
 {
 	//Set all the various options
@@ -124,8 +159,47 @@ bool Configure(const SerialSettings& settings, asio::serial_port& port, error_co
 	port.set_option(ConvertStopBits(settings.stopBits), ec);
 	if (ec) return false;
 
+#ifdef __linux__
+	if (settings.lowLatency && !ConfigureLowLatency(port, ec))
+	{
+		return false;
+	}
+#endif
+
 	return true;
 }
 
+std::chrono::nanoseconds GetCharacterTime(const SerialSettings& settings)
+{
+	if (settings.baud <= 0)
+	{
+		return std::chrono::nanoseconds(0);
+	}
+
+	// count in half bits so that 1.5 stop bits is exact
+	int64_t halfBits = 2 * (1 + settings.dataBits);
+
+	if (settings.parity != opendnp3::Parity::None)
+	{
+		halfBits += 2;
+	}
+
+	switch (settings.stopBits)
+	{
+	case(opendnp3::StopBits::One) :
+		halfBits += 2;
+		break;
+	case(opendnp3::StopBits::OnePointFive) :
+		halfBits += 3;
+		break;
+	case(opendnp3::StopBits::Two) :
+		halfBits += 4;
+		break;
+	default:
+		break;
+	}
+
+	return std::chrono::nanoseconds((halfBits * 500000000) / settings.baud);
 }
 
+}
@@ -0,0 +1,236 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiopal/ConnectionThrottle.h"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace asiopal
+{
+
+void ConnectionThrottle::Permit::Release()
+{
+	if (!this->released.exchange(true))
+	{
+		auto throttle = this->throttle.lock();
+		if (throttle)
+		{
+			throttle->OnRelease();
+		}
+	}
+}
+
+ConnectionThrottle::ConnectionThrottle(const std::shared_ptr<IO>& io) :
+	lastRefill(steady_clock_t::now()),
+	timer(io->service)
+{}
+
+void ConnectionThrottle::Configure(const ConnectionThrottleConfig& config)
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->config = config;
+		this->config.burstSize = std::max<uint32_t>(config.burstSize, 1);
+		this->tokens = this->config.burstSize;
+		this->lastRefill = steady_clock_t::now();
+	}
+
+	// the new limits may allow queued attempts to start
+	this->Dispatch();
+}
+
+void ConnectionThrottle::Request(const std::shared_ptr<Executor>& executor, const start_attempt_t& start)
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		if (this->isShutdown)
+		{
+			return;
+		}
+
+		this->queue.push_back(Pending { executor, start });
+
+		if (this->queue.size() > 1 || !this->CanStart() || !this->TryTakeToken(steady_clock_t::now()))
+		{
+			++this->statistics.numDelayed;
+
+			if (this->CanStart())
+			{
+				this->StartTimer(steady_clock_t::now());
+			}
+
+			return;
+		}
+
+		// the token was already taken above
+		this->queue.pop_back();
+		++this->statistics.numActive;
+		++this->statistics.numStarted;
+	}
+
+	auto permit = std::make_shared<Permit>(this->shared_from_this());
+	executor->strand.post([permit, start]()
+	{
+		start(permit);
+	});
+}
+
+void ConnectionThrottle::Cancel(const std::shared_ptr<Executor>& executor)
+{
+	std::vector<Pending> discarded;
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		// the queued attempts hold a reference to their channel, release them outside the lock
+		auto matches = [&](const Pending & pending)
+		{
+			return pending.executor == executor;
+		};
+
+		std::copy_if(this->queue.begin(), this->queue.end(), std::back_inserter(discarded), matches);
+		this->queue.erase(std::remove_if(this->queue.begin(), this->queue.end(), matches), this->queue.end());
+	}
+}
+
+ConnectionThrottleStatistics ConnectionThrottle::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+	auto statistics = this->statistics;
+	statistics.numQueued = static_cast<uint32_t>(this->queue.size());
+	return statistics;
+}
+
+void ConnectionThrottle::Shutdown()
+{
+	std::deque<Pending> discarded;
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->isShutdown = true;
+		discarded.swap(this->queue);
+		std::error_code ec;
+		this->timer.cancel(ec);
+	}
+}
+
+void ConnectionThrottle::OnRelease()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		if (this->statistics.numActive > 0)
+		{
+			--this->statistics.numActive;
+		}
+	}
+
+	this->Dispatch();
+}
+
+void ConnectionThrottle::Dispatch()
+{
+	std::vector<Pending> ready;
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		const auto now = steady_clock_t::now();
+
+		while (!this->queue.empty() && this->CanStart() && this->TryTakeToken(now))
+		{
+			ready.push_back(this->queue.front());
+			this->queue.pop_front();
+			++this->statistics.numActive;
+			++this->statistics.numStarted;
+		}
+
+		if (!this->queue.empty() && this->CanStart())
+		{
+			// only waiting for the bucket to refill
+			this->StartTimer(now);
+		}
+	}
+
+	for (auto& pending : ready)
+	{
+		auto permit = std::make_shared<Permit>(this->shared_from_this());
+		auto start = pending.start;
+		pending.executor->strand.post([permit, start]()
+		{
+			start(permit);
+		});
+	}
+}
+
+bool ConnectionThrottle::TryTakeToken(const steady_clock_t::time_point& now)
+{
+	if (this->config.maxAttemptsPerSecond == 0)
+	{
+		return true;
+	}
+
+	const auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(now - this->lastRefill).count();
+	this->tokens = std::min<double>(this->config.burstSize, this->tokens + elapsed * this->config.maxAttemptsPerSecond);
+	this->lastRefill = now;
+
+	if (this->tokens < 1.0)
+	{
+		return false;
+	}
+
+	this->tokens -= 1.0;
+	return true;
+}
+
+bool ConnectionThrottle::CanStart() const
+{
+	return (this->config.maxConcurrentAttempts == 0) || (this->statistics.numActive < this->config.maxConcurrentAttempts);
+}
+
+void ConnectionThrottle::StartTimer(const steady_clock_t::time_point& now)
+{
+	if (this->timerActive || this->config.maxAttemptsPerSecond == 0)
+	{
+		return;
+	}
+
+	const auto seconds = (1.0 - this->tokens) / this->config.maxAttemptsPerSecond;
+	const auto wait = std::chrono::duration_cast<steady_clock_t::duration>(std::chrono::duration<double>(seconds));
+
+	this->timerActive = true;
+	this->timer.expires_at(now + wait);
+	this->timer.async_wait([self = shared_from_this()](const std::error_code & ec)
+	{
+		{
+			std::lock_guard<std::mutex> lock(self->mutex);
+			self->timerActive = false;
+		}
+
+		if (!ec)
+		{
+			self->Dispatch();
+		}
+	});
+}
+
+}
@@ -20,6 +20,8 @@
  */
 #include "asiopal/IOpenDelayStrategy.h"
 
+#include <random>
+
 
 namespace asiopal
 {
@@ -37,6 +39,55 @@ openpal::TimeDuration ExponentialBackoffStrategy::GetNextDelay(const openpal::Ti
 	return (doubled > max.GetMilliseconds()) ? max : openpal::TimeDuration::Milliseconds(doubled);
 }
 
+namespace
+{
+// uniform in [min, max], each thread has its own generator so that strategies can be shared by all channels
+int64_t Uniform(int64_t min, int64_t max)
+{
+	thread_local std::mt19937_64 generator(std::random_device{}());
+
+	if (max <= min)
+	{
+		return min;
+	}
+
+	return std::uniform_int_distribution<int64_t>(min, max)(generator);
+}
+}
+
+FullJitterBackoffStrategy FullJitterBackoffStrategy::instance;
+
+IOpenDelayStrategy& FullJitterBackoffStrategy::Instance()
+{
+	return instance;
+}
+
+openpal::TimeDuration FullJitterBackoffStrategy::GetNextDelay(const openpal::TimeDuration& current, const openpal::TimeDuration& max) const
+{
+	return ExponentialBackoffStrategy::Instance().GetNextDelay(current, max);
+}
+
+openpal::TimeDuration FullJitterBackoffStrategy::GetWaitTime(const openpal::TimeDuration& delay) const
+{
+	return openpal::TimeDuration::Milliseconds(Uniform(0, delay.GetMilliseconds()));
+}
+
+DecorrelatedJitterStrategy DecorrelatedJitterStrategy::instance;
+
+IOpenDelayStrategy& DecorrelatedJitterStrategy::Instance()
+{
+	return instance;
+}
+
+openpal::TimeDuration DecorrelatedJitterStrategy::GetNextDelay(const openpal::TimeDuration& current, const openpal::TimeDuration& max) const
+{
+	return this->GetNextDelay(current, openpal::TimeDuration::Zero(), max);
 }
 
+openpal::TimeDuration DecorrelatedJitterStrategy::GetNextDelay(const openpal::TimeDuration& current, const openpal::TimeDuration& min, const openpal::TimeDuration& max) const
+{
+	const int64_t next = Uniform(min.GetMilliseconds(), 3 * current.GetMilliseconds());
+	return (next > max.GetMilliseconds()) ? max : openpal::TimeDuration::Milliseconds(next);
+}
 
+}
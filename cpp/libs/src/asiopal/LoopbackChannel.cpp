@@ -0,0 +1,369 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiopal/LoopbackChannel.h"
+
+#include <openpal/util/Uncopyable.h>
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace asiopal
+{
+
+/**
+* One direction of a loopback link. All members are guarded by the mutex.
+*/
+class LoopbackPipe : private openpal::Uncopyable
+{
+	struct Mark
+	{
+		// bytes before this position become readable at the specified time
+		uint64_t end;
+		steady_clock_t::time_point readable;
+	};
+
+	static size_t RoundUp(uint32_t size)
+	{
+		size_t capacity = 1;
+		while (capacity < size)
+		{
+			capacity <<= 1;
+		}
+		return capacity;
+	}
+
+public:
+
+	explicit LoopbackPipe(uint32_t size) : buffer(RoundUp(size)), mask(buffer.size() - 1)
+	{}
+
+	size_t Write(const openpal::RSlice& data)
+	{
+		const auto num = std::min<size_t>(data.Size(), buffer.size() - static_cast<size_t>(tail - head));
+		const auto offset = static_cast<size_t>(tail & mask);
+		const auto first = std::min(num, buffer.size() - offset);
+
+		memcpy(buffer.data() + offset, data, first);
+		memcpy(buffer.data(), data + first, num - first);
+
+		tail += num;
+		return num;
+	}
+
+	size_t Read(openpal::WSlice& dest, steady_clock_t::time_point now)
+	{
+		while (!marks.empty() && marks.front().readable <= now)
+		{
+			readable = marks.front().end;
+			marks.pop_front();
+		}
+
+		const auto limit = closed ? tail : readable;
+		const auto num = std::min<size_t>(dest.Size(), static_cast<size_t>(limit - head));
+		const auto offset = static_cast<size_t>(head & mask);
+		const auto first = std::min(num, buffer.size() - offset);
+
+		memcpy(dest, buffer.data() + offset, first);
+		memcpy(dest + first, buffer.data(), num - first);
+
+		head += num;
+		return num;
+	}
+
+	// make everything written so far readable at the specified time
+	void Publish(steady_clock_t::time_point time)
+	{
+		marks.push_back(Mark{ tail, time });
+	}
+
+	// make everything written so far readable immediately
+	void Publish()
+	{
+		readable = tail;
+	}
+
+	std::mutex mutex;
+	bool closed = false;
+	std::deque<Mark> marks;
+
+private:
+
+	std::vector<uint8_t> buffer;
+	const uint64_t mask;
+
+	uint64_t head = 0;
+	uint64_t tail = 0;
+	uint64_t readable = 0;
+};
+
+LoopbackChannel::pair_t LoopbackChannel::CreatePair(const std::shared_ptr<Executor>& first, const std::shared_ptr<Executor>& second, const LoopbackConfig& config)
+{
+	return CreatePair(first, config, second, config);
+}
+
+LoopbackChannel::pair_t LoopbackChannel::CreatePair(const std::shared_ptr<Executor>& first, const LoopbackConfig& firstConfig, const std::shared_ptr<Executor>& second, const LoopbackConfig& secondConfig)
+{
+	auto forward = std::make_shared<LoopbackPipe>(firstConfig.bufferSize);
+	auto reverse = std::make_shared<LoopbackPipe>(secondConfig.bufferSize);
+
+	auto channels = std::make_pair(
+	                    std::make_shared<LoopbackChannel>(first, reverse, forward, firstConfig),
+	                    std::make_shared<LoopbackChannel>(second, forward, reverse, secondConfig)
+	                );
+
+	channels.first->peer = channels.second;
+	channels.second->peer = channels.first;
+
+	return channels;
+}
+
+LoopbackChannel::LoopbackChannel(const std::shared_ptr<Executor>& executor, const std::shared_ptr<LoopbackPipe>& rx, const std::shared_ptr<LoopbackPipe>& tx, const LoopbackConfig& config) :
+	IAsyncChannel(executor),
+	config(config),
+	rx(rx),
+	tx(tx),
+	readTimer(executor->strand.get_io_context()),
+	writeTimer(executor->strand.get_io_context())
+{}
+
+void LoopbackChannel::BeginReadImpl(openpal::WSlice buffer)
+{
+	this->readPending = true;
+	this->readBuffer = buffer;
+	this->TryRead();
+}
+
+void LoopbackChannel::BeginWriteImpl(const openpal::RSlice& buffer)
+{
+	this->writePending = true;
+	this->writeClocking = false;
+	this->writeBuffer = buffer;
+	this->numWritten = 0;
+	this->TryWrite();
+}
+
+void LoopbackChannel::ShutdownImpl()
+{
+	this->closed = true;
+
+	for (auto& pipe : { this->rx, this->tx })
+	{
+		std::lock_guard<std::mutex> lock(pipe->mutex);
+		pipe->closed = true;
+	}
+
+	std::error_code ec;
+	this->readTimer.cancel(ec);
+	this->writeTimer.cancel(ec);
+
+	auto self = this->Self();
+	this->executor->strand.post([self]()
+	{
+		self->TryRead();
+		self->TryWrite();
+	});
+
+	this->NotifyPeerReadable();
+	this->NotifyPeerWritable();
+}
+
+void LoopbackChannel::TryRead()
+{
+	if (!this->readPending) return;
+
+	if (this->closed)
+	{
+		this->CompleteRead(std::make_error_code(std::errc::operation_canceled), 0);
+		return;
+	}
+
+	size_t num = 0;
+	bool eof = false;
+	steady_clock_t::time_point next;
+	{
+		std::lock_guard<std::mutex> lock(rx->mutex);
+		num = rx->Read(this->readBuffer, steady_clock_t::now());
+		if (num == 0)
+		{
+			eof = rx->closed;
+			next = rx->marks.empty() ? steady_clock_t::time_point::max() : rx->marks.front().readable;
+		}
+	}
+
+	if (num > 0)
+	{
+		this->NotifyPeerWritable();
+		this->CompleteRead(std::error_code(), num);
+	}
+	else if (eof)
+	{
+		this->CompleteRead(asio::error::eof, 0);
+	}
+	else if (next != steady_clock_t::time_point::max())
+	{
+		// data is in flight but not yet readable
+		auto callback = [self = this->Self()](const std::error_code & ec)
+		{
+			if (ec != std::errc::operation_canceled)
+			{
+				self->TryRead();
+			}
+		};
+
+		this->readTimer.expires_at(next);
+		this->readTimer.async_wait(this->executor->strand.wrap(callback));
+	}
+
+	// otherwise the peer will notify us when it writes
+}
+
+void LoopbackChannel::TryWrite()
+{
+	if (!this->writePending || this->writeClocking) return;
+
+	if (this->closed)
+	{
+		this->CompleteWrite(std::make_error_code(std::errc::operation_canceled), 0);
+		return;
+	}
+
+	size_t num = 0;
+	bool broken = false;
+	auto complete = steady_clock_t::now();
+	{
+		std::lock_guard<std::mutex> lock(tx->mutex);
+		if (tx->closed)
+		{
+			broken = true;
+		}
+		else
+		{
+			num = tx->Write(this->writeBuffer.Skip(static_cast<uint32_t>(this->numWritten)));
+
+			if (num > 0 && this->config.IsShaped())
+			{
+				if (this->config.bytesPerSecond > 0)
+				{
+					// the bytes are clocked out after anything already in flight
+					const auto duration = std::chrono::nanoseconds((static_cast<int64_t>(num) * 1000000000) / static_cast<int64_t>(this->config.bytesPerSecond));
+					this->txIdle = std::max(this->txIdle, complete) + std::chrono::duration_cast<steady_clock_t::duration>(duration);
+					complete = this->txIdle;
+				}
+
+				tx->Publish(complete + std::chrono::milliseconds(this->config.latency.GetMilliseconds()));
+			}
+			else if (num > 0)
+			{
+				tx->Publish();
+			}
+		}
+	}
+
+	if (broken)
+	{
+		this->CompleteWrite(std::make_error_code(std::errc::broken_pipe), 0);
+		return;
+	}
+
+	if (num > 0)
+	{
+		this->numWritten += num;
+		this->NotifyPeerReadable();
+	}
+
+	if (this->numWritten < this->writeBuffer.Size())
+	{
+		// the pipe is full, the peer will notify us when it reads
+		return;
+	}
+
+	if (complete > steady_clock_t::now())
+	{
+		// the write completes when the last byte has been clocked out
+		auto callback = [self = this->Self()](const std::error_code & ec)
+		{
+			self->writeClocking = false;
+			self->CompleteWrite(ec, ec ? 0 : self->numWritten);
+		};
+
+		this->writeClocking = true;
+		this->writeTimer.expires_at(complete);
+		this->writeTimer.async_wait(this->executor->strand.wrap(callback));
+	}
+	else
+	{
+		this->CompleteWrite(std::error_code(), this->numWritten);
+	}
+}
+
+void LoopbackChannel::CompleteRead(const std::error_code& ec, size_t num)
+{
+	this->readPending = false;
+
+	// always complete asynchronously so that a read started from a callback can't recurse
+	auto self = this->Self();
+	this->executor->strand.post([self, ec, num]()
+	{
+		self->OnReadCallback(ec, num);
+	});
+}
+
+void LoopbackChannel::CompleteWrite(const std::error_code& ec, size_t num)
+{
+	if (!this->writePending) return;
+
+	this->writePending = false;
+
+	auto self = this->Self();
+	this->executor->strand.post([self, ec, num]()
+	{
+		self->OnWriteCallback(ec, num);
+	});
+}
+
+void LoopbackChannel::NotifyPeerReadable()
+{
+	auto peer = this->peer.lock();
+	if (peer)
+	{
+		peer->executor->strand.post([peer]()
+		{
+			peer->TryRead();
+		});
+	}
+}
+
+void LoopbackChannel::NotifyPeerWritable()
+{
+	auto peer = this->peer.lock();
+	if (peer)
+	{
+		peer->executor->strand.post([peer]()
+		{
+			peer->TryWrite();
+		});
+	}
+}
+
+}
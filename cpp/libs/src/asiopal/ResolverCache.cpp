@@ -0,0 +1,89 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiopal/ResolverCache.h"
+
+namespace asiopal
+{
+
+ResolverCache::ResolverCache(const openpal::TimeDuration& ttl) :
+	ttl(std::chrono::milliseconds(ttl.GetMilliseconds()))
+{}
+
+bool ResolverCache::Lookup(const std::string& host, uint16_t port, endpoints_t& endpoints)
+{
+	return this->Lookup(host, port, steady_clock_t::now(), endpoints);
+}
+
+bool ResolverCache::Lookup(const std::string& host, uint16_t port, const steady_clock_t::time_point& now, endpoints_t& endpoints)
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	auto iter = this->entries.find(GetKey(host, port));
+
+	if (iter == this->entries.end())
+	{
+		return false;
+	}
+
+	if (now >= iter->second.expiration)
+	{
+		this->entries.erase(iter);
+		return false;
+	}
+
+	endpoints = iter->second.endpoints;
+	return true;
+}
+
+void ResolverCache::Store(const std::string& host, uint16_t port, const endpoints_t& endpoints)
+{
+	this->Store(host, port, endpoints, steady_clock_t::now());
+}
+
+void ResolverCache::Store(const std::string& host, uint16_t port, const endpoints_t& endpoints, const steady_clock_t::time_point& now)
+{
+	if (endpoints.empty())
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->entries[GetKey(host, port)] = Entry { endpoints, now + this->ttl };
+}
+
+void ResolverCache::Remove(const std::string& host, uint16_t port)
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->entries.erase(GetKey(host, port));
+}
+
+size_t ResolverCache::Size() const
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->entries.size();
+}
+
+std::string ResolverCache::GetKey(const std::string& host, uint16_t port)
+{
+	return host + ":" + std::to_string(port);
+}
+
+}
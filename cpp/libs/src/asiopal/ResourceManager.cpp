@@ -21,34 +21,86 @@
 
 #include "asiopal/ResourceManager.h"
 
+#include <iterator>
+#include <thread>
+
 namespace asiopal
 {
 
 void ResourceManager::Detach(const std::shared_ptr<IResource>& resource)
 {
-	std::lock_guard <std::mutex> lock(this->mutex);
-	this->resources.erase(resource);
+	auto& shard = this->GetShard(resource.get());
+	std::lock_guard <std::mutex> lock(shard.mutex);
+
+	// not recorded yet, so a Bind in flight must skip it
+	if (shard.resources.erase(resource) == 0)
+	{
+		// drop entries left by repeated or late detaches of resources that no longer exist
+		for (auto i = shard.detached.begin(); i != shard.detached.end();)
+		{
+			i = i->second.expired() ? shard.detached.erase(i) : std::next(i);
+		}
+
+		shard.detached[resource.get()] = resource;
+	}
 }
 
 void ResourceManager::Shutdown()
 {
-	std::set<std::shared_ptr<asiopal::IResource>> copy;
+	this->is_shutting_down = true;
 
+	// binds that started before the flag was set may still insert into a shard
+	for (auto& counter : this->binds_in_flight)
 	{
-		std::lock_guard <std::mutex> lock(this->mutex);
-		this->is_shutting_down = true;
-		for (auto& resource : this->resources)
+		while (counter.value.load() != 0)
 		{
-			copy.insert(resource);
+			std::this_thread::yield();
 		}
-		resources.clear();
+	}
+
+	std::vector<std::shared_ptr<asiopal::IResource>> copy;
+
+	for (auto& shard : this->shards)
+	{
+		std::lock_guard <std::mutex> lock(shard.mutex);
+		copy.insert(copy.end(), shard.resources.begin(), shard.resources.end());
+		shard.resources.clear();
 	}
 
 	for (auto& resource : copy)
 	{
 		resource->Shutdown();
 	}
+
+	// the resources detach as they shut down, and no Bind can consume those entries anymore
+	for (auto& shard : this->shards)
+	{
+		std::lock_guard <std::mutex> lock(shard.mutex);
+		shard.detached.clear();
+	}
+}
+
+size_t ResourceManager::Size()
+{
+	size_t size = 0;
+	for (auto& shard : this->shards)
+	{
+		std::lock_guard <std::mutex> lock(shard.mutex);
+		size += shard.resources.size();
+	}
+	return size;
+}
+
+ResourceManager::BindCounter& ResourceManager::GetBindCounter()
+{
+	return this->binds_in_flight[std::hash<std::thread::id>()(std::this_thread::get_id()) % NUM_SHARDS];
 }
 
+ResourceManager::Shard& ResourceManager::GetShard(const IResource* resource)
+{
+	// allocations are at least 16 byte aligned, so mix in the bits above the alignment
+	const auto address = reinterpret_cast<uintptr_t>(resource);
+	return this->shards[((address >> 4) ^ (address >> 12)) % NUM_SHARDS];
 }
 
+}
@@ -23,6 +23,8 @@
 
 #include "asiopal/ASIOSerialHelpers.h"
 
+#include <algorithm>
+
 #ifdef USE_FLOCK
 	#include <sys/file.h>
 	#include <cerrno>
@@ -31,7 +33,13 @@
 namespace asiopal
 {
 
-SerialChannel::SerialChannel(std::shared_ptr<Executor> executor) : IAsyncChannel(executor), port(executor->strand.get_io_context())
+SerialChannel::SerialChannel(std::shared_ptr<Executor> executor) :
+	IAsyncChannel(executor),
+	port(executor->strand.get_io_context()),
+	characterTime(0),
+	minInterFrameGap(0),
+	turnaroundDelay(0),
+	paceTimer(executor->strand.get_io_context())
 {}
 
 bool SerialChannel::Open(const SerialSettings& settings, std::error_code& ec)
@@ -56,6 +64,10 @@ bool SerialChannel::Open(const SerialSettings& settings, std::error_code& ec)
 		return false;
 	}
 
+	this->characterTime = GetCharacterTime(settings);
+	this->minInterFrameGap = std::chrono::milliseconds(settings.minInterFrameGap.GetMilliseconds());
+	this->turnaroundDelay = std::chrono::milliseconds(settings.turnaroundDelay.GetMilliseconds());
+
 	return true;
 }
 
@@ -63,6 +75,10 @@ void SerialChannel::BeginReadImpl(openpal::WSlice buffer)
 {
 	auto callback = [this](const std::error_code & ec, size_t num)
 	{
+		if (!ec && num > 0)
+		{
+			this->lastRx = steady_clock_t::now();
+		}
 		this->OnReadCallback(ec, num);
 	};
 
@@ -70,9 +86,51 @@ void SerialChannel::BeginReadImpl(openpal::WSlice buffer)
 }
 
 void SerialChannel::BeginWriteImpl(const openpal::RSlice& buffer)
+{
+	if (!this->IsPaced())
+	{
+		this->StartWrite(buffer);
+		return;
+	}
+
+	// a frame may not start until the remote has released the line and the previous frame has cleared it
+	const auto earliest = std::max(
+	                          this->lastRx + std::chrono::duration_cast<steady_clock_t::duration>(this->turnaroundDelay),
+	                          this->lastTxEnd + std::chrono::duration_cast<steady_clock_t::duration>(this->minInterFrameGap)
+	                      );
+
+	if (earliest <= steady_clock_t::now())
+	{
+		this->StartWrite(buffer);
+		return;
+	}
+
+	auto callback = [this, buffer](const std::error_code & ec)
+	{
+		if (ec)
+		{
+			this->OnWriteCallback(ec, 0);
+		}
+		else
+		{
+			this->StartWrite(buffer);
+		}
+	};
+
+	this->paceTimer.expires_at(earliest);
+	this->paceTimer.async_wait(this->executor->strand.wrap(callback));
+}
+
+void SerialChannel::StartWrite(const openpal::RSlice& buffer)
 {
 	auto callback = [this](const std::error_code & ec, size_t num)
 	{
+		if (!ec)
+		{
+			// the write completes when the bytes reach the driver, not when they leave the wire
+			const auto wireTime = this->characterTime * static_cast<int64_t>(num);
+			this->lastTxEnd = steady_clock_t::now() + std::chrono::duration_cast<steady_clock_t::duration>(wireTime);
+		}
 		this->OnWriteCallback(ec, num);
 	};
 
@@ -86,6 +144,7 @@ void SerialChannel::ShutdownImpl()
 	/* Explicitly unlock serial device handler before exiting.*/
 	flock(port.native_handle(), LOCK_UN);
 #endif
+	paceTimer.cancel(ec);
 	port.close(ec);
 }
 
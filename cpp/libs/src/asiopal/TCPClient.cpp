@@ -23,20 +23,24 @@
 
 #include "asiopal/SocketHelpers.h"
 
+#include <sstream>
+
 namespace asiopal
 {
 
 TCPClient::TCPClient(
     const openpal::Logger& logger,
     const std::shared_ptr<Executor>& executor,
-    const std::string& adapter
+    const std::string& adapter,
+    const std::shared_ptr<ResolverCache>& cache
 ) :
 	condition(logger),
 	executor(executor),
 	adapter(adapter),
 	socket(executor->strand.get_io_context()),
 	localEndpoint(),
-	resolver(executor->strand.get_io_context())
+	resolver(executor->strand.get_io_context()),
+	cache(cache)
 {}
 
 
@@ -50,6 +54,18 @@ bool TCPClient::Cancel()
 	std::error_code ec;
 	socket.cancel(ec);
 	resolver.cancel();
+
+	if (this->race)
+	{
+		this->race->complete = true;
+		this->race->timer.cancel(ec);
+		for (auto& attempt : this->race->sockets)
+		{
+			attempt->cancel(ec);
+		}
+		this->race.reset();
+	}
+
 	this->canceled = true;
 	return true;
 }
@@ -68,14 +84,53 @@ bool TCPClient::BeginConnect(const IPEndpoint& remote, const connect_callback_t&
 		return this->PostConnectError(callback, ec);
 	}
 
+	auto cb = [self = shared_from_this(), callback, remote](const std::error_code & ec, const ResolverCache::endpoints_t& endpoints)
+	{
+		self->HandleResolveResult(callback, remote, endpoints, ec);
+	};
+
+	this->Resolve(remote, cb);
+	return true;
+}
+
+bool TCPClient::BeginConnect(const std::vector<IPEndpoint>& remotes, const openpal::TimeDuration& attemptDelay, const connect_callback_t& callback)
+{
+	if (connecting || canceled || remotes.empty()) return false;
+
+	this->connecting = true;
+	this->race = std::make_shared<Race>(this->executor->strand.get_io_context(), remotes, attemptDelay, callback);
+	this->StartNextAttempt(this->race);
+	return true;
+}
+
+void TCPClient::Resolve(const IPEndpoint& remote, const resolve_callback_t& callback)
+{
+	std::error_code ec;
 	const auto address = asio::ip::address::from_string(remote.address, ec);
-	auto self = this->shared_from_this();
-	if (ec)
+
+	ResolverCache::endpoints_t endpoints;
+
+	if (!ec)
+	{
+		endpoints.push_back(asio::ip::tcp::endpoint(address, remote.port));
+	}
+	else if (!(this->cache && this->cache->Lookup(remote.address, remote.port, endpoints)))
 	{
 		// Try DNS resolution instead
-		auto cb = [self, callback](const std::error_code & ec, asio::ip::tcp::resolver::iterator endpoints)
+		auto cb = [self = shared_from_this(), callback, remote](const std::error_code & ec, asio::ip::tcp::resolver::iterator iter)
 		{
-			self->HandleResolveResult(callback, endpoints, ec);
+			ResolverCache::endpoints_t endpoints;
+			for (; iter != asio::ip::tcp::resolver::iterator(); ++iter)
+			{
+				endpoints.push_back(*iter);
+			}
+
+			if (!ec && self->cache)
+			{
+				self->cache->Store(remote.address, remote.port, endpoints);
+			}
+
+			callback(ec, endpoints);
 		};
 
 		std::stringstream portstr;
@@ -86,28 +141,35 @@ bool TCPClient::BeginConnect(const IPEndpoint& remote, const connect_callback_t&
 		    executor->strand.wrap(cb)
 		);
 
-		return true;
+		return;
+	}
+
+	callback(std::error_code(), endpoints);
+}
+
+void TCPClient::AsyncConnect(asio::ip::tcp::socket& socket, const ResolverCache::endpoints_t& endpoints, const std::function<void(const std::error_code&)>& callback)
+{
+	if (endpoints.size() == 1)
+	{
+		// connecting to a single endpoint preserves the binding to the local adapter
+		socket.async_connect(endpoints.front(), this->executor->strand.wrap(callback));
 	}
 	else
 	{
-		asio::ip::tcp::endpoint remoteEndpoint(address, remote.port);
-		auto cb = [self, callback](const std::error_code & ec)
+		auto list = std::make_shared<ResolverCache::endpoints_t>(endpoints);
+		auto cb = [list, callback](const std::error_code & ec, ResolverCache::endpoints_t::const_iterator)
 		{
-			self->connecting = false;
-			if (!self->canceled)
-			{
-				callback(self->executor, std::move(self->socket), ec);
-			}
+			callback(ec);
 		};
 
-		socket.async_connect(remoteEndpoint, executor->strand.wrap(cb));
-		return true;
+		asio::async_connect(socket, list->cbegin(), list->cend(), this->condition, this->executor->strand.wrap(cb));
 	}
 }
 
 void TCPClient::HandleResolveResult(
     const connect_callback_t& callback,
-    const asio::ip::tcp::resolver::iterator& endpoints,
+    const IPEndpoint& remote,
+    const ResolverCache::endpoints_t& endpoints,
     const std::error_code& ec
 )
 {
@@ -117,9 +179,15 @@ void TCPClient::HandleResolveResult(
 	}
 	else
 	{
-		// attempt a connection to each endpoint in the iterator until we connect
-		auto cb = [self = shared_from_this(), callback](const std::error_code & ec, asio::ip::tcp::resolver::iterator endpoints)
+		// attempt a connection to each endpoint in the list until we connect
+		auto cb = [self = shared_from_this(), callback, remote](const std::error_code & ec)
 		{
+			if (ec && self->cache)
+			{
+				// the cached addresses may be stale, resolve again on the next attempt
+				self->cache->Remove(remote.address, remote.port);
+			}
+
 			self->connecting = false;
 			if (!self->canceled)
 			{
@@ -127,7 +195,150 @@ void TCPClient::HandleResolveResult(
 			}
 		};
 
-		asio::async_connect(this->socket, endpoints, this->condition, this->executor->strand.wrap(cb));
+		this->AsyncConnect(this->socket, endpoints, cb);
+	}
+}
+
+void TCPClient::StartNextAttempt(const std::shared_ptr<Race>& race)
+{
+	if (race->complete || race->next >= race->remotes.size())
+	{
+		return;
+	}
+
+	const auto remote = race->remotes[race->next];
+	++race->next;
+	++race->numPending;
+
+	if (race->next < race->remotes.size())
+	{
+		// don't wait for this attempt to fail before trying the next remote
+		auto timeout = [self = shared_from_this(), race, attempt = race->next](const std::error_code & ec)
+		{
+			// a failed attempt starts the next remote itself, and canceling the timer doesn't
+			// stop a completion that was already queued, so only start it if nothing else has
+			if (!ec && !self->canceled && race->next == attempt)
+			{
+				self->StartNextAttempt(race);
+			}
+		};
+
+		race->timer.expires_from_now(race->attemptDelay);
+		race->timer.async_wait(this->executor->strand.wrap(timeout));
+	}
+
+	auto resolved = [self = shared_from_this(), race, remote](const std::error_code & ec, const ResolverCache::endpoints_t& endpoints)
+	{
+		if (ec)
+		{
+			self->OnAttemptFailed(race, ec);
+		}
+		else
+		{
+			self->OnAttemptResolved(race, remote, endpoints);
+		}
+	};
+
+	this->Resolve(remote, resolved);
+}
+
+void TCPClient::OnAttemptResolved(const std::shared_ptr<Race>& race, const IPEndpoint& remote, const ResolverCache::endpoints_t& endpoints)
+{
+	if (race->complete)
+	{
+		--race->numPending;
+		return;
+	}
+
+	auto attempt = std::make_unique<asio::ip::tcp::socket>(this->executor->strand.get_io_context());
+
+	asio::ip::tcp::endpoint local;
+	std::error_code ec;
+	SocketHelpers::BindToLocalAddress(this->adapter, local, *attempt, ec);
+
+	if (ec)
+	{
+		this->OnAttemptFailed(race, ec);
+		return;
+	}
+
+	auto& socket = *attempt;
+	race->sockets.push_back(std::move(attempt));
+
+	auto cb = [self = shared_from_this(), race, remote, &socket](const std::error_code & ec)
+	{
+		if (ec)
+		{
+			if (self->cache && ec != std::errc::operation_canceled)
+			{
+				self->cache->Remove(remote.address, remote.port);
+			}
+
+			self->OnAttemptFailed(race, ec);
+		}
+		else
+		{
+			self->OnAttemptConnected(race, socket);
+		}
+	};
+
+	this->AsyncConnect(socket, endpoints, cb);
+}
+
+void TCPClient::OnAttemptFailed(const std::shared_ptr<Race>& race, const std::error_code& ec)
+{
+	--race->numPending;
+
+	if (race->complete || this->canceled)
+	{
+		return;
+	}
+
+	race->lastError = ec;
+
+	if (race->next < race->remotes.size())
+	{
+		// start the next attempt right away instead of waiting for the timer
+		std::error_code ignored;
+		race->timer.cancel(ignored);
+		this->StartNextAttempt(race);
+	}
+	else if (race->numPending == 0)
+	{
+		race->complete = true;
+		this->race.reset();
+		this->PostConnectError(race->callback, race->lastError);
+	}
+}
+
+void TCPClient::OnAttemptConnected(const std::shared_ptr<Race>& race, asio::ip::tcp::socket& socket)
+{
+	--race->numPending;
+
+	if (race->complete)
+	{
+		return;
+	}
+
+	race->complete = true;
+
+	// cancel all of the losing attempts
+	std::error_code ec;
+	race->timer.cancel(ec);
+	for (auto& attempt : race->sockets)
+	{
+		if (attempt.get() != &socket)
+		{
+			attempt->close(ec);
+		}
+	}
+
+	this->race.reset();
+	this->connecting = false;
+
+	if (!this->canceled)
+	{
+		race->callback(this->executor, std::move(socket), std::error_code());
 	}
 }
 
@@ -146,5 +357,3 @@ bool TCPClient::PostConnectError(const connect_callback_t& callback, const std::
 }
 
 }
-
-
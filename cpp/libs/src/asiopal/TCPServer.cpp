@@ -42,9 +42,28 @@ TCPServer::TCPServer(
 	executor(executor),
 	endpoint(ip::tcp::v4(), endpoint.port),
 	acceptor(executor->strand.get_io_context()),
-	socket(executor->strand.get_io_context())
+	socket(executor->strand.get_io_context()),
+	session_id(0),
+	session_id_stride(1)
 {
-	this->Configure(endpoint.address, ec);
+	this->Configure(endpoint.address, false, ec);
+}
+
+TCPServer::TCPServer(
+    const openpal::Logger& logger,
+    const std::shared_ptr<Executor>& executor,
+    const IPEndpoint& endpoint,
+    const AcceptorShard& shard,
+    std::error_code& ec) :
+	logger(logger),
+	executor(executor),
+	endpoint(ip::tcp::v4(), endpoint.port),
+	acceptor(executor->strand.get_io_context()),
+	socket(executor->strand.get_io_context()),
+	session_id(shard.index),
+	session_id_stride(shard.count)
+{
+	this->Configure(endpoint.address, shard.IsShared(), ec);
 }
 
 void TCPServer::Shutdown()
@@ -58,7 +77,7 @@ void TCPServer::Shutdown()
 	}
 }
 
-void TCPServer::Configure(const std::string& adapter, std::error_code& ec)
+void TCPServer::Configure(const std::string& adapter, bool reusePort, std::error_code& ec)
 {
 	auto address = asio::ip::address::from_string(adapter, ec);
 
@@ -82,6 +101,21 @@ void TCPServer::Configure(const std::string& adapter, std::error_code& ec)
 		return;
 	}
 
+	if (reusePort)
+	{
+#ifdef SO_REUSEPORT
+		typedef asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT> reuse_port;
+		acceptor.set_option(reuse_port(true), ec);
+#else
+		ec = std::make_error_code(std::errc::operation_not_supported);
+#endif
+
+		if (ec)
+		{
+			return;
+		}
+	}
+
 	acceptor.bind(this->endpoint, ec);
 
 	if (ec)
@@ -112,13 +146,10 @@ void TCPServer::StartAccept()
 		else
 		{
 			const auto ID = self->session_id;
-			++self->session_id;
-
-
-			FORMAT_LOG_BLOCK(self->logger, flags::INFO, "Accepted connection from: %s", self->remote_endpoint.address().to_string().c_str());
+			self->session_id += self->session_id_stride;
 
 			// method responsible for closing
-			self->AcceptConnection(ID, self->executor, std::move(self->socket));
+			self->AcceptConnection(ID, self->executor, std::move(self->socket), self->remote_endpoint);
 			self->StartAccept();
 		}
 	};
@@ -32,7 +32,28 @@ SSLContext::SSLContext(const openpal::Logger& logger, bool server, const TLSConf
 	value(server ? asio::ssl::context_base::sslv23_server : asio::ssl::context_base::sslv23_client),
 	logger(logger)
 {
-	this->ApplyConfig(config, server, ec);
+	this->ApplyConfig(config, server, nullptr, ec);
+}
+
+SSLContext::SSLContext(const openpal::Logger& logger, bool server, const TLSConfig& config, const std::shared_ptr<TLSSessionCache>& sessions, std::error_code& ec) :
+	value(server ? asio::ssl::context_base::sslv23_server : asio::ssl::context_base::sslv23_client),
+	logger(logger)
+{
+	this->ApplyConfig(config, server, sessions, ec);
+}
+
+SSLContext::~SSLContext()
+{
+	// streams can outlive this object and keep the underlying SSL_CTX alive
+	if (this->sessions)
+	{
+		this->sessions->Detach(value.native_handle());
+	}
+
+	if (this->tickets)
+	{
+		this->tickets->Detach(value.native_handle());
+	}
 }
 
 int SSLContext::GetVerifyMode(bool server)
@@ -40,12 +61,17 @@ int SSLContext::GetVerifyMode(bool server)
 	return server ? (asio::ssl::verify_peer | asio::ssl::verify_fail_if_no_peer_cert) : asio::ssl::verify_peer;
 }
 
-std::error_code SSLContext::ApplyConfig(const TLSConfig& config, bool server, std::error_code& ec)
+std::error_code SSLContext::ApplyConfig(const TLSConfig& config, bool server, const std::shared_ptr<TLSSessionCache>& sessions, std::error_code& ec)
 {
-	// turn off session caching completely
+	// session caching is off unless explicitly enabled
 	SSL_CTX_set_session_cache_mode(value.native_handle(), SSL_SESS_CACHE_OFF);
 
-	auto OPTIONS = asio::ssl::context::default_workarounds | asio::ssl::context::no_sslv2 | asio::ssl::context::no_sslv3 | SSL_OP_NO_TICKET;
+	auto OPTIONS = asio::ssl::context::default_workarounds | asio::ssl::context::no_sslv2 | asio::ssl::context::no_sslv3;
+
+	if (!(config.allowSessionResumption && config.allowSessionTickets))
+	{
+		OPTIONS |= SSL_OP_NO_TICKET;
+	}
 
 	if (!config.allowTLSv10)
 	{
@@ -109,6 +135,51 @@ std::error_code SSLContext::ApplyConfig(const TLSConfig& config, bool server, st
 	if (value.use_private_key_file(config.privateKeyFilePath, asio::ssl::context_base::file_format::pem, ec))
 	{
 		FORMAT_LOG_BLOCK(logger, flags::ERR, "Error calling ssl::context::use_private_key_file(..): %s", ec.message().c_str());
+		return ec;
+	}
+
+	if (config.allowSessionResumption)
+	{
+		this->ConfigureSessionResumption(config, server, sessions, ec);
+	}
+
+	return ec;
+}
+
+std::error_code SSLContext::ConfigureSessionResumption(const TLSConfig& config, bool server, const std::shared_ptr<TLSSessionCache>& sessions, std::error_code& ec)
+{
+	const auto handle = value.native_handle();
+
+	SSL_CTX_set_timeout(handle, static_cast<long>(config.sessionTimeoutSeconds));
+
+	if (!server)
+	{
+		this->sessions = sessions ? sessions : std::make_shared<TLSSessionCache>();
+		this->sessions->Attach(handle);
+		return ec;
+	}
+
+	SSL_CTX_set_session_cache_mode(handle, SSL_SESS_CACHE_SERVER);
+	SSL_CTX_sess_set_cache_size(handle, static_cast<long>(config.sessionCacheSize));
+
+	// sessions can't be resumed on a context that verifies the peer unless it has an id context
+	const unsigned char SESSION_ID_CONTEXT[] = "opendnp3";
+	if (SSL_CTX_set_session_id_context(handle, SESSION_ID_CONTEXT, sizeof(SESSION_ID_CONTEXT) - 1) != 1)
+	{
+		ec = std::make_error_code(std::errc::invalid_argument);
+		FORMAT_LOG_BLOCK(logger, flags::ERR, "Error calling SSL_CTX_set_session_id_context(..): %s", ec.message().c_str());
+		return ec;
+	}
+
+	if (config.allowSessionTickets)
+	{
+		this->tickets.reset(new TLSTicketKeys(std::chrono::seconds(config.ticketKeyRotationSeconds)));
+		if (!this->tickets->Attach(handle))
+		{
+			ec = std::make_error_code(std::errc::invalid_argument);
+			FORMAT_LOG_BLOCK(logger, flags::ERR, "Error configuring session ticket keys: %s", ec.message().c_str());
+			return ec;
+		}
 	}
 
 	return ec;
@@ -22,6 +22,8 @@
 #define ASIOPAL_SSLCONTEXT_H
 
 #include "asiopal/TLSConfig.h"
+#include "asiopal/tls/TLSSessionCache.h"
+#include "asiopal/tls/TLSTicketKeys.h"
 
 #include <openpal/util/Uncopyable.h>
 #include <openpal/logging/Logger.h>
@@ -40,16 +42,34 @@ public:
 
 	SSLContext(const openpal::Logger& logger, bool server, const TLSConfig& cfg, std::error_code&);
 
+	/**
+	* @param sessions client-side session store shared with other contexts, e.g. those of previous connection
+	* attempts to the same endpoints. Ignored if resumption is disabled, a private store is created if nullptr.
+	*/
+	SSLContext(const openpal::Logger& logger, bool server, const TLSConfig& cfg, const std::shared_ptr<TLSSessionCache>& sessions, std::error_code&);
+
+	~SSLContext();
 
 	asio::ssl::context value;
 
+	/// client-side sessions per remote endpoint, nullptr if resumption is disabled or this is a server context
+	TLSSessionCache* GetSessionCache() const
+	{
+		return sessions.get();
+	}
+
 private:
 
 	openpal::Logger logger;
 
+	std::shared_ptr<TLSSessionCache> sessions;
+	std::unique_ptr<TLSTicketKeys> tickets;
+
 	static int GetVerifyMode(bool server);
 
-	std::error_code ApplyConfig(const TLSConfig& config, bool server, std::error_code& ec);
+	std::error_code ConfigureSessionResumption(const TLSConfig& config, bool server, const std::shared_ptr<TLSSessionCache>& sessions, std::error_code& ec);
+
+	std::error_code ApplyConfig(const TLSConfig& config, bool server, const std::shared_ptr<TLSSessionCache>& sessions, std::error_code& ec);
 };
 
 }
@@ -34,15 +34,19 @@ namespace asiopal
 TLSClient::TLSClient(
     const Logger& logger,
     const std::shared_ptr<Executor>& executor,
+    const std::shared_ptr<TLSHandshakeGate>& gate,
     const std::string& adapter,
     const TLSConfig& config,
+    const std::shared_ptr<TLSSessionCache>& sessions,
     std::error_code& ec)
 	:
 	logger(logger),
 	condition(logger),
 	executor(executor),
 	adapter(adapter),
-	ctx(logger, false, config, ec),
+	gate(gate ? gate : TLSHandshakeGate::Create(nullptr, 0)),
+	handshakeTimeout(openpal::TimeDuration::Seconds(config.handshakeTimeoutSeconds)),
+	ctx(logger, false, config, sessions, ec),
 	localEndpoint(),
 	resolver(executor->strand.get_io_service())
 {
@@ -58,6 +62,7 @@ bool TLSClient::Cancel()
 
 	std::error_code ec;
 	resolver.cancel();
+	gate->Clear(this);
 	this->canceled = true;
 	return true;
 }
@@ -74,6 +79,12 @@ bool TLSClient::BeginConnect(const IPEndpoint& remote, const connect_callback_t&
 		return preverified;
 	};
 
+	const auto sessionKey = GetSessionKey(remote);
+	if (this->ctx.GetSessionCache())
+	{
+		this->ctx.GetSessionCache()->Prepare(stream->native_handle(), sessionKey);
+	}
+
 	std::error_code ec;
 	stream->set_verify_callback(verify, ec);
 
@@ -112,9 +123,9 @@ bool TLSClient::BeginConnect(const IPEndpoint& remote, const connect_callback_t&
 	if (ec)
 	{
 		// Try DNS resolution instead
-		auto cb = [self, callback, stream](const std::error_code & ec, asio::ip::tcp::resolver::iterator endpoints)
+		auto cb = [self, callback, sessionKey, stream](const std::error_code & ec, asio::ip::tcp::resolver::iterator endpoints)
 		{
-			self->HandleResolveResult(callback, stream, endpoints, ec);
+			self->HandleResolveResult(callback, sessionKey, stream, endpoints, ec);
 		};
 
 		std::stringstream portstr;
@@ -130,9 +141,9 @@ bool TLSClient::BeginConnect(const IPEndpoint& remote, const connect_callback_t&
 	else
 	{
 		asio::ip::tcp::endpoint remoteEndpoint(address, remote.port);
-		auto cb = [self, stream, callback](const std::error_code & ec)
+		auto cb = [self, stream, sessionKey, callback](const std::error_code & ec)
 		{
-			self->HandleConnectResult(callback, stream, ec);
+			self->HandleConnectResult(callback, sessionKey, stream, ec);
 		};
 
 		stream->lowest_layer().async_connect(remoteEndpoint, executor->strand.wrap(cb));
@@ -162,8 +173,16 @@ void TLSClient::LogVerifyCallback(bool preverified, asio::ssl::verify_context& c
 	}
 }
 
+std::string TLSClient::GetSessionKey(const IPEndpoint& remote)
+{
+	std::ostringstream oss;
+	oss << remote.address << ":" << remote.port;
+	return oss.str();
+}
+
 void TLSClient::HandleResolveResult(
     const connect_callback_t& callback,
+    const std::string& sessionKey,
     const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream,
     const asio::ip::tcp::resolver::iterator& endpoints,
     const std::error_code& ec)
@@ -178,9 +197,9 @@ void TLSClient::HandleResolveResult(
 	else
 	{
 		// attempt a connection to each endpoint in the iterator until we connect
-		auto cb = [self = this->shared_from_this(), callback, stream](const std::error_code & ec, asio::ip::tcp::resolver::iterator endpoints)
+		auto cb = [self = this->shared_from_this(), callback, sessionKey, stream](const std::error_code & ec, asio::ip::tcp::resolver::iterator endpoints)
 		{
-			self->HandleConnectResult(callback, stream, ec);
+			self->HandleConnectResult(callback, sessionKey, stream, ec);
 		};
 
 		asio::async_connect(stream->lowest_layer(), endpoints, this->condition, this->executor->strand.wrap(cb));
@@ -189,6 +208,7 @@ void TLSClient::HandleResolveResult(
 
 void TLSClient::HandleConnectResult(
     const connect_callback_t& callback,
+    const std::string& sessionKey,
     const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream,
     const std::error_code& ec)
 {
@@ -201,15 +221,62 @@ void TLSClient::HandleConnectResult(
 	}
 	else
 	{
-		auto cb = [self = shared_from_this(), callback, stream](const std::error_code & ec)
+		auto start = [self = shared_from_this(), callback, sessionKey, stream](const std::shared_ptr<Executor>& strand, const TLSHandshakeGate::release_t& release)
 		{
-			if (!self->canceled)
+			// runs on the handshake strand, the result is handled back on the client's strand
+			auto cb = [self, release, callback, sessionKey, stream, start = steady_clock_t::now()](const std::error_code & ec)
 			{
-				callback(self->executor, stream, ec);
-			}
+				release();
+
+				self->executor->strand.post([self, callback, sessionKey, stream, start, ec]()
+				{
+					self->HandleHandshakeResult(callback, sessionKey, stream, start, ec);
+				});
+			};
+
+			stream->async_handshake(asio::ssl::stream_base::client, strand->strand.wrap(cb));
+		};
+
+		// closing the socket completes the pending handshake operation with an error
+		auto abort = [stream]()
+		{
+			std::error_code ec;
+			stream->lowest_layer().close(ec);
 		};
 
-		stream->async_handshake(asio::ssl::stream_base::client, executor->strand.wrap(cb));
+		this->gate->Submit(this, this->executor, this->handshakeTimeout, start, abort);
+	}
+}
+
+void TLSClient::HandleHandshakeResult(
+    const connect_callback_t& callback,
+    const std::string& sessionKey,
+    const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream,
+    steady_clock_t::time_point start,
+    const std::error_code& ec)
+{
+	if (ec)
+	{
+		++this->statistics.numHandshakeFail;
+
+		// don't offer a session that may have caused the failure again
+		if (this->ctx.GetSessionCache())
+		{
+			this->ctx.GetSessionCache()->Remove(sessionKey);
+		}
+	}
+	else
+	{
+		const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(steady_clock_t::now() - start).count();
+		const bool resumed = SSL_session_reused(stream->native_handle()) == 1;
+		this->statistics.OnHandshake(resumed, static_cast<uint64_t>(elapsed));
+
+		FORMAT_LOG_BLOCK(this->logger, flags::INFO, "TLS handshake complete (%s) in %lld us", resumed ? "resumed" : "full", static_cast<long long>(elapsed));
+	}
+
+	if (!this->canceled)
+	{
+		callback(this->executor, stream, ec);
 	}
 }
 
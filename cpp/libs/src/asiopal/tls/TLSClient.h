@@ -23,10 +23,14 @@
 
 #include "asiopal/Executor.h"
 #include "asiopal/IPEndpoint.h"
+#include "asiopal/SteadyClock.h"
 #include "asiopal/LoggingConnectionCondition.h"
 #include "asiopal/TLSConfig.h"
+#include "asiopal/TLSStatistics.h"
 
 #include "asiopal/tls/SSLContext.h"
+#include "asiopal/tls/TLSHandshakeGate.h"
+#include "asiopal/tls/TLSSessionCache.h"
 
 #include <asio/ssl.hpp>
 
@@ -43,19 +47,28 @@ public:
 	static std::shared_ptr<TLSClient> Create(
 	    const openpal::Logger& logger,
 	    const std::shared_ptr<Executor>& executor,
+	    const std::shared_ptr<TLSHandshakeGate>& gate,
 	    const std::string& adapter,
 	    const TLSConfig& config,
+	    const std::shared_ptr<TLSSessionCache>& sessions,
 	    std::error_code& ec)
 	{
-		auto ret = std::make_shared<TLSClient>(logger, executor, adapter, config, ec);
+		auto ret = std::make_shared<TLSClient>(logger, executor, gate, adapter, config, sessions, ec);
 		return ec ? nullptr : ret;
 	}
 
+	/**
+	* @param gate admission control shared with the other TLS clients and servers, a private unlimited gate is created if nullptr
+	* @param sessions client-side TLS sessions, shared between clients so that a new client can resume
+	* the sessions of the previous one. Only used when resumption is enabled, a private cache is created if nullptr.
+	*/
 	TLSClient(
 	    const openpal::Logger& logger,
 	    const std::shared_ptr<Executor>& executor,
+	    const std::shared_ptr<TLSHandshakeGate>& gate,
 	    const std::string& adapter,
 	    const TLSConfig& config,
+	    const std::shared_ptr<TLSSessionCache>& sessions,
 	    std::error_code& ec
 	);
 
@@ -63,12 +76,21 @@ public:
 
 	bool BeginConnect(const IPEndpoint& remote, const connect_callback_t& callback);
 
+	/// Handshake counters, only safe to read from the executor's strand
+	const TLSStatistics& GetStatistics() const
+	{
+		return statistics;
+	}
+
 private:
 
+	static std::string GetSessionKey(const IPEndpoint& remote);
+
 	void LogVerifyCallback(bool preverified, asio::ssl::verify_context& ctx);
 
 	void HandleResolveResult(
 	    const connect_callback_t& callback,
+	    const std::string& sessionKey,
 	    const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream,
 	    const asio::ip::tcp::resolver::iterator& endpoints,
 	    const std::error_code& ec
@@ -76,16 +98,28 @@ private:
 
 	void HandleConnectResult(
 	    const connect_callback_t& callback,
+	    const std::string& sessionKey,
+	    const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream,
+	    const std::error_code& ec
+	);
+
+	void HandleHandshakeResult(
+	    const connect_callback_t& callback,
+	    const std::string& sessionKey,
 	    const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream,
+	    steady_clock_t::time_point start,
 	    const std::error_code& ec
 	);
 
 	bool canceled = false;
+	TLSStatistics statistics;
 
 	openpal::Logger logger;
 	LoggingConnectionCondition condition;
 	const std::shared_ptr<Executor> executor;
 	const std::string adapter;
+	const std::shared_ptr<TLSHandshakeGate> gate;
+	const openpal::TimeDuration handshakeTimeout;
 	SSLContext ctx;
 	asio::ip::tcp::endpoint localEndpoint;
 	asio::ip::tcp::resolver resolver;
@@ -0,0 +1,185 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiopal/tls/TLSHandshakeGate.h"
+
+#include <openpal/executor/ITimer.h>
+
+namespace asiopal
+{
+
+TLSHandshakeGate::TLSHandshakeGate(const std::shared_ptr<IO>& io, uint32_t maxConcurrent) :
+	io(io),
+	maxConcurrent(maxConcurrent)
+{}
+
+void TLSHandshakeGate::Submit(
+    const void* owner,
+    const std::shared_ptr<Executor>& executor,
+    const openpal::TimeDuration& timeout,
+    const start_handshake_t& start,
+    const abort_handshake_t& abort)
+{
+	auto bound = this->Bind(executor, timeout, start, abort);
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		if (this->maxConcurrent && (this->active >= this->maxConcurrent))
+		{
+			this->queued.push_back(Queued { owner, bound });
+			return;
+		}
+
+		++this->active;
+		if (this->active > this->peak)
+		{
+			this->peak = this->active;
+		}
+	}
+
+	bound();
+}
+
+void TLSHandshakeGate::Release()
+{
+	start_t next;
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		if (this->queued.empty())
+		{
+			if (this->active > 0)
+			{
+				--this->active;
+			}
+			return;
+		}
+
+		// hand the slot directly to the next handshake in line
+		next = this->queued.front().start;
+		this->queued.pop_front();
+	}
+
+	next();
+}
+
+void TLSHandshakeGate::Clear(const void* owner)
+{
+	std::deque<Queued> discarded;
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		std::deque<Queued> retained;
+		for (auto& entry : this->queued)
+		{
+			(entry.owner == owner ? discarded : retained).push_back(std::move(entry));
+		}
+		this->queued.swap(retained);
+	}
+
+	// the queued closures may own the last reference to their sockets, destroy them outside the lock
+	discarded.clear();
+}
+
+uint32_t TLSHandshakeGate::NumActive() const
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->active;
+}
+
+uint32_t TLSHandshakeGate::NumQueued() const
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return static_cast<uint32_t>(this->queued.size());
+}
+
+uint32_t TLSHandshakeGate::PeakActive() const
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->peak;
+}
+
+uint32_t TLSHandshakeGate::NumTimeouts() const
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->timeouts;
+}
+
+TLSHandshakeGate::start_t TLSHandshakeGate::Bind(
+    const std::shared_ptr<Executor>& executor,
+    const openpal::TimeDuration& timeout,
+    const start_handshake_t& start,
+    const abort_handshake_t& abort)
+{
+	auto self = this->shared_from_this();
+
+	return [self, executor, timeout, start, abort]()
+	{
+		// even the first step of a handshake (e.g. key share generation) runs on the handshake strand
+		auto strand = self->io ? Executor::Create(self->io) : executor->Fork();
+
+		strand->strand.post([self, strand, timeout, start, abort]()
+		{
+			// the deadline and the completion both run on the handshake strand, so this needs no lock
+			auto released = std::make_shared<bool>(false);
+			openpal::ITimer* deadline = nullptr;
+
+			if (timeout.IsPostive())
+			{
+				deadline = strand->Start(timeout, [self, released, abort]()
+				{
+					if (*released) return;
+
+					*released = true;
+
+					{
+						std::lock_guard<std::mutex> lock(self->mutex);
+						++self->timeouts;
+					}
+
+					abort();
+					self->Release();
+				});
+			}
+
+			auto release = [self, released, deadline]()
+			{
+				if (*released) return;
+
+				*released = true;
+
+				// the timer is still pending, otherwise it would have set the flag
+				if (deadline)
+				{
+					deadline->Cancel();
+				}
+
+				self->Release();
+			};
+
+			start(strand, release);
+		});
+	};
+}
+
+}
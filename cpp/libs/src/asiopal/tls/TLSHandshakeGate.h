@@ -0,0 +1,134 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_TLSHANDSHAKEGATE_H
+#define ASIOPAL_TLSHANDSHAKEGATE_H
+
+#include "asiopal/Executor.h"
+
+#include <openpal/executor/TimeDuration.h>
+#include <openpal/util/Uncopyable.h>
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace asiopal
+{
+
+/**
+* Admission control and placement for TLS handshakes
+*
+* Every admitted handshake runs on its own strand, either on a dedicated handshake io_context
+* or forked from the data-plane executor, so that certificate verification and key exchange are
+* neither serialized on the listener's strand nor able to occupy every data-plane thread.
+*
+* A single gate is shared by all the TLS clients and servers of a manager. Each admitted handshake
+* holds its slot until it completes or its deadline expires, whichever comes first. On expiry the
+* handshake is aborted and the slot goes to the next handshake in line, so that a stalled peer
+* cannot hold a slot forever.
+*
+* Thread-safe: handshakes are submitted from the owners' strands and released from their own.
+*/
+class TLSHandshakeGate final : public std::enable_shared_from_this<TLSHandshakeGate>, private openpal::Uncopyable
+{
+
+public:
+
+	/// Gives up the slot of a handshake, only the first call has any effect. Must be called on the handshake strand.
+	typedef std::function<void()> release_t;
+
+	typedef std::function<void(const std::shared_ptr<Executor>& strand, const release_t& release)> start_handshake_t;
+
+	/// Invoked on the handshake strand when the deadline expires, e.g. to close the socket
+	typedef std::function<void()> abort_handshake_t;
+
+	/**
+	* @param io io_context dedicated to handshakes, or nullptr to fork strands from the data-plane executor
+	* @param maxConcurrent maximum number of handshakes in progress at once, 0 == unlimited
+	*/
+	TLSHandshakeGate(const std::shared_ptr<IO>& io, uint32_t maxConcurrent);
+
+	static std::shared_ptr<TLSHandshakeGate> Create(const std::shared_ptr<IO>& io, uint32_t maxConcurrent)
+	{
+		return std::make_shared<TLSHandshakeGate>(io, maxConcurrent);
+	}
+
+	/**
+	* Start the handshake on a new strand when a slot is available, otherwise queue it in FIFO order
+	*
+	* @param owner identifies the client or server that submitted the handshake, see Clear()
+	* @param timeout deadline of the handshake from the moment it is started, 0 == none
+	*/
+	void Submit(
+	    const void* owner,
+	    const std::shared_ptr<Executor>& executor,
+	    const openpal::TimeDuration& timeout,
+	    const start_handshake_t& start,
+	    const abort_handshake_t& abort
+	);
+
+	/// Discard the queued handshakes of an owner, e.g. when it shuts down
+	void Clear(const void* owner);
+
+	uint32_t NumActive() const;
+
+	uint32_t NumQueued() const;
+
+	/// Highest number of handshakes that were ever in progress at once
+	uint32_t PeakActive() const;
+
+	/// Number of handshakes aborted because their deadline expired
+	uint32_t NumTimeouts() const;
+
+private:
+
+	typedef std::function<void()> start_t;
+
+	struct Queued
+	{
+		const void* owner;
+		start_t start;
+	};
+
+	start_t Bind(
+	    const std::shared_ptr<Executor>& executor,
+	    const openpal::TimeDuration& timeout,
+	    const start_handshake_t& start,
+	    const abort_handshake_t& abort
+	);
+
+	void Release();
+
+	const std::shared_ptr<IO> io;
+	const uint32_t maxConcurrent;
+
+	mutable std::mutex mutex;
+	uint32_t active = 0;
+	uint32_t peak = 0;
+	uint32_t timeouts = 0;
+	std::deque<Queued> queued;
+};
+
+}
+
+#endif
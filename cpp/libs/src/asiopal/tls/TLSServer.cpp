@@ -21,6 +21,8 @@
 
 #include "asiopal/tls/TLSServer.h"
 
+#include "asiopal/SteadyClock.h"
+
 #include <openpal/logging/LogMacros.h>
 #include <opendnp3/LogLevels.h>
 
@@ -36,6 +38,7 @@ namespace asiopal
 TLSServer::TLSServer(
     const openpal::Logger& logger,
     const std::shared_ptr<Executor>& executor,
+    const std::shared_ptr<TLSHandshakeGate>& gate,
     const IPEndpoint& endpoint,
     const TLSConfig& config,
     std::error_code& ec
@@ -43,6 +46,8 @@ TLSServer::TLSServer(
 	logger(logger),
 	executor(executor),
 	ctx(logger, true, config, ec),
+	gate(gate ? gate : TLSHandshakeGate::Create(nullptr, 0)),
+	handshakeTimeout(openpal::TimeDuration::Seconds(config.handshakeTimeoutSeconds)),
 	endpoint(ip::tcp::v4(), endpoint.port),
 	acceptor(executor->strand.get_io_service()),
 	session_id(0)
@@ -56,6 +61,7 @@ TLSServer::TLSServer(
 void TLSServer::Shutdown()
 {
 	this->acceptor.close();
+	this->gate->Clear(this);
 }
 
 std::error_code TLSServer::ConfigureListener(const std::string& adapter, std::error_code& ec)
@@ -125,24 +131,57 @@ void TLSServer::StartAccept(std::error_code& ec)
 			return;
 		}
 
-		auto handshake_cb = [stream, ID, self](const std::error_code & ec)
+		auto start = [self, stream, ID](const std::shared_ptr<Executor>& strand, const TLSHandshakeGate::release_t& release)
+		{
+			self->BeginHandshake(ID, stream, strand, release);
+		};
+
+		// closing the socket completes the pending handshake operation with an error
+		auto abort = [stream]()
+		{
+			std::error_code ec;
+			stream->lowest_layer().close(ec);
+		};
+
+		self->gate->Submit(self.get(), self->executor, self->handshakeTimeout, start, abort);
+	};
+
+	this->acceptor.async_accept(stream->lowest_layer(), this->executor->strand.wrap(accept_cb));
+}
+
+void TLSServer::BeginHandshake(uint64_t sessionid, const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream, const std::shared_ptr<Executor>& strand, const TLSHandshakeGate::release_t& release)
+{
+	auto self(shared_from_this());
+
+	// runs on the handshake strand
+	auto handshake_cb = [stream, sessionid, self, release, start = steady_clock_t::now()](const std::error_code & ec)
+	{
+		release();
+
+		const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(steady_clock_t::now() - start).count();
+		const bool resumed = !ec && (SSL_session_reused(stream->native_handle()) == 1);
+
+		// only the established stream moves back to the data-plane
+		auto complete = [stream, sessionid, self, ec, elapsed, resumed]()
 		{
 			if (ec)
 			{
+				++self->statistics.numHandshakeFail;
 				FORMAT_LOG_BLOCK(self->logger, flags::INFO, "TLS handshake failed: %s", ec.message().c_str());
 				return;
 			}
 
-			self->AcceptStream(ID, self->executor, stream);
+			self->statistics.OnHandshake(resumed, static_cast<uint64_t>(elapsed));
+
+			FORMAT_LOG_BLOCK(self->logger, flags::INFO, "TLS handshake complete (%s) in %lld us", resumed ? "resumed" : "full", static_cast<long long>(elapsed));
+
+			self->AcceptStream(sessionid, self->executor, stream);
 		};
 
-		// Begin the TLS handshake
-		stream->async_handshake(asio::ssl::stream_base::server, self->executor->strand.wrap(handshake_cb));
+		self->executor->strand.post(complete);
 	};
 
-	this->acceptor.async_accept(stream->lowest_layer(), this->executor->strand.wrap(accept_cb));
+	stream->async_handshake(asio::ssl::stream_base::server, strand->strand.wrap(handshake_cb));
 }
 
 }
-
-
@@ -24,12 +24,14 @@
 #include "asiopal/IPEndpoint.h"
 #include "asiopal/IListener.h"
 #include "asiopal/TLSConfig.h"
+#include "asiopal/TLSStatistics.h"
 #include "asiopal/Executor.h"
 
 #include <openpal/util/Uncopyable.h>
 #include <openpal/logging/Logger.h>
 
 #include "asiopal/tls/SSLContext.h"
+#include "asiopal/tls/TLSHandshakeGate.h"
 
 namespace asiopal
 {
@@ -46,9 +48,13 @@ class TLSServer :
 
 public:
 
+	/**
+	* @param gate admission control shared with the other TLS clients and servers, a private unlimited gate is created if nullptr
+	*/
 	TLSServer(
 	    const openpal::Logger& logger,
 	    const std::shared_ptr<Executor>& executor,
+	    const std::shared_ptr<TLSHandshakeGate>& gate,
 	    const IPEndpoint& endpoint,
 	    const TLSConfig& config,
 	    std::error_code& ec
@@ -57,11 +63,24 @@ public:
 	/// Stop listening for connections, permanently shutting down the listener
 	void Shutdown() override;
 
+	/// Handshake counters, only safe to read from the executor's strand
+	const TLSStatistics& GetStatistics() const
+	{
+		return statistics;
+	}
+
+	/// Admission control of the handshakes started by this server
+	const TLSHandshakeGate& GetHandshakeGate() const
+	{
+		return *gate;
+	}
+
 protected:
 
 	// Inherited classes must implement these methods
 
 	virtual bool AcceptConnection(uint64_t sessionid, const asio::ip::tcp::endpoint& remote) = 0;
+	// invoked on the handshake strand, concurrently with the handshakes of other sessions
 	virtual bool VerifyCallback(uint64_t sessionid, bool preverified, asio::ssl::verify_context& ctx) = 0;
 	virtual void AcceptStream(uint64_t sessionid, const std::shared_ptr<Executor>& executor, std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>> stream) = 0;
 	virtual void OnShutdown() = 0;
@@ -76,11 +95,17 @@ private:
 	std::error_code ConfigureContext(const TLSConfig& config, std::error_code& ec);
 	std::error_code ConfigureListener(const std::string& adapter, std::error_code& ec);
 
+	void BeginHandshake(uint64_t sessionid, const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream, const std::shared_ptr<Executor>& strand, const TLSHandshakeGate::release_t& release);
+
 	SSLContext ctx;
+	const std::shared_ptr<TLSHandshakeGate> gate;
+	const openpal::TimeDuration handshakeTimeout;
 	asio::ip::tcp::endpoint endpoint;
 	asio::ip::tcp::acceptor acceptor;
 
 	uint64_t session_id;
+
+	TLSStatistics statistics;
 };
 
 }
@@ -0,0 +1,123 @@
+/*
+* Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+* more contributor license agreements. See the NOTICE file distributed
+* with this work for additional information regarding copyright ownership.
+* Green Energy Corp licenses this file to you under the Apache License,
+* Version 2.0 (the "License"); you may not use this file except in
+* compliance with the License.  You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*
+* This project was forked on 01/01/2013 by Automatak, LLC and modifications
+* may have been made to this file. Automatak, LLC licenses these modifications
+* to you under the terms of the License.
+*/
+
+#include "asiopal/tls/TLSSessionCache.h"
+
+namespace asiopal
+{
+
+namespace
+{
+
+int GetContextIndex()
+{
+	static const int index = SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+	return index;
+}
+
+int GetConnectionIndex()
+{
+	static const int index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+	return index;
+}
+
+}
+
+TLSSessionCache::~TLSSessionCache()
+{
+	for (auto& entry : this->sessions)
+	{
+		if (entry.second)
+		{
+			SSL_SESSION_free(entry.second);
+		}
+	}
+}
+
+void TLSSessionCache::Attach(SSL_CTX* ctx)
+{
+	// the client only needs the callback, OpenSSL's internal store is keyed by session id which is useless to a client
+	SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+	SSL_CTX_set_ex_data(ctx, GetContextIndex(), this);
+	SSL_CTX_sess_set_new_cb(ctx, &TLSSessionCache::OnNewSession);
+}
+
+void TLSSessionCache::Detach(SSL_CTX* ctx)
+{
+	SSL_CTX_set_ex_data(ctx, GetContextIndex(), nullptr);
+}
+
+void TLSSessionCache::Prepare(SSL* ssl, const std::string& endpoint)
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	auto& entry = *this->sessions.emplace(endpoint, nullptr).first;
+
+	if (entry.second)
+	{
+		SSL_set_session(ssl, entry.second);
+	}
+
+	SSL_set_ex_data(ssl, GetConnectionIndex(), const_cast<std::string*>(&entry.first));
+}
+
+void TLSSessionCache::Remove(const std::string& endpoint)
+{
+	this->Store(endpoint, nullptr);
+}
+
+void TLSSessionCache::Store(const std::string& endpoint, SSL_SESSION* session)
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	auto iter = this->sessions.find(endpoint);
+	if (iter == this->sessions.end())
+	{
+		if (session)
+		{
+			SSL_SESSION_free(session);
+		}
+		return;
+	}
+
+	if (iter->second)
+	{
+		SSL_SESSION_free(iter->second);
+	}
+
+	iter->second = session;
+}
+
+int TLSSessionCache::OnNewSession(SSL* ssl, SSL_SESSION* session)
+{
+	auto cache = static_cast<TLSSessionCache*>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), GetContextIndex()));
+	auto endpoint = static_cast<const std::string*>(SSL_get_ex_data(ssl, GetConnectionIndex()));
+
+	if (!(cache && endpoint))
+	{
+		return 0; // we didn't take ownership
+	}
+
+	cache->Store(*endpoint, session);
+	return 1; // the cache owns the reference
+}
+
+}
@@ -0,0 +1,76 @@
+/*
+* Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+* more contributor license agreements. See the NOTICE file distributed
+* with this work for additional information regarding copyright ownership.
+* Green Energy Corp licenses this file to you under the Apache License,
+* Version 2.0 (the "License"); you may not use this file except in
+* compliance with the License.  You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*
+* This project was forked on 01/01/2013 by Automatak, LLC and modifications
+* may have been made to this file. Automatak, LLC licenses these modifications
+* to you under the terms of the License.
+*/
+#ifndef ASIOPAL_TLSSESSIONCACHE_H
+#define ASIOPAL_TLSSESSIONCACHE_H
+
+#include <openpal/util/Uncopyable.h>
+
+#include <openssl/ssl.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace asiopal
+{
+
+/**
+* Client-side store of the most recent TLS session negotiated with each remote endpoint
+*
+* New sessions are delivered by OpenSSL's new session callback, so TLS 1.3 tickets that
+* arrive after the handshake are captured as well.
+*/
+class TLSSessionCache : private openpal::Uncopyable
+{
+
+public:
+
+	TLSSessionCache() = default;
+
+	~TLSSessionCache();
+
+	/// Configure a client context to deliver its new sessions to this cache
+	void Attach(SSL_CTX* ctx);
+
+	/// Stop delivering new sessions to this cache
+	void Detach(SSL_CTX* ctx);
+
+	/// Offer the cached session for an endpoint (if any) and associate the connection with the endpoint
+	void Prepare(SSL* ssl, const std::string& endpoint);
+
+	/// Forget the session for an endpoint, e.g. after a failed handshake
+	void Remove(const std::string& endpoint);
+
+private:
+
+	static int OnNewSession(SSL* ssl, SSL_SESSION* session);
+
+	void Store(const std::string& endpoint, SSL_SESSION* session);
+
+	std::mutex mutex;
+
+	// nodes are never erased so that connections can safely refer to the keys
+	std::map<std::string, SSL_SESSION*> sessions;
+};
+
+}
+
+#endif
@@ -0,0 +1,202 @@
+/*
+* Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+* more contributor license agreements. See the NOTICE file distributed
+* with this work for additional information regarding copyright ownership.
+* Green Energy Corp licenses this file to you under the Apache License,
+* Version 2.0 (the "License"); you may not use this file except in
+* compliance with the License.  You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*
+* This project was forked on 01/01/2013 by Automatak, LLC and modifications
+* may have been made to this file. Automatak, LLC licenses these modifications
+* to you under the terms of the License.
+*/
+
+#include "asiopal/tls/TLSTicketKeys.h"
+
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#endif
+
+#include <cstring>
+
+namespace asiopal
+{
+
+namespace
+{
+
+int GetContextIndex()
+{
+	static const int index = SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+	return index;
+}
+
+}
+
+TLSTicketKeys::TLSTicketKeys(std::chrono::seconds rotationPeriod) : rotationPeriod(rotationPeriod)
+{}
+
+bool TLSTicketKeys::Attach(SSL_CTX* ctx)
+{
+	if (!this->Rotate(steady_clock_t::now()))
+	{
+		return false;
+	}
+
+	SSL_CTX_set_ex_data(ctx, GetContextIndex(), this);
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	return SSL_CTX_set_tlsext_ticket_key_evp_cb(ctx, &TLSTicketKeys::OnTicket) == 1;
+#else
+	return SSL_CTX_set_tlsext_ticket_key_cb(ctx, &TLSTicketKeys::OnTicket) == 1;
+#endif
+}
+
+void TLSTicketKeys::Detach(SSL_CTX* ctx)
+{
+	SSL_CTX_set_ex_data(ctx, GetContextIndex(), nullptr);
+}
+
+bool TLSTicketKeys::Rotate(steady_clock_t::time_point now)
+{
+	Key next;
+
+	if (RAND_bytes(next.name, sizeof(next.name)) != 1 ||
+	        RAND_bytes(next.aesKey, sizeof(next.aesKey)) != 1 ||
+	        RAND_bytes(next.hmacKey, sizeof(next.hmacKey)) != 1)
+	{
+		return false;
+	}
+
+	next.created = now;
+	next.valid = true;
+
+	this->previous = this->current;
+	this->current = next;
+	return true;
+}
+
+bool TLSTicketKeys::GetEncryptionKey(Key& key)
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	const auto now = steady_clock_t::now();
+
+	if ((now - this->current.created) >= this->rotationPeriod)
+	{
+		// if we can't generate a new key, keep using the old one
+		this->Rotate(now);
+	}
+
+	key = this->current;
+	return key.valid;
+}
+
+TLSTicketKeys::Lookup TLSTicketKeys::GetDecryptionKey(const uint8_t* name, Key& key)
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	if (this->current.valid && memcmp(name, this->current.name, sizeof(this->current.name)) == 0)
+	{
+		key = this->current;
+		return Lookup::CURRENT;
+	}
+
+	if (this->previous.valid && memcmp(name, this->previous.name, sizeof(this->previous.name)) == 0)
+	{
+		// tickets from the previous generation expire with the next rotation
+		if ((steady_clock_t::now() - this->previous.created) < 2 * this->rotationPeriod)
+		{
+			key = this->previous;
+			return Lookup::PREVIOUS;
+		}
+	}
+
+	return Lookup::UNKNOWN;
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+int TLSTicketKeys::OnTicket(SSL* ssl, unsigned char* name, unsigned char* iv, EVP_CIPHER_CTX* cipher, EVP_MAC_CTX* hmac, int enc)
+#else
+int TLSTicketKeys::OnTicket(SSL* ssl, unsigned char* name, unsigned char* iv, EVP_CIPHER_CTX* cipher, HMAC_CTX* hmac, int enc)
+#endif
+{
+	auto keys = static_cast<TLSTicketKeys*>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), GetContextIndex()));
+	if (!keys)
+	{
+		return -1;
+	}
+
+	Key key;
+	int result = 1;
+
+	if (enc)
+	{
+		if (!keys->GetEncryptionKey(key) || RAND_bytes(iv, EVP_MAX_IV_LENGTH) != 1)
+		{
+			return -1;
+		}
+
+		memcpy(name, key.name, sizeof(key.name));
+
+		if (EVP_EncryptInit_ex(cipher, EVP_aes_256_cbc(), nullptr, key.aesKey, iv) != 1)
+		{
+			return -1;
+		}
+	}
+	else
+	{
+		switch (keys->GetDecryptionKey(name, key))
+		{
+		case(Lookup::CURRENT):
+			result = 1;
+			break;
+		case(Lookup::PREVIOUS):
+			result = 2; // accept the ticket, but issue a new one sealed with the current key
+			break;
+		default:
+			return 0; // unknown or expired key, fall back to a full handshake
+		}
+
+		if (EVP_DecryptInit_ex(cipher, EVP_aes_256_cbc(), nullptr, key.aesKey, iv) != 1)
+		{
+			return -1;
+		}
+	}
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	char digest[] = "SHA256";
+	OSSL_PARAM params[] =
+	{
+		OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, key.hmacKey, sizeof(key.hmacKey)),
+		OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest, 0),
+		OSSL_PARAM_construct_end()
+	};
+
+	if (EVP_MAC_CTX_set_params(hmac, params) != 1)
+	{
+		return -1;
+	}
+#else
+	if (HMAC_Init_ex(hmac, key.hmacKey, sizeof(key.hmacKey), EVP_sha256(), nullptr) != 1)
+	{
+		return -1;
+	}
+#endif
+
+	return result;
+}
+
+}
@@ -0,0 +1,94 @@
+/*
+* Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+* more contributor license agreements. See the NOTICE file distributed
+* with this work for additional information regarding copyright ownership.
+* Green Energy Corp licenses this file to you under the Apache License,
+* Version 2.0 (the "License"); you may not use this file except in
+* compliance with the License.  You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*
+* This project was forked on 01/01/2013 by Automatak, LLC and modifications
+* may have been made to this file. Automatak, LLC licenses these modifications
+* to you under the terms of the License.
+*/
+#ifndef ASIOPAL_TLSTICKETKEYS_H
+#define ASIOPAL_TLSTICKETKEYS_H
+
+#include "asiopal/SteadyClock.h"
+
+#include <openpal/util/Uncopyable.h>
+
+#include <openssl/ssl.h>
+
+#include <cstdint>
+#include <mutex>
+
+namespace asiopal
+{
+
+/**
+* Server-side session ticket keys with periodic rotation
+*
+* New tickets are always sealed with the current key. Tickets sealed with the previous
+* key are still accepted for one more rotation period, and are re-issued under the current key.
+*/
+class TLSTicketKeys : private openpal::Uncopyable
+{
+
+public:
+
+	explicit TLSTicketKeys(std::chrono::seconds rotationPeriod);
+
+	/// Install the ticket key callback on a server context
+	bool Attach(SSL_CTX* ctx);
+
+	/// Stop sealing or opening tickets with these keys
+	void Detach(SSL_CTX* ctx);
+
+private:
+
+	struct Key
+	{
+		uint8_t name[16];
+		uint8_t aesKey[32];
+		uint8_t hmacKey[32];
+		steady_clock_t::time_point created;
+		bool valid = false;
+	};
+
+	enum class Lookup : uint8_t
+	{
+		CURRENT,
+		PREVIOUS,
+		UNKNOWN
+	};
+
+	bool GetEncryptionKey(Key& key);
+
+	Lookup GetDecryptionKey(const uint8_t* name, Key& key);
+
+	bool Rotate(steady_clock_t::time_point now);
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	static int OnTicket(SSL* ssl, unsigned char* name, unsigned char* iv, EVP_CIPHER_CTX* cipher, EVP_MAC_CTX* hmac, int enc);
+#else
+	static int OnTicket(SSL* ssl, unsigned char* name, unsigned char* iv, EVP_CIPHER_CTX* cipher, HMAC_CTX* hmac, int enc);
+#endif
+
+	const std::chrono::seconds rotationPeriod;
+
+	std::mutex mutex;
+	Key current;
+	Key previous;
+};
+
+}
+
+#endif
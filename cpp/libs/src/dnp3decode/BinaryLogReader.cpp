@@ -0,0 +1,220 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "dnp3decode/BinaryLogReader.h"
+
+#include <openpal/logging/BinaryLogFormat.h>
+#include <openpal/logging/LogArguments.h>
+#include <openpal/logging/StringFormatting.h>
+#include <openpal/util/ToHex.h>
+
+#include <cstring>
+
+using namespace openpal;
+
+namespace opendnp3
+{
+
+BinaryLogReader::BinaryLogReader(std::istream& input) : input(input)
+{}
+
+bool BinaryLogReader::ReadHeader()
+{
+	char magic[BinaryLogFormat::MAGIC_SIZE];
+	uint8_t version = 0;
+
+	if (!ReadBytes(magic, sizeof(magic)) || !ReadInt(version))
+	{
+		corrupt = true;
+		return false;
+	}
+
+	if (memcmp(magic, BinaryLogFormat::Magic(), sizeof(magic)) != 0 || version != BinaryLogFormat::VERSION)
+	{
+		corrupt = true;
+		return false;
+	}
+
+	return true;
+}
+
+bool BinaryLogReader::Read(BinaryLogRecord& record)
+{
+	while (!corrupt)
+	{
+		uint8_t type = 0;
+		if (!ReadBytes(&type, 1))
+		{
+			// clean end of input between records
+			return false;
+		}
+
+		switch (static_cast<BinaryLogFormat::RecordType>(type))
+		{
+		case(BinaryLogFormat::RecordType::String) :
+			{
+				uint32_t id = 0;
+				uint16_t length = 0;
+				std::string value;
+				if (!ReadInt(id) || !ReadInt(length) || !ReadString(length, value))
+				{
+					break;
+				}
+				strings[id] = value;
+				continue;
+			}
+		case(BinaryLogFormat::RecordType::Text) :
+			{
+				uint16_t length = 0;
+				std::string text;
+				if (!ReadCommon(record) || !ReadInt(length) || !ReadString(length, text))
+				{
+					break;
+				}
+				record.lines.push_back(text);
+				return true;
+			}
+		case(BinaryLogFormat::RecordType::Format) :
+			{
+				uint32_t format = 0;
+				uint16_t length = 0;
+				if (!ReadCommon(record) || !ReadInt(format) || !ReadInt(length))
+				{
+					break;
+				}
+				payload.resize(length);
+				if (!ReadBytes(payload.data(), length))
+				{
+					break;
+				}
+				std::string text;
+				LogArguments::Render(Lookup(format).c_str(), RSlice(payload.data(), length), text);
+				record.lines.push_back(text);
+				return true;
+			}
+		case(BinaryLogFormat::RecordType::Hex) :
+			{
+				uint16_t firstRowSize = 0;
+				uint16_t otherRowSize = 0;
+				uint32_t length = 0;
+				if (!ReadCommon(record) || !ReadInt(firstRowSize) || !ReadInt(otherRowSize) || !ReadInt(length))
+				{
+					break;
+				}
+				payload.resize(length);
+				if (!ReadBytes(payload.data(), length))
+				{
+					break;
+				}
+
+				// same row layout as LogHex(..)
+				uint32_t pos = 0;
+				while (pos < length)
+				{
+					uint32_t rowSize = (length - pos < MAX_HEX_PER_LINE) ? (length - pos) : MAX_HEX_PER_LINE;
+					const uint32_t limit = record.lines.empty() ? firstRowSize : otherRowSize;
+					if (limit > 0 && limit < rowSize)
+					{
+						rowSize = limit;
+					}
+
+					std::string line;
+					for (uint32_t i = 0; i < rowSize; ++i)
+					{
+						const auto value = payload[pos + i];
+						line.push_back(ToHexChar((value & 0xf0) >> 4));
+						line.push_back(ToHexChar(value & 0xf));
+						line.push_back(' ');
+					}
+					record.lines.push_back(line);
+					pos += rowSize;
+				}
+				return true;
+			}
+		default:
+			break;
+		}
+
+		corrupt = true;
+	}
+
+	return false;
+}
+
+bool BinaryLogReader::ReadCommon(BinaryLogRecord& record)
+{
+	uint32_t id = 0;
+	uint32_t location = 0;
+
+	record.lines.clear();
+
+	if (!ReadInt(record.milliseconds) || !ReadInt(record.filters) || !ReadInt(id) || !ReadInt(location))
+	{
+		return false;
+	}
+
+	record.loggerid = Lookup(id);
+	record.location = Lookup(location);
+	return true;
+}
+
+bool BinaryLogReader::ReadBytes(void* dest, size_t count)
+{
+	if (count == 0)
+	{
+		return true;
+	}
+
+	input.read(static_cast<char*>(dest), count);
+	return static_cast<size_t>(input.gcount()) == count;
+}
+
+bool BinaryLogReader::ReadString(size_t length, std::string& output)
+{
+	output.resize(length);
+	return ReadBytes(&output[0], length);
+}
+
+template <class T>
+bool BinaryLogReader::ReadInt(T& value)
+{
+	uint8_t bytes[sizeof(T)];
+	if (!ReadBytes(bytes, sizeof(T)))
+	{
+		return false;
+	}
+
+	uint64_t result = 0;
+	for (size_t i = 0; i < sizeof(T); ++i)
+	{
+		result |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+	}
+	value = static_cast<T>(result);
+	return true;
+}
+
+const std::string& BinaryLogReader::Lookup(uint32_t id)
+{
+	static const std::string unknown("<?>");
+	const auto iter = strings.find(id);
+	return (iter == strings.end()) ? unknown : iter->second;
+}
+
+}
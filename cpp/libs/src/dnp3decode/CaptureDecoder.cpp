@@ -0,0 +1,335 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "dnp3decode/CaptureDecoder.h"
+
+#include "CaptureReader.h"
+#include "CaptureStream.h"
+#include "FlowParser.h"
+#include "MappedFile.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+
+namespace opendnp3
+{
+
+namespace
+{
+
+class Demultiplexer
+{
+public:
+
+	Demultiplexer(const CaptureDecoderConfig& config, CaptureDecoderStatistics& stats) : config(config), stats(stats)
+	{}
+
+	bool Add(uint64_t packetNumber, const CapturePacket& packet)
+	{
+		FlowSegment segment;
+		if (!ParseFlowSegment(packet.linkType, packet.data, segment) || !IsSelected(segment.key))
+		{
+			return false;
+		}
+
+		auto stream = this->GetStream(packetNumber, segment);
+
+		if (segment.key.protocol == PROTOCOL_TCP)
+		{
+			stream->AddTCP(packet.nanoseconds, packetNumber, segment.seq, segment.syn, segment.payload);
+
+			if (segment.fin)
+			{
+				stream->Close(packetNumber);
+			}
+		}
+		else
+		{
+			stream->AddDatagram(packet.nanoseconds, packetNumber, segment.payload);
+		}
+
+		return true;
+	}
+
+	void Expire(uint64_t packet)
+	{
+		for (auto& stream : streams)
+		{
+			stream->Expire(packet);
+		}
+	}
+
+	void Flush()
+	{
+		for (auto& stream : streams)
+		{
+			stream->Flush();
+		}
+	}
+
+	// free the streams that closed before the packet and have been fully decoded
+	void Release(uint64_t packet)
+	{
+		auto releasable = [packet](const std::unique_ptr<CaptureStream>& stream)
+		{
+			return stream->IsReleasable(packet);
+		};
+
+		if (std::none_of(streams.begin(), streams.end(), releasable))
+		{
+			return;
+		}
+
+		for (auto iter = active.begin(); iter != active.end();)
+		{
+			iter = iter->second->IsReleasable(packet) ? active.erase(iter) : std::next(iter);
+		}
+
+		for (auto& stream : streams)
+		{
+			if (releasable(stream))
+			{
+				this->Accumulate(*stream);
+			}
+		}
+
+		streams.erase(std::remove_if(streams.begin(), streams.end(), releasable), streams.end());
+	}
+
+	void Accumulate(const CaptureStream& stream)
+	{
+		stats.numPayloadBytes += stream.numPayloadBytes;
+		stats.numDuplicateBytes += stream.numDuplicateBytes;
+		stats.numGaps += stream.numGaps;
+	}
+
+	// in the order they were first seen, which keeps the output deterministic
+	std::vector<std::unique_ptr<CaptureStream>> streams;
+
+private:
+
+	bool IsSelected(const FlowKey& key) const
+	{
+		if (config.ports.empty())
+		{
+			return true;
+		}
+
+		for (auto port : config.ports)
+		{
+			if (key.sourcePort == port || key.destinationPort == port)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	CaptureStream* GetStream(uint64_t packetNumber, const FlowSegment& segment)
+	{
+		auto iter = active.find(segment.key);
+
+		if (iter != active.end())
+		{
+			auto stream = iter->second;
+			if (!stream->IsNewConnection(segment.seq, segment.syn))
+			{
+				return stream;
+			}
+
+			// the 4-tuple was reused, decode what's left of the old connection and start over
+			stream->Close(packetNumber);
+			stream->Flush();
+		}
+
+		streams.push_back(std::unique_ptr<CaptureStream>(new CaptureStream(segment.key.ToString(), config.filters)));
+		active[segment.key] = streams.back().get();
+
+		++stats.numStreams;
+		stats.maxActiveStreams = std::max<uint64_t>(stats.maxActiveStreams, streams.size());
+
+		return streams.back().get();
+	}
+
+	const CaptureDecoderConfig& config;
+	CaptureDecoderStatistics& stats;
+	std::unordered_map<FlowKey, CaptureStream*, FlowKeyHash> active;
+};
+
+void DecodeInParallel(const std::vector<CaptureStream*>& work, uint32_t numThreads)
+{
+	std::atomic<size_t> next(0);
+
+	auto run = [&]()
+	{
+		for (size_t i = next.fetch_add(1); i < work.size(); i = next.fetch_add(1))
+		{
+			work[i]->Decode();
+		}
+	};
+
+	const auto numWorkers = std::min<size_t>(numThreads, work.size());
+
+	std::vector<std::thread> workers;
+	for (size_t i = 1; i < numWorkers; ++i)
+	{
+		workers.push_back(std::thread(run));
+	}
+
+	run();
+
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+}
+
+}
+
+CaptureDecoder::CaptureDecoder(const CaptureDecoderConfig& config, ICaptureHandler& handler) :
+	config(config),
+	handler(&handler)
+{}
+
+CaptureDecoderStatistics CaptureDecoder::Decode(const std::string& path, std::error_code& ec)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	CaptureDecoderStatistics stats;
+	stats.numThreads = (config.numThreads > 0) ? config.numThreads : std::max(1u, std::thread::hardware_concurrency());
+
+	auto file = MappedFile::Open(path, ec);
+	if (ec)
+	{
+		return stats;
+	}
+
+	stats.numBytes = file->Size();
+
+	CaptureReader reader(file->Data(), file->Size());
+	if (!reader.ReadHeader())
+	{
+		ec = std::make_error_code(std::errc::invalid_argument);
+		return stats;
+	}
+
+	Demultiplexer demux(config, stats);
+	const auto packetsPerPass = std::max<uint32_t>(1, config.packetsPerPass);
+
+	std::vector<CaptureStream*> work;
+	std::vector<std::pair<size_t, const CaptureRecord*>> output;
+
+	auto pass = [&]()
+	{
+		work.clear();
+		for (auto& stream : demux.streams)
+		{
+			if (stream->HasData())
+			{
+				work.push_back(stream.get());
+			}
+		}
+
+		// start the largest streams first so they don't hold up the end of the pass
+		std::stable_sort(work.begin(), work.end(), [](const CaptureStream * lhs, const CaptureStream * rhs)
+		{
+			return lhs->NumReadyBytes() > rhs->NumReadyBytes();
+		});
+
+		DecodeInParallel(work, stats.numThreads);
+
+		output.clear();
+		for (size_t i = 0; i < demux.streams.size(); ++i)
+		{
+			for (auto& record : demux.streams[i]->Records())
+			{
+				output.push_back(std::make_pair(i, &record));
+			}
+		}
+
+		// each packet belongs to a single stream, so this only reorders between streams
+		std::stable_sort(output.begin(), output.end(), [](const std::pair<size_t, const CaptureRecord*>& lhs, const std::pair<size_t, const CaptureRecord*>& rhs)
+		{
+			if (lhs.second->nanoseconds != rhs.second->nanoseconds)
+			{
+				return lhs.second->nanoseconds < rhs.second->nanoseconds;
+			}
+			return lhs.second->packet < rhs.second->packet;
+		});
+
+		for (auto& item : output)
+		{
+			const auto& record = *item.second;
+			handler->OnLine(CaptureLine{ record.nanoseconds, demux.streams[item.first]->Name().c_str(), record.filters, record.message.c_str() });
+		}
+
+		stats.numLines += output.size();
+
+		for (auto& stream : demux.streams)
+		{
+			stream->Records().clear();
+		}
+	};
+
+	CapturePacket packet;
+	uint32_t numInPass = 0;
+	uint64_t passStart = 0;
+
+	while (reader.Read(packet))
+	{
+		if (!demux.Add(stats.numPackets, packet))
+		{
+			++stats.numIgnoredPackets;
+		}
+
+		++stats.numPackets;
+
+		if (++numInPass == packetsPerPass)
+		{
+			// a missing segment that wasn't retransmitted within a whole pass never will be
+			demux.Expire(passStart);
+			pass();
+			// a stream that closed before this pass has had a whole pass for its retransmissions
+			demux.Release(passStart);
+			numInPass = 0;
+			passStart = stats.numPackets;
+		}
+	}
+
+	demux.Flush();
+	pass();
+
+	stats.truncated = reader.IsCorrupt();
+
+	for (auto& stream : demux.streams)
+	{
+		demux.Accumulate(*stream);
+	}
+
+	stats.elapsed = std::chrono::steady_clock::now() - start;
+	return stats;
+}
+
+}
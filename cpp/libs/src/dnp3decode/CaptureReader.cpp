@@ -0,0 +1,383 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "CaptureReader.h"
+
+#include <cmath>
+
+namespace opendnp3
+{
+
+namespace
+{
+
+const uint32_t PCAP_MAGIC_MICROSECONDS = 0xA1B2C3D4;
+const uint32_t PCAP_MAGIC_NANOSECONDS = 0xA1B23C4D;
+const uint32_t PCAP_HEADER_SIZE = 24;
+const uint32_t PCAP_RECORD_HEADER_SIZE = 16;
+
+const uint32_t PCAPNG_SECTION_HEADER = 0x0A0D0D0A;
+const uint32_t PCAPNG_INTERFACE_DESCRIPTION = 0x00000001;
+const uint32_t PCAPNG_OBSOLETE_PACKET = 0x00000002;
+const uint32_t PCAPNG_SIMPLE_PACKET = 0x00000003;
+const uint32_t PCAPNG_ENHANCED_PACKET = 0x00000006;
+const uint32_t PCAPNG_BYTE_ORDER_MAGIC = 0x1A2B3C4D;
+
+const uint16_t PCAPNG_OPTION_END = 0;
+const uint16_t PCAPNG_OPTION_TSRESOL = 9;
+const uint16_t PCAPNG_OPTION_TSOFFSET = 14;
+
+// type and total length at the front, total length repeated at the back
+const uint32_t PCAPNG_BLOCK_OVERHEAD = 12;
+
+const int64_t NANOSECONDS_PER_SECOND = 1000000000;
+
+uint32_t ReadLE32(const uint8_t* source)
+{
+	return static_cast<uint32_t>(source[0]) | (static_cast<uint32_t>(source[1]) << 8) | (static_cast<uint32_t>(source[2]) << 16) | (static_cast<uint32_t>(source[3]) << 24);
+}
+
+uint32_t ReadBE32(const uint8_t* source)
+{
+	return (static_cast<uint32_t>(source[0]) << 24) | (static_cast<uint32_t>(source[1]) << 16) | (static_cast<uint32_t>(source[2]) << 8) | static_cast<uint32_t>(source[3]);
+}
+
+uint32_t Pad4(uint32_t length)
+{
+	return (length + 3) & ~static_cast<uint32_t>(3);
+}
+
+}
+
+CaptureReader::CaptureReader(const uint8_t* data, uint64_t size) : data(data), size(size)
+{}
+
+bool CaptureReader::ReadHeader()
+{
+	if (size < PCAP_HEADER_SIZE)
+	{
+		return false;
+	}
+
+	const auto magic = ReadLE32(data);
+
+	if (magic == PCAPNG_SECTION_HEADER)
+	{
+		// the section header is parsed as the first block
+		format = Format::PcapNG;
+		return ReadSectionHeader(data);
+	}
+
+	if (magic == PCAP_MAGIC_MICROSECONDS || magic == PCAP_MAGIC_NANOSECONDS)
+	{
+		bigEndian = false;
+	}
+	else if (ReadBE32(data) == PCAP_MAGIC_MICROSECONDS || ReadBE32(data) == PCAP_MAGIC_NANOSECONDS)
+	{
+		bigEndian = true;
+	}
+	else
+	{
+		return false;
+	}
+
+	format = Format::Pcap;
+	nanosecond = (Read32(data) == PCAP_MAGIC_NANOSECONDS);
+	// the upper bits may carry FCS information
+	linkType = Read32(data + 20) & 0xFFFF;
+	position = PCAP_HEADER_SIZE;
+	return true;
+}
+
+bool CaptureReader::Read(CapturePacket& packet)
+{
+	if (corrupt)
+	{
+		return false;
+	}
+
+	return (format == Format::Pcap) ? ReadPcap(packet) : ReadPcapNG(packet);
+}
+
+bool CaptureReader::ReadPcap(CapturePacket& packet)
+{
+	if (Remaining() == 0)
+	{
+		return false;
+	}
+
+	if (Remaining() < PCAP_RECORD_HEADER_SIZE)
+	{
+		corrupt = true;
+		return false;
+	}
+
+	const uint8_t* record = data + position;
+	const auto seconds = Read32(record);
+	const auto fraction = Read32(record + 4);
+	const auto captured = Read32(record + 8);
+
+	if (Remaining() - PCAP_RECORD_HEADER_SIZE < captured)
+	{
+		corrupt = true;
+		return false;
+	}
+
+	packet.nanoseconds = static_cast<int64_t>(seconds) * NANOSECONDS_PER_SECOND + (nanosecond ? fraction : static_cast<int64_t>(fraction) * 1000);
+	packet.linkType = linkType;
+	packet.data = openpal::RSlice(record + PCAP_RECORD_HEADER_SIZE, captured);
+
+	position += PCAP_RECORD_HEADER_SIZE + captured;
+	return true;
+}
+
+bool CaptureReader::ReadPcapNG(CapturePacket& packet)
+{
+	while (Remaining() > 0)
+	{
+		if (Remaining() < PCAPNG_BLOCK_OVERHEAD)
+		{
+			corrupt = true;
+			return false;
+		}
+
+		const uint8_t* block = data + position;
+		const auto type = ReadLE32(block);
+
+		if (type == PCAPNG_SECTION_HEADER)
+		{
+			// may change the byte order, so the length is read afterwards
+			if (!ReadSectionHeader(block))
+			{
+				return false;
+			}
+			continue;
+		}
+
+		const auto length = Read32(block + 4);
+
+		if (length < PCAPNG_BLOCK_OVERHEAD || (length % 4) != 0 || length > Remaining())
+		{
+			corrupt = true;
+			return false;
+		}
+
+		position += length;
+
+		const uint32_t body = length - PCAPNG_BLOCK_OVERHEAD;
+
+		switch (Read32(block))
+		{
+		case(PCAPNG_INTERFACE_DESCRIPTION):
+			ReadInterface(block, length);
+			break;
+		case(PCAPNG_ENHANCED_PACKET):
+			if (body >= 20)
+			{
+				const auto captured = Read32(block + 20);
+				if (captured > body - 20)
+				{
+					corrupt = true;
+					return false;
+				}
+				if (ReadPacket(Read32(block + 8), Read32(block + 12), Read32(block + 16), captured, block + 28, packet))
+				{
+					return true;
+				}
+			}
+			break;
+		case(PCAPNG_OBSOLETE_PACKET):
+			if (body >= 20)
+			{
+				const auto captured = Read32(block + 20);
+				if (captured > body - 20)
+				{
+					corrupt = true;
+					return false;
+				}
+				if (ReadPacket(Read16(block + 8), Read32(block + 12), Read32(block + 16), captured, block + 28, packet))
+				{
+					return true;
+				}
+			}
+			break;
+		case(PCAPNG_SIMPLE_PACKET):
+			if (body >= 4 && !interfaces.empty())
+			{
+				// no timestamp, the original length is only an upper bound on the data
+				const auto original = Read32(block + 8);
+				const auto captured = (original < body - 4) ? original : (body - 4);
+
+				packet.nanoseconds = lastNanoseconds;
+				packet.linkType = interfaces.front().linkType;
+				packet.data = openpal::RSlice(block + 12, captured);
+				return true;
+			}
+			break;
+		default:
+			// statistics, name resolution, custom blocks etc
+			break;
+		}
+	}
+
+	return false;
+}
+
+bool CaptureReader::ReadSectionHeader(const uint8_t* block)
+{
+	if (Remaining() < PCAPNG_BLOCK_OVERHEAD + 4)
+	{
+		corrupt = true;
+		return false;
+	}
+
+	const auto order = ReadLE32(block + 8);
+	if (order == PCAPNG_BYTE_ORDER_MAGIC)
+	{
+		bigEndian = false;
+	}
+	else if (ReadBE32(block + 8) == PCAPNG_BYTE_ORDER_MAGIC)
+	{
+		bigEndian = true;
+	}
+	else
+	{
+		corrupt = true;
+		return false;
+	}
+
+	const auto length = Read32(block + 4);
+	if (length < PCAPNG_BLOCK_OVERHEAD + 4 || (length % 4) != 0 || length > Remaining())
+	{
+		corrupt = true;
+		return false;
+	}
+
+	// interface ids are scoped to a section
+	interfaces.clear();
+	position += length;
+	return true;
+}
+
+void CaptureReader::ReadInterface(const uint8_t* block, uint32_t length)
+{
+	Interface iface;
+
+	if (length >= 20)
+	{
+		iface.linkType = Read16(block + 8);
+
+		const uint8_t* option = block + 16;
+		const uint8_t* end = block + length - 4;
+
+		while ((end - option) >= 4)
+		{
+			const auto code = Read16(option);
+			const auto optionLength = Read16(option + 2);
+			const uint8_t* value = option + 4;
+
+			if (code == PCAPNG_OPTION_END || static_cast<uint32_t>(end - value) < optionLength)
+			{
+				break;
+			}
+
+			if (code == PCAPNG_OPTION_TSRESOL && optionLength >= 1)
+			{
+				iface.resolution = value[0];
+			}
+			else if (code == PCAPNG_OPTION_TSOFFSET && optionLength >= 8)
+			{
+				const uint64_t high = Read32(bigEndian ? value : value + 4);
+				const uint64_t low = Read32(bigEndian ? value + 4 : value);
+				iface.offsetSeconds = static_cast<int64_t>((high << 32) | low);
+			}
+
+			option = value + Pad4(optionLength);
+		}
+	}
+
+	interfaces.push_back(iface);
+}
+
+bool CaptureReader::ReadPacket(uint32_t interfaceId, uint32_t high, uint32_t low, uint32_t captured, const uint8_t* packetData, CapturePacket& packet)
+{
+	if (interfaceId >= interfaces.size())
+	{
+		// nothing is known about the link type
+		return false;
+	}
+
+	const auto& iface = interfaces[interfaceId];
+	const auto timestamp = (static_cast<uint64_t>(high) << 32) | low;
+
+	packet.nanoseconds = ToNanoseconds(iface, timestamp);
+	packet.linkType = iface.linkType;
+	packet.data = openpal::RSlice(packetData, captured);
+
+	lastNanoseconds = packet.nanoseconds;
+	return true;
+}
+
+int64_t CaptureReader::ToNanoseconds(const Interface& iface, uint64_t timestamp)
+{
+	const int64_t offset = iface.offsetSeconds * NANOSECONDS_PER_SECOND;
+	const uint8_t exponent = iface.resolution & 0x7F;
+
+	if (iface.resolution & 0x80)
+	{
+		// units of 2^-exponent seconds
+		if (exponent == 0)
+		{
+			return offset + static_cast<int64_t>(timestamp) * NANOSECONDS_PER_SECOND;
+		}
+		if (exponent >= 64)
+		{
+			return offset;
+		}
+		const auto seconds = timestamp >> exponent;
+		const auto fraction = timestamp & ((static_cast<uint64_t>(1) << exponent) - 1);
+		return offset + static_cast<int64_t>(seconds) * NANOSECONDS_PER_SECOND + static_cast<int64_t>(std::ldexp(static_cast<double>(fraction), -exponent) * NANOSECONDS_PER_SECOND);
+	}
+
+	// units of 10^-exponent seconds
+	int64_t scale = 1;
+	if (exponent <= 9)
+	{
+		for (uint8_t i = exponent; i < 9; ++i) scale *= 10;
+		return offset + static_cast<int64_t>(timestamp) * scale;
+	}
+
+	for (uint8_t i = 9; i < exponent && i < 27; ++i) scale *= 10;
+	return offset + static_cast<int64_t>(timestamp / static_cast<uint64_t>(scale));
+}
+
+uint16_t CaptureReader::Read16(const uint8_t* source) const
+{
+	return bigEndian ?
+	       static_cast<uint16_t>((source[0] << 8) | source[1]) :
+	       static_cast<uint16_t>(source[0] | (source[1] << 8));
+}
+
+uint32_t CaptureReader::Read32(const uint8_t* source) const
+{
+	return bigEndian ? ReadBE32(source) : ReadLE32(source);
+}
+
+}
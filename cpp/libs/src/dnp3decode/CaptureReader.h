@@ -0,0 +1,129 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_CAPTUREREADER_H
+#define OPENDNP3_CAPTUREREADER_H
+
+#include <openpal/container/RSlice.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+* A packet record from a capture file. The data points into the capture itself.
+*/
+struct CapturePacket
+{
+	/// capture time in nanoseconds since the epoch
+	int64_t nanoseconds = 0;
+
+	/// LINKTYPE_* value describing the first header in the data
+	uint32_t linkType = 0;
+
+	openpal::RSlice data;
+};
+
+/**
+* Iterates the packets of a pcap or pcapng file held in memory, in either byte order
+*/
+class CaptureReader
+{
+public:
+
+	CaptureReader(const uint8_t* data, uint64_t size);
+
+	/**
+	* Identify the format of the capture. Must be called once before Read(..)
+	*
+	* @return false if the input is neither pcap nor pcapng
+	*/
+	bool ReadHeader();
+
+	/**
+	* Read the next packet, skipping any pcapng blocks that don't contain one
+	*
+	* @return false at the end of the input, or if the input is corrupt (see IsCorrupt())
+	*/
+	bool Read(CapturePacket& packet);
+
+	bool IsCorrupt() const
+	{
+		return corrupt;
+	}
+
+private:
+
+	enum class Format
+	{
+		Pcap,
+		PcapNG
+	};
+
+	struct Interface
+	{
+		uint32_t linkType = 0;
+
+		// if_tsresol, a power of 10 unless the high bit is set, in which case a power of 2
+		uint8_t resolution = 6;
+
+		// if_tsoffset
+		int64_t offsetSeconds = 0;
+	};
+
+	bool ReadPcap(CapturePacket& packet);
+	bool ReadPcapNG(CapturePacket& packet);
+
+	bool ReadSectionHeader(const uint8_t* block);
+	void ReadInterface(const uint8_t* block, uint32_t length);
+	bool ReadPacket(uint32_t interfaceId, uint32_t high, uint32_t low, uint32_t captured, const uint8_t* data, CapturePacket& packet);
+
+	static int64_t ToNanoseconds(const Interface& iface, uint64_t timestamp);
+
+	uint16_t Read16(const uint8_t* source) const;
+	uint32_t Read32(const uint8_t* source) const;
+
+	uint64_t Remaining() const
+	{
+		return size - position;
+	}
+
+	const uint8_t* const data;
+	const uint64_t size;
+	uint64_t position = 0;
+
+	Format format = Format::Pcap;
+	bool bigEndian = false;
+	bool corrupt = false;
+
+	// pcap
+	uint32_t linkType = 0;
+	bool nanosecond = false;
+
+	// pcapng
+	std::vector<Interface> interfaces;
+	int64_t lastNanoseconds = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,212 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "CaptureStream.h"
+
+#include "opendnp3/LogLevels.h"
+
+#include <sstream>
+
+using namespace openpal;
+
+namespace opendnp3
+{
+
+void CaptureStream::Handler::Log(const LogEntry& entry)
+{
+	records.push_back(CaptureRecord{ nanoseconds, packet, entry.filters.GetBitfield(), entry.message });
+}
+
+CaptureStream::CaptureStream(const std::string& name, LogFilters filters) :
+	name(name),
+	handler(std::make_shared<Handler>()),
+	decoder(callbacks, Logger(handler, name, filters))
+{}
+
+bool CaptureStream::IsNewConnection(uint32_t seq, bool syn) const
+{
+	return syn && started && (seq != isn);
+}
+
+void CaptureStream::AddTCP(int64_t nanoseconds, uint64_t packet, uint32_t seq, bool syn, const RSlice& payload)
+{
+	if (!started)
+	{
+		if (syn)
+		{
+			isn = seq;
+			nextSeq = seq + 1;
+		}
+		else if (payload.IsNotEmpty())
+		{
+			// the capture started after the handshake
+			isn = seq - 1;
+			nextSeq = seq;
+		}
+		else
+		{
+			return;
+		}
+
+		started = true;
+	}
+
+	if (payload.IsEmpty())
+	{
+		return;
+	}
+
+	// serial number arithmetic handles sequence numbers that wrap
+	const int64_t offset = nextOffset + static_cast<int32_t>(seq - nextSeq);
+	const int64_t end = offset + payload.Size();
+
+	if (end <= nextOffset)
+	{
+		numDuplicateBytes += payload.Size();
+		return;
+	}
+
+	if (offset > nextOffset)
+	{
+		auto& existing = outOfOrder[offset];
+		if (existing.data.Size() < payload.Size())
+		{
+			numOutOfOrderBytes += payload.Size() - existing.data.Size();
+			existing = Segment{ nanoseconds, packet, payload, 0 };
+		}
+
+		while (numOutOfOrderBytes > MAX_OUT_OF_ORDER_BYTES)
+		{
+			this->SkipHole();
+		}
+		return;
+	}
+
+	// trim anything that overlaps bytes that were already delivered
+	const auto overlap = static_cast<uint32_t>(nextOffset - offset);
+	numDuplicateBytes += overlap;
+
+	this->Deliver(Segment{ nanoseconds, packet, payload.Skip(overlap), 0 });
+	this->DeliverInOrder();
+}
+
+void CaptureStream::AddDatagram(int64_t nanoseconds, uint64_t packet, const RSlice& payload)
+{
+	if (payload.IsNotEmpty())
+	{
+		this->Deliver(Segment{ nanoseconds, packet, payload, 0 });
+	}
+}
+
+void CaptureStream::Expire(uint64_t packet)
+{
+	while (!outOfOrder.empty() && outOfOrder.begin()->second.packet < packet)
+	{
+		this->SkipHole();
+	}
+}
+
+void CaptureStream::Flush()
+{
+	while (!outOfOrder.empty())
+	{
+		this->SkipHole();
+	}
+}
+
+void CaptureStream::Close(uint64_t packet)
+{
+	if (!closed)
+	{
+		closed = true;
+		closedAt = packet;
+	}
+}
+
+void CaptureStream::Deliver(const Segment& segment)
+{
+	ready.push_back(segment);
+	numReadyBytes += segment.data.Size();
+	numPayloadBytes += segment.data.Size();
+	nextOffset += segment.data.Size();
+	nextSeq += segment.data.Size();
+}
+
+void CaptureStream::DeliverInOrder()
+{
+	while (!outOfOrder.empty() && outOfOrder.begin()->first <= nextOffset)
+	{
+		const auto offset = outOfOrder.begin()->first;
+		const auto segment = outOfOrder.begin()->second;
+		outOfOrder.erase(outOfOrder.begin());
+		numOutOfOrderBytes -= segment.data.Size();
+
+		const int64_t end = offset + segment.data.Size();
+		if (end <= nextOffset)
+		{
+			numDuplicateBytes += segment.data.Size();
+			continue;
+		}
+
+		const auto overlap = static_cast<uint32_t>(nextOffset - offset);
+		numDuplicateBytes += overlap;
+		this->Deliver(Segment{ segment.nanoseconds, segment.packet, segment.data.Skip(overlap), 0 });
+	}
+}
+
+void CaptureStream::SkipHole()
+{
+	const auto offset = outOfOrder.begin()->first;
+	auto segment = outOfOrder.begin()->second;
+	outOfOrder.erase(outOfOrder.begin());
+	numOutOfOrderBytes -= segment.data.Size();
+
+	++numGaps;
+	segment.gap = static_cast<uint64_t>(offset - nextOffset);
+
+	nextSeq += static_cast<uint32_t>(segment.gap);
+	nextOffset = offset;
+
+	this->Deliver(segment);
+	this->DeliverInOrder();
+}
+
+void CaptureStream::Decode()
+{
+	for (auto& segment : ready)
+	{
+		handler->nanoseconds = segment.nanoseconds;
+		handler->packet = segment.packet;
+
+		if (segment.gap > 0)
+		{
+			std::ostringstream oss;
+			oss << "missing " << segment.gap << " bytes of stream data, the link layer will resynchronize";
+			handler->records.push_back(CaptureRecord{ segment.nanoseconds, segment.packet, flags::WARN, oss.str() });
+		}
+
+		decoder.DecodeLPDU(segment.data);
+	}
+
+	ready.clear();
+	numReadyBytes = 0;
+}
+
+}
@@ -0,0 +1,172 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_CAPTURESTREAM_H
+#define OPENDNP3_CAPTURESTREAM_H
+
+#include "DecoderImpl.h"
+
+#include <openpal/logging/ILogHandler.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+* Output of a stream's decoder, tagged with the packet that carried the decoded bytes
+*/
+struct CaptureRecord
+{
+	int64_t nanoseconds;
+	uint64_t packet;
+	int32_t filters;
+	std::string message;
+};
+
+/**
+* One direction of a TCP connection or UDP flow, with its own decoder state
+*
+* Segments are added in capture order by the reading thread. Decode() may then run on any thread
+* as long as only one thread touches the stream at a time.
+*/
+class CaptureStream final : private openpal::Uncopyable
+{
+public:
+
+	CaptureStream(const std::string& name, openpal::LogFilters filters);
+
+	/**
+	* @return true if a SYN with a new initial sequence number shows that this is a new connection
+	*/
+	bool IsNewConnection(uint32_t seq, bool syn) const;
+
+	void AddTCP(int64_t nanoseconds, uint64_t packet, uint32_t seq, bool syn, const openpal::RSlice& payload);
+
+	void AddDatagram(int64_t nanoseconds, uint64_t packet, const openpal::RSlice& payload);
+
+	/**
+	* Skip over holes that were waiting on a segment captured before the specified packet
+	*/
+	void Expire(uint64_t packet);
+
+	/**
+	* Skip over any holes so that everything buffered out of order is decoded by the next pass
+	*/
+	void Flush();
+
+	/**
+	* Record that the connection was closed by a FIN or RST, or replaced by a new connection, at the specified packet
+	*/
+	void Close(uint64_t packet);
+
+	/**
+	* @return true if the stream closed before the specified packet and everything it buffered has been decoded and output
+	*/
+	bool IsReleasable(uint64_t packet) const
+	{
+		return closed && (closedAt < packet) && outOfOrder.empty() && ready.empty() && handler->records.empty();
+	}
+
+	bool HasData() const
+	{
+		return !ready.empty();
+	}
+
+	uint64_t NumReadyBytes() const
+	{
+		return numReadyBytes;
+	}
+
+	/**
+	* Decode the bytes added since the last pass, appending to Records()
+	*/
+	void Decode();
+
+	std::vector<CaptureRecord>& Records()
+	{
+		return handler->records;
+	}
+
+	const std::string& Name() const
+	{
+		return name;
+	}
+
+	uint64_t numPayloadBytes = 0;
+	uint64_t numDuplicateBytes = 0;
+	uint64_t numGaps = 0;
+
+private:
+
+	// segments are held out of order until the hole is filled, or this many bytes are waiting
+	static const uint64_t MAX_OUT_OF_ORDER_BYTES = 256 * 1024;
+
+	struct Segment
+	{
+		int64_t nanoseconds;
+		uint64_t packet;
+		openpal::RSlice data;
+
+		// bytes missing before the data
+		uint64_t gap;
+	};
+
+	class Handler final : public openpal::ILogHandler
+	{
+	public:
+
+		virtual void Log(const openpal::LogEntry& entry) override;
+
+		int64_t nanoseconds = 0;
+		uint64_t packet = 0;
+		std::vector<CaptureRecord> records;
+	};
+
+	void Deliver(const Segment& segment);
+	void DeliverInOrder();
+	void SkipHole();
+
+	const std::string name;
+	std::shared_ptr<Handler> handler;
+	IDecoderCallbacks callbacks;
+	DecoderImpl decoder;
+
+	// TCP sequence tracking, with offsets relative to the first byte so that they never wrap
+	bool started = false;
+	uint32_t isn = 0;
+	uint32_t nextSeq = 0;
+	int64_t nextOffset = 0;
+	std::map<int64_t, Segment> outOfOrder;
+	uint64_t numOutOfOrderBytes = 0;
+
+	std::vector<Segment> ready;
+	uint64_t numReadyBytes = 0;
+
+	bool closed = false;
+	uint64_t closedAt = 0;
+};
+
+}
+
+#endif
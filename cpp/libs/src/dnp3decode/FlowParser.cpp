@@ -0,0 +1,313 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "FlowParser.h"
+
+#include <cstring>
+#include <sstream>
+
+namespace opendnp3
+{
+
+namespace
+{
+
+const uint32_t LINKTYPE_NULL = 0;
+const uint32_t LINKTYPE_ETHERNET = 1;
+const uint32_t LINKTYPE_RAW_OPENBSD = 12;
+const uint32_t LINKTYPE_LOOP = 108;
+const uint32_t LINKTYPE_RAW = 101;
+const uint32_t LINKTYPE_LINUX_SLL = 113;
+const uint32_t LINKTYPE_IPV4 = 228;
+const uint32_t LINKTYPE_IPV6 = 229;
+const uint32_t LINKTYPE_LINUX_SLL2 = 276;
+
+const uint16_t ETHERTYPE_IPV4 = 0x0800;
+const uint16_t ETHERTYPE_IPV6 = 0x86DD;
+const uint16_t ETHERTYPE_VLAN = 0x8100;
+const uint16_t ETHERTYPE_QINQ = 0x88A8;
+
+const uint8_t IPV6_HOP_BY_HOP = 0;
+const uint8_t IPV6_ROUTING = 43;
+const uint8_t IPV6_DESTINATION = 60;
+
+const uint8_t TCP_FIN = 0x01;
+const uint8_t TCP_SYN = 0x02;
+const uint8_t TCP_RST = 0x04;
+
+uint16_t ReadBE16(const uint8_t* source)
+{
+	return static_cast<uint16_t>((source[0] << 8) | source[1]);
+}
+
+uint32_t ReadBE32(const uint8_t* source)
+{
+	return (static_cast<uint32_t>(source[0]) << 24) | (static_cast<uint32_t>(source[1]) << 16) | (static_cast<uint32_t>(source[2]) << 8) | static_cast<uint32_t>(source[3]);
+}
+
+bool ParseTransport(uint8_t protocol, openpal::RSlice data, FlowSegment& segment)
+{
+	segment.key.protocol = protocol;
+
+	if (protocol == PROTOCOL_TCP)
+	{
+		if (data.Size() < 20)
+		{
+			return false;
+		}
+
+		const uint32_t headerLength = (data[12] >> 4) * 4;
+		if (headerLength < 20 || headerLength > data.Size())
+		{
+			return false;
+		}
+
+		segment.key.sourcePort = ReadBE16(data);
+		segment.key.destinationPort = ReadBE16(data + 2);
+		segment.seq = ReadBE32(data + 4);
+		segment.syn = (data[13] & TCP_SYN) != 0;
+		segment.fin = (data[13] & (TCP_FIN | TCP_RST)) != 0;
+		segment.payload = data.Skip(headerLength);
+		return true;
+	}
+
+	if (protocol == PROTOCOL_UDP)
+	{
+		if (data.Size() < 8)
+		{
+			return false;
+		}
+
+		const uint16_t length = ReadBE16(data + 4);
+		if (length < 8)
+		{
+			return false;
+		}
+
+		segment.key.sourcePort = ReadBE16(data);
+		segment.key.destinationPort = ReadBE16(data + 2);
+		segment.seq = 0;
+		segment.syn = false;
+		segment.fin = false;
+		// the captured data may be shorter than the datagram if it was truncated
+		segment.payload = data.Take(length).Skip(8);
+		return true;
+	}
+
+	return false;
+}
+
+bool ParseIPv4(openpal::RSlice data, FlowSegment& segment)
+{
+	if (data.Size() < 20)
+	{
+		return false;
+	}
+
+	const uint32_t headerLength = (data[0] & 0x0F) * 4;
+	const uint16_t fragment = ReadBE16(data + 6);
+
+	// packets captured before TCP segmentation offload have a total length of 0, use the captured length like Wireshark does
+	const uint32_t totalLength = (ReadBE16(data + 2) == 0) ? data.Size() : ReadBE16(data + 2);
+
+	// more fragments set, or a non-zero offset
+	if (headerLength < 20 || totalLength < headerLength || (fragment & 0x3FFF) != 0)
+	{
+		return false;
+	}
+
+	segment.key.ipVersion = 4;
+	segment.key.source.fill(0);
+	segment.key.destination.fill(0);
+	memcpy(segment.key.source.data(), data + 12, 4);
+	memcpy(segment.key.destination.data(), data + 16, 4);
+
+	// ethernet frames may be padded beyond the end of the IP packet
+	const auto payload = data.Take(totalLength);
+	if (payload.Size() < headerLength)
+	{
+		return false;
+	}
+
+	return ParseTransport(data[9], payload.Skip(headerLength), segment);
+}
+
+bool ParseIPv6(openpal::RSlice data, FlowSegment& segment)
+{
+	if (data.Size() < 40)
+	{
+		return false;
+	}
+
+	segment.key.ipVersion = 6;
+	memcpy(segment.key.source.data(), data + 8, 16);
+	memcpy(segment.key.destination.data(), data + 24, 16);
+
+	uint8_t next = data[6];
+	auto payload = data.Skip(40).Take(ReadBE16(data + 4));
+
+	while (next == IPV6_HOP_BY_HOP || next == IPV6_ROUTING || next == IPV6_DESTINATION)
+	{
+		if (payload.Size() < 8)
+		{
+			return false;
+		}
+
+		const uint32_t length = (payload[1] + 1) * 8;
+		if (length > payload.Size())
+		{
+			return false;
+		}
+
+		next = payload[0];
+		payload.Advance(length);
+	}
+
+	// fragments and anything else that isn't TCP/UDP are rejected here
+	return ParseTransport(next, payload, segment);
+}
+
+bool ParseIP(openpal::RSlice data, FlowSegment& segment)
+{
+	if (data.IsEmpty())
+	{
+		return false;
+	}
+
+	switch (data[0] >> 4)
+	{
+	case(4):
+		return ParseIPv4(data, segment);
+	case(6):
+		return ParseIPv6(data, segment);
+	default:
+		return false;
+	}
+}
+
+bool ParseEtherType(uint16_t type, openpal::RSlice data, FlowSegment& segment)
+{
+	while (type == ETHERTYPE_VLAN || type == ETHERTYPE_QINQ)
+	{
+		if (data.Size() < 4)
+		{
+			return false;
+		}
+		type = ReadBE16(data + 2);
+		data.Advance(4);
+	}
+
+	switch (type)
+	{
+	case(ETHERTYPE_IPV4):
+		return ParseIPv4(data, segment);
+	case(ETHERTYPE_IPV6):
+		return ParseIPv6(data, segment);
+	default:
+		return false;
+	}
+}
+
+}
+
+bool FlowKey::operator==(const FlowKey& other) const
+{
+	return protocol == other.protocol &&
+	       ipVersion == other.ipVersion &&
+	       sourcePort == other.sourcePort &&
+	       destinationPort == other.destinationPort &&
+	       source == other.source &&
+	       destination == other.destination;
+}
+
+std::string FlowKey::ToString() const
+{
+	auto address = [this](std::ostringstream & oss, const std::array<uint8_t, 16>& bytes)
+	{
+		if (ipVersion == 4)
+		{
+			oss << static_cast<int>(bytes[0]) << "." << static_cast<int>(bytes[1]) << "." << static_cast<int>(bytes[2]) << "." << static_cast<int>(bytes[3]);
+		}
+		else
+		{
+			oss << "[" << std::hex;
+			for (size_t i = 0; i < 16; i += 2)
+			{
+				oss << ((i == 0) ? "" : ":") << ((bytes[i] << 8) | bytes[i + 1]);
+			}
+			oss << std::dec << "]";
+		}
+	};
+
+	std::ostringstream oss;
+	oss << ((protocol == PROTOCOL_TCP) ? "tcp " : "udp ");
+	address(oss, source);
+	oss << ":" << sourcePort << " > ";
+	address(oss, destination);
+	oss << ":" << destinationPort;
+	return oss.str();
+}
+
+size_t FlowKeyHash::operator()(const FlowKey& key) const
+{
+	// FNV-1a
+	uint64_t hash = 14695981039346656037ULL;
+	auto add = [&hash](uint8_t value)
+	{
+		hash ^= value;
+		hash *= 1099511628211ULL;
+	};
+
+	add(key.protocol);
+	for (auto value : key.source) add(value);
+	for (auto value : key.destination) add(value);
+	add(static_cast<uint8_t>(key.sourcePort >> 8));
+	add(static_cast<uint8_t>(key.sourcePort));
+	add(static_cast<uint8_t>(key.destinationPort >> 8));
+	add(static_cast<uint8_t>(key.destinationPort));
+
+	return static_cast<size_t>(hash);
+}
+
+bool ParseFlowSegment(uint32_t linkType, const openpal::RSlice& packet, FlowSegment& segment)
+{
+	switch (linkType)
+	{
+	case(LINKTYPE_ETHERNET):
+		return (packet.Size() >= 14) && ParseEtherType(ReadBE16(packet + 12), packet.Skip(14), segment);
+	case(LINKTYPE_RAW):
+	case(LINKTYPE_RAW_OPENBSD):
+	case(LINKTYPE_IPV4):
+	case(LINKTYPE_IPV6):
+		return ParseIP(packet, segment);
+	case(LINKTYPE_LINUX_SLL):
+		return (packet.Size() >= 16) && ParseEtherType(ReadBE16(packet + 14), packet.Skip(16), segment);
+	case(LINKTYPE_LINUX_SLL2):
+		return (packet.Size() >= 20) && ParseEtherType(ReadBE16(packet), packet.Skip(20), segment);
+	case(LINKTYPE_NULL):
+	case(LINKTYPE_LOOP):
+		// a 4 byte address family in the capturing host's byte order, the IP version is enough
+		return (packet.Size() >= 4) && ParseIP(packet.Skip(4), segment);
+	default:
+		return false;
+	}
+}
+
+}
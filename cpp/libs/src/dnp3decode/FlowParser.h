@@ -0,0 +1,88 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_FLOWPARSER_H
+#define OPENDNP3_FLOWPARSER_H
+
+#include <openpal/container/RSlice.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace opendnp3
+{
+
+/**
+* Addresses and ports that identify one direction of a TCP or UDP flow
+*/
+struct FlowKey
+{
+	uint8_t protocol = 0;
+	uint8_t ipVersion = 0;
+	std::array<uint8_t, 16> source {};
+	std::array<uint8_t, 16> destination {};
+	uint16_t sourcePort = 0;
+	uint16_t destinationPort = 0;
+
+	bool operator==(const FlowKey& other) const;
+
+	/// e.g. "tcp 10.0.0.1:20000 > 10.0.0.2:50123"
+	std::string ToString() const;
+};
+
+struct FlowKeyHash
+{
+	size_t operator()(const FlowKey& key) const;
+};
+
+/**
+* The transport layer of a captured packet
+*/
+struct FlowSegment
+{
+	FlowKey key;
+
+	/// TCP only
+	uint32_t seq = 0;
+	bool syn = false;
+	/// FIN or RST, the sender won't send anything after this segment
+	bool fin = false;
+
+	openpal::RSlice payload;
+};
+
+const uint8_t PROTOCOL_TCP = 6;
+const uint8_t PROTOCOL_UDP = 17;
+
+/**
+* Find the TCP or UDP payload of a captured packet
+*
+* @param linkType LINKTYPE_* value of the capture interface
+* @param packet the captured bytes, starting with the link layer header
+* @param segment receives the flow and payload
+* @return false if the packet isn't an unfragmented TCP or UDP packet over IPv4 or IPv6, or is truncated
+*/
+bool ParseFlowSegment(uint32_t linkType, const openpal::RSlice& packet, FlowSegment& segment);
+
+}
+
+#endif
@@ -0,0 +1,147 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "MappedFile.h"
+
+#if defined(WIN32)
+	#include <windows.h>
+#else
+	#include <cerrno>
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace opendnp3
+{
+
+#if defined(WIN32)
+
+std::unique_ptr<MappedFile> MappedFile::Open(const std::string& path, std::error_code& ec)
+{
+	auto error = []()
+	{
+		return std::error_code(static_cast<int>(GetLastError()), std::system_category());
+	};
+
+	std::unique_ptr<MappedFile> mapped(new MappedFile());
+
+	mapped->file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (mapped->file == INVALID_HANDLE_VALUE)
+	{
+		mapped->file = nullptr;
+		ec = error();
+		return nullptr;
+	}
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(mapped->file, &size))
+	{
+		ec = error();
+		return nullptr;
+	}
+
+	mapped->size = static_cast<uint64_t>(size.QuadPart);
+	if (mapped->size == 0)
+	{
+		// empty files can't be mapped
+		return mapped;
+	}
+
+	mapped->mapping = CreateFileMappingA(mapped->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapped->mapping)
+	{
+		ec = error();
+		return nullptr;
+	}
+
+	mapped->data = static_cast<const uint8_t*>(MapViewOfFile(mapped->mapping, FILE_MAP_READ, 0, 0, 0));
+	if (!mapped->data)
+	{
+		ec = error();
+		return nullptr;
+	}
+
+	return mapped;
+}
+
+MappedFile::~MappedFile()
+{
+	if (data) UnmapViewOfFile(data);
+	if (mapping) CloseHandle(mapping);
+	if (file) CloseHandle(file);
+}
+
+#else
+
+std::unique_ptr<MappedFile> MappedFile::Open(const std::string& path, std::error_code& ec)
+{
+	const int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		ec = std::error_code(errno, std::generic_category());
+		return nullptr;
+	}
+
+	std::unique_ptr<MappedFile> mapped(new MappedFile());
+
+	struct stat info;
+	if (fstat(fd, &info) != 0)
+	{
+		ec = std::error_code(errno, std::generic_category());
+		close(fd);
+		return nullptr;
+	}
+
+	mapped->size = static_cast<uint64_t>(info.st_size);
+
+	// empty files can't be mapped
+	if (mapped->size > 0)
+	{
+		void* address = mmap(nullptr, static_cast<size_t>(mapped->size), PROT_READ, MAP_PRIVATE, fd, 0);
+		if (address == MAP_FAILED)
+		{
+			ec = std::error_code(errno, std::generic_category());
+			close(fd);
+			return nullptr;
+		}
+
+		// the capture is read front to back
+		madvise(address, static_cast<size_t>(mapped->size), MADV_SEQUENTIAL);
+		mapped->data = static_cast<const uint8_t*>(address);
+	}
+
+	// the mapping remains valid after the descriptor is closed
+	close(fd);
+	return mapped;
+}
+
+MappedFile::~MappedFile()
+{
+	if (data)
+	{
+		munmap(const_cast<uint8_t*>(data), static_cast<size_t>(size));
+	}
+}
+
+#endif
+
+}
@@ -0,0 +1,76 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_MAPPEDFILE_H
+#define OPENDNP3_MAPPEDFILE_H
+
+#include <openpal/util/Uncopyable.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <system_error>
+
+namespace opendnp3
+{
+
+/**
+* A read-only memory mapping of an entire file
+*/
+class MappedFile final : private openpal::Uncopyable
+{
+public:
+
+	/**
+	* Map a file into memory
+	*
+	* @param path the file to map
+	* @param ec An error code. If set, a nullptr will be returned
+	*/
+	static std::unique_ptr<MappedFile> Open(const std::string& path, std::error_code& ec);
+
+	~MappedFile();
+
+	const uint8_t* Data() const
+	{
+		return data;
+	}
+
+	uint64_t Size() const
+	{
+		return size;
+	}
+
+private:
+
+	MappedFile() = default;
+
+	const uint8_t* data = nullptr;
+	uint64_t size = 0;
+
+#if defined(WIN32)
+	void* file = nullptr;
+	void* mapping = nullptr;
+#endif
+};
+
+}
+
+#endif
@@ -0,0 +1,147 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "opendnp3/LatencyHistogram.h"
+
+#include <cstring>
+
+namespace opendnp3
+{
+
+LatencyHistogram::LatencyHistogram()
+{
+	this->Reset();
+}
+
+void LatencyHistogram::Record(int64_t latency)
+{
+	const uint64_t value = (latency < 0) ? 0 : static_cast<uint64_t>(latency);
+
+	++buckets[GetIndex(value)];
+	++count;
+	sum += value;
+
+	if (value < min)
+	{
+		min = value;
+	}
+
+	if (value > max)
+	{
+		max = value;
+	}
+}
+
+void LatencyHistogram::Reset()
+{
+	count = 0;
+	sum = 0;
+	min = UINT64_MAX;
+	max = 0;
+	memset(buckets, 0, sizeof(buckets));
+}
+
+double LatencyHistogram::Mean() const
+{
+	return (count == 0) ? 0.0 : static_cast<double>(sum) / static_cast<double>(count);
+}
+
+uint64_t LatencyHistogram::ValueAtPercentile(double percentile) const
+{
+	if (count == 0)
+	{
+		return 0;
+	}
+
+	if (percentile < 0.0)
+	{
+		percentile = 0.0;
+	}
+	else if (percentile > 100.0)
+	{
+		percentile = 100.0;
+	}
+
+	// rank of the value we're looking for, at least the first value
+	auto target = static_cast<uint64_t>((percentile / 100.0) * static_cast<double>(count) + 0.5);
+	if (target == 0)
+	{
+		target = 1;
+	}
+
+	uint64_t total = 0;
+	for (uint32_t i = 0; i < NUM_BUCKETS; ++i)
+	{
+		total += buckets[i];
+		if (total >= target)
+		{
+			const auto value = HighestEquivalentValue(i);
+			return (value > max) ? max : value;
+		}
+	}
+
+	return max;
+}
+
+uint32_t LatencyHistogram::GetIndex(uint64_t value)
+{
+	const uint64_t MAX_VALUE = (static_cast<uint64_t>(1) << MAX_VALUE_BITS) - 1;
+
+	if (value > MAX_VALUE)
+	{
+		value = MAX_VALUE;
+	}
+
+	// the first two sub-bucket ranges have a resolution of 1
+	if (value < 2 * SUB_BUCKET_COUNT)
+	{
+		return static_cast<uint32_t>(value);
+	}
+
+	// position of the most significant bit
+	uint32_t msb = 0;
+	auto remainder = value;
+	for (uint32_t shift = MAX_VALUE_BITS / 2; shift > 0; shift >>= 1)
+	{
+		if (remainder >> shift)
+		{
+			remainder >>= shift;
+			msb += shift;
+		}
+	}
+
+	// keep the top SUB_BUCKET_BITS + 1 bits, which lie in [SUB_BUCKET_COUNT, 2 * SUB_BUCKET_COUNT)
+	const auto shift = msb - SUB_BUCKET_BITS;
+	return shift * SUB_BUCKET_COUNT + static_cast<uint32_t>(value >> shift);
+}
+
+uint64_t LatencyHistogram::HighestEquivalentValue(uint32_t index)
+{
+	if (index < 2 * SUB_BUCKET_COUNT)
+	{
+		return index;
+	}
+
+	const auto shift = (index / SUB_BUCKET_COUNT) - 1;
+	const auto subBucket = static_cast<uint64_t>((index % SUB_BUCKET_COUNT) + SUB_BUCKET_COUNT);
+	return ((subBucket + 1) << shift) - 1;
+}
+
+}
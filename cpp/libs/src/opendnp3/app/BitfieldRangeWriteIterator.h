@@ -21,6 +21,8 @@
 #ifndef OPENDNP3_BITFIELDRANGEWRITEITERATOR_H
 #define OPENDNP3_BITFIELDRANGEWRITEITERATOR_H
 
+#include "opendnp3/app/PackedBits.h"
+
 #include <openpal/serialization/Format.h>
 
 namespace opendnp3
@@ -98,6 +100,34 @@ public:
 		}
 	}
 
+	/**
+	* Write as many as count bits from a packed source, beginning with the bit at index
+	*
+	* @return the number of bits written
+	*/
+	uint32_t Write(const PackedBits& bits, uint32_t index, uint32_t count)
+	{
+		if (!isValid)
+		{
+			return 0;
+		}
+
+		const uint32_t num = (count < (maxCount - this->count)) ? count : (maxCount - this->count);
+		uint32_t written = 0;
+
+		// complete a partially written byte one bit at a time
+		while ((written < num) && ((this->count % 8) != 0))
+		{
+			this->Write(bits.Get(index + written));
+			++written;
+		}
+
+		bits.CopyTo(index + written, num - written, (*pPosition) + (this->count / 8));
+		this->count += (num - written);
+
+		return num;
+	}
+
 	bool IsValid() const
 	{
 		return isValid;
@@ -106,7 +136,7 @@ public:
 private:
 
 	typename IndexType::Type start;
-	typename IndexType::Type count;
+	uint32_t count;
 
 	uint32_t maxCount;
 
@@ -33,8 +33,8 @@ class DNP3Serializer : public openpal::Serializer<T>
 {
 public:
 
-	DNP3Serializer(GroupVariationID id_, uint32_t size_, typename openpal::Serializer<T>::ReadFunc pReadFunc_, typename openpal::Serializer<T>::WriteFunc pWriteFunc_) :
-		openpal::Serializer<T>(size_, pReadFunc_, pWriteFunc_),
+	DNP3Serializer(GroupVariationID id_, uint32_t size_, typename openpal::Serializer<T>::ReadFunc pReadFunc_, typename openpal::Serializer<T>::WriteFunc pWriteFunc_, typename openpal::Serializer<T>::WriteManyFunc pWriteManyFunc_ = nullptr) :
+		openpal::Serializer<T>(size_, pReadFunc_, pWriteFunc_, pWriteManyFunc_),
 		id(id_)
 	{}
 
@@ -0,0 +1,116 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "OctetArena.h"
+
+#include <new>
+
+namespace opendnp3
+{
+
+OctetArena& OctetArena::Instance()
+{
+	// never destroyed so that values in static storage can be released during exit
+	static OctetArena* arena = new OctetArena();
+	return *arena;
+}
+
+OctetArena::OctetArena()
+{
+	// capacities of 24, 56, 120 and 256 bytes
+	const uint32_t sizes[NUM_SIZE_CLASSES] = { 32, 64, 128, 264 };
+	for (uint32_t i = 0; i < NUM_SIZE_CLASSES; ++i)
+	{
+		classes[i].blockSize = sizes[i];
+	}
+}
+
+OctetBlock* OctetArena::Allocate(uint8_t size)
+{
+	uint8_t index = 0;
+	while ((index + 1u) < NUM_SIZE_CLASSES && (sizeof(OctetBlock) + size) > classes[index].blockSize)
+	{
+		++index;
+	}
+
+	auto& sizeClass = classes[index];
+
+	void* memory = nullptr;
+
+	{
+		std::lock_guard<std::mutex> lock(sizeClass.mutex);
+
+		if (!sizeClass.freeList)
+		{
+			this->AddSlab(sizeClass);
+		}
+
+		memory = sizeClass.freeList;
+		sizeClass.freeList = sizeClass.freeList->next;
+		++sizeClass.numInUse;
+	}
+
+	return new (memory) OctetBlock(index);
+}
+
+void OctetArena::Free(OctetBlock* block)
+{
+	auto& sizeClass = classes[block->sizeClass];
+	block->~OctetBlock();
+
+	auto free = reinterpret_cast<FreeBlock*>(block);
+
+	std::lock_guard<std::mutex> lock(sizeClass.mutex);
+	free->next = sizeClass.freeList;
+	sizeClass.freeList = free;
+	--sizeClass.numInUse;
+}
+
+void OctetArena::AddSlab(SizeClass& sizeClass)
+{
+	std::unique_ptr<uint8_t[]> slab(new uint8_t[SLAB_SIZE]);
+
+	const auto numBlocks = SLAB_SIZE / sizeClass.blockSize;
+	for (uint32_t i = 0; i < numBlocks; ++i)
+	{
+		auto free = reinterpret_cast<FreeBlock*>(slab.get() + (i * sizeClass.blockSize));
+		free->next = sizeClass.freeList;
+		sizeClass.freeList = free;
+	}
+
+	sizeClass.slabs.push_back(std::move(slab));
+}
+
+OctetArenaStatistics OctetArena::GetStatistics()
+{
+	OctetArenaStatistics statistics;
+
+	for (auto& sizeClass : classes)
+	{
+		std::lock_guard<std::mutex> lock(sizeClass.mutex);
+		statistics.numBlocksInUse += sizeClass.numInUse;
+		statistics.numBytesInUse += static_cast<uint64_t>(sizeClass.numInUse) * sizeClass.blockSize;
+		statistics.numBytesReserved += static_cast<uint64_t>(sizeClass.slabs.size()) * SLAB_SIZE;
+	}
+
+	return statistics;
+}
+
+}
@@ -0,0 +1,147 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_OCTETARENA_H
+#define OPENDNP3_OCTETARENA_H
+
+#include <openpal/util/Uncopyable.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+* Immutable, reference counted storage for the contents of an octet string
+*
+* The contents immediately follow the header in the same allocation
+*/
+class OctetBlock : private openpal::Uncopyable
+{
+	friend class OctetArena;
+
+public:
+
+	uint8_t* Data()
+	{
+		return reinterpret_cast<uint8_t*>(this) + sizeof(OctetBlock);
+	}
+
+	const uint8_t* Data() const
+	{
+		return reinterpret_cast<const uint8_t*>(this) + sizeof(OctetBlock);
+	}
+
+	uint32_t NumReferences() const
+	{
+		return references.load(std::memory_order_relaxed);
+	}
+
+private:
+
+	OctetBlock(uint8_t sizeClass) : references(1), sizeClass(sizeClass)
+	{}
+
+	std::atomic<uint32_t> references;
+	uint8_t sizeClass;
+};
+
+struct OctetArenaStatistics
+{
+	/// blocks currently referenced by at least one value
+	uint32_t numBlocksInUse = 0;
+
+	/// bytes of the blocks currently in use, including headers
+	uint64_t numBytesInUse = 0;
+
+	/// bytes reserved by all slabs
+	uint64_t numBytesReserved = 0;
+};
+
+/**
+* Slab allocator for octet strings that are too large to be stored inline.
+*
+* Blocks are carved from slabs of a few fixed size classes and recycled through
+* per-class free lists. Slabs are never returned to the system.
+*/
+class OctetArena final : private openpal::Uncopyable
+{
+
+public:
+
+	/// The arena shared by all octet strings in the process
+	static OctetArena& Instance();
+
+	/**
+	* @param size number of bytes of content, at most 255
+	* @return a block with a single reference
+	*/
+	OctetBlock* Allocate(uint8_t size);
+
+	static void Retain(OctetBlock* block)
+	{
+		block->references.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	static void Release(OctetBlock* block)
+	{
+		if (block->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			Instance().Free(block);
+		}
+	}
+
+	OctetArenaStatistics GetStatistics();
+
+private:
+
+	OctetArena();
+
+	void Free(OctetBlock* block);
+
+	static const uint32_t NUM_SIZE_CLASSES = 4;
+	static const uint32_t SLAB_SIZE = 16384;
+
+	struct FreeBlock
+	{
+		FreeBlock* next;
+	};
+
+	struct SizeClass
+	{
+		uint32_t blockSize = 0;
+		uint32_t numInUse = 0;
+		FreeBlock* freeList = nullptr;
+		std::vector<std::unique_ptr<uint8_t[]>> slabs;
+		std::mutex mutex;
+	};
+
+	void AddSlab(SizeClass& sizeClass);
+
+	SizeClass classes[NUM_SIZE_CLASSES];
+};
+
+}
+
+#endif
@@ -20,6 +20,8 @@
  */
 #include "opendnp3/app/OctetData.h"
 
+#include "opendnp3/app/OctetArena.h"
+
 #include <openpal/container/WSlice.h>
 #include <openpal/util/Comparisons.h>
 #include <openpal/util/Limits.h>
@@ -33,7 +35,7 @@ namespace opendnp3
 
 OctetData::OctetData() : size(1)
 {
-
+	storage.bytes[0] = 0x00;
 }
 
 OctetData::OctetData(const char* input) : OctetData(ToSlice(input))
@@ -41,13 +43,74 @@ OctetData::OctetData(const char* input) : OctetData(ToSlice(input))
 
 }
 
-OctetData::OctetData(const RSlice& input) :
-	size(input.IsEmpty() ? 1  : openpal::Min<uint32_t>(MAX_SIZE, input.Size()))
+OctetData::OctetData(const RSlice& input) : OctetData()
 {
 	if (input.IsNotEmpty())
 	{
-		auto dest = buffer.GetWSlice();
-		input.Take(size).CopyTo(dest);
+		this->Assign(input.Take(MAX_SIZE));
+	}
+}
+
+OctetData::OctetData(const OctetData& other) : storage(other.storage), size(other.size)
+{
+	if (!IsInline())
+	{
+		OctetArena::Retain(storage.block);
+	}
+}
+
+OctetData::OctetData(OctetData&& other) noexcept : storage(other.storage), size(other.size)
+{
+	// leave the other value with the default contents
+	other.size = 1;
+	other.storage.bytes[0] = 0x00;
+}
+
+OctetData& OctetData::operator=(const OctetData& other)
+{
+	if (this != &other)
+	{
+		if (!other.IsInline())
+		{
+			OctetArena::Retain(other.storage.block);
+		}
+
+		if (!IsInline())
+		{
+			OctetArena::Release(storage.block);
+		}
+
+		this->storage = other.storage;
+		this->size = other.size;
+	}
+
+	return *this;
+}
+
+OctetData& OctetData::operator=(OctetData&& other) noexcept
+{
+	if (this != &other)
+	{
+		if (!IsInline())
+		{
+			OctetArena::Release(storage.block);
+		}
+
+		this->storage = other.storage;
+		this->size = other.size;
+
+		other.size = 1;
+		other.storage.bytes[0] = 0x00;
+	}
+
+	return *this;
+}
+
+OctetData::~OctetData()
+{
+	if (!IsInline())
+	{
+		OctetArena::Release(storage.block);
 	}
 }
 
@@ -55,17 +118,13 @@ bool OctetData::Set(const openpal::RSlice& input)
 {
 	if (input.IsEmpty())
 	{
-		this->size = 0;
-		this->buffer.GetWSlice()[0] = 0x00;
+		this->Assign(input);
+		this->storage.bytes[0] = 0x00;
 		return false;
 	}
 
 	const bool is_oversized = input.Size() > MAX_SIZE;
-	const uint8_t usable_size = is_oversized ? MAX_SIZE : static_cast<uint8_t>(input.Size());
-
-	auto dest = this->buffer.GetWSlice();
-	input.Take(usable_size).CopyTo(dest);
-	this->size = usable_size;
+	this->Assign(input.Take(MAX_SIZE));
 	return !is_oversized;
 }
 
@@ -78,7 +137,32 @@ bool OctetData::Set(const char* input)
 
 openpal::RSlice OctetData::ToRSlice() const
 {
-	return buffer.ToRSlice(size);
+	return IsInline() ? RSlice(storage.bytes, size) : RSlice(storage.block->Data(), size);
+}
+
+void OctetData::Assign(const openpal::RSlice& input)
+{
+	// the input may point into the block being replaced, so it is released last
+	OctetBlock* previous = IsInline() ? nullptr : storage.block;
+	const auto length = static_cast<uint8_t>(input.Size());
+
+	if (length <= INLINE_SIZE)
+	{
+		memmove(storage.bytes, input, length);
+	}
+	else
+	{
+		auto block = OctetArena::Instance().Allocate(length);
+		memcpy(block->Data(), input, length);
+		storage.block = block;
+	}
+
+	this->size = length;
+
+	if (previous)
+	{
+		OctetArena::Release(previous);
+	}
 }
 
 openpal::RSlice OctetData::ToSlice(const char* input)
@@ -0,0 +1,162 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_PACKEDBITS_H
+#define OPENDNP3_PACKEDBITS_H
+
+#include <openpal/container/Array.h>
+#include <openpal/util/Uncopyable.h>
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+* A fixed size plane of bits stored in 64-bit words, least significant bit first.
+*
+* Runs of bits are counted and copied a word at a time, which is how packed
+* DNP3 bitfields (e.g. Group1Var1) are written without visiting every point.
+*/
+class PackedBits : private openpal::Uncopyable
+{
+
+public:
+
+	// the extra word lets Window() read past the last bit without a bounds check
+	explicit PackedBits(uint32_t size) : size(size), words((size / 64) + 2)
+	{}
+
+	uint32_t Size() const
+	{
+		return size;
+	}
+
+	bool Get(uint32_t index) const
+	{
+		return (words[index / 64] & (uint64_t(1) << (index % 64))) != 0;
+	}
+
+	void Set(uint32_t index, bool value)
+	{
+		const auto mask = uint64_t(1) << (index % 64);
+
+		if (value)
+		{
+			words[index / 64] |= mask;
+		}
+		else
+		{
+			words[index / 64] &= ~mask;
+		}
+	}
+
+	/// Clear count bits beginning at index
+	void Clear(uint32_t index, uint32_t count)
+	{
+		while (count > 0)
+		{
+			const auto offset = index % 64;
+			const auto num = (count < (64 - offset)) ? count : (64 - offset);
+			const auto mask = (num == 64) ? ~uint64_t(0) : (((uint64_t(1) << num) - 1) << offset);
+
+			words[index / 64] &= ~mask;
+
+			index += num;
+			count -= num;
+		}
+	}
+
+	/// @return the number of consecutive set bits beginning at index, but no more than max
+	uint32_t CountOnes(uint32_t index, uint32_t max) const
+	{
+		uint32_t count = 0;
+
+		while (count < max)
+		{
+			const auto window = Window(index + count);
+
+			if (window == ~uint64_t(0))
+			{
+				count += 64;
+			}
+			else
+			{
+				// the window has a zero, find the lowest one
+				auto bits = window;
+				while (bits & 1)
+				{
+					bits >>= 1;
+					++count;
+				}
+
+				break;
+			}
+		}
+
+		return (count < max) ? count : max;
+	}
+
+	/// Copy count bits beginning at index to dest, which must have room for (count + 7) / 8 bytes.
+	/// Unused bits in the last byte are zero.
+	void CopyTo(uint32_t index, uint32_t count, uint8_t* dest) const
+	{
+		while (count > 0)
+		{
+			const auto num = (count < 64) ? count : 64;
+			const auto window = (num == 64) ? Window(index) : (Window(index) & ((uint64_t(1) << num) - 1));
+			const auto numBytes = (num + 7) / 8;
+
+			for (uint32_t i = 0; i < numBytes; ++i)
+			{
+				dest[i] = static_cast<uint8_t>(window >> (8 * i));
+			}
+
+			dest += numBytes;
+			index += num;
+			count -= num;
+		}
+	}
+
+private:
+
+	/// @return the 64 bits beginning at index, zero filled past the end
+	uint64_t Window(uint32_t index) const
+	{
+		const auto word = index / 64;
+		const auto offset = index % 64;
+
+		if (offset == 0)
+		{
+			return words[word];
+		}
+		else
+		{
+			return (words[word] >> offset) | (words[word + 1] << (64 - offset));
+		}
+	}
+
+	const uint32_t size;
+	openpal::Array<uint64_t, uint32_t> words;
+};
+
+}
+
+#endif
@@ -81,6 +81,33 @@ public:
 		}
 	}
 
+	/**
+	* @return the number of values that still fit in the buffer
+	*/
+	uint32_t Remaining() const
+	{
+		return isValid ? (pPosition->Size() / sizeOfTypePlusIndex) : 0;
+	}
+
+	/**
+	* Write up to num values, each prefixed with the corresponding UInt16 index
+	*
+	* @return the number of values written
+	*/
+	uint32_t WriteMany(const openpal::StridedView<WriteType>& values, const uint16_t* indices, uint32_t num)
+	{
+		static_assert(PrefixType::SIZE == 2, "bulk writes require a 16-bit prefix");
+
+		if (!isValid)
+		{
+			return 0;
+		}
+
+		const uint32_t written = serializer.WriteMany(values, indices, num, *pPosition);
+		count += static_cast<typename PrefixType::Type>(written);
+		return written;
+	}
+
 	bool IsValid() const
 	{
 		return isValid;
@@ -21,6 +21,7 @@
 #ifndef OPENDNP3_RANGEWRITEITERATOR_H
 #define OPENDNP3_RANGEWRITEITERATOR_H
 
+#include <openpal/container/StridedView.h>
 #include <openpal/serialization/Format.h>
 #include <openpal/serialization/Serializer.h>
 
@@ -79,6 +80,24 @@ public:
 		}
 	}
 
+	/**
+	* Write as many of the values as fit in both the buffer and the index range
+	*
+	* @return the number of values written
+	*/
+	uint32_t WriteMany(const openpal::StridedView<WriteType>& values, uint32_t num)
+	{
+		if (!isValid || count > IndexType::Max)
+		{
+			return 0;
+		}
+
+		const uint32_t remaining = IndexType::Max - count + 1;
+		const uint32_t written = serializer.WriteMany(values, nullptr, (num < remaining) ? num : remaining, *pPosition);
+		count += written;
+		return written;
+	}
+
 	bool IsValid() const
 	{
 		return isValid;
@@ -95,136 +95,98 @@ ParseResult CountIndexParser::Process(const HeaderRecord& record, openpal::RSlic
 }
 
 
+HandlerTable<CountIndexParser::ParseFun> CountIndexParser::CreateHandlers()
+{
+	HandlerTable<ParseFun> handlers;
+
+	handlers.Set(GroupVariation::Group2Var1, &Parse<Group2Var1>);
+	handlers.Set(GroupVariation::Group2Var2, &Parse<Group2Var2>);
+	handlers.Set(GroupVariation::Group2Var3, &Parse<Group2Var3>);
+
+	handlers.Set(GroupVariation::Group4Var1, &Parse<Group4Var1>);
+	handlers.Set(GroupVariation::Group4Var2, &Parse<Group4Var2>);
+	handlers.Set(GroupVariation::Group4Var3, &Parse<Group4Var3>);
+
+	handlers.Set(GroupVariation::Group11Var1, &Parse<Group11Var1>);
+	handlers.Set(GroupVariation::Group11Var2, &Parse<Group11Var2>);
+
+	handlers.Set(GroupVariation::Group12Var1, &Parse<Group12Var1>);
+
+	handlers.Set(GroupVariation::Group13Var1, &Parse<Group13Var1>);
+	handlers.Set(GroupVariation::Group13Var2, &Parse<Group13Var2>);
+
+	handlers.Set(GroupVariation::Group22Var1, &Parse<Group22Var1>);
+	handlers.Set(GroupVariation::Group22Var2, &Parse<Group22Var2>);
+	handlers.Set(GroupVariation::Group22Var5, &Parse<Group22Var5>);
+	handlers.Set(GroupVariation::Group22Var6, &Parse<Group22Var6>);
+
+	handlers.Set(GroupVariation::Group23Var1, &Parse<Group23Var1>);
+	handlers.Set(GroupVariation::Group23Var2, &Parse<Group23Var2>);
+	handlers.Set(GroupVariation::Group23Var5, &Parse<Group23Var5>);
+	handlers.Set(GroupVariation::Group23Var6, &Parse<Group23Var6>);
+
+	handlers.Set(GroupVariation::Group32Var1, &Parse<Group32Var1>);
+	handlers.Set(GroupVariation::Group32Var2, &Parse<Group32Var2>);
+	handlers.Set(GroupVariation::Group32Var3, &Parse<Group32Var3>);
+	handlers.Set(GroupVariation::Group32Var4, &Parse<Group32Var4>);
+	handlers.Set(GroupVariation::Group32Var5, &Parse<Group32Var5>);
+	handlers.Set(GroupVariation::Group32Var6, &Parse<Group32Var6>);
+	handlers.Set(GroupVariation::Group32Var7, &Parse<Group32Var7>);
+	handlers.Set(GroupVariation::Group32Var8, &Parse<Group32Var8>);
+
+	handlers.Set(GroupVariation::Group41Var1, &Parse<Group41Var1>);
+	handlers.Set(GroupVariation::Group41Var2, &Parse<Group41Var2>);
+	handlers.Set(GroupVariation::Group41Var3, &Parse<Group41Var3>);
+	handlers.Set(GroupVariation::Group41Var4, &Parse<Group41Var4>);
+
+	handlers.Set(GroupVariation::Group42Var1, &Parse<Group42Var1>);
+	handlers.Set(GroupVariation::Group42Var2, &Parse<Group42Var2>);
+	handlers.Set(GroupVariation::Group42Var3, &Parse<Group42Var3>);
+	handlers.Set(GroupVariation::Group42Var4, &Parse<Group42Var4>);
+	handlers.Set(GroupVariation::Group42Var5, &Parse<Group42Var5>);
+	handlers.Set(GroupVariation::Group42Var6, &Parse<Group42Var6>);
+	handlers.Set(GroupVariation::Group42Var7, &Parse<Group42Var7>);
+	handlers.Set(GroupVariation::Group42Var8, &Parse<Group42Var8>);
+
+	handlers.Set(GroupVariation::Group43Var1, &Parse<Group43Var1>);
+	handlers.Set(GroupVariation::Group43Var2, &Parse<Group43Var2>);
+	handlers.Set(GroupVariation::Group43Var3, &Parse<Group43Var3>);
+	handlers.Set(GroupVariation::Group43Var4, &Parse<Group43Var4>);
+	handlers.Set(GroupVariation::Group43Var5, &Parse<Group43Var5>);
+	handlers.Set(GroupVariation::Group43Var6, &Parse<Group43Var6>);
+	handlers.Set(GroupVariation::Group43Var7, &Parse<Group43Var7>);
+	handlers.Set(GroupVariation::Group43Var8, &Parse<Group43Var8>);
+
+	handlers.Set(GroupVariation::Group50Var4, &Parse<Group50Var4>);
+
+	handlers.Set(GroupVariation::Group111Var0, &ParseIndexPrefixedOctetData);
+
+	handlers.Set(GroupVariation::Group122Var1, &ParseType<Group122Var1>);
+	handlers.Set(GroupVariation::Group122Var2, &ParseType<Group122Var2>);
+
+	return handlers;
+}
+
 ParseResult CountIndexParser::ParseCountOfObjects(openpal::RSlice& buffer, const HeaderRecord& record, const NumParser& numparser, uint16_t count, openpal::Logger* pLogger, IAPDUHandler* pHandler)
 {
-	switch (record.enumeration)
+	static const HandlerTable<ParseFun> handlers = CreateHandlers();
+
+	const auto& info = GroupVariationTable::Lookup(record.enumeration);
+	const auto parse = handlers.Get(info);
+
+	if ((info.qualifiers & GroupVariationTable::COUNT_AND_PREFIX) && parse)
 	{
-	case(GroupVariation::Group2Var1) :
-		return CountIndexParser::From<Group2Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group2Var2) :
-		return CountIndexParser::From<Group2Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group2Var3) :
-		return CountIndexParser::From<Group2Var3>(count, numparser).Process(record, buffer, pHandler, pLogger);
-
-	case(GroupVariation::Group4Var1) :
-		return CountIndexParser::From<Group4Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group4Var2) :
-		return CountIndexParser::From<Group4Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group4Var3) :
-		return CountIndexParser::From<Group4Var3>(count, numparser).Process(record, buffer, pHandler, pLogger);
-
-
-	case(GroupVariation::Group11Var1) :
-		return CountIndexParser::From<Group11Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group11Var2) :
-		return CountIndexParser::From<Group11Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
-
-	case(GroupVariation::Group12Var1) :
-		return CountIndexParser::From<Group12Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
-
-	case(GroupVariation::Group13Var1) :
-		return CountIndexParser::From<Group13Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group13Var2) :
-		return CountIndexParser::From<Group13Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
-
-	case(GroupVariation::Group22Var1) :
-		return CountIndexParser::From<Group22Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group22Var2) :
-		return CountIndexParser::From<Group22Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group22Var5) :
-		return CountIndexParser::From<Group22Var5>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group22Var6) :
-		return CountIndexParser::From<Group22Var6>(count, numparser).Process(record, buffer, pHandler, pLogger);
-
-	case(GroupVariation::Group23Var1) :
-		return CountIndexParser::From<Group23Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group23Var2) :
-		return CountIndexParser::From<Group23Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group23Var5) :
-		return CountIndexParser::From<Group23Var5>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group23Var6) :
-		return CountIndexParser::From<Group23Var6>(count, numparser).Process(record, buffer, pHandler, pLogger);
-
-	case(GroupVariation::Group32Var1) :
-		return CountIndexParser::From<Group32Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group32Var2) :
-		return CountIndexParser::From<Group32Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group32Var3) :
-		return CountIndexParser::From<Group32Var3>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group32Var4) :
-		return CountIndexParser::From<Group32Var4>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group32Var5) :
-		return CountIndexParser::From<Group32Var5>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group32Var6) :
-		return CountIndexParser::From<Group32Var6>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group32Var7) :
-		return CountIndexParser::From<Group32Var7>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group32Var8) :
-		return CountIndexParser::From<Group32Var8>(count, numparser).Process(record, buffer, pHandler, pLogger);
-
-	case(GroupVariation::Group41Var1) :
-		return CountIndexParser::From<Group41Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group41Var2) :
-		return CountIndexParser::From<Group41Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group41Var3) :
-		return CountIndexParser::From<Group41Var3>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group41Var4) :
-		return CountIndexParser::From<Group41Var4>(count, numparser).Process(record, buffer, pHandler, pLogger);
-
-	case(GroupVariation::Group42Var1) :
-		return CountIndexParser::From<Group42Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group42Var2) :
-		return CountIndexParser::From<Group42Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group42Var3) :
-		return CountIndexParser::From<Group42Var3>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group42Var4) :
-		return CountIndexParser::From<Group42Var4>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group42Var5) :
-		return CountIndexParser::From<Group42Var5>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group42Var6) :
-		return CountIndexParser::From<Group42Var6>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group42Var7) :
-		return CountIndexParser::From<Group42Var7>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group42Var8) :
-		return CountIndexParser::From<Group42Var8>(count, numparser).Process(record, buffer, pHandler, pLogger);
-
-	case(GroupVariation::Group43Var1) :
-		return CountIndexParser::From<Group43Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group43Var2) :
-		return CountIndexParser::From<Group43Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group43Var3) :
-		return CountIndexParser::From<Group43Var3>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group43Var4) :
-		return CountIndexParser::From<Group43Var4>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group43Var5) :
-		return CountIndexParser::From<Group43Var5>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group43Var6) :
-		return CountIndexParser::From<Group43Var6>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group43Var7) :
-		return CountIndexParser::From<Group43Var7>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group43Var8) :
-		return CountIndexParser::From<Group43Var8>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group50Var4) :
-		return CountIndexParser::From<Group50Var4>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group111Var0) :
-		return ParseIndexPrefixedOctetData(buffer, record, numparser, count, pLogger, pHandler);
-
-	case(GroupVariation::Group122Var1) :
-		return CountIndexParser::FromType<Group122Var1>(count, numparser).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group122Var2) :
-		return CountIndexParser::FromType<Group122Var2>(count, numparser).Process(record, buffer, pHandler, pLogger);
-
-	default:
-
-		FORMAT_LOGGER_BLOCK(pLogger, flags::WARN,
-		                    "Unsupported qualifier/object - %s - %i / %i",
-		                    QualifierCodeToString(record.GetQualifierCode()), record.group, record.variation);
-
-		return ParseResult::INVALID_OBJECT_QUALIFIER;
+		return parse(buffer, record, numparser, count, pLogger, pHandler);
 	}
+
+	FORMAT_LOGGER_BLOCK(pLogger, flags::WARN,
+	                    "Unsupported qualifier/object - %s - %i / %i",
+	                    QualifierCodeToString(record.GetQualifierCode()), record.group, record.variation);
+
+	return ParseResult::INVALID_OBJECT_QUALIFIER;
 }
 
-ParseResult CountIndexParser::ParseIndexPrefixedOctetData(openpal::RSlice& buffer, const HeaderRecord& record, const NumParser& numparser, uint32_t count, openpal::Logger* pLogger, IAPDUHandler* pHandler)
+ParseResult CountIndexParser::ParseIndexPrefixedOctetData(openpal::RSlice& buffer, const HeaderRecord& record, const NumParser& numparser, uint16_t count, openpal::Logger* pLogger, IAPDUHandler* pHandler)
 {
 	if (record.variation == 0)
 	{
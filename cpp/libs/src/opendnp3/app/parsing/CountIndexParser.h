@@ -30,6 +30,7 @@
 #include "opendnp3/app/parsing/NumParser.h"
 #include "opendnp3/app/parsing/ParserSettings.h"
 
+#include "opendnp3/app/HandlerTable.h"
 #include "opendnp3/app/parsing/BufferedCollection.h"
 
 namespace opendnp3
@@ -39,6 +40,8 @@ class CountIndexParser
 {
 	typedef void(*HandleFun)(const HeaderRecord& record, uint16_t count, const NumParser& numparser, const openpal::RSlice& buffer, IAPDUHandler& handler);
 
+	typedef ParseResult(*ParseFun)(openpal::RSlice& buffer, const HeaderRecord& record, const NumParser& numparser, uint16_t count, openpal::Logger* pLogger, IAPDUHandler* pHandler);
+
 public:
 
 	static ParseResult ParseHeader(
@@ -63,9 +66,18 @@ private:
 	template <class Type>
 	static CountIndexParser FromType(uint16_t count, const NumParser& numparser);
 
+	// Parse functions for every object that may be used with a count and prefix, indexed by handler slot
+	static HandlerTable<ParseFun> CreateHandlers();
+
+	template <class Descriptor>
+	static ParseResult Parse(openpal::RSlice& buffer, const HeaderRecord& record, const NumParser& numparser, uint16_t count, openpal::Logger* pLogger, IAPDUHandler* pHandler);
+
+	template <class Type>
+	static ParseResult ParseType(openpal::RSlice& buffer, const HeaderRecord& record, const NumParser& numparser, uint16_t count, openpal::Logger* pLogger, IAPDUHandler* pHandler);
+
 	static ParseResult ParseCountOfObjects(openpal::RSlice& buffer, const HeaderRecord& record, const NumParser& numparser, uint16_t count, openpal::Logger* pLogger, IAPDUHandler* pHandler);
 
-	static ParseResult ParseIndexPrefixedOctetData(openpal::RSlice& buffer, const HeaderRecord& record, const NumParser& numParser, uint32_t count, openpal::Logger* pLogger, IAPDUHandler* pHandler);
+	static ParseResult ParseIndexPrefixedOctetData(openpal::RSlice& buffer, const HeaderRecord& record, const NumParser& numParser, uint16_t count, openpal::Logger* pLogger, IAPDUHandler* pHandler);
 
 	template <class Descriptor>
 	static void InvokeCountOf(const HeaderRecord& record, uint16_t count, const NumParser& numparser, const openpal::RSlice& buffer, IAPDUHandler& handler);
@@ -97,6 +109,18 @@ CountIndexParser CountIndexParser::FromType(uint16_t count, const NumParser& num
 	return CountIndexParser(count, SIZE, numparser, &InvokeCountOfType<Type>);
 }
 
+template <class Descriptor>
+ParseResult CountIndexParser::Parse(openpal::RSlice& buffer, const HeaderRecord& record, const NumParser& numparser, uint16_t count, openpal::Logger* pLogger, IAPDUHandler* pHandler)
+{
+	return From<Descriptor>(count, numparser).Process(record, buffer, pHandler, pLogger);
+}
+
+template <class Type>
+ParseResult CountIndexParser::ParseType(openpal::RSlice& buffer, const HeaderRecord& record, const NumParser& numparser, uint16_t count, openpal::Logger* pLogger, IAPDUHandler* pHandler)
+{
+	return FromType<Type>(count, numparser).Process(record, buffer, pHandler, pLogger);
+}
+
 template <class Descriptor>
 void CountIndexParser::InvokeCountOf(const HeaderRecord& record, uint16_t count, const NumParser& numparser, const openpal::RSlice& buffer, IAPDUHandler& handler)
 {
@@ -87,42 +87,43 @@ ParseResult CountParser::ParseHeader(openpal::RSlice& buffer, const NumParser& n
 	}
 }
 
-ParseResult CountParser::ParseCountOfObjects(openpal::RSlice& buffer, const HeaderRecord& record, uint16_t count, openpal::Logger* pLogger, IAPDUHandler* pHandler)
+HandlerTable<CountParser::ParseFun> CountParser::CreateHandlers()
 {
-	switch (record.enumeration)
-	{
-	case(GroupVariation::Group50Var1) :
-		return CountParser::From<Group50Var1>(count).Process(record, buffer, pHandler, pLogger);
+	HandlerTable<ParseFun> handlers;
 
-	case(GroupVariation::Group50Var3):
-		return CountParser::From<Group50Var3>(count).Process(record, buffer, pHandler, pLogger);
+	handlers.Set(GroupVariation::Group50Var1, &Parse<Group50Var1>);
+	handlers.Set(GroupVariation::Group50Var3, &Parse<Group50Var3>);
 
-	case(GroupVariation::Group51Var1) :
-		return CountParser::From<Group51Var1>(count).Process(record, buffer, pHandler, pLogger);
+	handlers.Set(GroupVariation::Group51Var1, &Parse<Group51Var1>);
+	handlers.Set(GroupVariation::Group51Var2, &Parse<Group51Var2>);
 
-	case(GroupVariation::Group51Var2) :
-		return CountParser::From<Group51Var2>(count).Process(record, buffer, pHandler, pLogger);
+	handlers.Set(GroupVariation::Group52Var1, &Parse<Group52Var1>);
+	handlers.Set(GroupVariation::Group52Var2, &Parse<Group52Var2>);
 
-	case(GroupVariation::Group52Var1) :
-		return CountParser::From<Group52Var1>(count).Process(record, buffer, pHandler, pLogger);
+	handlers.Set(GroupVariation::Group120Var3, &Parse<Group120Var3>);
+	handlers.Set(GroupVariation::Group120Var4, &Parse<Group120Var4>);
 
-	case(GroupVariation::Group52Var2) :
-		return CountParser::From<Group52Var2>(count).Process(record, buffer, pHandler, pLogger);
+	return handlers;
+}
 
-	case(GroupVariation::Group120Var3) :
-		return CountParser::From<Group120Var3>(count).Process(record, buffer, pHandler, pLogger);
+ParseResult CountParser::ParseCountOfObjects(openpal::RSlice& buffer, const HeaderRecord& record, uint16_t count, openpal::Logger* pLogger, IAPDUHandler* pHandler)
+{
+	static const HandlerTable<ParseFun> handlers = CreateHandlers();
 
-	case(GroupVariation::Group120Var4) :
-		return CountParser::From<Group120Var4>(count).Process(record, buffer, pHandler, pLogger);
+	const auto& info = GroupVariationTable::Lookup(record.enumeration);
+	const auto parse = handlers.Get(info);
 
-	default:
-		FORMAT_LOGGER_BLOCK(pLogger, flags::WARN, "Unsupported qualifier/object - %s - %i / %i",
-		                    QualifierCodeToString(record.GetQualifierCode()),
-		                    record.group,
-		                    record.variation);
-
-		return ParseResult::INVALID_OBJECT_QUALIFIER;
+	if ((info.qualifiers & GroupVariationTable::COUNT) && parse)
+	{
+		return parse(buffer, record, count, pLogger, pHandler);
 	}
+
+	FORMAT_LOGGER_BLOCK(pLogger, flags::WARN, "Unsupported qualifier/object - %s - %i / %i",
+	                    QualifierCodeToString(record.GetQualifierCode()),
+	                    record.group,
+	                    record.variation);
+
+	return ParseResult::INVALID_OBJECT_QUALIFIER;
 }
 
 }
@@ -31,6 +31,7 @@
 #include "opendnp3/app/parsing/NumParser.h"
 #include "opendnp3/app/parsing/ParserSettings.h"
 #include "opendnp3/app/parsing/BufferedCollection.h"
+#include "opendnp3/app/HandlerTable.h"
 
 namespace opendnp3
 {
@@ -39,6 +40,8 @@ class CountParser
 {
 	typedef void (*HandleFun)(const HeaderRecord& record, uint16_t count, const openpal::RSlice& buffer, IAPDUHandler& handler);
 
+	typedef ParseResult (*ParseFun)(openpal::RSlice& buffer, const HeaderRecord& record, uint16_t count, openpal::Logger* pLogger, IAPDUHandler* pHandler);
+
 public:
 
 	static ParseResult ParseHeader(
@@ -59,6 +62,12 @@ private:
 	template <class Descriptor>
 	static CountParser From(uint16_t count);
 
+	// Parse functions for every object that may be used with a count, indexed by handler slot
+	static HandlerTable<ParseFun> CreateHandlers();
+
+	template <class Descriptor>
+	static ParseResult Parse(openpal::RSlice& buffer, const HeaderRecord& record, uint16_t count, openpal::Logger* pLogger, IAPDUHandler* pHandler);
+
 	static ParseResult ParseCountOfObjects(openpal::RSlice& buffer, const HeaderRecord& record, uint16_t count, openpal::Logger* pLogger, IAPDUHandler* pHandler);
 
 	template <class Descriptor>
@@ -80,6 +89,12 @@ CountParser CountParser::From(uint16_t count)
 	return CountParser(count, size, &InvokeCountOf<Descriptor>);
 }
 
+template <class Descriptor>
+ParseResult CountParser::Parse(openpal::RSlice& buffer, const HeaderRecord& record, uint16_t count, openpal::Logger* pLogger, IAPDUHandler* pHandler)
+{
+	return From<Descriptor>(count).Process(record, buffer, pHandler, pLogger);
+}
+
 template <class T>
 void CountParser::InvokeCountOf(const HeaderRecord& record, uint16_t count, const openpal::RSlice& buffer, IAPDUHandler& handler)
 {
@@ -91,56 +91,43 @@ ParseResult FreeFormatParser::ParseHeader(openpal::RSlice& buffer, const ParserS
 
 	FreeFormatHeader header(record, FREE_FORMAT_COUNT);
 
-	switch (record.enumeration)
-	{
-	case(GroupVariation::Group120Var1) :
-		return ParseFreeFormat(ParseAny<Group120Var1>, header, FREE_FORMAT_SIZE, copy, pHandler, pLogger);
-
-	case(GroupVariation::Group120Var2) :
-		return ParseFreeFormat(ParseAny<Group120Var2>, header, FREE_FORMAT_SIZE, copy, pHandler, pLogger);
-
-	case(GroupVariation::Group120Var5) :
-		return ParseFreeFormat(ParseAny<Group120Var5>, header, FREE_FORMAT_SIZE, copy, pHandler, pLogger);
-
-	case(GroupVariation::Group120Var6) :
-		return ParseFreeFormat(ParseAny<Group120Var6>, header, FREE_FORMAT_SIZE, copy, pHandler, pLogger);
-
-	case(GroupVariation::Group120Var7) :
-		return ParseFreeFormat(ParseAny<Group120Var7>, header, FREE_FORMAT_SIZE, copy, pHandler, pLogger);
-
-	case(GroupVariation::Group120Var9) :
-		return ParseFreeFormat(ParseAny<Group120Var9>, header, FREE_FORMAT_SIZE, copy, pHandler, pLogger);
-
-	case(GroupVariation::Group120Var8) :
-		return ParseFreeFormat(ParseAny<Group120Var8>, header, FREE_FORMAT_SIZE, copy, pHandler, pLogger);
-
-	case(GroupVariation::Group120Var10) :
-		return ParseFreeFormat(ParseAny<Group120Var10>, header, FREE_FORMAT_SIZE, copy, pHandler, pLogger);
-
-	case(GroupVariation::Group120Var11) :
-		return ParseFreeFormat(ParseAny<Group120Var11>, header, FREE_FORMAT_SIZE, copy, pHandler, pLogger);
+	static const HandlerTable<FreeFormatHandler> handlers = CreateHandlers();
 
-	case(GroupVariation::Group120Var12) :
-		return ParseFreeFormat(ParseAny<Group120Var12>, header, FREE_FORMAT_SIZE, copy, pHandler, pLogger);
+	const auto& info = GroupVariationTable::Lookup(record.enumeration);
+	const auto parse = handlers.Get(info);
 
-	case(GroupVariation::Group120Var13) :
-		return ParseFreeFormat(ParseAny<Group120Var13>, header, FREE_FORMAT_SIZE, copy, pHandler, pLogger);
-
-	case(GroupVariation::Group120Var14) :
-		return ParseFreeFormat(ParseAny<Group120Var14>, header, FREE_FORMAT_SIZE, copy, pHandler, pLogger);
-
-	case(GroupVariation::Group120Var15) :
-		return ParseFreeFormat(ParseAny<Group120Var15>, header, FREE_FORMAT_SIZE, copy, pHandler, pLogger);
+	if ((info.qualifiers & GroupVariationTable::FREE_FORMAT) && parse)
+	{
+		return ParseFreeFormat(parse, header, FREE_FORMAT_SIZE, copy, pHandler, pLogger);
+	}
 
-	default:
-		FORMAT_LOGGER_BLOCK(pLogger, flags::WARN,
-		                    "Unsupported qualifier/object - %s - %i / %i",
-		                    QualifierCodeToString(record.GetQualifierCode()), record.group, record.variation
-		                   );
+	FORMAT_LOGGER_BLOCK(pLogger, flags::WARN,
+	                    "Unsupported qualifier/object - %s - %i / %i",
+	                    QualifierCodeToString(record.GetQualifierCode()), record.group, record.variation
+	                   );
 
-		return ParseResult::INVALID_OBJECT_QUALIFIER;
-	}
+	return ParseResult::INVALID_OBJECT_QUALIFIER;
+}
 
+HandlerTable<FreeFormatParser::FreeFormatHandler> FreeFormatParser::CreateHandlers()
+{
+	HandlerTable<FreeFormatHandler> handlers;
+
+	handlers.Set(GroupVariation::Group120Var1, &ParseAny<Group120Var1>);
+	handlers.Set(GroupVariation::Group120Var2, &ParseAny<Group120Var2>);
+	handlers.Set(GroupVariation::Group120Var5, &ParseAny<Group120Var5>);
+	handlers.Set(GroupVariation::Group120Var6, &ParseAny<Group120Var6>);
+	handlers.Set(GroupVariation::Group120Var7, &ParseAny<Group120Var7>);
+	handlers.Set(GroupVariation::Group120Var8, &ParseAny<Group120Var8>);
+	handlers.Set(GroupVariation::Group120Var9, &ParseAny<Group120Var9>);
+	handlers.Set(GroupVariation::Group120Var10, &ParseAny<Group120Var10>);
+	handlers.Set(GroupVariation::Group120Var11, &ParseAny<Group120Var11>);
+	handlers.Set(GroupVariation::Group120Var12, &ParseAny<Group120Var12>);
+	handlers.Set(GroupVariation::Group120Var13, &ParseAny<Group120Var13>);
+	handlers.Set(GroupVariation::Group120Var14, &ParseAny<Group120Var14>);
+	handlers.Set(GroupVariation::Group120Var15, &ParseAny<Group120Var15>);
+
+	return handlers;
 }
 
 ParseResult FreeFormatParser::ParseFreeFormat(FreeFormatHandler parser, const FreeFormatHeader& header, uint16_t size, openpal::RSlice& objects, IAPDUHandler* pHandler, openpal::Logger* pLogger)
@@ -29,6 +29,7 @@
 #include "opendnp3/app/parsing/ParseResult.h"
 #include "opendnp3/app/parsing/IAPDUHandler.h"
 #include "opendnp3/app/parsing/ParserSettings.h"
+#include "opendnp3/app/HandlerTable.h"
 
 namespace opendnp3
 {
@@ -44,7 +45,10 @@ public:
 
 private:
 
-	typedef bool(&FreeFormatHandler)(const FreeFormatHeader& header, const openpal::RSlice& objects, IAPDUHandler* pHandler);
+	typedef bool(*FreeFormatHandler)(const FreeFormatHeader& header, const openpal::RSlice& objects, IAPDUHandler* pHandler);
+
+	// Free format handlers for every object that may be used with the free format qualifier, indexed by handler slot
+	static HandlerTable<FreeFormatHandler> CreateHandlers();
 
 	static ParseResult ParseFreeFormat(FreeFormatHandler handler, const FreeFormatHeader& header, uint16_t size, openpal::RSlice& objects, IAPDUHandler* pHandler, openpal::Logger* pLogger);
 
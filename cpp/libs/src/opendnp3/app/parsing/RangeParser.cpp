@@ -94,70 +94,70 @@ ParseResult RangeParser::Process(const HeaderRecord& record, openpal::RSlice& bu
 	}
 }
 
-#define MACRO_PARSE_OBJECTS_WITH_RANGE(descriptor) \
-	case(GroupVariation::descriptor): \
-	return RangeParser::FromFixedSize<descriptor>(range).Process(record, buffer, pHandler, pLogger);
-
-ParseResult RangeParser::ParseRangeOfObjects(openpal::RSlice& buffer, const HeaderRecord& record, const Range& range, openpal::Logger* pLogger, IAPDUHandler* pHandler)
+HandlerTable<RangeParser::ParseFun> RangeParser::CreateHandlers()
 {
-	switch (record.enumeration)
-	{
-	case(GroupVariation::Group1Var1) :
-		return RangeParser::FromBitfieldType<Binary>(range).Process(record, buffer, pHandler, pLogger);
+	HandlerTable<ParseFun> handlers;
 
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group1Var2);
+	handlers.Set(GroupVariation::Group1Var1, &ParseBitfieldType<Binary>);
+	handlers.Set(GroupVariation::Group1Var2, &ParseFixedSize<Group1Var2>);
 
-	case(GroupVariation::Group3Var1) :
-		return RangeParser::FromDoubleBitfieldType<DoubleBitBinary>(range).Process(record, buffer, pHandler, pLogger);
-	case(GroupVariation::Group10Var1):
-		return RangeParser::FromBitfieldType<BinaryOutputStatus>(range).Process(record, buffer, pHandler, pLogger);
+	handlers.Set(GroupVariation::Group3Var1, &ParseDoubleBitfieldType<DoubleBitBinary>);
+	handlers.Set(GroupVariation::Group3Var2, &ParseFixedSize<Group3Var2>);
 
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group3Var2);
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group10Var2);
+	handlers.Set(GroupVariation::Group10Var1, &ParseBitfieldType<BinaryOutputStatus>);
+	handlers.Set(GroupVariation::Group10Var2, &ParseFixedSize<Group10Var2>);
 
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group20Var1);
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group20Var2);
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group20Var5);
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group20Var6);
+	handlers.Set(GroupVariation::Group20Var1, &ParseFixedSize<Group20Var1>);
+	handlers.Set(GroupVariation::Group20Var2, &ParseFixedSize<Group20Var2>);
+	handlers.Set(GroupVariation::Group20Var5, &ParseFixedSize<Group20Var5>);
+	handlers.Set(GroupVariation::Group20Var6, &ParseFixedSize<Group20Var6>);
 
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group21Var1);
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group21Var2);
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group21Var5);
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group21Var6);
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group21Var9);
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group21Var10);
+	handlers.Set(GroupVariation::Group21Var1, &ParseFixedSize<Group21Var1>);
+	handlers.Set(GroupVariation::Group21Var2, &ParseFixedSize<Group21Var2>);
+	handlers.Set(GroupVariation::Group21Var5, &ParseFixedSize<Group21Var5>);
+	handlers.Set(GroupVariation::Group21Var6, &ParseFixedSize<Group21Var6>);
+	handlers.Set(GroupVariation::Group21Var9, &ParseFixedSize<Group21Var9>);
+	handlers.Set(GroupVariation::Group21Var10, &ParseFixedSize<Group21Var10>);
 
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group30Var1);
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group30Var2);
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group30Var3);
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group30Var4);
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group30Var5);
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group30Var6);
+	handlers.Set(GroupVariation::Group30Var1, &ParseFixedSize<Group30Var1>);
+	handlers.Set(GroupVariation::Group30Var2, &ParseFixedSize<Group30Var2>);
+	handlers.Set(GroupVariation::Group30Var3, &ParseFixedSize<Group30Var3>);
+	handlers.Set(GroupVariation::Group30Var4, &ParseFixedSize<Group30Var4>);
+	handlers.Set(GroupVariation::Group30Var5, &ParseFixedSize<Group30Var5>);
+	handlers.Set(GroupVariation::Group30Var6, &ParseFixedSize<Group30Var6>);
 
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group40Var1);
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group40Var2);
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group40Var3);
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group40Var4);
+	handlers.Set(GroupVariation::Group40Var1, &ParseFixedSize<Group40Var1>);
+	handlers.Set(GroupVariation::Group40Var2, &ParseFixedSize<Group40Var2>);
+	handlers.Set(GroupVariation::Group40Var3, &ParseFixedSize<Group40Var3>);
+	handlers.Set(GroupVariation::Group40Var4, &ParseFixedSize<Group40Var4>);
 
-		MACRO_PARSE_OBJECTS_WITH_RANGE(Group50Var4);
+	handlers.Set(GroupVariation::Group50Var4, &ParseFixedSize<Group50Var4>);
 
-	case(GroupVariation::Group80Var1) :
-		return RangeParser::FromBitfieldType<IINValue>(range).Process(record, buffer, pHandler, pLogger);
+	handlers.Set(GroupVariation::Group80Var1, &ParseBitfieldType<IINValue>);
+	handlers.Set(GroupVariation::Group110Var0, &ParseRangeOfOctetData);
+	handlers.Set(GroupVariation::Group121Var1, &ParseFixedSizeType<Group121Var1>);
 
-	case(GroupVariation::Group110Var0) :
-		return ParseRangeOfOctetData(buffer, record, range, pLogger, pHandler);
+	return handlers;
+}
 
-	case(GroupVariation::Group121Var1) :
-		return RangeParser::FromFixedSizeType<Group121Var1>(range).Process(record, buffer, pHandler, pLogger);
+ParseResult RangeParser::ParseRangeOfObjects(openpal::RSlice& buffer, const HeaderRecord& record, const Range& range, openpal::Logger* pLogger, IAPDUHandler* pHandler)
+{
+	static const HandlerTable<ParseFun> handlers = CreateHandlers();
 
-	default:
-		FORMAT_LOGGER_BLOCK(pLogger, flags::WARN, "Unsupported qualifier/object - %s - %i / %i",
-		                    QualifierCodeToString(record.GetQualifierCode()),
-		                    record.group,
-		                    record.variation);
+	const auto& info = GroupVariationTable::Lookup(record.enumeration);
+	const auto parse = handlers.Get(info);
 
-		return ParseResult::INVALID_OBJECT_QUALIFIER;
+	if ((info.qualifiers & GroupVariationTable::RANGE) && parse)
+	{
+		return parse(buffer, record, range, pLogger, pHandler);
 	}
+
+	FORMAT_LOGGER_BLOCK(pLogger, flags::WARN, "Unsupported qualifier/object - %s - %i / %i",
+	                    QualifierCodeToString(record.GetQualifierCode()),
+	                    record.group,
+	                    record.variation);
+
+	return ParseResult::INVALID_OBJECT_QUALIFIER;
 }
 
 ParseResult RangeParser::ParseRangeOfOctetData(openpal::RSlice& buffer, const HeaderRecord& record, const Range& range, openpal::Logger* pLogger, IAPDUHandler* pHandler)
@@ -32,6 +32,7 @@
 #include "opendnp3/app/parsing/BitReader.h"
 
 #include "opendnp3/app/Range.h"
+#include "opendnp3/app/HandlerTable.h"
 #include "opendnp3/app/parsing/BufferedCollection.h"
 
 
@@ -42,6 +43,7 @@ class RangeParser
 {
 	typedef void (*HandleFun)(const HeaderRecord& record, const Range& range, const openpal::RSlice& buffer, IAPDUHandler& handler);
 
+	typedef ParseResult (*ParseFun)(openpal::RSlice& buffer, const HeaderRecord& record, const Range& range, openpal::Logger* pLogger, IAPDUHandler* pHandler);
 
 
 public:
@@ -74,6 +76,21 @@ private:
 	template <class Type>
 	static RangeParser FromDoubleBitfieldType(const Range& range);
 
+	// Parse functions for every object that may be used with a range, indexed by handler slot
+	static HandlerTable<ParseFun> CreateHandlers();
+
+	template <class Descriptor>
+	static ParseResult ParseFixedSize(openpal::RSlice& buffer, const HeaderRecord& record, const Range& range, openpal::Logger* pLogger, IAPDUHandler* pHandler);
+
+	template <class Type>
+	static ParseResult ParseFixedSizeType(openpal::RSlice& buffer, const HeaderRecord& record, const Range& range, openpal::Logger* pLogger, IAPDUHandler* pHandler);
+
+	template <class Type>
+	static ParseResult ParseBitfieldType(openpal::RSlice& buffer, const HeaderRecord& record, const Range& range, openpal::Logger* pLogger, IAPDUHandler* pHandler);
+
+	template <class Type>
+	static ParseResult ParseDoubleBitfieldType(openpal::RSlice& buffer, const HeaderRecord& record, const Range& range, openpal::Logger* pLogger, IAPDUHandler* pHandler);
+
 	static ParseResult ParseRangeOfObjects(openpal::RSlice& buffer, const HeaderRecord& record, const Range& range, openpal::Logger* pLogger, IAPDUHandler* pHandler);
 
 	static ParseResult ParseRangeOfOctetData(openpal::RSlice& buffer, const HeaderRecord& record, const Range& range, openpal::Logger* pLogger, IAPDUHandler* pHandler);
@@ -113,6 +130,30 @@ RangeParser RangeParser::FromFixedSizeType(const Range& range)
 	return RangeParser(range, size, &InvokeRangeOfType<Type>);
 }
 
+template <class Descriptor>
+ParseResult RangeParser::ParseFixedSize(openpal::RSlice& buffer, const HeaderRecord& record, const Range& range, openpal::Logger* pLogger, IAPDUHandler* pHandler)
+{
+	return FromFixedSize<Descriptor>(range).Process(record, buffer, pHandler, pLogger);
+}
+
+template <class Type>
+ParseResult RangeParser::ParseFixedSizeType(openpal::RSlice& buffer, const HeaderRecord& record, const Range& range, openpal::Logger* pLogger, IAPDUHandler* pHandler)
+{
+	return FromFixedSizeType<Type>(range).Process(record, buffer, pHandler, pLogger);
+}
+
+template <class Type>
+ParseResult RangeParser::ParseBitfieldType(openpal::RSlice& buffer, const HeaderRecord& record, const Range& range, openpal::Logger* pLogger, IAPDUHandler* pHandler)
+{
+	return FromBitfieldType<Type>(range).Process(record, buffer, pHandler, pLogger);
+}
+
+template <class Type>
+ParseResult RangeParser::ParseDoubleBitfieldType(openpal::RSlice& buffer, const HeaderRecord& record, const Range& range, openpal::Logger* pLogger, IAPDUHandler* pHandler)
+{
+	return FromDoubleBitfieldType<Type>(range).Process(record, buffer, pHandler, pLogger);
+}
+
 template <class Descriptor>
 void RangeParser::InvokeRangeOf(const HeaderRecord& record, const Range& range, const openpal::RSlice& buffer, IAPDUHandler& handler)
 {
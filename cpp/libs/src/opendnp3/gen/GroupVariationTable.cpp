@@ -0,0 +1,239 @@
+//
+//  _   _         ______    _ _ _   _             _ _ _
+// | \ | |       |  ____|  | (_) | (_)           | | | |
+// |  \| | ___   | |__   __| |_| |_ _ _ __   __ _| | | |
+// | . ` |/ _ \  |  __| / _` | | __| | '_ \ / _` | | | |
+// | |\  | (_) | | |___| (_| | | |_| | | | | (_| |_|_|_|
+// |_| \_|\___/  |______\__,_|_|\__|_|_| |_|\__, (_|_|_)
+//                                           __/ |
+//                                          |___/
+// 
+// This file is auto-generated. Do not edit manually
+// 
+// Copyright 2013 Automatak LLC
+// 
+// Automatak LLC (www.automatak.com) licenses this file
+// to you under the the Apache License Version 2.0 (the "License"):
+// 
+// http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "opendnp3/gen/GroupVariationTable.h"
+
+namespace opendnp3 {
+
+const uint8_t GroupVariationTable::groups[256] =
+{
+  0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 5, 6, 7, 8, 0, 0,
+  0, 0, 0, 0, 9, 10, 11, 12, 0, 0, 0, 0, 0, 0, 13, 0,
+  14, 0, 0, 0, 0, 0, 0, 0, 15, 16, 17, 18, 0, 0, 0, 0,
+  0, 0, 19, 20, 21, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 26,
+  27, 28, 0, 0, 0, 0, 0, 0, 29, 30, 31, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const GroupVariationTable::Row GroupVariationTable::rows[32] =
+{
+  { 0, 0 }, // unknown groups
+  { 1, 3 }, // group 1
+  { 4, 4 }, // group 2
+  { 8, 3 }, // group 3
+  { 11, 4 }, // group 4
+  { 15, 3 }, // group 10
+  { 18, 3 }, // group 11
+  { 21, 2 }, // group 12
+  { 23, 3 }, // group 13
+  { 26, 7 }, // group 20
+  { 33, 11 }, // group 21
+  { 44, 7 }, // group 22
+  { 51, 7 }, // group 23
+  { 58, 7 }, // group 30
+  { 65, 9 }, // group 32
+  { 74, 5 }, // group 40
+  { 79, 5 }, // group 41
+  { 84, 9 }, // group 42
+  { 93, 9 }, // group 43
+  { 102, 5 }, // group 50
+  { 107, 3 }, // group 51
+  { 110, 3 }, // group 52
+  { 113, 5 }, // group 60
+  { 118, 9 }, // group 70
+  { 127, 2 }, // group 80
+  { 129, 1 }, // group 110
+  { 130, 1 }, // group 111
+  { 131, 1 }, // group 112
+  { 132, 1 }, // group 113
+  { 133, 16 }, // group 120
+  { 149, 2 }, // group 121
+  { 151, 3 }, // group 122
+};
+
+const GroupVariationInfo GroupVariationTable::entries[154] =
+{
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::Group1Var0, 0, 0x00, 0x00, 1, "Binary Input - Any Variation" },
+  { GroupVariation::Group1Var1, 0, 0x00, 0x01, 2, "Binary Input - Packed Format" },
+  { GroupVariation::Group1Var2, 1, 0x04, 0x01, 3, "Binary Input - With Flags" },
+  { GroupVariation::Group2Var0, 0, 0x00, 0x00, 4, "Binary Input Event - Any Variation" },
+  { GroupVariation::Group2Var1, 1, 0x0C, 0x04, 5, "Binary Input Event - Without Time" },
+  { GroupVariation::Group2Var2, 7, 0x0D, 0x04, 6, "Binary Input Event - With Absolute Time" },
+  { GroupVariation::Group2Var3, 3, 0x0E, 0x04, 7, "Binary Input Event - With Relative Time" },
+  { GroupVariation::Group3Var0, 0, 0x00, 0x00, 8, "Double-bit Binary Input - Any Variation" },
+  { GroupVariation::Group3Var1, 0, 0x00, 0x01, 9, "Double-bit Binary Input - Packed Format" },
+  { GroupVariation::Group3Var2, 1, 0x04, 0x01, 10, "Double-bit Binary Input - With Flags" },
+  { GroupVariation::Group4Var0, 0, 0x00, 0x00, 11, "Double-bit Binary Input Event - Any Variation" },
+  { GroupVariation::Group4Var1, 1, 0x0C, 0x04, 12, "Double-bit Binary Input Event - Without Time" },
+  { GroupVariation::Group4Var2, 7, 0x0D, 0x04, 13, "Double-bit Binary Input Event - With Absolute Time" },
+  { GroupVariation::Group4Var3, 3, 0x0E, 0x04, 14, "Double-bit Binary Input Event - With Relative Time" },
+  { GroupVariation::Group10Var0, 0, 0x00, 0x00, 15, "Binary Output - Any Variation" },
+  { GroupVariation::Group10Var1, 0, 0x00, 0x01, 16, "Binary Output - Packed Format" },
+  { GroupVariation::Group10Var2, 1, 0x04, 0x01, 17, "Binary Output - Output Status With Flags" },
+  { GroupVariation::Group11Var0, 0, 0x00, 0x00, 18, "Binary Output Event - Any Variation" },
+  { GroupVariation::Group11Var1, 1, 0x0C, 0x04, 19, "Binary Output Event - Output Status Without Time" },
+  { GroupVariation::Group11Var2, 7, 0x0D, 0x04, 20, "Binary Output Event - Output Status With Time" },
+  { GroupVariation::Group12Var0, 0, 0x00, 0x00, 21, "Binary Command - Any Variation" },
+  { GroupVariation::Group12Var1, 11, 0x00, 0x04, 22, "Binary Command - CROB" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::Group13Var1, 1, 0x0C, 0x04, 23, "Binary Command Event - Without Time" },
+  { GroupVariation::Group13Var2, 7, 0x0D, 0x04, 24, "Binary Command Event - With Time" },
+  { GroupVariation::Group20Var0, 0, 0x00, 0x00, 25, "Counter - Any Variation" },
+  { GroupVariation::Group20Var1, 5, 0x04, 0x01, 26, "Counter - 32-bit With Flag" },
+  { GroupVariation::Group20Var2, 3, 0x04, 0x01, 27, "Counter - 16-bit With Flag" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::Group20Var5, 4, 0x00, 0x01, 28, "Counter - 32-bit Without Flag" },
+  { GroupVariation::Group20Var6, 2, 0x00, 0x01, 29, "Counter - 16-bit Without Flag" },
+  { GroupVariation::Group21Var0, 0, 0x00, 0x00, 30, "Frozen Counter - Any Variation" },
+  { GroupVariation::Group21Var1, 5, 0x04, 0x01, 31, "Frozen Counter - 32-bit With Flag" },
+  { GroupVariation::Group21Var2, 3, 0x04, 0x01, 32, "Frozen Counter - 16-bit With Flag" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::Group21Var5, 11, 0x05, 0x01, 33, "Frozen Counter - 32-bit With Flag and Time" },
+  { GroupVariation::Group21Var6, 9, 0x05, 0x01, 34, "Frozen Counter - 16-bit With Flag and Time" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::Group21Var9, 4, 0x00, 0x01, 35, "Frozen Counter - 32-bit Without Flag" },
+  { GroupVariation::Group21Var10, 2, 0x00, 0x01, 36, "Frozen Counter - 16-bit Without Flag" },
+  { GroupVariation::Group22Var0, 0, 0x00, 0x00, 37, "Counter Event - Any Variation" },
+  { GroupVariation::Group22Var1, 5, 0x0C, 0x04, 38, "Counter Event - 32-bit With Flag" },
+  { GroupVariation::Group22Var2, 3, 0x0C, 0x04, 39, "Counter Event - 16-bit With Flag" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::Group22Var5, 11, 0x0D, 0x04, 40, "Counter Event - 32-bit With Flag and Time" },
+  { GroupVariation::Group22Var6, 9, 0x0D, 0x04, 41, "Counter Event - 16-bit With Flag and Time" },
+  { GroupVariation::Group23Var0, 0, 0x00, 0x00, 42, "Frozen Counter Event - Any Variation" },
+  { GroupVariation::Group23Var1, 5, 0x0C, 0x04, 43, "Frozen Counter Event - 32-bit With Flag" },
+  { GroupVariation::Group23Var2, 3, 0x0C, 0x04, 44, "Frozen Counter Event - 16-bit With Flag" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::Group23Var5, 11, 0x0D, 0x04, 45, "Frozen Counter Event - 32-bit With Flag and Time" },
+  { GroupVariation::Group23Var6, 9, 0x0D, 0x04, 46, "Frozen Counter Event - 16-bit With Flag and Time" },
+  { GroupVariation::Group30Var0, 0, 0x00, 0x00, 47, "Analog Input - Any Variation" },
+  { GroupVariation::Group30Var1, 5, 0x04, 0x01, 48, "Analog Input - 32-bit With Flag" },
+  { GroupVariation::Group30Var2, 3, 0x04, 0x01, 49, "Analog Input - 16-bit With Flag" },
+  { GroupVariation::Group30Var3, 4, 0x00, 0x01, 50, "Analog Input - 32-bit Without Flag" },
+  { GroupVariation::Group30Var4, 2, 0x00, 0x01, 51, "Analog Input - 16-bit Without Flag" },
+  { GroupVariation::Group30Var5, 5, 0x04, 0x01, 52, "Analog Input - Single-precision With Flag" },
+  { GroupVariation::Group30Var6, 9, 0x04, 0x01, 53, "Analog Input - Double-precision With Flag" },
+  { GroupVariation::Group32Var0, 0, 0x00, 0x00, 54, "Analog Input Event - Any Variation" },
+  { GroupVariation::Group32Var1, 5, 0x0C, 0x04, 55, "Analog Input Event - 32-bit With Flag" },
+  { GroupVariation::Group32Var2, 3, 0x0C, 0x04, 56, "Analog Input Event - 16-bit With Flag" },
+  { GroupVariation::Group32Var3, 11, 0x0D, 0x04, 57, "Analog Input Event - 32-bit With Flag and Time" },
+  { GroupVariation::Group32Var4, 9, 0x0D, 0x04, 58, "Analog Input Event - 16-bit With Flag and Time" },
+  { GroupVariation::Group32Var5, 5, 0x0C, 0x04, 59, "Analog Input Event - Single-precision With Flag" },
+  { GroupVariation::Group32Var6, 9, 0x0C, 0x04, 60, "Analog Input Event - Double-precision With Flag" },
+  { GroupVariation::Group32Var7, 11, 0x0D, 0x04, 61, "Analog Input Event - Single-precision With Flag and Time" },
+  { GroupVariation::Group32Var8, 15, 0x0D, 0x04, 62, "Analog Input Event - Double-precision With Flag and Time" },
+  { GroupVariation::Group40Var0, 0, 0x00, 0x00, 63, "Analog Output Status - Any Variation" },
+  { GroupVariation::Group40Var1, 5, 0x04, 0x01, 64, "Analog Output Status - 32-bit With Flag" },
+  { GroupVariation::Group40Var2, 3, 0x04, 0x01, 65, "Analog Output Status - 16-bit With Flag" },
+  { GroupVariation::Group40Var3, 5, 0x04, 0x01, 66, "Analog Output Status - Single-precision With Flag" },
+  { GroupVariation::Group40Var4, 9, 0x04, 0x01, 67, "Analog Output Status - Double-precision With Flag" },
+  { GroupVariation::Group41Var0, 0, 0x00, 0x00, 68, "Analog Output - Any Variation" },
+  { GroupVariation::Group41Var1, 5, 0x00, 0x04, 69, "Analog Output - 32-bit With Flag" },
+  { GroupVariation::Group41Var2, 3, 0x00, 0x04, 70, "Analog Output - 16-bit With Flag" },
+  { GroupVariation::Group41Var3, 5, 0x00, 0x04, 71, "Analog Output - Single-precision" },
+  { GroupVariation::Group41Var4, 9, 0x00, 0x04, 72, "Analog Output - Double-precision" },
+  { GroupVariation::Group42Var0, 0, 0x00, 0x00, 73, "Analog Output Event - Any Variation" },
+  { GroupVariation::Group42Var1, 5, 0x0C, 0x04, 74, "Analog Output Event - 32-bit With Flag" },
+  { GroupVariation::Group42Var2, 3, 0x0C, 0x04, 75, "Analog Output Event - 16-bit With Flag" },
+  { GroupVariation::Group42Var3, 11, 0x0D, 0x04, 76, "Analog Output Event - 32-bit With Flag and Time" },
+  { GroupVariation::Group42Var4, 9, 0x0D, 0x04, 77, "Analog Output Event - 16-bit With Flag and Time" },
+  { GroupVariation::Group42Var5, 5, 0x0C, 0x04, 78, "Analog Output Event - Single-precision With Flag" },
+  { GroupVariation::Group42Var6, 9, 0x0C, 0x04, 79, "Analog Output Event - Double-precision With Flag" },
+  { GroupVariation::Group42Var7, 11, 0x0D, 0x04, 80, "Analog Output Event - Single-precision With Flag and Time" },
+  { GroupVariation::Group42Var8, 15, 0x0D, 0x04, 81, "Analog Output Event - Double-precision With Flag and Time" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::Group43Var1, 5, 0x08, 0x04, 82, "Analog Command Event - 32-bit" },
+  { GroupVariation::Group43Var2, 3, 0x08, 0x04, 83, "Analog Command Event - 16-bit" },
+  { GroupVariation::Group43Var3, 11, 0x09, 0x04, 84, "Analog Command Event - 32-bit With Time" },
+  { GroupVariation::Group43Var4, 9, 0x09, 0x04, 85, "Analog Command Event - 16-bit With Time" },
+  { GroupVariation::Group43Var5, 5, 0x08, 0x04, 86, "Analog Command Event - Single-precision" },
+  { GroupVariation::Group43Var6, 9, 0x08, 0x04, 87, "Analog Command Event - Double-precision" },
+  { GroupVariation::Group43Var7, 11, 0x09, 0x04, 88, "Analog Command Event - Single-precision With Time" },
+  { GroupVariation::Group43Var8, 15, 0x09, 0x04, 89, "Analog Command Event - Double-precision With Time" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::Group50Var1, 6, 0x01, 0x02, 90, "Time and Date - Absolute Time" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::Group50Var3, 6, 0x01, 0x02, 91, "Time and Date - Absolute Time at last recorded time" },
+  { GroupVariation::Group50Var4, 11, 0x01, 0x05, 92, "Time and Date - Indexed absolute time and long interval" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::Group51Var1, 6, 0x01, 0x02, 93, "Time and Date CTO - Absolute time, synchronized" },
+  { GroupVariation::Group51Var2, 6, 0x01, 0x02, 94, "Time and Date CTO - Absolute time, unsynchronized" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::Group52Var1, 2, 0x02, 0x02, 95, "Time Delay - Coarse" },
+  { GroupVariation::Group52Var2, 2, 0x02, 0x02, 96, "Time Delay - Fine" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::Group60Var1, 0, 0x00, 0x00, 97, "Class Data - Class 0" },
+  { GroupVariation::Group60Var2, 0, 0x00, 0x00, 98, "Class Data - Class 1" },
+  { GroupVariation::Group60Var3, 0, 0x00, 0x00, 99, "Class Data - Class 2" },
+  { GroupVariation::Group60Var4, 0, 0x00, 0x00, 100, "Class Data - Class 3" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::Group70Var1, 0, 0x00, 0x00, 101, "File-control - File identifier" },
+  { GroupVariation::Group70Var2, 0, 0x00, 0x00, 102, "File-control - Authentication" },
+  { GroupVariation::Group70Var3, 0, 0x00, 0x00, 103, "File-control - File command" },
+  { GroupVariation::Group70Var4, 0, 0x00, 0x00, 104, "File-control - File command status" },
+  { GroupVariation::Group70Var5, 0, 0x00, 0x00, 105, "File-control - File transport" },
+  { GroupVariation::Group70Var6, 0, 0x00, 0x00, 106, "File-control - File transport status" },
+  { GroupVariation::Group70Var7, 0, 0x00, 0x00, 107, "File-control - File descriptor" },
+  { GroupVariation::Group70Var8, 0, 0x00, 0x00, 108, "File-control - File specification string" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::Group80Var1, 0, 0x00, 0x01, 109, "Internal Indications - Packed Format" },
+  { GroupVariation::Group110Var0, 0, 0x00, 0x01, 110, "Octet String - Sized by variation" },
+  { GroupVariation::Group111Var0, 0, 0x00, 0x04, 111, "Octet String Event - Sized by variation" },
+  { GroupVariation::Group112Var0, 0, 0x00, 0x00, 112, "Virtual Terminal Output Block - Sized by variation" },
+  { GroupVariation::Group113Var0, 0, 0x00, 0x00, 113, "Virtual Terminal Event Data - Sized by variation" },
+  { GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, "UNKNOWN" },
+  { GroupVariation::Group120Var1, 0, 0x00, 0x08, 114, "Authentication - Challenge" },
+  { GroupVariation::Group120Var2, 0, 0x00, 0x08, 115, "Authentication - Reply" },
+  { GroupVariation::Group120Var3, 6, 0x00, 0x02, 116, "Authentication - Aggressive Mode Request" },
+  { GroupVariation::Group120Var4, 2, 0x00, 0x02, 117, "Authentication - Session Key Status Request" },
+  { GroupVariation::Group120Var5, 0, 0x00, 0x08, 118, "Authentication - Session Key Status" },
+  { GroupVariation::Group120Var6, 0, 0x00, 0x08, 119, "Authentication - Session Key Change" },
+  { GroupVariation::Group120Var7, 0, 0x00, 0x08, 120, "Authentication - Error" },
+  { GroupVariation::Group120Var8, 0, 0x00, 0x08, 121, "Authentication - User Certificate" },
+  { GroupVariation::Group120Var9, 0, 0x00, 0x08, 122, "Authentication - HMAC" },
+  { GroupVariation::Group120Var10, 0, 0x00, 0x08, 123, "Authentication - User Status Change" },
+  { GroupVariation::Group120Var11, 0, 0x00, 0x08, 124, "Authentication - Update Key Change Request" },
+  { GroupVariation::Group120Var12, 0, 0x00, 0x08, 125, "Authentication - Update Key Change Reply" },
+  { GroupVariation::Group120Var13, 0, 0x00, 0x08, 126, "Authentication - Update Key Change" },
+  { GroupVariation::Group120Var14, 0, 0x00, 0x08, 127, "Authentication - Update Key Change Signature" },
+  { GroupVariation::Group120Var15, 0, 0x00, 0x08, 128, "Authentication - Update Key Change Confirmation" },
+  { GroupVariation::Group121Var0, 0, 0x00, 0x00, 129, "Security statistic - Any Variation" },
+  { GroupVariation::Group121Var1, 7, 0x04, 0x01, 130, "Security statistic - 32-bit With Flag" },
+  { GroupVariation::Group122Var0, 0, 0x00, 0x00, 131, "Security Statistic event - Any Variation" },
+  { GroupVariation::Group122Var1, 7, 0x0C, 0x04, 132, "Security Statistic event - 32-bit With Flag" },
+  { GroupVariation::Group122Var2, 13, 0x0D, 0x04, 133, "Security Statistic event - 32-bit With Flag and Time" },
+};
+
+}
@@ -62,6 +62,12 @@ public:
 	/// Resets the state of parser
 	void Reset();
 
+	/// @return true if the parser holds the beginning of a frame that has not yet been completed
+	bool HasPartialFrame() const
+	{
+		return (state != State::FindSync) || (buffer.NumBytesRead() > 0);
+	}
+
 	const LinkStatistics::Parser& Statistics() const
 	{
 		return this->statistics;
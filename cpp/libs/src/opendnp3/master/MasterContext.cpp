@@ -48,7 +48,8 @@ MContext::MContext(
     const std::shared_ptr<ISOEHandler>& SOEHandler,
     const std::shared_ptr<IMasterApplication>& application,
     const std::shared_ptr<IMasterScheduler>& scheduler,
-    const MasterParams& params
+    const MasterParams& params,
+    const std::shared_ptr<openpal::Buffer>& txBuffer
 ) :
 	logger(logger),
 	executor(executor),
@@ -60,7 +61,7 @@ MContext::MContext(
 	scheduler(scheduler),
 	responseTimer(*executor),
 	tasks(params, logger, *application, *SOEHandler),
-	txBuffer(params.maxTxFragSize),
+	txBuffer(txBuffer ? txBuffer : std::make_shared<openpal::Buffer>(params.maxTxFragSize)),
 	tstate(TaskState::IDLE)
 {}
 
@@ -267,7 +268,7 @@ bool MContext::CheckConfirmTransmit()
 	}
 
 	auto confirm = this->confirmQueue.front();
-	APDUWrapper wrapper(this->txBuffer.GetWSlice());
+	APDUWrapper wrapper(this->txBuffer->GetWSlice());
 	wrapper.SetFunction(confirm.function);
 	wrapper.SetControl(confirm.control);
 	this->Transmit(wrapper.ToRSlice());
@@ -434,7 +435,7 @@ void MContext::ScheduleAdhocTask(const std::shared_ptr<IMasterTask>& task)
 
 MContext::TaskState MContext::ResumeActiveTask()
 {
-	APDURequest request(this->txBuffer.GetWSlice());
+	APDURequest request(this->txBuffer->GetWSlice());
 
 	/// try to build a requst for the task
 	if (!this->activeTask->BuildRequest(request, this->solSeq))
@@ -445,6 +446,7 @@ MContext::TaskState MContext::ResumeActiveTask()
 	}
 
 	this->StartResponseTimer();
+	this->requestTime = this->executor->GetTime();
 	auto apdu = request.ToRSlice();
 	this->RecordLastRequest(apdu);
 	this->Transmit(apdu);
@@ -515,6 +517,8 @@ MContext::TaskState MContext::OnResponse_WaitForResponse(const APDUResponseHeade
 
 	auto now = this->executor->GetTime();
 
+	this->latency.requestToResponse.Record(now.milliseconds - this->requestTime.milliseconds);
+
 	auto result = this->activeTask->OnResponse(header, objects, now);
 
 	if (header.control.CON)
@@ -526,6 +530,7 @@ MContext::TaskState MContext::OnResponse_WaitForResponse(const APDUResponseHeade
 	{
 	case(IMasterTask::ResponseResult::OK_CONTINUE) :
 		this->StartResponseTimer();
+		this->requestTime = now;
 		return TaskState::WAIT_FOR_RESPONSE;
 	case(IMasterTask::ResponseResult::OK_REPEAT) :
 		return StartTask_TaskReady();
@@ -27,6 +27,7 @@
 #include <openpal/executor/TimerRef.h>
 
 #include "opendnp3/LayerInterfaces.h"
+#include "opendnp3/StackStatistics.h"
 
 #include "opendnp3/app/AppSeqNum.h"
 #include "opendnp3/app/MeasurementTypes.h"
@@ -67,7 +68,8 @@ public:
 	    const std::shared_ptr<ISOEHandler>& SOEHandler,
 	    const std::shared_ptr<IMasterApplication>& application,
 	    const std::shared_ptr<IMasterScheduler>& scheduler,
-	    const MasterParams& params
+	    const MasterParams& params,
+	    const std::shared_ptr<openpal::Buffer>& txBuffer = nullptr	// optional, must hold params.maxTxFragSize bytes
 	);
 
 	openpal::Logger logger;
@@ -89,10 +91,12 @@ public:
 	AppSeqNum unsolSeq;
 	std::shared_ptr<IMasterTask> activeTask;
 	openpal::TimerRef responseTimer;
+	openpal::MonotonicTimestamp requestTime;
+	StackStatistics::Latency latency;
 
 	MasterTasks tasks;
 	std::deque<APDUHeader> confirmQueue;
-	openpal::Buffer txBuffer;
+	const std::shared_ptr<openpal::Buffer> txBuffer;
 	TaskState tstate;
 
 	// --- implement  IUpperLayer ------
@@ -49,7 +49,7 @@ void MasterSchedulerBackend::Add(const std::shared_ptr<IMasterTask>& task, IMast
 {
 	if (this->isShutdown) return;
 	
-	this->tasks.push_back(Record(task, runner));
+	this->tasks.push_back(Record(task, runner, this->executor->GetTime()));
 	this->PostCheckForTaskRun();
 }
 
@@ -164,6 +164,11 @@ bool MasterSchedulerBackend::CheckForTaskRun()
 	const auto IS_EXPIRED = now.milliseconds >= best_task->task->ExpirationTime().milliseconds;
 	if (IS_EXPIRED)
 	{
+		// a task is runnable from the later of when it was queued and when it expired
+		const auto expiration = best_task->task->ExpirationTime();
+		const auto runnable = (expiration > best_task->queued) ? expiration : best_task->queued;
+		this->queueLatency.Record(now.milliseconds - runnable.milliseconds);
+
 		this->current = *best_task;
 		this->tasks.erase(best_task);
 		this->current.runner->Run(this->current.task);
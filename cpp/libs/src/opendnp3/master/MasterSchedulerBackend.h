@@ -23,6 +23,7 @@
 
 #include "opendnp3/master/IMasterTaskRunner.h"
 #include "opendnp3/master/IMasterScheduler.h"
+#include "opendnp3/LatencyHistogram.h"
 
 #include "openpal/executor/TimerRef.h"
 
@@ -42,10 +43,12 @@ class MasterSchedulerBackend final : public IMasterScheduler, public std::enable
 
 		Record(
 		    const std::shared_ptr<IMasterTask>& task,
-		    IMasterTaskRunner& runner
+		    IMasterTaskRunner& runner,
+		    const openpal::MonotonicTimestamp& queued
 		) :
 			task(task),
-			runner(&runner)
+			runner(&runner),
+			queued(queued)
 		{}
 
 		operator bool()
@@ -66,6 +69,7 @@ class MasterSchedulerBackend final : public IMasterScheduler, public std::enable
 
 		std::shared_ptr<IMasterTask> task;
 		IMasterTaskRunner* runner = nullptr;
+		openpal::MonotonicTimestamp queued;
 
 	};
 
@@ -87,12 +91,19 @@ public:
 
 	virtual void Evaluate() override;
 
+	/// @return histogram of the time between a task becoming runnable and the scheduler starting it
+	const LatencyHistogram& GetQueueLatency() const
+	{
+		return queueLatency;
+	}
+
 private:
 	bool isShutdown = false;
 	bool taskCheckPending = false;
 
 	Record current;
 	std::vector<Record> tasks;
+	LatencyHistogram queueLatency;
 
 	void PostCheckForTaskRun();
 
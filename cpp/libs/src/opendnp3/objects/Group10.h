@@ -25,6 +25,7 @@
 #include <openpal/container/RSlice.h>
 #include <openpal/container/WSlice.h>
 #include "opendnp3/app/DNPTime.h"
+#include <openpal/container/StridedView.h>
 #include "opendnp3/app/DNP3Serializer.h"
 #include "opendnp3/app/MeasurementTypeSpecs.h"
 
@@ -59,7 +60,8 @@ struct Group10Var2
   typedef BinaryOutputStatusSpec Spec;
   static bool ReadTarget(openpal::RSlice&, BinaryOutputStatus&);
   static bool WriteTarget(const BinaryOutputStatus&, openpal::WSlice&);
-  static DNP3Serializer<BinaryOutputStatus> Inst() { return DNP3Serializer<BinaryOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<BinaryOutputStatus>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<BinaryOutputStatus> Inst() { return DNP3Serializer<BinaryOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 
@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -63,6 +64,26 @@ bool Group11Var1::WriteTarget(const BinaryOutputStatus& value, openpal::WSlice&
   return Group11Var1::Write(ConvertGroup11Var1::Apply(value), buff);
 }
 
+uint32_t Group11Var1::WriteTargets(const openpal::StridedView<BinaryOutputStatus>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup11Var1::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group11Var2 -------
 
 Group11Var2::Group11Var2() : flags(0), time(0)
@@ -97,5 +118,26 @@ bool Group11Var2::WriteTarget(const BinaryOutputStatus& value, openpal::WSlice&
   return Group11Var2::Write(ConvertGroup11Var2::Apply(value), buff);
 }
 
+uint32_t Group11Var2::WriteTargets(const openpal::StridedView<BinaryOutputStatus>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup11Var2::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt48::Write(dest + 1, gv.time);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 
 }
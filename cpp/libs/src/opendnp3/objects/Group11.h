@@ -25,6 +25,7 @@
 #include <openpal/container/RSlice.h>
 #include <openpal/container/WSlice.h>
 #include "opendnp3/app/DNPTime.h"
+#include <openpal/container/StridedView.h>
 #include "opendnp3/app/DNP3Serializer.h"
 #include "opendnp3/app/MeasurementTypeSpecs.h"
 
@@ -53,7 +54,8 @@ struct Group11Var1
   typedef BinaryOutputStatusSpec Spec;
   static bool ReadTarget(openpal::RSlice&, BinaryOutputStatus&);
   static bool WriteTarget(const BinaryOutputStatus&, openpal::WSlice&);
-  static DNP3Serializer<BinaryOutputStatus> Inst() { return DNP3Serializer<BinaryOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<BinaryOutputStatus>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<BinaryOutputStatus> Inst() { return DNP3Serializer<BinaryOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Binary Output Event - Output Status With Time
@@ -74,7 +76,8 @@ struct Group11Var2
   typedef BinaryOutputStatusSpec Spec;
   static bool ReadTarget(openpal::RSlice&, BinaryOutputStatus&);
   static bool WriteTarget(const BinaryOutputStatus&, openpal::WSlice&);
-  static DNP3Serializer<BinaryOutputStatus> Inst() { return DNP3Serializer<BinaryOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<BinaryOutputStatus>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<BinaryOutputStatus> Inst() { return DNP3Serializer<BinaryOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 
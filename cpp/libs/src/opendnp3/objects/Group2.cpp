@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -63,6 +64,26 @@ bool Group2Var1::WriteTarget(const Binary& value, openpal::WSlice& buff)
   return Group2Var1::Write(ConvertGroup2Var1::Apply(value), buff);
 }
 
+uint32_t Group2Var1::WriteTargets(const openpal::StridedView<Binary>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup2Var1::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group2Var2 -------
 
 Group2Var2::Group2Var2() : flags(0), time(0)
@@ -97,6 +118,27 @@ bool Group2Var2::WriteTarget(const Binary& value, openpal::WSlice& buff)
   return Group2Var2::Write(ConvertGroup2Var2::Apply(value), buff);
 }
 
+uint32_t Group2Var2::WriteTargets(const openpal::StridedView<Binary>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup2Var2::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt48::Write(dest + 1, gv.time);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group2Var3 -------
 
 Group2Var3::Group2Var3() : flags(0), time(0)
@@ -131,5 +173,26 @@ bool Group2Var3::WriteTarget(const Binary& value, openpal::WSlice& buff)
   return Group2Var3::Write(ConvertGroup2Var3::Apply(value), buff);
 }
 
+uint32_t Group2Var3::WriteTargets(const openpal::StridedView<Binary>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup2Var3::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt16::Write(dest + 1, gv.time);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 
 }
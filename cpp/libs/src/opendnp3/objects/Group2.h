@@ -25,6 +25,7 @@
 #include <openpal/container/RSlice.h>
 #include <openpal/container/WSlice.h>
 #include "opendnp3/app/DNPTime.h"
+#include <openpal/container/StridedView.h>
 #include "opendnp3/app/DNP3Serializer.h"
 #include "opendnp3/app/MeasurementTypeSpecs.h"
 
@@ -53,7 +54,8 @@ struct Group2Var1
   typedef BinarySpec Spec;
   static bool ReadTarget(openpal::RSlice&, Binary&);
   static bool WriteTarget(const Binary&, openpal::WSlice&);
-  static DNP3Serializer<Binary> Inst() { return DNP3Serializer<Binary>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Binary>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Binary> Inst() { return DNP3Serializer<Binary>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Binary Input Event - With Absolute Time
@@ -74,7 +76,8 @@ struct Group2Var2
   typedef BinarySpec Spec;
   static bool ReadTarget(openpal::RSlice&, Binary&);
   static bool WriteTarget(const Binary&, openpal::WSlice&);
-  static DNP3Serializer<Binary> Inst() { return DNP3Serializer<Binary>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Binary>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Binary> Inst() { return DNP3Serializer<Binary>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Binary Input Event - With Relative Time
@@ -95,7 +98,8 @@ struct Group2Var3
   typedef BinarySpec Spec;
   static bool ReadTarget(openpal::RSlice&, Binary&);
   static bool WriteTarget(const Binary&, openpal::WSlice&);
-  static DNP3Serializer<Binary> Inst() { return DNP3Serializer<Binary>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Binary>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Binary> Inst() { return DNP3Serializer<Binary>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 
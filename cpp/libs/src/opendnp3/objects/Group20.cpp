@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -63,6 +64,27 @@ bool Group20Var1::WriteTarget(const Counter& value, openpal::WSlice& buff)
   return Group20Var1::Write(ConvertGroup20Var1::Apply(value), buff);
 }
 
+uint32_t Group20Var1::WriteTargets(const openpal::StridedView<Counter>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup20Var1::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt32::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group20Var2 -------
 
 Group20Var2::Group20Var2() : flags(0), value(0)
@@ -97,6 +119,27 @@ bool Group20Var2::WriteTarget(const Counter& value, openpal::WSlice& buff)
   return Group20Var2::Write(ConvertGroup20Var2::Apply(value), buff);
 }
 
+uint32_t Group20Var2::WriteTargets(const openpal::StridedView<Counter>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup20Var2::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt16::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group20Var5 -------
 
 Group20Var5::Group20Var5() : value(0)
@@ -131,6 +174,26 @@ bool Group20Var5::WriteTarget(const Counter& value, openpal::WSlice& buff)
   return Group20Var5::Write(ConvertGroup20Var5::Apply(value), buff);
 }
 
+uint32_t Group20Var5::WriteTargets(const openpal::StridedView<Counter>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup20Var5::Apply(values[i]);
+    UInt32::Write(dest, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group20Var6 -------
 
 Group20Var6::Group20Var6() : value(0)
@@ -165,5 +228,25 @@ bool Group20Var6::WriteTarget(const Counter& value, openpal::WSlice& buff)
   return Group20Var6::Write(ConvertGroup20Var6::Apply(value), buff);
 }
 
+uint32_t Group20Var6::WriteTargets(const openpal::StridedView<Counter>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup20Var6::Apply(values[i]);
+    UInt16::Write(dest, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 
 }
@@ -25,6 +25,7 @@
 #include <openpal/container/RSlice.h>
 #include <openpal/container/WSlice.h>
 #include "opendnp3/app/DNPTime.h"
+#include <openpal/container/StridedView.h>
 #include "opendnp3/app/DNP3Serializer.h"
 #include "opendnp3/app/MeasurementTypeSpecs.h"
 
@@ -55,7 +56,8 @@ struct Group20Var1
   typedef CounterSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Counter&);
   static bool WriteTarget(const Counter&, openpal::WSlice&);
-  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Counter>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Counter - 16-bit With Flag
@@ -77,7 +79,8 @@ struct Group20Var2
   typedef CounterSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Counter&);
   static bool WriteTarget(const Counter&, openpal::WSlice&);
-  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Counter>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Counter - 32-bit Without Flag
@@ -98,7 +101,8 @@ struct Group20Var5
   typedef CounterSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Counter&);
   static bool WriteTarget(const Counter&, openpal::WSlice&);
-  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Counter>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Counter - 16-bit Without Flag
@@ -119,7 +123,8 @@ struct Group20Var6
   typedef CounterSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Counter&);
   static bool WriteTarget(const Counter&, openpal::WSlice&);
-  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Counter>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 
@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -63,6 +64,27 @@ bool Group21Var1::WriteTarget(const FrozenCounter& value, openpal::WSlice& buff)
   return Group21Var1::Write(ConvertGroup21Var1::Apply(value), buff);
 }
 
+uint32_t Group21Var1::WriteTargets(const openpal::StridedView<FrozenCounter>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup21Var1::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt32::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group21Var2 -------
 
 Group21Var2::Group21Var2() : flags(0), value(0)
@@ -97,6 +119,27 @@ bool Group21Var2::WriteTarget(const FrozenCounter& value, openpal::WSlice& buff)
   return Group21Var2::Write(ConvertGroup21Var2::Apply(value), buff);
 }
 
+uint32_t Group21Var2::WriteTargets(const openpal::StridedView<FrozenCounter>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup21Var2::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt16::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group21Var5 -------
 
 Group21Var5::Group21Var5() : flags(0), value(0), time(0)
@@ -131,6 +174,28 @@ bool Group21Var5::WriteTarget(const FrozenCounter& value, openpal::WSlice& buff)
   return Group21Var5::Write(ConvertGroup21Var5::Apply(value), buff);
 }
 
+uint32_t Group21Var5::WriteTargets(const openpal::StridedView<FrozenCounter>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup21Var5::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt32::Write(dest + 1, gv.value);
+    UInt48::Write(dest + 5, gv.time);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group21Var6 -------
 
 Group21Var6::Group21Var6() : flags(0), value(0), time(0)
@@ -165,6 +230,28 @@ bool Group21Var6::WriteTarget(const FrozenCounter& value, openpal::WSlice& buff)
   return Group21Var6::Write(ConvertGroup21Var6::Apply(value), buff);
 }
 
+uint32_t Group21Var6::WriteTargets(const openpal::StridedView<FrozenCounter>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup21Var6::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt16::Write(dest + 1, gv.value);
+    UInt48::Write(dest + 3, gv.time);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group21Var9 -------
 
 Group21Var9::Group21Var9() : value(0)
@@ -199,6 +286,26 @@ bool Group21Var9::WriteTarget(const FrozenCounter& value, openpal::WSlice& buff)
   return Group21Var9::Write(ConvertGroup21Var9::Apply(value), buff);
 }
 
+uint32_t Group21Var9::WriteTargets(const openpal::StridedView<FrozenCounter>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup21Var9::Apply(values[i]);
+    UInt32::Write(dest, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group21Var10 -------
 
 Group21Var10::Group21Var10() : value(0)
@@ -233,5 +340,25 @@ bool Group21Var10::WriteTarget(const FrozenCounter& value, openpal::WSlice& buff
   return Group21Var10::Write(ConvertGroup21Var10::Apply(value), buff);
 }
 
+uint32_t Group21Var10::WriteTargets(const openpal::StridedView<FrozenCounter>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup21Var10::Apply(values[i]);
+    UInt16::Write(dest, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 
 }
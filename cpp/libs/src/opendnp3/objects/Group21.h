@@ -25,6 +25,7 @@
 #include <openpal/container/RSlice.h>
 #include <openpal/container/WSlice.h>
 #include "opendnp3/app/DNPTime.h"
+#include <openpal/container/StridedView.h>
 #include "opendnp3/app/DNP3Serializer.h"
 #include "opendnp3/app/MeasurementTypeSpecs.h"
 
@@ -55,7 +56,8 @@ struct Group21Var1
   typedef FrozenCounterSpec Spec;
   static bool ReadTarget(openpal::RSlice&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, openpal::WSlice&);
-  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<FrozenCounter>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Frozen Counter - 16-bit With Flag
@@ -77,7 +79,8 @@ struct Group21Var2
   typedef FrozenCounterSpec Spec;
   static bool ReadTarget(openpal::RSlice&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, openpal::WSlice&);
-  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<FrozenCounter>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Frozen Counter - 32-bit With Flag and Time
@@ -100,7 +103,8 @@ struct Group21Var5
   typedef FrozenCounterSpec Spec;
   static bool ReadTarget(openpal::RSlice&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, openpal::WSlice&);
-  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<FrozenCounter>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Frozen Counter - 16-bit With Flag and Time
@@ -123,7 +127,8 @@ struct Group21Var6
   typedef FrozenCounterSpec Spec;
   static bool ReadTarget(openpal::RSlice&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, openpal::WSlice&);
-  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<FrozenCounter>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Frozen Counter - 32-bit Without Flag
@@ -144,7 +149,8 @@ struct Group21Var9
   typedef FrozenCounterSpec Spec;
   static bool ReadTarget(openpal::RSlice&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, openpal::WSlice&);
-  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<FrozenCounter>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Frozen Counter - 16-bit Without Flag
@@ -165,7 +171,8 @@ struct Group21Var10
   typedef FrozenCounterSpec Spec;
   static bool ReadTarget(openpal::RSlice&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, openpal::WSlice&);
-  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<FrozenCounter>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 
@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -63,6 +64,27 @@ bool Group22Var1::WriteTarget(const Counter& value, openpal::WSlice& buff)
   return Group22Var1::Write(ConvertGroup22Var1::Apply(value), buff);
 }
 
+uint32_t Group22Var1::WriteTargets(const openpal::StridedView<Counter>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup22Var1::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt32::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group22Var2 -------
 
 Group22Var2::Group22Var2() : flags(0), value(0)
@@ -97,6 +119,27 @@ bool Group22Var2::WriteTarget(const Counter& value, openpal::WSlice& buff)
   return Group22Var2::Write(ConvertGroup22Var2::Apply(value), buff);
 }
 
+uint32_t Group22Var2::WriteTargets(const openpal::StridedView<Counter>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup22Var2::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt16::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group22Var5 -------
 
 Group22Var5::Group22Var5() : flags(0), value(0), time(0)
@@ -131,6 +174,28 @@ bool Group22Var5::WriteTarget(const Counter& value, openpal::WSlice& buff)
   return Group22Var5::Write(ConvertGroup22Var5::Apply(value), buff);
 }
 
+uint32_t Group22Var5::WriteTargets(const openpal::StridedView<Counter>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup22Var5::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt32::Write(dest + 1, gv.value);
+    UInt48::Write(dest + 5, gv.time);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group22Var6 -------
 
 Group22Var6::Group22Var6() : flags(0), value(0), time(0)
@@ -165,5 +230,27 @@ bool Group22Var6::WriteTarget(const Counter& value, openpal::WSlice& buff)
   return Group22Var6::Write(ConvertGroup22Var6::Apply(value), buff);
 }
 
+uint32_t Group22Var6::WriteTargets(const openpal::StridedView<Counter>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup22Var6::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt16::Write(dest + 1, gv.value);
+    UInt48::Write(dest + 3, gv.time);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 
 }
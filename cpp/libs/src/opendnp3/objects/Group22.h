@@ -25,6 +25,7 @@
 #include <openpal/container/RSlice.h>
 #include <openpal/container/WSlice.h>
 #include "opendnp3/app/DNPTime.h"
+#include <openpal/container/StridedView.h>
 #include "opendnp3/app/DNP3Serializer.h"
 #include "opendnp3/app/MeasurementTypeSpecs.h"
 
@@ -55,7 +56,8 @@ struct Group22Var1
   typedef CounterSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Counter&);
   static bool WriteTarget(const Counter&, openpal::WSlice&);
-  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Counter>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Counter Event - 16-bit With Flag
@@ -77,7 +79,8 @@ struct Group22Var2
   typedef CounterSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Counter&);
   static bool WriteTarget(const Counter&, openpal::WSlice&);
-  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Counter>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Counter Event - 32-bit With Flag and Time
@@ -100,7 +103,8 @@ struct Group22Var5
   typedef CounterSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Counter&);
   static bool WriteTarget(const Counter&, openpal::WSlice&);
-  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Counter>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Counter Event - 16-bit With Flag and Time
@@ -123,7 +127,8 @@ struct Group22Var6
   typedef CounterSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Counter&);
   static bool WriteTarget(const Counter&, openpal::WSlice&);
-  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Counter>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 
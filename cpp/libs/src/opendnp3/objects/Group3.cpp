@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -63,5 +64,25 @@ bool Group3Var2::WriteTarget(const DoubleBitBinary& value, openpal::WSlice& buff
   return Group3Var2::Write(ConvertGroup3Var2::Apply(value), buff);
 }
 
+uint32_t Group3Var2::WriteTargets(const openpal::StridedView<DoubleBitBinary>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup3Var2::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 
 }
@@ -25,6 +25,7 @@
 #include <openpal/container/RSlice.h>
 #include <openpal/container/WSlice.h>
 #include "opendnp3/app/DNPTime.h"
+#include <openpal/container/StridedView.h>
 #include "opendnp3/app/DNP3Serializer.h"
 #include "opendnp3/app/MeasurementTypeSpecs.h"
 
@@ -59,7 +60,8 @@ struct Group3Var2
   typedef DoubleBitBinarySpec Spec;
   static bool ReadTarget(openpal::RSlice&, DoubleBitBinary&);
   static bool WriteTarget(const DoubleBitBinary&, openpal::WSlice&);
-  static DNP3Serializer<DoubleBitBinary> Inst() { return DNP3Serializer<DoubleBitBinary>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<DoubleBitBinary>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<DoubleBitBinary> Inst() { return DNP3Serializer<DoubleBitBinary>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 
@@ -25,6 +25,7 @@
 #include <openpal/container/RSlice.h>
 #include <openpal/container/WSlice.h>
 #include "opendnp3/app/DNPTime.h"
+#include <openpal/container/StridedView.h>
 #include "opendnp3/app/DNP3Serializer.h"
 #include "opendnp3/app/MeasurementTypeSpecs.h"
 
@@ -55,7 +56,8 @@ struct Group30Var1
   typedef AnalogSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Analog>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Input - 16-bit With Flag
@@ -77,7 +79,8 @@ struct Group30Var2
   typedef AnalogSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Analog>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Input - 32-bit Without Flag
@@ -98,7 +101,8 @@ struct Group30Var3
   typedef AnalogSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Analog>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Input - 16-bit Without Flag
@@ -119,7 +123,8 @@ struct Group30Var4
   typedef AnalogSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Analog>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Input - Single-precision With Flag
@@ -141,7 +146,8 @@ struct Group30Var5
   typedef AnalogSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Analog>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Input - Double-precision With Flag
@@ -163,7 +169,8 @@ struct Group30Var6
   typedef AnalogSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Analog>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 
@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -63,6 +64,27 @@ bool Group32Var1::WriteTarget(const Analog& value, openpal::WSlice& buff)
   return Group32Var1::Write(ConvertGroup32Var1::Apply(value), buff);
 }
 
+uint32_t Group32Var1::WriteTargets(const openpal::StridedView<Analog>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup32Var1::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    Int32::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group32Var2 -------
 
 Group32Var2::Group32Var2() : flags(0), value(0)
@@ -97,6 +119,27 @@ bool Group32Var2::WriteTarget(const Analog& value, openpal::WSlice& buff)
   return Group32Var2::Write(ConvertGroup32Var2::Apply(value), buff);
 }
 
+uint32_t Group32Var2::WriteTargets(const openpal::StridedView<Analog>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup32Var2::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    Int16::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group32Var3 -------
 
 Group32Var3::Group32Var3() : flags(0), value(0), time(0)
@@ -131,6 +174,28 @@ bool Group32Var3::WriteTarget(const Analog& value, openpal::WSlice& buff)
   return Group32Var3::Write(ConvertGroup32Var3::Apply(value), buff);
 }
 
+uint32_t Group32Var3::WriteTargets(const openpal::StridedView<Analog>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup32Var3::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    Int32::Write(dest + 1, gv.value);
+    UInt48::Write(dest + 5, gv.time);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group32Var4 -------
 
 Group32Var4::Group32Var4() : flags(0), value(0), time(0)
@@ -165,6 +230,28 @@ bool Group32Var4::WriteTarget(const Analog& value, openpal::WSlice& buff)
   return Group32Var4::Write(ConvertGroup32Var4::Apply(value), buff);
 }
 
+uint32_t Group32Var4::WriteTargets(const openpal::StridedView<Analog>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup32Var4::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    Int16::Write(dest + 1, gv.value);
+    UInt48::Write(dest + 3, gv.time);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group32Var5 -------
 
 Group32Var5::Group32Var5() : flags(0), value(0.0)
@@ -199,6 +286,27 @@ bool Group32Var5::WriteTarget(const Analog& value, openpal::WSlice& buff)
   return Group32Var5::Write(ConvertGroup32Var5::Apply(value), buff);
 }
 
+uint32_t Group32Var5::WriteTargets(const openpal::StridedView<Analog>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup32Var5::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    SingleFloat::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group32Var6 -------
 
 Group32Var6::Group32Var6() : flags(0), value(0.0)
@@ -233,6 +341,27 @@ bool Group32Var6::WriteTarget(const Analog& value, openpal::WSlice& buff)
   return Group32Var6::Write(ConvertGroup32Var6::Apply(value), buff);
 }
 
+uint32_t Group32Var6::WriteTargets(const openpal::StridedView<Analog>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup32Var6::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    DoubleFloat::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group32Var7 -------
 
 Group32Var7::Group32Var7() : flags(0), value(0.0), time(0)
@@ -267,6 +396,28 @@ bool Group32Var7::WriteTarget(const Analog& value, openpal::WSlice& buff)
   return Group32Var7::Write(ConvertGroup32Var7::Apply(value), buff);
 }
 
+uint32_t Group32Var7::WriteTargets(const openpal::StridedView<Analog>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup32Var7::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    SingleFloat::Write(dest + 1, gv.value);
+    UInt48::Write(dest + 5, gv.time);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group32Var8 -------
 
 Group32Var8::Group32Var8() : flags(0), value(0.0), time(0)
@@ -301,5 +452,27 @@ bool Group32Var8::WriteTarget(const Analog& value, openpal::WSlice& buff)
   return Group32Var8::Write(ConvertGroup32Var8::Apply(value), buff);
 }
 
+uint32_t Group32Var8::WriteTargets(const openpal::StridedView<Analog>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup32Var8::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    DoubleFloat::Write(dest + 1, gv.value);
+    UInt48::Write(dest + 9, gv.time);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 
 }
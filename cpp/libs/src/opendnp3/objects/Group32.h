@@ -25,6 +25,7 @@
 #include <openpal/container/RSlice.h>
 #include <openpal/container/WSlice.h>
 #include "opendnp3/app/DNPTime.h"
+#include <openpal/container/StridedView.h>
 #include "opendnp3/app/DNP3Serializer.h"
 #include "opendnp3/app/MeasurementTypeSpecs.h"
 
@@ -55,7 +56,8 @@ struct Group32Var1
   typedef AnalogSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Analog>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Input Event - 16-bit With Flag
@@ -77,7 +79,8 @@ struct Group32Var2
   typedef AnalogSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Analog>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Input Event - 32-bit With Flag and Time
@@ -100,7 +103,8 @@ struct Group32Var3
   typedef AnalogSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Analog>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Input Event - 16-bit With Flag and Time
@@ -123,7 +127,8 @@ struct Group32Var4
   typedef AnalogSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Analog>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Input Event - Single-precision With Flag
@@ -145,7 +150,8 @@ struct Group32Var5
   typedef AnalogSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Analog>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Input Event - Double-precision With Flag
@@ -167,7 +173,8 @@ struct Group32Var6
   typedef AnalogSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Analog>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Input Event - Single-precision With Flag and Time
@@ -190,7 +197,8 @@ struct Group32Var7
   typedef AnalogSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Analog>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Input Event - Double-precision With Flag and Time
@@ -213,7 +221,8 @@ struct Group32Var8
   typedef AnalogSpec Spec;
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
-  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<Analog>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 
@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -63,6 +64,26 @@ bool Group4Var1::WriteTarget(const DoubleBitBinary& value, openpal::WSlice& buff
   return Group4Var1::Write(ConvertGroup4Var1::Apply(value), buff);
 }
 
+uint32_t Group4Var1::WriteTargets(const openpal::StridedView<DoubleBitBinary>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup4Var1::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group4Var2 -------
 
 Group4Var2::Group4Var2() : flags(0), time(0)
@@ -97,6 +118,27 @@ bool Group4Var2::WriteTarget(const DoubleBitBinary& value, openpal::WSlice& buff
   return Group4Var2::Write(ConvertGroup4Var2::Apply(value), buff);
 }
 
+uint32_t Group4Var2::WriteTargets(const openpal::StridedView<DoubleBitBinary>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup4Var2::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt48::Write(dest + 1, gv.time);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group4Var3 -------
 
 Group4Var3::Group4Var3() : flags(0), time(0)
@@ -131,5 +173,26 @@ bool Group4Var3::WriteTarget(const DoubleBitBinary& value, openpal::WSlice& buff
   return Group4Var3::Write(ConvertGroup4Var3::Apply(value), buff);
 }
 
+uint32_t Group4Var3::WriteTargets(const openpal::StridedView<DoubleBitBinary>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup4Var3::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt16::Write(dest + 1, gv.time);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 
 }
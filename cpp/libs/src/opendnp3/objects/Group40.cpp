@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -63,6 +64,27 @@ bool Group40Var1::WriteTarget(const AnalogOutputStatus& value, openpal::WSlice&
   return Group40Var1::Write(ConvertGroup40Var1::Apply(value), buff);
 }
 
+uint32_t Group40Var1::WriteTargets(const openpal::StridedView<AnalogOutputStatus>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup40Var1::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    Int32::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group40Var2 -------
 
 Group40Var2::Group40Var2() : flags(0), value(0)
@@ -97,6 +119,27 @@ bool Group40Var2::WriteTarget(const AnalogOutputStatus& value, openpal::WSlice&
   return Group40Var2::Write(ConvertGroup40Var2::Apply(value), buff);
 }
 
+uint32_t Group40Var2::WriteTargets(const openpal::StridedView<AnalogOutputStatus>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup40Var2::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    Int16::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group40Var3 -------
 
 Group40Var3::Group40Var3() : flags(0), value(0.0)
@@ -131,6 +174,27 @@ bool Group40Var3::WriteTarget(const AnalogOutputStatus& value, openpal::WSlice&
   return Group40Var3::Write(ConvertGroup40Var3::Apply(value), buff);
 }
 
+uint32_t Group40Var3::WriteTargets(const openpal::StridedView<AnalogOutputStatus>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup40Var3::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    SingleFloat::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group40Var4 -------
 
 Group40Var4::Group40Var4() : flags(0), value(0.0)
@@ -165,5 +229,26 @@ bool Group40Var4::WriteTarget(const AnalogOutputStatus& value, openpal::WSlice&
   return Group40Var4::Write(ConvertGroup40Var4::Apply(value), buff);
 }
 
+uint32_t Group40Var4::WriteTargets(const openpal::StridedView<AnalogOutputStatus>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup40Var4::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    DoubleFloat::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 
 }
@@ -25,6 +25,7 @@
 #include <openpal/container/RSlice.h>
 #include <openpal/container/WSlice.h>
 #include "opendnp3/app/DNPTime.h"
+#include <openpal/container/StridedView.h>
 #include "opendnp3/app/DNP3Serializer.h"
 #include "opendnp3/app/MeasurementTypeSpecs.h"
 
@@ -55,7 +56,8 @@ struct Group40Var1
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(openpal::RSlice&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, openpal::WSlice&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<AnalogOutputStatus>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Output Status - 16-bit With Flag
@@ -77,7 +79,8 @@ struct Group40Var2
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(openpal::RSlice&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, openpal::WSlice&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<AnalogOutputStatus>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Output Status - Single-precision With Flag
@@ -99,7 +102,8 @@ struct Group40Var3
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(openpal::RSlice&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, openpal::WSlice&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<AnalogOutputStatus>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Output Status - Double-precision With Flag
@@ -121,7 +125,8 @@ struct Group40Var4
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(openpal::RSlice&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, openpal::WSlice&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<AnalogOutputStatus>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 
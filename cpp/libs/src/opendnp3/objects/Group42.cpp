@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -63,6 +64,27 @@ bool Group42Var1::WriteTarget(const AnalogOutputStatus& value, openpal::WSlice&
   return Group42Var1::Write(ConvertGroup42Var1::Apply(value), buff);
 }
 
+uint32_t Group42Var1::WriteTargets(const openpal::StridedView<AnalogOutputStatus>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup42Var1::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    Int32::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group42Var2 -------
 
 Group42Var2::Group42Var2() : flags(0), value(0)
@@ -97,6 +119,27 @@ bool Group42Var2::WriteTarget(const AnalogOutputStatus& value, openpal::WSlice&
   return Group42Var2::Write(ConvertGroup42Var2::Apply(value), buff);
 }
 
+uint32_t Group42Var2::WriteTargets(const openpal::StridedView<AnalogOutputStatus>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup42Var2::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    Int16::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group42Var3 -------
 
 Group42Var3::Group42Var3() : flags(0), value(0), time(0)
@@ -131,6 +174,28 @@ bool Group42Var3::WriteTarget(const AnalogOutputStatus& value, openpal::WSlice&
   return Group42Var3::Write(ConvertGroup42Var3::Apply(value), buff);
 }
 
+uint32_t Group42Var3::WriteTargets(const openpal::StridedView<AnalogOutputStatus>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup42Var3::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    Int32::Write(dest + 1, gv.value);
+    UInt48::Write(dest + 5, gv.time);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group42Var4 -------
 
 Group42Var4::Group42Var4() : flags(0), value(0), time(0)
@@ -165,6 +230,28 @@ bool Group42Var4::WriteTarget(const AnalogOutputStatus& value, openpal::WSlice&
   return Group42Var4::Write(ConvertGroup42Var4::Apply(value), buff);
 }
 
+uint32_t Group42Var4::WriteTargets(const openpal::StridedView<AnalogOutputStatus>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup42Var4::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    Int16::Write(dest + 1, gv.value);
+    UInt48::Write(dest + 3, gv.time);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group42Var5 -------
 
 Group42Var5::Group42Var5() : flags(0), value(0.0)
@@ -199,6 +286,27 @@ bool Group42Var5::WriteTarget(const AnalogOutputStatus& value, openpal::WSlice&
   return Group42Var5::Write(ConvertGroup42Var5::Apply(value), buff);
 }
 
+uint32_t Group42Var5::WriteTargets(const openpal::StridedView<AnalogOutputStatus>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup42Var5::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    SingleFloat::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group42Var6 -------
 
 Group42Var6::Group42Var6() : flags(0), value(0.0)
@@ -233,6 +341,27 @@ bool Group42Var6::WriteTarget(const AnalogOutputStatus& value, openpal::WSlice&
   return Group42Var6::Write(ConvertGroup42Var6::Apply(value), buff);
 }
 
+uint32_t Group42Var6::WriteTargets(const openpal::StridedView<AnalogOutputStatus>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup42Var6::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    DoubleFloat::Write(dest + 1, gv.value);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group42Var7 -------
 
 Group42Var7::Group42Var7() : flags(0), value(0.0), time(0)
@@ -267,6 +396,28 @@ bool Group42Var7::WriteTarget(const AnalogOutputStatus& value, openpal::WSlice&
   return Group42Var7::Write(ConvertGroup42Var7::Apply(value), buff);
 }
 
+uint32_t Group42Var7::WriteTargets(const openpal::StridedView<AnalogOutputStatus>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup42Var7::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    SingleFloat::Write(dest + 1, gv.value);
+    UInt48::Write(dest + 5, gv.time);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 // ------- Group42Var8 -------
 
 Group42Var8::Group42Var8() : flags(0), value(0.0), time(0)
@@ -301,5 +452,27 @@ bool Group42Var8::WriteTarget(const AnalogOutputStatus& value, openpal::WSlice&
   return Group42Var8::Write(ConvertGroup42Var8::Apply(value), buff);
 }
 
+uint32_t Group42Var8::WriteTargets(const openpal::StridedView<AnalogOutputStatus>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup42Var8::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    DoubleFloat::Write(dest + 1, gv.value);
+    UInt48::Write(dest + 9, gv.time);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 
 }
@@ -25,6 +25,7 @@
 #include <openpal/container/RSlice.h>
 #include <openpal/container/WSlice.h>
 #include "opendnp3/app/DNPTime.h"
+#include <openpal/container/StridedView.h>
 #include "opendnp3/app/DNP3Serializer.h"
 #include "opendnp3/app/MeasurementTypeSpecs.h"
 
@@ -55,7 +56,8 @@ struct Group42Var1
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(openpal::RSlice&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, openpal::WSlice&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<AnalogOutputStatus>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Output Event - 16-bit With Flag
@@ -77,7 +79,8 @@ struct Group42Var2
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(openpal::RSlice&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, openpal::WSlice&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<AnalogOutputStatus>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Output Event - 32-bit With Flag and Time
@@ -100,7 +103,8 @@ struct Group42Var3
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(openpal::RSlice&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, openpal::WSlice&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<AnalogOutputStatus>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Output Event - 16-bit With Flag and Time
@@ -123,7 +127,8 @@ struct Group42Var4
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(openpal::RSlice&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, openpal::WSlice&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<AnalogOutputStatus>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Output Event - Single-precision With Flag
@@ -145,7 +150,8 @@ struct Group42Var5
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(openpal::RSlice&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, openpal::WSlice&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<AnalogOutputStatus>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Output Event - Double-precision With Flag
@@ -167,7 +173,8 @@ struct Group42Var6
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(openpal::RSlice&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, openpal::WSlice&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<AnalogOutputStatus>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Output Event - Single-precision With Flag and Time
@@ -190,7 +197,8 @@ struct Group42Var7
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(openpal::RSlice&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, openpal::WSlice&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<AnalogOutputStatus>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 // Analog Output Event - Double-precision With Flag and Time
@@ -213,7 +221,8 @@ struct Group42Var8
   typedef AnalogOutputStatusSpec Spec;
   static bool ReadTarget(openpal::RSlice&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, openpal::WSlice&);
-  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<AnalogOutputStatus>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 
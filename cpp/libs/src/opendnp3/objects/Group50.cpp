@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -93,5 +94,27 @@ bool Group50Var4::WriteTarget(const TimeAndInterval& value, openpal::WSlice& buf
   return Group50Var4::Write(ConvertGroup50Var4::Apply(value), buff);
 }
 
+uint32_t Group50Var4::WriteTargets(const openpal::StridedView<TimeAndInterval>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)
+{
+  const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();
+  const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < num; ++i)
+  {
+    if(indices)
+    {
+      UInt16::Write(dest, indices[i]);
+      dest += UInt16::SIZE;
+    }
+    const auto gv = ConvertGroup50Var4::Apply(values[i]);
+    UInt48::Write(dest, gv.time);
+    UInt32::Write(dest + 6, gv.interval);
+    UInt8::Write(dest + 10, gv.units);
+    dest += Size();
+  }
+  buff.Advance(num * size);
+  return num;
+}
+
 
 }
@@ -25,6 +25,7 @@
 #include <openpal/container/RSlice.h>
 #include <openpal/container/WSlice.h>
 #include "opendnp3/app/DNPTime.h"
+#include <openpal/container/StridedView.h>
 #include "opendnp3/app/DNP3Serializer.h"
 #include "opendnp3/app/MeasurementTypeSpecs.h"
 
@@ -77,7 +78,8 @@ struct Group50Var4
   typedef TimeAndIntervalSpec Spec;
   static bool ReadTarget(openpal::RSlice&, TimeAndInterval&);
   static bool WriteTarget(const TimeAndInterval&, openpal::WSlice&);
-  static DNP3Serializer<TimeAndInterval> Inst() { return DNP3Serializer<TimeAndInterval>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static uint32_t WriteTargets(const openpal::StridedView<TimeAndInterval>&, const uint16_t*, uint32_t, openpal::WSlice&);
+  static DNP3Serializer<TimeAndInterval> Inst() { return DNP3Serializer<TimeAndInterval>(ID(), Size(), &ReadTarget, &WriteTarget, &WriteTargets); }
 };
 
 
@@ -0,0 +1,65 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "ChatterFilters.h"
+
+#include <algorithm>
+
+namespace opendnp3
+{
+
+namespace
+{
+bool IsBefore(const ChatterFilters::Filter& filter, uint16_t rawIndex)
+{
+	return filter.rawIndex < rawIndex;
+}
+}
+
+void ChatterFilters::Configure(EventType type, uint16_t rawIndex, const ChatterFilterConfig& config)
+{
+	auto& list = this->Get(type);
+	auto pos = std::lower_bound(list.begin(), list.end(), rawIndex, IsBefore);
+
+	if (pos != list.end() && pos->rawIndex == rawIndex)
+	{
+		pos->config = config;
+	}
+	else
+	{
+		list.insert(pos, Filter{ rawIndex, config, ChatterState() });
+	}
+}
+
+ChatterFilters::Filter* ChatterFilters::Find(EventType type, uint16_t rawIndex)
+{
+	auto& list = this->Get(type);
+
+	// most databases have no filters at all
+	if (list.empty())
+	{
+		return nullptr;
+	}
+
+	auto pos = std::lower_bound(list.begin(), list.end(), rawIndex, IsBefore);
+	return (pos != list.end() && pos->rawIndex == rawIndex) ? &(*pos) : nullptr;
+}
+
+}
@@ -0,0 +1,89 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_CHATTERFILTERS_H
+#define OPENDNP3_CHATTERFILTERS_H
+
+#include "opendnp3/app/EventType.h"
+#include "opendnp3/outstation/ChatterFilterStatistics.h"
+#include "opendnp3/outstation/MeasurementConfig.h"
+
+#include <openpal/util/Uncopyable.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace opendnp3
+{
+
+/// State of the chatter filter of a point. Times are the low 32 bits of the monotonic clock in milliseconds
+struct ChatterState
+{
+	/// start of the current counting window
+	uint32_t windowStart = 0;
+
+	/// time of the last detected change
+	uint32_t lastChange = 0;
+
+	/// events suppressed by the filter since the database was created
+	uint32_t numSuppressed = 0;
+
+	/// events counted in the current window
+	uint16_t count = 0;
+
+	bool filtered = false;
+};
+
+/**
+* Configuration and state of the chatter filters, kept apart from the database cells so that
+* only the points with a filter pay for one. Filters are sorted by raw index within each type.
+*/
+class ChatterFilters : private openpal::Uncopyable
+{
+
+public:
+
+	struct Filter
+	{
+		uint16_t rawIndex;
+		ChatterFilterConfig config;
+		ChatterState state;
+	};
+
+	/// Add a filter to a point or replace the configuration of its existing filter
+	void Configure(EventType type, uint16_t rawIndex, const ChatterFilterConfig& config);
+
+	/// @return the filter of a point or nullptr if the point does not have one
+	Filter* Find(EventType type, uint16_t rawIndex);
+
+	/// @return the filters of a type sorted by raw index
+	std::vector<Filter>& Get(EventType type)
+	{
+		return filters[static_cast<uint16_t>(type)];
+	}
+
+private:
+
+	std::vector<Filter> filters[ChatterFilterStatistics::NUM_EVENT_TYPES];
+};
+
+}
+
+#endif
@@ -0,0 +1,338 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "CompactEncoding.h"
+
+#include "opendnp3/objects/Group1.h"
+#include "opendnp3/objects/Group20.h"
+#include "opendnp3/objects/Group21.h"
+#include "opendnp3/objects/Group22.h"
+#include "opendnp3/objects/Group23.h"
+#include "opendnp3/objects/Group30.h"
+#include "opendnp3/objects/Group32.h"
+#include "opendnp3/objects/Group40.h"
+#include "opendnp3/objects/Group42.h"
+
+#include <openpal/util/Limits.h>
+
+#include <cmath>
+
+namespace opendnp3
+{
+
+template <class V>
+V Narrower(V configured, V candidate)
+{
+	return (CompactEncoding::Size(candidate, 1) < CompactEncoding::Size(configured, 1)) ? candidate : configured;
+}
+
+void CompactEncoding::Accumulate(Needs& needs, const Binary& value)
+{
+	needs.flags |= !BinarySpec::IsQualityOnlineOnly(value);
+}
+
+void CompactEncoding::Accumulate(Needs& needs, const Counter& value)
+{
+	AccumulateFlags(needs, value.flags);
+	AccumulateInteger(needs, value.value);
+}
+
+void CompactEncoding::Accumulate(Needs& needs, const FrozenCounter& value)
+{
+	AccumulateFlags(needs, value.flags);
+	AccumulateInteger(needs, value.value);
+}
+
+void CompactEncoding::Accumulate(Needs& needs, const Analog& value)
+{
+	AccumulateFlags(needs, value.flags);
+	AccumulateReal(needs, value.value);
+}
+
+void CompactEncoding::Accumulate(Needs& needs, const AnalogOutputStatus& value)
+{
+	AccumulateFlags(needs, value.flags);
+	AccumulateReal(needs, value.value);
+}
+
+void CompactEncoding::AccumulateFlags(Needs& needs, const Flags& flags)
+{
+	needs.flags |= (flags.value != 0x01);
+}
+
+void CompactEncoding::AccumulateInteger(Needs& needs, uint32_t value)
+{
+	needs.wide |= (value > openpal::MaxValue<uint16_t>());
+}
+
+void CompactEncoding::AccumulateReal(Needs& needs, double value)
+{
+	// the comparisons are false for NaN
+	const bool isInt32 = (value >= openpal::MinValue<int32_t>()) && (value <= openpal::MaxValue<int32_t>()) && (std::floor(value) == value);
+
+	if (isInt32)
+	{
+		needs.wide |= (value < openpal::MinValue<int16_t>()) || (value > openpal::MaxValue<int16_t>());
+	}
+	else
+	{
+		needs.fractional = true;
+	}
+}
+
+StaticBinaryVariation CompactEncoding::Select(StaticBinaryVariation variation, const Needs& needs)
+{
+	// the packed format can't carry flags, but is always the smallest when it doesn't need to
+	return needs.flags ? StaticBinaryVariation::Group1Var2 : StaticBinaryVariation::Group1Var1;
+}
+
+StaticCounterVariation CompactEncoding::Select(StaticCounterVariation variation, const Needs& needs)
+{
+	const auto candidate = needs.flags ?
+	                       (needs.wide ? StaticCounterVariation::Group20Var1 : StaticCounterVariation::Group20Var2) :
+	                       (needs.wide ? StaticCounterVariation::Group20Var5 : StaticCounterVariation::Group20Var6);
+
+	return Narrower(variation, candidate);
+}
+
+StaticFrozenCounterVariation CompactEncoding::Select(StaticFrozenCounterVariation variation, const Needs& needs)
+{
+	switch (variation)
+	{
+	case(StaticFrozenCounterVariation::Group21Var5):
+	case(StaticFrozenCounterVariation::Group21Var6):
+		return variation; // never drop the freeze time
+	default:
+		break;
+	}
+
+	const auto candidate = needs.flags ?
+	                       (needs.wide ? StaticFrozenCounterVariation::Group21Var1 : StaticFrozenCounterVariation::Group21Var2) :
+	                       (needs.wide ? StaticFrozenCounterVariation::Group21Var9 : StaticFrozenCounterVariation::Group21Var10);
+
+	return Narrower(variation, candidate);
+}
+
+StaticAnalogVariation CompactEncoding::Select(StaticAnalogVariation variation, const Needs& needs)
+{
+	if (needs.fractional)
+	{
+		return variation;
+	}
+
+	const auto candidate = needs.flags ?
+	                       (needs.wide ? StaticAnalogVariation::Group30Var1 : StaticAnalogVariation::Group30Var2) :
+	                       (needs.wide ? StaticAnalogVariation::Group30Var3 : StaticAnalogVariation::Group30Var4);
+
+	return Narrower(variation, candidate);
+}
+
+StaticAnalogOutputStatusVariation CompactEncoding::Select(StaticAnalogOutputStatusVariation variation, const Needs& needs)
+{
+	if (needs.fractional)
+	{
+		return variation;
+	}
+
+	const auto candidate = needs.wide ? StaticAnalogOutputStatusVariation::Group40Var1 : StaticAnalogOutputStatusVariation::Group40Var2;
+
+	return Narrower(variation, candidate);
+}
+
+EventCounterVariation CompactEncoding::Select(EventCounterVariation variation, const Needs& needs)
+{
+	const bool hasTime = (variation == EventCounterVariation::Group22Var5) || (variation == EventCounterVariation::Group22Var6);
+
+	const auto candidate = hasTime ?
+	                       (needs.wide ? EventCounterVariation::Group22Var5 : EventCounterVariation::Group22Var6) :
+	                       (needs.wide ? EventCounterVariation::Group22Var1 : EventCounterVariation::Group22Var2);
+
+	return Narrower(variation, candidate);
+}
+
+EventFrozenCounterVariation CompactEncoding::Select(EventFrozenCounterVariation variation, const Needs& needs)
+{
+	const bool hasTime = (variation == EventFrozenCounterVariation::Group23Var5) || (variation == EventFrozenCounterVariation::Group23Var6);
+
+	const auto candidate = hasTime ?
+	                       (needs.wide ? EventFrozenCounterVariation::Group23Var5 : EventFrozenCounterVariation::Group23Var6) :
+	                       (needs.wide ? EventFrozenCounterVariation::Group23Var1 : EventFrozenCounterVariation::Group23Var2);
+
+	return Narrower(variation, candidate);
+}
+
+EventAnalogVariation CompactEncoding::Select(EventAnalogVariation variation, const Needs& needs)
+{
+	if (needs.fractional)
+	{
+		return variation;
+	}
+
+	switch (variation)
+	{
+	case(EventAnalogVariation::Group32Var3):
+	case(EventAnalogVariation::Group32Var4):
+	case(EventAnalogVariation::Group32Var7):
+	case(EventAnalogVariation::Group32Var8):
+		return Narrower(variation, needs.wide ? EventAnalogVariation::Group32Var3 : EventAnalogVariation::Group32Var4);
+	default:
+		return Narrower(variation, needs.wide ? EventAnalogVariation::Group32Var1 : EventAnalogVariation::Group32Var2);
+	}
+}
+
+EventAnalogOutputStatusVariation CompactEncoding::Select(EventAnalogOutputStatusVariation variation, const Needs& needs)
+{
+	if (needs.fractional)
+	{
+		return variation;
+	}
+
+	switch (variation)
+	{
+	case(EventAnalogOutputStatusVariation::Group42Var3):
+	case(EventAnalogOutputStatusVariation::Group42Var4):
+	case(EventAnalogOutputStatusVariation::Group42Var7):
+	case(EventAnalogOutputStatusVariation::Group42Var8):
+		return Narrower(variation, needs.wide ? EventAnalogOutputStatusVariation::Group42Var3 : EventAnalogOutputStatusVariation::Group42Var4);
+	default:
+		return Narrower(variation, needs.wide ? EventAnalogOutputStatusVariation::Group42Var1 : EventAnalogOutputStatusVariation::Group42Var2);
+	}
+}
+
+uint32_t CompactEncoding::Size(StaticBinaryVariation variation, uint32_t count)
+{
+	switch (variation)
+	{
+	case(StaticBinaryVariation::Group1Var1):
+		return (count + 7) / 8;
+	default:
+		return count * Group1Var2::Size();
+	}
+}
+
+uint32_t CompactEncoding::Size(StaticCounterVariation variation, uint32_t count)
+{
+	switch (variation)
+	{
+	case(StaticCounterVariation::Group20Var2): return count * Group20Var2::Size();
+	case(StaticCounterVariation::Group20Var5): return count * Group20Var5::Size();
+	case(StaticCounterVariation::Group20Var6): return count * Group20Var6::Size();
+	default:
+		return count * Group20Var1::Size();
+	}
+}
+
+uint32_t CompactEncoding::Size(StaticFrozenCounterVariation variation, uint32_t count)
+{
+	switch (variation)
+	{
+	case(StaticFrozenCounterVariation::Group21Var2): return count * Group21Var2::Size();
+	case(StaticFrozenCounterVariation::Group21Var5): return count * Group21Var5::Size();
+	case(StaticFrozenCounterVariation::Group21Var6): return count * Group21Var6::Size();
+	case(StaticFrozenCounterVariation::Group21Var9): return count * Group21Var9::Size();
+	case(StaticFrozenCounterVariation::Group21Var10): return count * Group21Var10::Size();
+	default:
+		return count * Group21Var1::Size();
+	}
+}
+
+uint32_t CompactEncoding::Size(StaticAnalogVariation variation, uint32_t count)
+{
+	switch (variation)
+	{
+	case(StaticAnalogVariation::Group30Var2): return count * Group30Var2::Size();
+	case(StaticAnalogVariation::Group30Var3): return count * Group30Var3::Size();
+	case(StaticAnalogVariation::Group30Var4): return count * Group30Var4::Size();
+	case(StaticAnalogVariation::Group30Var5): return count * Group30Var5::Size();
+	case(StaticAnalogVariation::Group30Var6): return count * Group30Var6::Size();
+	default:
+		return count * Group30Var1::Size();
+	}
+}
+
+uint32_t CompactEncoding::Size(StaticAnalogOutputStatusVariation variation, uint32_t count)
+{
+	switch (variation)
+	{
+	case(StaticAnalogOutputStatusVariation::Group40Var2): return count * Group40Var2::Size();
+	case(StaticAnalogOutputStatusVariation::Group40Var3): return count * Group40Var3::Size();
+	case(StaticAnalogOutputStatusVariation::Group40Var4): return count * Group40Var4::Size();
+	default:
+		return count * Group40Var1::Size();
+	}
+}
+
+uint32_t CompactEncoding::Size(EventCounterVariation variation, uint32_t count)
+{
+	switch (variation)
+	{
+	case(EventCounterVariation::Group22Var2): return count * Group22Var2::Size();
+	case(EventCounterVariation::Group22Var5): return count * Group22Var5::Size();
+	case(EventCounterVariation::Group22Var6): return count * Group22Var6::Size();
+	default:
+		return count * Group22Var1::Size();
+	}
+}
+
+uint32_t CompactEncoding::Size(EventFrozenCounterVariation variation, uint32_t count)
+{
+	switch (variation)
+	{
+	case(EventFrozenCounterVariation::Group23Var2): return count * Group23Var2::Size();
+	case(EventFrozenCounterVariation::Group23Var5): return count * Group23Var5::Size();
+	case(EventFrozenCounterVariation::Group23Var6): return count * Group23Var6::Size();
+	default:
+		return count * Group23Var1::Size();
+	}
+}
+
+uint32_t CompactEncoding::Size(EventAnalogVariation variation, uint32_t count)
+{
+	switch (variation)
+	{
+	case(EventAnalogVariation::Group32Var2): return count * Group32Var2::Size();
+	case(EventAnalogVariation::Group32Var3): return count * Group32Var3::Size();
+	case(EventAnalogVariation::Group32Var4): return count * Group32Var4::Size();
+	case(EventAnalogVariation::Group32Var5): return count * Group32Var5::Size();
+	case(EventAnalogVariation::Group32Var6): return count * Group32Var6::Size();
+	case(EventAnalogVariation::Group32Var7): return count * Group32Var7::Size();
+	case(EventAnalogVariation::Group32Var8): return count * Group32Var8::Size();
+	default:
+		return count * Group32Var1::Size();
+	}
+}
+
+uint32_t CompactEncoding::Size(EventAnalogOutputStatusVariation variation, uint32_t count)
+{
+	switch (variation)
+	{
+	case(EventAnalogOutputStatusVariation::Group42Var2): return count * Group42Var2::Size();
+	case(EventAnalogOutputStatusVariation::Group42Var3): return count * Group42Var3::Size();
+	case(EventAnalogOutputStatusVariation::Group42Var4): return count * Group42Var4::Size();
+	case(EventAnalogOutputStatusVariation::Group42Var5): return count * Group42Var5::Size();
+	case(EventAnalogOutputStatusVariation::Group42Var6): return count * Group42Var6::Size();
+	case(EventAnalogOutputStatusVariation::Group42Var7): return count * Group42Var7::Size();
+	case(EventAnalogOutputStatusVariation::Group42Var8): return count * Group42Var8::Size();
+	default:
+		return count * Group42Var1::Size();
+	}
+}
+
+}
@@ -0,0 +1,124 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_COMPACTENCODING_H
+#define OPENDNP3_COMPACTENCODING_H
+
+#include "opendnp3/app/MeasurementTypes.h"
+
+#include "opendnp3/gen/StaticBinaryVariation.h"
+#include "opendnp3/gen/StaticCounterVariation.h"
+#include "opendnp3/gen/StaticFrozenCounterVariation.h"
+#include "opendnp3/gen/StaticAnalogVariation.h"
+#include "opendnp3/gen/StaticAnalogOutputStatusVariation.h"
+#include "opendnp3/gen/EventCounterVariation.h"
+#include "opendnp3/gen/EventFrozenCounterVariation.h"
+#include "opendnp3/gen/EventAnalogVariation.h"
+#include "opendnp3/gen/EventAnalogOutputStatusVariation.h"
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+* Selects the narrowest variation that encodes a value, or a run of values, exactly.
+*
+* A variation is only ever replaced by a smaller one of the same kind, so time-tagged
+* events keep their time and a configured 16-bit variation is never widened. The only
+* exception is Group1Var1 which is promoted to Group1Var2 whenever flags must be reported.
+*/
+class CompactEncoding
+{
+
+public:
+
+	/// What a set of values requires from an encoding
+	struct Needs
+	{
+		/// a flag other than ONLINE is set
+		bool flags = false;
+
+		/// a value does not fit in 16 bits
+		bool wide = false;
+
+		/// a value is not an integer that fits in 32 bits
+		bool fractional = false;
+	};
+
+	static void Accumulate(Needs& needs, const Binary& value);
+	static void Accumulate(Needs& needs, const Counter& value);
+	static void Accumulate(Needs& needs, const FrozenCounter& value);
+	static void Accumulate(Needs& needs, const Analog& value);
+	static void Accumulate(Needs& needs, const AnalogOutputStatus& value);
+
+	template <class T>
+	static void Accumulate(Needs& needs, const T& value)
+	{
+		// types without a narrower encoding
+	}
+
+	static StaticBinaryVariation Select(StaticBinaryVariation variation, const Needs& needs);
+	static StaticCounterVariation Select(StaticCounterVariation variation, const Needs& needs);
+	static StaticFrozenCounterVariation Select(StaticFrozenCounterVariation variation, const Needs& needs);
+	static StaticAnalogVariation Select(StaticAnalogVariation variation, const Needs& needs);
+	static StaticAnalogOutputStatusVariation Select(StaticAnalogOutputStatusVariation variation, const Needs& needs);
+
+	static EventCounterVariation Select(EventCounterVariation variation, const Needs& needs);
+	static EventFrozenCounterVariation Select(EventFrozenCounterVariation variation, const Needs& needs);
+	static EventAnalogVariation Select(EventAnalogVariation variation, const Needs& needs);
+	static EventAnalogOutputStatusVariation Select(EventAnalogOutputStatusVariation variation, const Needs& needs);
+
+	template <class V>
+	static V Select(V variation, const Needs& needs)
+	{
+		return variation;
+	}
+
+	/// @return the number of object bytes needed to encode count values with the variation
+	static uint32_t Size(StaticBinaryVariation variation, uint32_t count);
+	static uint32_t Size(StaticCounterVariation variation, uint32_t count);
+	static uint32_t Size(StaticFrozenCounterVariation variation, uint32_t count);
+	static uint32_t Size(StaticAnalogVariation variation, uint32_t count);
+	static uint32_t Size(StaticAnalogOutputStatusVariation variation, uint32_t count);
+
+	static uint32_t Size(EventCounterVariation variation, uint32_t count);
+	static uint32_t Size(EventFrozenCounterVariation variation, uint32_t count);
+	static uint32_t Size(EventAnalogVariation variation, uint32_t count);
+	static uint32_t Size(EventAnalogOutputStatusVariation variation, uint32_t count);
+
+	template <class V>
+	static uint32_t Size(V variation, uint32_t count)
+	{
+		return 0;
+	}
+
+private:
+
+	static void AccumulateFlags(Needs& needs, const Flags& flags);
+	static void AccumulateInteger(Needs& needs, uint32_t value);
+	static void AccumulateReal(Needs& needs, double value);
+
+	CompactEncoding() = delete;
+};
+
+}
+
+#endif
@@ -22,6 +22,7 @@
 
 #include <openpal/logging/LogMacros.h>
 
+#include <algorithm>
 #include <assert.h>
 
 using namespace openpal;
@@ -29,10 +30,43 @@ using namespace openpal;
 namespace opendnp3
 {
 
-Database::Database(const DatabaseSizes& dbSizes, IEventReceiver& eventReceiver, IndexMode indexMode, StaticTypeBitField allowedClass0Types) :
+namespace
+{
+// sets or clears the chatter flag on types that define one
+// @return true if the type has a chatter flag
+template <class T>
+bool SetChatterFlag(T& value, bool set)
+{
+	return false;
+}
+
+template <class T>
+bool SetFlag(T& value, uint8_t flag, bool set)
+{
+	value.flags = Flags(set ? (value.flags.value | flag) : (value.flags.value & ~flag));
+	return true;
+}
+
+template <>
+bool SetChatterFlag(Binary& value, bool set)
+{
+	return SetFlag(value, static_cast<uint8_t>(BinaryQuality::CHATTER_FILTER), set);
+}
+
+template <>
+bool SetChatterFlag(DoubleBitBinary& value, bool set)
+{
+	return SetFlag(value, static_cast<uint8_t>(DoubleBitBinaryQuality::CHATTER_FILTER), set);
+}
+}
+
+Database::Database(const DatabaseSizes& dbSizes, IEventReceiver& eventReceiver, IndexMode indexMode, StaticTypeBitField allowedClass0Types, IMonotonicTimeSource* clock, bool compactEncoding) :
 	eventReceiver(&eventReceiver),
 	indexMode(indexMode),
-	buffers(dbSizes, allowedClass0Types, indexMode)
+	buffers(dbSizes, allowedClass0Types, indexMode, compactEncoding),
+	clock(clock),
+	compactEncoding(compactEncoding),
+	chatterResumeTime(MonotonicTimestamp::Max())
 {
 
 }
@@ -116,6 +150,82 @@ bool Database::Modify(FlagsType type, uint16_t start, uint16_t stop, uint8_t fla
 	return false;
 }
 
+bool Database::ConfigureChatterFilter(EventType type, uint16_t index, const ChatterFilterConfig& config)
+{
+	switch (type)
+	{
+	case(EventType::Binary):
+		return ConfigureChatterFilter<BinarySpec>(index, config);
+	case(EventType::DoubleBitBinary):
+		return ConfigureChatterFilter<DoubleBitBinarySpec>(index, config);
+	case(EventType::Analog):
+		return ConfigureChatterFilter<AnalogSpec>(index, config);
+	case(EventType::Counter):
+		return ConfigureChatterFilter<CounterSpec>(index, config);
+	case(EventType::FrozenCounter):
+		return ConfigureChatterFilter<FrozenCounterSpec>(index, config);
+	case(EventType::BinaryOutputStatus):
+		return ConfigureChatterFilter<BinaryOutputStatusSpec>(index, config);
+	case(EventType::AnalogOutputStatus):
+		return ConfigureChatterFilter<AnalogOutputStatusSpec>(index, config);
+	case(EventType::OctetString):
+		return ConfigureChatterFilter<OctetStringSpec>(index, config);
+	}
+
+	return false;
+}
+
+void Database::ResumeChatterFilters()
+{
+	if (!clock || this->chatterStatistics.numFiltered == 0)
+	{
+		this->chatterResumeTime = MonotonicTimestamp::Max();
+		return;
+	}
+
+	const auto now = clock->GetTime();
+
+	// recalculated by the sweep
+	this->chatterResumeTime = MonotonicTimestamp::Max();
+
+	this->ResumeChatterFilters<BinarySpec>(now);
+	this->ResumeChatterFilters<DoubleBitBinarySpec>(now);
+	this->ResumeChatterFilters<AnalogSpec>(now);
+	this->ResumeChatterFilters<CounterSpec>(now);
+	this->ResumeChatterFilters<FrozenCounterSpec>(now);
+	this->ResumeChatterFilters<BinaryOutputStatusSpec>(now);
+	this->ResumeChatterFilters<AnalogOutputStatusSpec>(now);
+	this->ResumeChatterFilters<OctetStringSpec>(now);
+}
+
+ChatterFilterStatistics Database::GetChatterStatistics(uint16_t maxPoints)
+{
+	auto statistics = this->chatterStatistics;
+
+	if (maxPoints > 0)
+	{
+		this->AddChatterPoints<BinarySpec>(statistics.topPoints);
+		this->AddChatterPoints<DoubleBitBinarySpec>(statistics.topPoints);
+		this->AddChatterPoints<AnalogSpec>(statistics.topPoints);
+		this->AddChatterPoints<CounterSpec>(statistics.topPoints);
+		this->AddChatterPoints<FrozenCounterSpec>(statistics.topPoints);
+		this->AddChatterPoints<BinaryOutputStatusSpec>(statistics.topPoints);
+		this->AddChatterPoints<AnalogOutputStatusSpec>(statistics.topPoints);
+		this->AddChatterPoints<OctetStringSpec>(statistics.topPoints);
+
+		auto compare = [](const ChatterFilterStatistics::Point & lhs, const ChatterFilterStatistics::Point & rhs)
+		{
+			return lhs.numSuppressed > rhs.numSuppressed;
+		};
+
+		const auto count = std::min<size_t>(maxPoints, statistics.topPoints.size());
+		std::partial_sort(statistics.topPoints.begin(), statistics.topPoints.begin() + count, statistics.topPoints.end(), compare);
+		statistics.topPoints.resize(count);
+	}
+
+	return statistics;
+}
+
 bool Database::ConvertToEventClass(PointClass pc, EventClass& ec)
 {
 	switch (pc)
@@ -158,7 +268,7 @@ bool Database::UpdateEvent(const typename Spec::meas_t& value, uint16_t index, E
 
 	if (view.Contains(rawIndex))
 	{
-		this->UpdateAny(view[rawIndex], value, mode);
+		this->UpdateAny(view[rawIndex], rawIndex, value, mode);
 		return true;
 	}
 	else
@@ -168,18 +278,27 @@ bool Database::UpdateEvent(const typename Spec::meas_t& value, uint16_t index, E
 }
 
 template <class Spec>
-bool Database::UpdateAny(Cell<Spec>& cell, const typename Spec::meas_t& value, EventMode mode)
+bool Database::UpdateAny(Cell<Spec>& cell, uint16_t rawIndex, const typename Spec::meas_t& value, EventMode mode)
 {
+	auto filter = this->chatterFilters.Find(Spec::EventTypeEnum, rawIndex);
+
+	// while the chatter filter is active, the stored and reported values carry its flag
+	auto actual = value;
+	if (filter && filter->state.filtered)
+	{
+		SetChatterFlag(actual, true);
+	}
+
 	switch (mode)
 	{
 	case(EventMode::Force):
 	case(EventMode::EventOnly):
-		this->TryCreateEvent(cell, value);
+		this->TryCreateEvent(cell, filter, actual);
 		break;
 	case(EventMode::Detect):
-		if (cell.event.IsEvent(cell.config, value))
+		if (cell.event.IsEvent(cell.config, actual))
 		{
-			this->TryCreateEvent(cell, value);
+			this->TryCreateEvent(cell, filter, actual);
 		}
 		break;
 	default:
@@ -189,22 +308,175 @@ bool Database::UpdateAny(Cell<Spec>& cell, const typename Spec::meas_t& value, E
 	// we always update the static value unless the mode is EventOnly
 	if (mode != EventMode::EventOnly)
 	{
-		cell.value = value;
+		cell.value = actual;
 	}
 
 	return true;
 }
 
 template <class Spec>
-void Database::TryCreateEvent(Cell<Spec>& cell, const typename Spec::meas_t& value)
+void Database::TryCreateEvent(Cell<Spec>& cell, ChatterFilters::Filter* filter, typename Spec::meas_t& value)
 {
 	EventClass ec;
 	// don't create an event if point is assigned to Class 0
 	if (ConvertToEventClass(cell.config.clazz, ec))
 	{
+		const bool suppressed = filter && this->IsChatterSuppressed<Spec>(*filter, value);
+
+		// change detection continues from suppressed values
 		cell.event.lastEvent = value;
-		this->eventReceiver->Update(Event<Spec>(value, cell.config.vIndex, ec, cell.config.evariation));
+
+		if (!suppressed)
+		{
+			this->eventReceiver->Update(Event<Spec>(value, cell.config.vIndex, ec, this->GetEventVariation(cell, value)));
+		}
+	}
+}
+
+template <class Spec>
+typename Spec::event_variation_t Database::GetEventVariation(const Cell<Spec>& cell, const typename Spec::meas_t& value)
+{
+	if (!this->compactEncoding)
+	{
+		return cell.config.evariation;
+	}
+
+	CompactEncoding::Needs needs;
+	CompactEncoding::Accumulate(needs, value);
+	const auto variation = CompactEncoding::Select(cell.config.evariation, needs);
+
+	if (variation != cell.config.evariation)
+	{
+		++buffers.compaction.numEvents;
+		buffers.compaction.numEventBytesSaved += CompactEncoding::Size(cell.config.evariation, 1) - CompactEncoding::Size(variation, 1);
 	}
+
+	return variation;
+}
+
+template <class Spec>
+bool Database::IsChatterSuppressed(ChatterFilters::Filter& filter, typename Spec::meas_t& value)
+{
+	const auto& config = filter.config;
+	auto& state = filter.state;
+
+	if (config.maxEvents == 0 || !clock)
+	{
+		return false;
+	}
+
+	const auto now = clock->GetTime();
+	const auto nowMs = static_cast<uint32_t>(now.milliseconds);
+
+	if (!state.filtered)
+	{
+		if (state.count == 0 || (nowMs - state.windowStart) >= static_cast<uint32_t>(config.window.GetMilliseconds()))
+		{
+			state.windowStart = nowMs;
+			state.count = 0;
+		}
+
+		if (state.count < config.maxEvents)
+		{
+			++state.count;
+			return false;
+		}
+
+		state.filtered = true;
+		++this->chatterStatistics.numFiltered;
+
+		const auto resume = now.Add(config.quietPeriod);
+		if (resume < this->chatterResumeTime)
+		{
+			this->chatterResumeTime = resume;
+		}
+
+		// report the flag in place of the change on types that have one
+		if (SetChatterFlag(value, true))
+		{
+			state.lastChange = nowMs;
+			return false;
+		}
+	}
+
+	state.lastChange = nowMs;
+	++state.numSuppressed;
+	++this->chatterStatistics.numSuppressed[static_cast<uint16_t>(Spec::EventTypeEnum)];
+	return true;
+}
+
+template <class Spec>
+void Database::ResumeChatterFilters(const MonotonicTimestamp& now)
+{
+	auto view = buffers.buffers.GetArrayView<Spec>();
+
+	for (auto& filter : this->chatterFilters.Get(Spec::EventTypeEnum))
+	{
+		auto& state = filter.state;
+
+		if (!state.filtered)
+		{
+			continue;
+		}
+
+		auto& cell = view[filter.rawIndex];
+		const auto quietPeriod = filter.config.quietPeriod;
+		const auto elapsed = static_cast<uint32_t>(now.milliseconds) - state.lastChange;
+
+		if (elapsed < static_cast<uint32_t>(quietPeriod.GetMilliseconds()))
+		{
+			const auto resume = now.Add(TimeDuration::Milliseconds(quietPeriod.GetMilliseconds() - elapsed));
+			if (resume < this->chatterResumeTime)
+			{
+				this->chatterResumeTime = resume;
+			}
+			continue;
+		}
+
+		state.filtered = false;
+		state.count = 0;
+		--this->chatterStatistics.numFiltered;
+
+		// report the current value so the master sees the final state of the point
+		auto value = cell.value;
+		SetChatterFlag(value, false);
+		cell.value = value;
+
+		EventClass ec;
+		if (ConvertToEventClass(cell.config.clazz, ec))
+		{
+			cell.event.lastEvent = value;
+			this->eventReceiver->Update(Event<Spec>(value, cell.config.vIndex, ec, this->GetEventVariation(cell, value)));
+		}
+	}
+}
+
+template <class Spec>
+void Database::AddChatterPoints(std::vector<ChatterFilterStatistics::Point>& points)
+{
+	auto view = buffers.buffers.GetArrayView<Spec>();
+
+	for (const auto& filter : this->chatterFilters.Get(Spec::EventTypeEnum))
+	{
+		if (filter.state.numSuppressed > 0 || filter.state.filtered)
+		{
+			points.push_back({ Spec::EventTypeEnum, view[filter.rawIndex].config.vIndex, filter.state.numSuppressed, filter.state.filtered });
+		}
+	}
+}
+
+template <class Spec>
+bool Database::ConfigureChatterFilter(uint16_t index, const ChatterFilterConfig& config)
+{
+	const auto rawIndex = GetRawIndex<Spec>(index);
+
+	if (!buffers.buffers.GetArrayView<Spec>().Contains(rawIndex))
+	{
+		return false;
+	}
+
+	this->chatterFilters.Configure(Spec::EventTypeEnum, rawIndex, config);
+	return true;
 }
 
 template <class Spec>
@@ -221,7 +493,7 @@ bool Database::Modify(uint16_t start, uint16_t stop, uint8_t flags)
 		{
 			auto copy = view[i].value;
 			copy.flags = flags;
-			this->UpdateAny(view[i], copy, EventMode::Detect);
+			this->UpdateAny(view[i], i, copy, EventMode::Detect);
 		}
 
 		return true;
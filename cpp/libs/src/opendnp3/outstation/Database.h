@@ -27,6 +27,10 @@
 #include "opendnp3/outstation/IDatabase.h"
 #include "opendnp3/outstation/IEventReceiver.h"
 #include "opendnp3/outstation/DatabaseBuffers.h"
+#include "opendnp3/outstation/ChatterFilterStatistics.h"
+#include "opendnp3/outstation/ChatterFilters.h"
+
+#include <openpal/executor/IMonotonicTimeSource.h>
 
 namespace opendnp3
 {
@@ -38,7 +42,11 @@ class Database final : public IDatabase, private openpal::Uncopyable
 {
 public:
 
-	Database(const DatabaseSizes&, IEventReceiver& eventReceiver, IndexMode indexMode, StaticTypeBitField allowedClass0Types);
+	/**
+	* @param clock optional time source used by the chatter filters, which are disabled without one
+	* @param compactEncoding narrow the variations of static values and events to fit their values
+	*/
+	Database(const DatabaseSizes&, IEventReceiver& eventReceiver, IndexMode indexMode, StaticTypeBitField allowedClass0Types, openpal::IMonotonicTimeSource* clock = nullptr, bool compactEncoding = false);
 
 	// ------- IDatabase --------------
 
@@ -76,6 +84,36 @@ public:
 		return buffers.buffers.GetView();
 	}
 
+	/**
+	* Add a chatter filter to a point or replace the configuration of its filter
+	*
+	* @return false if the point does not exist
+	*/
+	bool ConfigureChatterFilter(EventType type, uint16_t index, const ChatterFilterConfig& config);
+
+	/**
+	* Remove the chatter filter from every point that has been quiet for long enough, reporting its current value
+	*/
+	void ResumeChatterFilters();
+
+	/**
+	* @return the earliest time a filtered point may resume, or MonotonicTimestamp::Max() if no point is filtered
+	*/
+	openpal::MonotonicTimestamp GetChatterResumeTime() const
+	{
+		return chatterResumeTime;
+	}
+
+	/**
+	* @param maxPoints maximum number of points to include in the list of top offenders
+	*/
+	ChatterFilterStatistics GetChatterStatistics(uint16_t maxPoints);
+
+	const StackStatistics::Compaction& GetCompactionStatistics() const
+	{
+		return buffers.compaction;
+	}
+
 private:
 
 	template <class Spec>
@@ -90,16 +128,39 @@ private:
 	bool UpdateEvent(const typename Spec::meas_t& value, uint16_t index, EventMode mode);
 
 	template <class Spec>
-	bool UpdateAny(Cell<Spec>& cell, const typename Spec::meas_t& value, EventMode mode);
+	bool UpdateAny(Cell<Spec>& cell, uint16_t rawIndex, const typename Spec::meas_t& value, EventMode mode);
+
+	template <class Spec>
+	void TryCreateEvent(Cell<Spec>& cell, ChatterFilters::Filter* filter, typename Spec::meas_t& value);
+
+	template <class Spec>
+	typename Spec::event_variation_t GetEventVariation(const Cell<Spec>& cell, const typename Spec::meas_t& value);
 
+	/// Count an event against the chatter filter of a point, setting the chatter flag on the value if the filter engages
+	/// @return true if the event should be suppressed
 	template <class Spec>
-	void TryCreateEvent(Cell<Spec>& cell, const typename Spec::meas_t& value);
+	bool IsChatterSuppressed(ChatterFilters::Filter& filter, typename Spec::meas_t& value);
+
+	template <class Spec>
+	bool ConfigureChatterFilter(uint16_t index, const ChatterFilterConfig& config);
+
+	template <class Spec>
+	void ResumeChatterFilters(const openpal::MonotonicTimestamp& now);
+
+	template <class Spec>
+	void AddChatterPoints(std::vector<ChatterFilterStatistics::Point>& points);
 
 	template <class Spec>
 	bool Modify(uint16_t start, uint16_t stop, uint8_t flags);
 
 	// stores the most recent values, selected values, and metadata
 	DatabaseBuffers buffers;
+
+	openpal::IMonotonicTimeSource* clock;
+	bool compactEncoding;
+	ChatterFilters chatterFilters;
+	ChatterFilterStatistics chatterStatistics;
+	openpal::MonotonicTimestamp chatterResumeTime;
 };
 
 
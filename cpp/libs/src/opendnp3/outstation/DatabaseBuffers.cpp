@@ -20,6 +20,8 @@
  */
 #include "DatabaseBuffers.h"
 
+#include "opendnp3/objects/Group1.h"
+
 #include "openpal/logging/LogMacros.h"
 
 #include <assert.h>
@@ -29,10 +31,13 @@ using namespace openpal;
 namespace opendnp3
 {
 
-DatabaseBuffers::DatabaseBuffers(const DatabaseSizes& dbSizes, StaticTypeBitField allowedClass0Types, IndexMode indexMode) :
+DatabaseBuffers::DatabaseBuffers(const DatabaseSizes& dbSizes, StaticTypeBitField allowedClass0Types, IndexMode indexMode, bool compactEncoding) :
 	buffers(dbSizes),
 	class0(allowedClass0Types),
-	indexMode(indexMode)
+	indexMode(indexMode),
+	compactEncoding(compactEncoding),
+	packedBinaries(dbSizes.numBinary),
+	packedBinaryValues(dbSizes.numBinary)
 {
 
 }
@@ -47,6 +52,105 @@ void DatabaseBuffers::Unselect()
 	this->Deselect<BinaryOutputStatusSpec>();
 	this->Deselect<AnalogOutputStatusSpec>();
 	this->Deselect<TimeAndIntervalSpec>();
+	this->packedBinaries.Clear(0, this->packedBinaries.Size());
+}
+
+HandlerTable<DatabaseBuffers::SelectAllFun> DatabaseBuffers::CreateSelectAllHandlers()
+{
+	HandlerTable<SelectAllFun> handlers;
+
+	handlers.Set(GroupVariation::Group1Var0, &DatabaseBuffers::SelectAll<BinarySpec>);
+	handlers.Set(GroupVariation::Group1Var1, &DatabaseBuffers::SelectAllUsing<BinarySpec, StaticBinaryVariation::Group1Var1>);
+	handlers.Set(GroupVariation::Group1Var2, &DatabaseBuffers::SelectAllUsing<BinarySpec, StaticBinaryVariation::Group1Var2>);
+
+	handlers.Set(GroupVariation::Group3Var0, &DatabaseBuffers::SelectAll<DoubleBitBinarySpec>);
+	handlers.Set(GroupVariation::Group3Var2, &DatabaseBuffers::SelectAllUsing<DoubleBitBinarySpec, StaticDoubleBinaryVariation::Group3Var2>);
+
+	handlers.Set(GroupVariation::Group10Var0, &DatabaseBuffers::SelectAll<BinaryOutputStatusSpec>);
+	handlers.Set(GroupVariation::Group10Var2, &DatabaseBuffers::SelectAllUsing<BinaryOutputStatusSpec, StaticBinaryOutputStatusVariation::Group10Var2>);
+
+	handlers.Set(GroupVariation::Group20Var0, &DatabaseBuffers::SelectAll<CounterSpec>);
+	handlers.Set(GroupVariation::Group20Var1, &DatabaseBuffers::SelectAllUsing<CounterSpec, StaticCounterVariation::Group20Var1>);
+	handlers.Set(GroupVariation::Group20Var2, &DatabaseBuffers::SelectAllUsing<CounterSpec, StaticCounterVariation::Group20Var2>);
+	handlers.Set(GroupVariation::Group20Var5, &DatabaseBuffers::SelectAllUsing<CounterSpec, StaticCounterVariation::Group20Var5>);
+	handlers.Set(GroupVariation::Group20Var6, &DatabaseBuffers::SelectAllUsing<CounterSpec, StaticCounterVariation::Group20Var6>);
+
+	handlers.Set(GroupVariation::Group21Var0, &DatabaseBuffers::SelectAll<FrozenCounterSpec>);
+	handlers.Set(GroupVariation::Group21Var1, &DatabaseBuffers::SelectAllUsing<FrozenCounterSpec, StaticFrozenCounterVariation::Group21Var1>);
+	handlers.Set(GroupVariation::Group21Var2, &DatabaseBuffers::SelectAllUsing<FrozenCounterSpec, StaticFrozenCounterVariation::Group21Var2>);
+	handlers.Set(GroupVariation::Group21Var5, &DatabaseBuffers::SelectAllUsing<FrozenCounterSpec, StaticFrozenCounterVariation::Group21Var5>);
+	handlers.Set(GroupVariation::Group21Var6, &DatabaseBuffers::SelectAllUsing<FrozenCounterSpec, StaticFrozenCounterVariation::Group21Var6>);
+	handlers.Set(GroupVariation::Group21Var9, &DatabaseBuffers::SelectAllUsing<FrozenCounterSpec, StaticFrozenCounterVariation::Group21Var9>);
+	handlers.Set(GroupVariation::Group21Var10, &DatabaseBuffers::SelectAllUsing<FrozenCounterSpec, StaticFrozenCounterVariation::Group21Var10>);
+
+	handlers.Set(GroupVariation::Group30Var0, &DatabaseBuffers::SelectAll<AnalogSpec>);
+	handlers.Set(GroupVariation::Group30Var1, &DatabaseBuffers::SelectAllUsing<AnalogSpec, StaticAnalogVariation::Group30Var1>);
+	handlers.Set(GroupVariation::Group30Var2, &DatabaseBuffers::SelectAllUsing<AnalogSpec, StaticAnalogVariation::Group30Var2>);
+	handlers.Set(GroupVariation::Group30Var3, &DatabaseBuffers::SelectAllUsing<AnalogSpec, StaticAnalogVariation::Group30Var3>);
+	handlers.Set(GroupVariation::Group30Var4, &DatabaseBuffers::SelectAllUsing<AnalogSpec, StaticAnalogVariation::Group30Var4>);
+	handlers.Set(GroupVariation::Group30Var5, &DatabaseBuffers::SelectAllUsing<AnalogSpec, StaticAnalogVariation::Group30Var5>);
+	handlers.Set(GroupVariation::Group30Var6, &DatabaseBuffers::SelectAllUsing<AnalogSpec, StaticAnalogVariation::Group30Var6>);
+
+	handlers.Set(GroupVariation::Group40Var0, &DatabaseBuffers::SelectAll<AnalogOutputStatusSpec>);
+	handlers.Set(GroupVariation::Group40Var1, &DatabaseBuffers::SelectAllUsing<AnalogOutputStatusSpec, StaticAnalogOutputStatusVariation::Group40Var1>);
+	handlers.Set(GroupVariation::Group40Var2, &DatabaseBuffers::SelectAllUsing<AnalogOutputStatusSpec, StaticAnalogOutputStatusVariation::Group40Var2>);
+	handlers.Set(GroupVariation::Group40Var3, &DatabaseBuffers::SelectAllUsing<AnalogOutputStatusSpec, StaticAnalogOutputStatusVariation::Group40Var3>);
+	handlers.Set(GroupVariation::Group40Var4, &DatabaseBuffers::SelectAllUsing<AnalogOutputStatusSpec, StaticAnalogOutputStatusVariation::Group40Var4>);
+
+	handlers.Set(GroupVariation::Group50Var4, &DatabaseBuffers::SelectAllUsing<TimeAndIntervalSpec, StaticTimeAndIntervalVariation::Group50Var4>);
+
+	handlers.Set(GroupVariation::Group110Var0, &DatabaseBuffers::SelectAll<OctetStringSpec>);
+
+	return handlers;
+}
+
+HandlerTable<DatabaseBuffers::SelectRangeFun> DatabaseBuffers::CreateSelectRangeHandlers()
+{
+	HandlerTable<SelectRangeFun> handlers;
+
+	handlers.Set(GroupVariation::Group1Var0, &DatabaseBuffers::SelectRange<BinarySpec>);
+	handlers.Set(GroupVariation::Group1Var1, &DatabaseBuffers::SelectRangeUsing<BinarySpec, StaticBinaryVariation::Group1Var1>);
+	handlers.Set(GroupVariation::Group1Var2, &DatabaseBuffers::SelectRangeUsing<BinarySpec, StaticBinaryVariation::Group1Var2>);
+
+	handlers.Set(GroupVariation::Group3Var0, &DatabaseBuffers::SelectRange<DoubleBitBinarySpec>);
+	handlers.Set(GroupVariation::Group3Var2, &DatabaseBuffers::SelectRangeUsing<DoubleBitBinarySpec, StaticDoubleBinaryVariation::Group3Var2>);
+
+	handlers.Set(GroupVariation::Group10Var0, &DatabaseBuffers::SelectRange<BinaryOutputStatusSpec>);
+	handlers.Set(GroupVariation::Group10Var2, &DatabaseBuffers::SelectRangeUsing<BinaryOutputStatusSpec, StaticBinaryOutputStatusVariation::Group10Var2>);
+
+	handlers.Set(GroupVariation::Group20Var0, &DatabaseBuffers::SelectRange<CounterSpec>);
+	handlers.Set(GroupVariation::Group20Var1, &DatabaseBuffers::SelectRangeUsing<CounterSpec, StaticCounterVariation::Group20Var1>);
+	handlers.Set(GroupVariation::Group20Var2, &DatabaseBuffers::SelectRangeUsing<CounterSpec, StaticCounterVariation::Group20Var2>);
+	handlers.Set(GroupVariation::Group20Var5, &DatabaseBuffers::SelectRangeUsing<CounterSpec, StaticCounterVariation::Group20Var5>);
+	handlers.Set(GroupVariation::Group20Var6, &DatabaseBuffers::SelectRangeUsing<CounterSpec, StaticCounterVariation::Group20Var6>);
+
+	handlers.Set(GroupVariation::Group21Var0, &DatabaseBuffers::SelectRange<FrozenCounterSpec>);
+	handlers.Set(GroupVariation::Group21Var1, &DatabaseBuffers::SelectRangeUsing<FrozenCounterSpec, StaticFrozenCounterVariation::Group21Var1>);
+	handlers.Set(GroupVariation::Group21Var2, &DatabaseBuffers::SelectRangeUsing<FrozenCounterSpec, StaticFrozenCounterVariation::Group21Var2>);
+	handlers.Set(GroupVariation::Group21Var5, &DatabaseBuffers::SelectRangeUsing<FrozenCounterSpec, StaticFrozenCounterVariation::Group21Var5>);
+	handlers.Set(GroupVariation::Group21Var6, &DatabaseBuffers::SelectRangeUsing<FrozenCounterSpec, StaticFrozenCounterVariation::Group21Var6>);
+	handlers.Set(GroupVariation::Group21Var9, &DatabaseBuffers::SelectRangeUsing<FrozenCounterSpec, StaticFrozenCounterVariation::Group21Var9>);
+	handlers.Set(GroupVariation::Group21Var10, &DatabaseBuffers::SelectRangeUsing<FrozenCounterSpec, StaticFrozenCounterVariation::Group21Var10>);
+
+	handlers.Set(GroupVariation::Group30Var0, &DatabaseBuffers::SelectRange<AnalogSpec>);
+	handlers.Set(GroupVariation::Group30Var1, &DatabaseBuffers::SelectRangeUsing<AnalogSpec, StaticAnalogVariation::Group30Var1>);
+	handlers.Set(GroupVariation::Group30Var2, &DatabaseBuffers::SelectRangeUsing<AnalogSpec, StaticAnalogVariation::Group30Var2>);
+	handlers.Set(GroupVariation::Group30Var3, &DatabaseBuffers::SelectRangeUsing<AnalogSpec, StaticAnalogVariation::Group30Var3>);
+	handlers.Set(GroupVariation::Group30Var4, &DatabaseBuffers::SelectRangeUsing<AnalogSpec, StaticAnalogVariation::Group30Var4>);
+	handlers.Set(GroupVariation::Group30Var5, &DatabaseBuffers::SelectRangeUsing<AnalogSpec, StaticAnalogVariation::Group30Var5>);
+	handlers.Set(GroupVariation::Group30Var6, &DatabaseBuffers::SelectRangeUsing<AnalogSpec, StaticAnalogVariation::Group30Var6>);
+
+	handlers.Set(GroupVariation::Group40Var0, &DatabaseBuffers::SelectRange<AnalogOutputStatusSpec>);
+	handlers.Set(GroupVariation::Group40Var1, &DatabaseBuffers::SelectRangeUsing<AnalogOutputStatusSpec, StaticAnalogOutputStatusVariation::Group40Var1>);
+	handlers.Set(GroupVariation::Group40Var2, &DatabaseBuffers::SelectRangeUsing<AnalogOutputStatusSpec, StaticAnalogOutputStatusVariation::Group40Var2>);
+	handlers.Set(GroupVariation::Group40Var3, &DatabaseBuffers::SelectRangeUsing<AnalogOutputStatusSpec, StaticAnalogOutputStatusVariation::Group40Var3>);
+	handlers.Set(GroupVariation::Group40Var4, &DatabaseBuffers::SelectRangeUsing<AnalogOutputStatusSpec, StaticAnalogOutputStatusVariation::Group40Var4>);
+
+	handlers.Set(GroupVariation::Group50Var4, &DatabaseBuffers::SelectRangeUsing<TimeAndIntervalSpec, StaticTimeAndIntervalVariation::Group50Var4>);
+
+	handlers.Set(GroupVariation::Group110Var0, &DatabaseBuffers::SelectRangeUsing<OctetStringSpec, StaticOctetStringVariation::Group110Var0>);
+
+	return handlers;
 }
 
 IINField DatabaseBuffers::SelectAll(GroupVariation gv)
@@ -65,173 +169,19 @@ IINField DatabaseBuffers::SelectAll(GroupVariation gv)
 
 		return IINField::Empty();
 	}
-	else
-	{
-		switch (gv)
-		{
-		case(GroupVariation::Group1Var0):
-			return this->SelectAll<BinarySpec>();
-		case(GroupVariation::Group1Var1) :
-			return this->SelectAllUsing<BinarySpec>(StaticBinaryVariation::Group1Var1);
-		case(GroupVariation::Group1Var2) :
-			return this->SelectAllUsing<BinarySpec>(StaticBinaryVariation::Group1Var2);
-
-		case(GroupVariation::Group3Var0) :
-			return this->SelectAll<DoubleBitBinarySpec>();
-		case(GroupVariation::Group3Var2) :
-			return this->SelectAllUsing<DoubleBitBinarySpec>(StaticDoubleBinaryVariation::Group3Var2);
-
-		case(GroupVariation::Group10Var0) :
-			return this->SelectAll<BinaryOutputStatusSpec>();
-		case(GroupVariation::Group10Var2) :
-			return this->SelectAllUsing<BinaryOutputStatusSpec>(StaticBinaryOutputStatusVariation::Group10Var2);
-
-		case(GroupVariation::Group20Var0):
-			return this->SelectAll<CounterSpec>();
-		case(GroupVariation::Group20Var1):
-			return this->SelectAllUsing<CounterSpec>(StaticCounterVariation::Group20Var1);
-		case(GroupVariation::Group20Var2) :
-			return this->SelectAllUsing<CounterSpec>(StaticCounterVariation::Group20Var2);
-		case(GroupVariation::Group20Var5) :
-			return this->SelectAllUsing<CounterSpec>(StaticCounterVariation::Group20Var5);
-		case(GroupVariation::Group20Var6) :
-			return this->SelectAllUsing<CounterSpec>(StaticCounterVariation::Group20Var6);
-
-		case(GroupVariation::Group21Var0) :
-			return this->SelectAll<FrozenCounterSpec>();
-		case(GroupVariation::Group21Var1) :
-			return this->SelectAllUsing<FrozenCounterSpec>(StaticFrozenCounterVariation::Group21Var1);
-		case(GroupVariation::Group21Var2) :
-			return this->SelectAllUsing<FrozenCounterSpec>(StaticFrozenCounterVariation::Group21Var2);
-		case(GroupVariation::Group21Var5) :
-			return this->SelectAllUsing<FrozenCounterSpec>(StaticFrozenCounterVariation::Group21Var5);
-		case(GroupVariation::Group21Var6) :
-			return this->SelectAllUsing<FrozenCounterSpec>(StaticFrozenCounterVariation::Group21Var6);
-		case(GroupVariation::Group21Var9) :
-			return this->SelectAllUsing<FrozenCounterSpec>(StaticFrozenCounterVariation::Group21Var9);
-		case(GroupVariation::Group21Var10) :
-			return this->SelectAllUsing<FrozenCounterSpec>(StaticFrozenCounterVariation::Group21Var10);
-
-		case(GroupVariation::Group30Var0) :
-			return this->SelectAll<AnalogSpec>();
-		case(GroupVariation::Group30Var1) :
-			return this->SelectAllUsing<AnalogSpec>(StaticAnalogVariation::Group30Var1);
-		case(GroupVariation::Group30Var2) :
-			return this->SelectAllUsing<AnalogSpec>(StaticAnalogVariation::Group30Var2);
-		case(GroupVariation::Group30Var3) :
-			return this->SelectAllUsing<AnalogSpec>(StaticAnalogVariation::Group30Var3);
-		case(GroupVariation::Group30Var4) :
-			return this->SelectAllUsing<AnalogSpec>(StaticAnalogVariation::Group30Var4);
-		case(GroupVariation::Group30Var5) :
-			return this->SelectAllUsing<AnalogSpec>(StaticAnalogVariation::Group30Var5);
-		case(GroupVariation::Group30Var6) :
-			return this->SelectAllUsing<AnalogSpec>(StaticAnalogVariation::Group30Var6);
-
-		case(GroupVariation::Group40Var0) :
-			return this->SelectAll<AnalogOutputStatusSpec>();
-		case(GroupVariation::Group40Var1) :
-			return this->SelectAllUsing<AnalogOutputStatusSpec>(StaticAnalogOutputStatusVariation::Group40Var1);
-		case(GroupVariation::Group40Var2) :
-			return this->SelectAllUsing<AnalogOutputStatusSpec>(StaticAnalogOutputStatusVariation::Group40Var2);
-		case(GroupVariation::Group40Var3) :
-			return this->SelectAllUsing<AnalogOutputStatusSpec>(StaticAnalogOutputStatusVariation::Group40Var3);
-		case(GroupVariation::Group40Var4) :
-			return this->SelectAllUsing<AnalogOutputStatusSpec>(StaticAnalogOutputStatusVariation::Group40Var4);
-
-		case(GroupVariation::Group50Var4) :
-			return this->SelectAllUsing<TimeAndIntervalSpec>(StaticTimeAndIntervalVariation::Group50Var4);
-
-		case(GroupVariation::Group110Var0):
-			return this->SelectAll<OctetStringSpec>();
-
-		default:
-			return IINField(IINBit::FUNC_NOT_SUPPORTED);
-		}
-	}
+
+	static const HandlerTable<SelectAllFun> handlers = CreateSelectAllHandlers();
+
+	const auto select = handlers.Get(GroupVariationTable::Lookup(gv));
+	return select ? (this->*select)() : IINField(IINBit::FUNC_NOT_SUPPORTED);
 }
 
 IINField DatabaseBuffers::SelectRange(GroupVariation gv, const Range& range)
 {
-	switch (gv)
-	{
-	case(GroupVariation::Group1Var0) :
-		return this->SelectRange<BinarySpec>(range);
-	case(GroupVariation::Group1Var1) :
-		return this->SelectRangeUsing<BinarySpec>(range, StaticBinaryVariation::Group1Var1);
-	case(GroupVariation::Group1Var2) :
-		return this->SelectRangeUsing<BinarySpec>(range, StaticBinaryVariation::Group1Var2);
-
-	case(GroupVariation::Group3Var0) :
-		return this->SelectRange<DoubleBitBinarySpec>(range);
-	case(GroupVariation::Group3Var2) :
-		return this->SelectRangeUsing<DoubleBitBinarySpec>(range, StaticDoubleBinaryVariation::Group3Var2);
-
-	case(GroupVariation::Group10Var0) :
-		return this->SelectRange<BinaryOutputStatusSpec>(range);
-	case(GroupVariation::Group10Var2) :
-		return this->SelectRangeUsing<BinaryOutputStatusSpec>(range, StaticBinaryOutputStatusVariation::Group10Var2);
-
-	case(GroupVariation::Group20Var0) :
-		return this->SelectRange<CounterSpec>(range);
-	case(GroupVariation::Group20Var1) :
-		return this->SelectRangeUsing<CounterSpec>(range, StaticCounterVariation::Group20Var1);
-	case(GroupVariation::Group20Var2) :
-		return this->SelectRangeUsing<CounterSpec>(range, StaticCounterVariation::Group20Var2);
-	case(GroupVariation::Group20Var5) :
-		return this->SelectRangeUsing<CounterSpec>(range, StaticCounterVariation::Group20Var5);
-	case(GroupVariation::Group20Var6) :
-		return this->SelectRangeUsing<CounterSpec>(range, StaticCounterVariation::Group20Var6);
-
-	case(GroupVariation::Group21Var0) :
-		return this->SelectRange<FrozenCounterSpec>(range);
-	case(GroupVariation::Group21Var1) :
-		return this->SelectRangeUsing<FrozenCounterSpec>(range, StaticFrozenCounterVariation::Group21Var1);
-	case(GroupVariation::Group21Var2) :
-		return this->SelectRangeUsing<FrozenCounterSpec>(range, StaticFrozenCounterVariation::Group21Var2);
-	case(GroupVariation::Group21Var5) :
-		return this->SelectRangeUsing<FrozenCounterSpec>(range, StaticFrozenCounterVariation::Group21Var5);
-	case(GroupVariation::Group21Var6) :
-		return this->SelectRangeUsing<FrozenCounterSpec>(range, StaticFrozenCounterVariation::Group21Var6);
-	case(GroupVariation::Group21Var9) :
-		return this->SelectRangeUsing<FrozenCounterSpec>(range, StaticFrozenCounterVariation::Group21Var9);
-	case(GroupVariation::Group21Var10) :
-		return this->SelectRangeUsing<FrozenCounterSpec>(range, StaticFrozenCounterVariation::Group21Var10);
-
-	case(GroupVariation::Group30Var0) :
-		return this->SelectRange<AnalogSpec>(range);
-	case(GroupVariation::Group30Var1) :
-		return this->SelectRangeUsing<AnalogSpec>(range, StaticAnalogVariation::Group30Var1);
-	case(GroupVariation::Group30Var2) :
-		return this->SelectRangeUsing<AnalogSpec>(range, StaticAnalogVariation::Group30Var2);
-	case(GroupVariation::Group30Var3) :
-		return this->SelectRangeUsing<AnalogSpec>(range, StaticAnalogVariation::Group30Var3);
-	case(GroupVariation::Group30Var4) :
-		return this->SelectRangeUsing<AnalogSpec>(range, StaticAnalogVariation::Group30Var4);
-	case(GroupVariation::Group30Var5) :
-		return this->SelectRangeUsing<AnalogSpec>(range, StaticAnalogVariation::Group30Var5);
-	case(GroupVariation::Group30Var6) :
-		return this->SelectRangeUsing<AnalogSpec>(range, StaticAnalogVariation::Group30Var6);
-
-	case(GroupVariation::Group40Var0) :
-		return this->SelectRange<AnalogOutputStatusSpec>(range);
-	case(GroupVariation::Group40Var1) :
-		return this->SelectRangeUsing<AnalogOutputStatusSpec>(range, StaticAnalogOutputStatusVariation::Group40Var1);
-	case(GroupVariation::Group40Var2) :
-		return this->SelectRangeUsing<AnalogOutputStatusSpec>(range, StaticAnalogOutputStatusVariation::Group40Var2);
-	case(GroupVariation::Group40Var3) :
-		return this->SelectRangeUsing<AnalogOutputStatusSpec>(range, StaticAnalogOutputStatusVariation::Group40Var3);
-	case(GroupVariation::Group40Var4) :
-		return this->SelectRangeUsing<AnalogOutputStatusSpec>(range, StaticAnalogOutputStatusVariation::Group40Var4);
-
-	case(GroupVariation::Group50Var4) :
-		return this->SelectRangeUsing<TimeAndIntervalSpec>(range, StaticTimeAndIntervalVariation::Group50Var4);
-
-	case(GroupVariation::Group110Var0):
-		return this->SelectRangeUsing<OctetStringSpec>(range, StaticOctetStringVariation::Group110Var0);
+	static const HandlerTable<SelectRangeFun> handlers = CreateSelectRangeHandlers();
 
-	default:
-		return IINField(IINBit::FUNC_NOT_SUPPORTED);
-	}
+	const auto select = handlers.Get(GroupVariationTable::Lookup(gv));
+	return select ? (this->*select)(range) : IINField(IINBit::FUNC_NOT_SUPPORTED);
 }
 
 bool DatabaseBuffers::Load(HeaderWriter& writer)
@@ -324,6 +274,61 @@ StaticBinaryVariation DatabaseBuffers::CheckForPromotion<BinarySpec>(const Binar
 	}
 }
 
+void DatabaseBuffers::RecordSelection(uint16_t index, const Cell<BinarySpec>& cell)
+{
+	// a run of packed values is contiguous when every value sits at its own index
+	const bool packed = !cell.selection.compact && (cell.selection.variation == StaticBinaryVariation::Group1Var1) && (cell.config.vIndex == index);
+
+	this->packedBinaries.Set(index, packed);
+	this->packedBinaryValues.Set(index, cell.selection.value.value);
+}
+
+bool DatabaseBuffers::TryLoadPacked(openpal::ArrayView<Cell<BinarySpec>, uint16_t>& view, HeaderWriter& writer, Range& range, bool& spaceRemaining)
+{
+	if (!this->packedBinaries.Get(range.start))
+	{
+		return false;
+	}
+
+	const auto count = this->packedBinaries.CountOnes(range.start, range.Count());
+
+	// same qualifier selection as the per-point writer
+	const auto mapped = Range::From(range.start, view[range.stop].config.vIndex);
+
+	uint32_t written = 0;
+
+	if (mapped.IsOneByte())
+	{
+		auto iter = writer.IterateOverSingleBitfield<openpal::UInt8>(Group1Var1::ID(), QualifierCode::UINT8_START_STOP, static_cast<uint8_t>(mapped.start));
+		written = iter.Write(this->packedBinaryValues, range.start, count);
+	}
+	else
+	{
+		auto iter = writer.IterateOverSingleBitfield<openpal::UInt16>(Group1Var1::ID(), QualifierCode::UINT16_START_STOP, mapped.start);
+		written = iter.Write(this->packedBinaryValues, range.start, count);
+	}
+
+	for (uint32_t i = range.start; i < range.start + written; ++i)
+	{
+		view[i].selection.selected = false;
+	}
+
+	this->packedBinaries.Clear(range.start, written);
+
+	if (written == range.Count())
+	{
+		range = Range::Invalid();
+	}
+	else
+	{
+		range.start += static_cast<uint16_t>(written);
+	}
+
+	spaceRemaining = (written == count);
+
+	return true;
+}
+
 Range DatabaseBuffers::RangeOf(uint16_t size)
 {
 	return size > 0 ? Range::From(0, size - 1) : Range::Invalid();
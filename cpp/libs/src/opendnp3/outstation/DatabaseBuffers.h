@@ -22,6 +22,9 @@
 #define OPENDNP3_DATABASEBUFFERS_H
 
 #include "opendnp3/app/Range.h"
+#include "opendnp3/app/HandlerTable.h"
+#include "opendnp3/app/PackedBits.h"
+#include "opendnp3/StackStatistics.h"
 
 #include "opendnp3/gen/IndexMode.h"
 
@@ -35,6 +38,7 @@
 #include "opendnp3/outstation/IStaticSelector.h"
 #include "opendnp3/outstation/IClassAssigner.h"
 #include "opendnp3/outstation/StaticWriters.h"
+#include "opendnp3/outstation/CompactEncoding.h"
 
 namespace opendnp3
 {
@@ -46,7 +50,7 @@ class DatabaseBuffers final : public IStaticSelector, public IResponseLoader, pu
 {
 public:
 
-	DatabaseBuffers(const DatabaseSizes&, StaticTypeBitField allowedClass0Types, IndexMode indexMode);
+	DatabaseBuffers(const DatabaseSizes&, StaticTypeBitField allowedClass0Types, IndexMode indexMode, bool compactEncoding = false);
 
 	// ------- IStaticSelector -------------
 
@@ -72,16 +76,46 @@ public:
 	// stores the most revent values and event information
 	StaticBuffers buffers;
 
+	// bytes saved by compact encoding
+	StackStatistics::Compaction compaction;
+
 private:
 
+	typedef IINField(DatabaseBuffers::*SelectAllFun)();
+	typedef IINField(DatabaseBuffers::*SelectRangeFun)(const Range& range);
+
+	// selection functions for every static object that may be requested, indexed by handler slot
+	static HandlerTable<SelectAllFun> CreateSelectAllHandlers();
+	static HandlerTable<SelectRangeFun> CreateSelectRangeHandlers();
+
 	StaticTypeBitField class0;
 	IndexMode indexMode;
+	bool compactEncoding;
 
 	SelectedRanges ranges;
 
+	// binaries selected for Group1Var1 at their own index and their selected values, written a word at a time
+	PackedBits packedBinaries;
+	PackedBits packedBinaryValues;
+
 	template <class Spec>
 	bool LoadType(HeaderWriter& writer);
 
+	template <class Spec>
+	void RecordSelection(uint16_t index, const Cell<Spec>& cell) {}
+	void RecordSelection(uint16_t index, const Cell<BinarySpec>& cell);
+
+	/// @return true if a run of packed values beginning at range.start was written, otherwise the caller writes it
+	template <class Spec>
+	bool TryLoadPacked(openpal::ArrayView<Cell<Spec>, uint16_t>& view, HeaderWriter& writer, Range& range, bool& spaceRemaining)
+	{
+		return false;
+	}
+	bool TryLoadPacked(openpal::ArrayView<Cell<BinarySpec>, uint16_t>& view, HeaderWriter& writer, Range& range, bool& spaceRemaining);
+
+	template <class Spec>
+	bool LoadCompactRun(openpal::ArrayView<Cell<Spec>, uint16_t>& view, HeaderWriter& writer, Range& range);
+
 	template <class Spec>
 	void Deselect()
 	{
@@ -140,6 +174,12 @@ private:
 		return GenericSelect(RangeOf(view.Size()), view, false, variation);
 	}
 
+	template <class T, typename T::static_variation_t variation>
+	IINField SelectAllUsing()
+	{
+		return SelectAllUsing<T>(variation);
+	}
+
 	template <class T>
 	IINField SelectVirtualRange(const Range& range, bool usedefault, typename T::static_variation_t variation)
 	{
@@ -175,6 +215,12 @@ private:
 	{
 		return SelectVirtualRange<T>(range, false, variation);
 	}
+
+	template <class T, typename T::static_variation_t variation>
+	IINField SelectRangeUsing(const Range& range)
+	{
+		return SelectRangeUsing<T>(range, variation);
+	}
 };
 
 template <class T>
@@ -203,8 +249,11 @@ IINField DatabaseBuffers::GenericSelect(
 				{
 					view[i].selection.selected = true;
 					view[i].selection.value = view[i].value;
+					view[i].selection.compact = useDefault && this->compactEncoding;
 					auto var = useDefault ? view[i].config.svariation : variation;
-					view[i].selection.variation = CheckForPromotion<T>(view[i].selection.value, var);
+					// compact runs are promoted as a whole when they are loaded
+					view[i].selection.variation = view[i].selection.compact ? var : CheckForPromotion<T>(view[i].selection.value, var);
+					this->RecordSelection(i, view[i]);
 				}
 			}
 
@@ -236,7 +285,16 @@ bool DatabaseBuffers::LoadType(HeaderWriter& writer)
 	// ... load values, manipulate the range
 	while (spaceRemaining && range.IsValid())
 	{
-		if (view[range.start].selection.selected)
+		if (!view[range.start].selection.selected)
+		{
+			// just skip over values that are not selected
+			range.Advance();
+		}
+		else if (view[range.start].selection.compact)
+		{
+			spaceRemaining = this->LoadCompactRun(view, writer, range);
+		}
+		else if (!this->TryLoadPacked(view, writer, range, spaceRemaining))
 		{
 			/// lookup the specific write function based on the reporting variation
 			auto writeFun = StaticWriters::Get(view[range.start].selection.variation);
@@ -244,14 +302,77 @@ bool DatabaseBuffers::LoadType(HeaderWriter& writer)
 			// start writing a header, the invoked function will advance the range appropriately
 			spaceRemaining = writeFun(view, writer, range);
 		}
-		else
+	}
+
+	ranges.Set<T>(range);
+
+	return spaceRemaining;
+}
+
+template <class T>
+bool DatabaseBuffers::LoadCompactRun(openpal::ArrayView<Cell<T>, uint16_t>& view, HeaderWriter& writer, Range& range)
+{
+	// find the run of values that the writer would place in a single header
+	const auto configured = view[range.start].selection.variation;
+	const auto start = view[range.start].config.vIndex;
+	uint16_t nextIndex = start;
+	uint32_t end = range.start;
+	CompactEncoding::Needs needs;
+
+	while (
+	    (end <= range.stop) &&
+	    view[end].selection.selected &&
+	    view[end].selection.compact &&
+	    (view[end].selection.variation == configured) &&
+	    (view[end].config.vIndex == nextIndex)
+	)
+	{
+		CompactEncoding::Accumulate(needs, view[end].selection.value);
+		++end;
+		++nextIndex;
+	}
+
+	const auto variation = CompactEncoding::Select(configured, needs);
+	auto run = Range::From(range.start, static_cast<uint16_t>(end - 1));
+
+	for (uint32_t i = run.start; i <= run.stop; ++i)
+	{
+		view[i].selection.variation = variation;
+	}
+
+	// the writers choose the qualifier from the last index of the range they are given, so only give them this run
+	const bool wideQualifier = !Range::From(start, view[range.stop].config.vIndex).IsOneByte();
+	const bool narrowQualifier = Range::From(start, view[run.stop].config.vIndex).IsOneByte();
+
+	const auto writeFun = StaticWriters::Get(variation);
+	const bool spaceRemaining = writeFun(view, writer, run);
+	const uint32_t numWritten = run.IsValid() ? (run.start - range.start) : (end - range.start);
+
+	if (numWritten > 0)
+	{
+		const auto configuredSize = CompactEncoding::Size(configured, numWritten);
+		const auto compactSize = CompactEncoding::Size(variation, numWritten);
+		const uint32_t saved = ((configuredSize > compactSize) ? (configuredSize - compactSize) : 0) + ((wideQualifier && narrowQualifier) ? 2 : 0);
+
+		if (saved > 0)
 		{
-			// just skip over values that are not selected
-			range.Advance();
+			++this->compaction.numStaticHeaders;
+			this->compaction.numStaticBytesSaved += saved;
 		}
 	}
 
-	ranges.Set<T>(range);
+	if (run.IsValid())
+	{
+		range.start = run.start;
+	}
+	else if (end > range.stop)
+	{
+		range = Range::Invalid();
+	}
+	else
+	{
+		range.start = static_cast<uint16_t>(end);
+	}
 
 	return spaceRemaining;
 }
@@ -21,7 +21,9 @@
 #ifndef OPENDNP3_OUTSTATIONCHANNEL_STATES_H
 #define OPENDNP3_OUTSTATIONCHANNEL_STATES_H
 
+#include "opendnp3/app/EventType.h"
 #include "opendnp3/outstation/OutstationSeqNum.h"
+#include "opendnp3/outstation/UnsolicitedHold.h"
 #include "opendnp3/app/TxBuffer.h"
 
 #include <openpal/util/Uncopyable.h>
@@ -46,19 +48,44 @@ class OutstationUnsolState : private openpal::Uncopyable
 {
 public:
 
-	OutstationUnsolState(uint32_t maxTxSize) :
+	OutstationUnsolState(uint32_t maxTxSize, openpal::IExecutor& executor) :
 		completedNull(false),
-		tx(maxTxSize)
+		tx(maxTxSize),
+		class1(executor, statistics),
+		class2(executor, statistics),
+		class3(executor, statistics)
 	{}
 
 	void Reset()
 	{
 		completedNull = false;
+		class1.Reset();
+		class2.Reset();
+		class3.Reset();
+	}
+
+	UnsolicitedHold& GetHold(EventClass clazz)
+	{
+		switch (clazz)
+		{
+		case(EventClass::EC1):
+			return class1;
+		case(EventClass::EC2):
+			return class2;
+		default:
+			return class3;
+		}
 	}
 
 	bool completedNull;
 	OutstationSeqNum seq;
 	TxBuffer tx;
+	StackStatistics::Unsolicited statistics;
+
+	// hold state of each event class
+	UnsolicitedHold class1;
+	UnsolicitedHold class2;
+	UnsolicitedHold class3;
 };
 
 }
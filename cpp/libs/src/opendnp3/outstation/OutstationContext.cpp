@@ -41,6 +41,8 @@
 
 #include <openpal/logging/LogMacros.h>
 
+#include <initializer_list>
+
 using namespace openpal;
 
 namespace opendnp3
@@ -62,17 +64,19 @@ OContext::OContext(
 	lower(lower),
 	commandHandler(commandHandler),
 	application(application),
-	eventBuffer(config.eventBufferConfig),
-	database(dbSizes, eventBuffer, config.params.indexMode, config.params.typesAllowedInClass0),
+	eventBuffer(config.eventBufferConfig, executor.get()),
+	database(dbSizes, eventBuffer, config.params.indexMode, config.params.typesAllowedInClass0, executor.get(), config.params.compactEncoding),
 	rspContext(database.GetResponseLoader(), eventBuffer),
 	params(config.params),
 	isOnline(false),
 	isTransmitting(false),
 	staticIIN(IINBit::DEVICE_RESTART),
 	confirmTimer(*executor),
+	chatterTimer(*executor),
 	deferred(config.params.maxRxFragSize),
+	deferredConfirm(0), // confirms don't carry objects
 	sol(config.params.maxTxFragSize),
-	unsol(config.params.maxTxFragSize)
+	unsol(config.params.maxTxFragSize, *executor)
 {
 
 }
@@ -107,6 +111,7 @@ bool OContext::OnLowerLayerDown()
 	unsol.Reset();
 	history.Reset();
 	deferred.Reset();
+	deferredConfirm.Reset();
 	eventBuffer.Unselect();
 	rspContext.Reset();
 	confirmTimer.Cancel();
@@ -201,7 +206,14 @@ bool OContext::ProcessObjects(const ParsedRequest& request)
 	{
 		if (this->isTransmitting)
 		{
-			this->deferred.Set(request);
+			if (request.header.function == FunctionCode::CONFIRM)
+			{
+				this->deferredConfirm.Set(request);
+			}
+			else
+			{
+				this->deferred.Set(request);
+			}
 			return true;
 		}
 		else
@@ -241,6 +253,10 @@ bool OContext::ProcessConfirm(const ParsedRequest& request)
 void OContext::BeginResponseTx(uint16_t destination, const openpal::RSlice& data, const AppControlField& control)
 {
 	this->sol.tx.Record(control, data);
+	if (control.CON)
+	{
+		this->confirmTxTime = this->executor->GetTime();
+	}
 	this->BeginTx(destination, data);
 }
 
@@ -249,6 +265,7 @@ void OContext::BeginUnsolTx(const AppControlField& control, const RSlice& respon
 	this->unsol.tx.Record(control, response);
 	this->unsol.seq.confirmNum = this->unsol.seq.num;
 	this->unsol.seq.num.Increment();
+	this->confirmTxTime = this->executor->GetTime();
 	this->BeginTx(this->addresses.destination, response);
 }
 
@@ -266,6 +283,16 @@ void OContext::BeginTx(uint16_t destination, const openpal::RSlice& message)
 
 void OContext::CheckForDeferredRequest()
 {
+	// the confirm was received first, so it must be processed before any other deferred request
+	if (this->CanTransmit() && this->deferredConfirm.IsSet())
+	{
+		auto handler = [this](const ParsedRequest & request)
+		{
+			return this->ProcessConfirm(request);
+		};
+		this->deferredConfirm.Process(handler);
+	}
+
 	if (this->CanTransmit() && this->deferred.IsSet())
 	{
 		auto handler = [this](const ParsedRequest & request)
@@ -307,37 +334,97 @@ bool OContext::ProcessDeferredRequest(const ParsedRequest& request)
 
 void OContext::CheckForUnsolicited()
 {
-	if (this->CanTransmit() && this->state->IsIdle() && this->params.allowUnsolicited)
+	if (!this->params.allowUnsolicited)
+	{
+		return;
+	}
+
+	if (this->unsol.completedNull)
 	{
-		if (this->unsol.completedNull)
+		// hold times are started when events are first observed, even if we can't transmit yet
+		if (this->UpdateUnsolicitedHolds() && this->CanTransmit() && this->state->IsIdle())
 		{
-			// are there events to be reported?
-			if (this->params.unsolClassMask.Intersects(this->eventBuffer.UnwrittenClassField()))
-			{
+			this->BeginUnsolicitedEvents();
+		}
+	}
+	else if (this->CanTransmit() && this->state->IsIdle())
+	{
+		// send a NULL unsolcited message
+		auto response = this->unsol.tx.Start();
+		build::NullUnsolicited(response, this->unsol.seq.num, this->GetResponseIIN());
+		this->RestartConfirmTimer();
+		this->state = &StateUnsolicitedConfirmWait::Inst();
+		this->BeginUnsolTx(response.GetControl(), response.ToRSlice());
+	}
+}
 
-				auto response = this->unsol.tx.Start();
-				auto writer = response.GetWriter();
+bool OContext::UpdateUnsolicitedHolds()
+{
+	auto onExpiration = [this]()
+	{
+		this->CheckForTaskStart();
+	};
 
-				this->eventBuffer.Unselect();
-				this->eventBuffer.SelectAllByClass(this->params.unsolClassMask);
-				this->eventBuffer.Load(writer);
+	auto update = [&](EventClass clazz, const UnsolicitedTrigger & trigger) -> bool
+	{
+		auto& hold = this->unsol.GetHold(clazz);
 
-				build::NullUnsolicited(response, this->unsol.seq.num, this->GetResponseIIN());
-				this->RestartConfirmTimer();
-				this->state = &StateUnsolicitedConfirmWait::Inst();
-				this->BeginUnsolTx(response.GetControl(), response.ToRSlice());
-			}
+		if (!this->params.unsolClassMask.HasEventType(clazz))
+		{
+			hold.Reset();
+			return false;
 		}
-		else
+
+		return hold.Update(trigger, this->eventBuffer.NumUnwritten(clazz), onExpiration);
+	};
+
+	// every class is evaluated so that each one starts its own hold time
+	const bool class1 = update(EventClass::EC1, this->params.unsolClass1Trigger);
+	const bool class2 = update(EventClass::EC2, this->params.unsolClass2Trigger);
+	const bool class3 = update(EventClass::EC3, this->params.unsolClass3Trigger);
+
+	return class1 || class2 || class3;
+}
+
+void OContext::BeginUnsolicitedEvents()
+{
+	auto response = this->unsol.tx.Start();
+	auto writer = response.GetWriter();
+
+	// events of every enabled class are written, not just those of the classes that triggered the response
+	this->eventBuffer.Unselect();
+	this->eventBuffer.SelectAllByClass(this->params.unsolClassMask);
+
+	const auto numUnwritten = this->NumUnwrittenUnsolicitedEvents();
+	this->eventBuffer.Load(writer);
+	const auto numEvents = numUnwritten - this->NumUnwrittenUnsolicitedEvents();
+
+	++this->unsol.statistics.numFragments;
+	this->unsol.statistics.numEvents += numEvents;
+	this->unsol.statistics.eventsPerFragment.Record(numEvents);
+
+	for (auto clazz : { EventClass::EC1, EventClass::EC2, EventClass::EC3 })
+	{
+		this->unsol.GetHold(clazz).OnReport(this->eventBuffer.NumUnwritten(clazz) == 0);
+	}
+
+	build::NullUnsolicited(response, this->unsol.seq.num, this->GetResponseIIN());
+	this->RestartConfirmTimer();
+	this->state = &StateUnsolicitedConfirmWait::Inst();
+	this->BeginUnsolTx(response.GetControl(), response.ToRSlice());
+}
+
+uint32_t OContext::NumUnwrittenUnsolicitedEvents() const
+{
+	uint32_t count = 0;
+	for (auto clazz : { EventClass::EC1, EventClass::EC2, EventClass::EC3 })
+	{
+		if (this->params.unsolClassMask.HasEventType(clazz))
 		{
-			// send a NULL unsolcited message
-			auto response = this->unsol.tx.Start();
-			build::NullUnsolicited(response, this->unsol.seq.num, this->GetResponseIIN());
-			this->RestartConfirmTimer();
-			this->state = &StateUnsolicitedConfirmWait::Inst();
-			this->BeginUnsolTx(response.GetControl(), response.ToRSlice());
+			count += this->eventBuffer.NumUnwritten(clazz);
 		}
 	}
+	return count;
 }
 
 void OContext::RestartConfirmTimer()
@@ -351,6 +438,16 @@ void OContext::RestartConfirmTimer()
 	this->confirmTimer.Restart(this->params.unsolConfirmTimeout, timeout);
 }
 
+void OContext::RecordConfirm()
+{
+	this->latency.confirmRoundTrip.Record(this->executor->GetTime().milliseconds - this->confirmTxTime.milliseconds);
+}
+
+void OContext::ClearWrittenEvents()
+{
+	this->eventBuffer.ClearWritten(this->confirmTxTime, this->latency.eventToTransmit);
+}
+
 void OContext::RespondToNonReadRequest(const ParsedRequest& request)
 {
 	this->history.RecordLastProcessedRequest(request.header, request.objects);
@@ -495,11 +592,37 @@ bool OContext::ProcessMessage(const Message& message)
 
 void OContext::CheckForTaskStart()
 {
+	this->CheckForChatterResume();
+
 	// do these checks in order of priority
 	this->CheckForDeferredRequest();
 	this->CheckForUnsolicited();
 }
 
+void OContext::CheckForChatterResume()
+{
+	const auto resume = this->database.GetChatterResumeTime();
+
+	if (resume.IsMax())
+	{
+		this->chatterTimer.Cancel();
+		return;
+	}
+
+	if (this->chatterTimer.IsActive() && !(resume < this->chatterTimer.ExpiresAt()))
+	{
+		return;
+	}
+
+	auto expired = [this]()
+	{
+		this->database.ResumeChatterFilters();
+		this->CheckForTaskStart();
+	};
+
+	this->chatterTimer.Restart(resume, expired);
+}
+
 void OContext::SetRestartIIN()
 {
 	this->staticIIN.SetBit(IINBit::DEVICE_RESTART);
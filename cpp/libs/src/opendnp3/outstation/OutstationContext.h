@@ -22,6 +22,7 @@
 #define OPENDNP3_OUTSTATIONCONTEXT_H
 
 #include "opendnp3/LayerInterfaces.h"
+#include "opendnp3/StackStatistics.h"
 
 #include "opendnp3/gen/SecurityStatIndex.h"
 
@@ -92,6 +93,31 @@ public:
 
 	void SetRestartIIN();
 
+	const StackStatistics::Latency& GetLatencyStatistics() const
+	{
+		return latency;
+	}
+
+	const StackStatistics::Unsolicited& GetUnsolicitedStatistics() const
+	{
+		return unsol.statistics;
+	}
+
+	const StackStatistics::Compaction& GetCompactionStatistics() const
+	{
+		return database.GetCompactionStatistics();
+	}
+
+	bool ConfigureChatterFilter(EventType type, uint16_t index, const ChatterFilterConfig& config)
+	{
+		return database.ConfigureChatterFilter(type, index, config);
+	}
+
+	ChatterFilterStatistics GetChatterStatistics(uint16_t maxPoints)
+	{
+		return database.GetChatterStatistics(maxPoints);
+	}
+
 private:
 
 	/// ---- Helper functions that operate on the current state, and may return a new state ----
@@ -132,8 +158,22 @@ private:
 
 	void RestartConfirmTimer();
 
+	void RecordConfirm();
+
+	void ClearWrittenEvents();
+
 	void CheckForUnsolicited();
 
+	void CheckForChatterResume();
+
+	/// Evaluate the unsolicited trigger of each class
+	/// @return true if any class enabled for unsolicited reporting has events that should be reported now
+	bool UpdateUnsolicitedHolds();
+
+	void BeginUnsolicitedEvents();
+
+	uint32_t NumUnwrittenUnsolicitedEvents() const;
+
 	bool CanTransmit() const;
 
 	IINField GetResponseIIN();
@@ -185,9 +225,16 @@ private:
 	bool isTransmitting;
 	IINField staticIIN;
 	openpal::TimerRef confirmTimer;
+	openpal::TimerRef chatterTimer;
+	openpal::MonotonicTimestamp confirmTxTime;
+	StackStatistics::Latency latency;
 	RequestHistory history;
 	DeferredRequest deferred;
 
+	// a confirm that arrived before the transmission it confirms completed, kept apart from
+	// the deferred request so that a request which follows the confirm can't overwrite it
+	DeferredRequest deferredConfirm;
+
 	// ------ Dynamic state related to controls ------
 	ControlState control;
 
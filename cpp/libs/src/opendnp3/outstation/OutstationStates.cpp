@@ -99,7 +99,8 @@ OutstationState& StateSolicitedConfirmWait::OnConfirm(OContext& ctx, const Parse
 
 	ctx.history.Reset(); // any time we get a confirm we can treat any request as a new request
 	ctx.confirmTimer.Cancel();
-	ctx.eventBuffer.ClearWritten();
+	ctx.RecordConfirm();
+	ctx.ClearWrittenEvents();
 
 	if (ctx.rspContext.HasSelection())
 	{
@@ -173,10 +174,14 @@ OutstationState& StateUnsolicitedConfirmWait::OnConfirm(OContext& ctx, const Par
 
 	ctx.history.Reset(); // any time we get a confirm we can treat any request as a new request
 	ctx.confirmTimer.Cancel();
+	ctx.RecordConfirm();
 
 	if (ctx.unsol.completedNull)
 	{
-		ctx.eventBuffer.ClearWritten();
+		ctx.ClearWrittenEvents();
+		ctx.unsol.class1.OnConfirm();
+		ctx.unsol.class2.OnConfirm();
+		ctx.unsol.class3.OnConfirm();
 	}
 	else
 	{
@@ -193,6 +198,9 @@ OutstationState& StateUnsolicitedConfirmWait::OnConfirmTimeout(OContext& ctx)
 	if (ctx.unsol.completedNull)
 	{
 		ctx.eventBuffer.Unselect();
+		ctx.unsol.class1.OnConfirmTimeout();
+		ctx.unsol.class2.OnConfirmTimeout();
+		ctx.unsol.class3.OnConfirmTimeout();
 	}
 
 	return StateIdle::Inst();
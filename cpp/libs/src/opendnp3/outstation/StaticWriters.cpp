@@ -39,30 +39,38 @@ namespace opendnp3
 template <class Spec, class IndexType >
 bool LoadWithRangeIterator(openpal::ArrayView<Cell<Spec>, uint16_t>& view, RangeWriteIterator<IndexType, typename Spec::meas_t>& iterator, Range& range)
 {
+	if (!range.IsValid())
+	{
+		return true;
+	}
+
+	// measure the run of selected values with the same variation and consecutive virtual indices up front
 	const Cell<Spec>& start = view[range.start];
-	uint16_t nextIndex = start.config.vIndex;
+	const uint32_t first = range.start;
+	uint32_t count = 0;
 
 	while (
-	    range.IsValid() &&
-	    view[range.start].selection.selected &&
-	    (view[range.start].selection.variation == start.selection.variation) &&
-	    (view[range.start].config.vIndex == nextIndex)
+	    (first + count) <= range.stop &&
+	    view[first + count].selection.selected &&
+	    (view[first + count].selection.variation == start.selection.variation) &&
+	    (view[first + count].config.vIndex == start.config.vIndex + count)
 	)
 	{
-		if (iterator.Write(view[range.start].selection.value))
-		{
-			// deselect the value and advance the range
-			view[range.start].selection.selected = false;
-			range.Advance();
-			++nextIndex;
-		}
-		else
-		{
-			return false;
-		}
+		++count;
 	}
 
-	return true;
+	// serialize as much of the run as fits in a single pass
+	const openpal::StridedView<typename Spec::meas_t> values(&start.selection.value, sizeof(Cell<Spec>));
+	const uint32_t written = iterator.WriteMany(values, count);
+
+	// deselect the written values and advance the range
+	for (uint32_t i = 0; i < written; ++i)
+	{
+		view[first + i].selection.selected = false;
+		range.Advance();
+	}
+
+	return written == count;
 }
 
 template <class Spec, class IndexType>
@@ -0,0 +1,131 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_UNSOLICITEDHOLD_H
+#define OPENDNP3_UNSOLICITEDHOLD_H
+
+#include "opendnp3/StackStatistics.h"
+#include "opendnp3/outstation/UnsolicitedTrigger.h"
+
+#include <openpal/executor/TimerRef.h>
+#include <openpal/util/Uncopyable.h>
+
+namespace opendnp3
+{
+
+/**
+* Tracks the hold time of the unreported events of a single class
+*/
+class UnsolicitedHold : private openpal::Uncopyable
+{
+public:
+
+	UnsolicitedHold(openpal::IExecutor& executor, StackStatistics::Unsolicited& statistics) :
+		statistics(&statistics),
+		timer(executor)
+	{}
+
+	/**
+	* Evaluate the trigger against the current number of unreported events, starting the hold timer if required
+	*
+	* @param onExpiration action invoked if the hold timer expires
+	* @return true if the events of the class should be reported now
+	*/
+	template <class Lambda>
+	bool Update(const UnsolicitedTrigger& trigger, uint32_t numUnwritten, const Lambda& onExpiration)
+	{
+		if (numUnwritten == 0)
+		{
+			// nothing left to report, unless the reported events are still awaiting confirmation
+			if (!pending)
+			{
+				this->Reset();
+			}
+			return false;
+		}
+
+		if (triggered || !trigger.holdTime.IsPostive())
+		{
+			return true;
+		}
+
+		if (trigger.maxEvents > 0 && numUnwritten >= trigger.maxEvents)
+		{
+			++statistics->numEventThresholdReached;
+			this->timer.Cancel();
+			this->triggered = true;
+			return true;
+		}
+
+		auto expired = [this, onExpiration]()
+		{
+			++statistics->numHoldTimeExpired;
+			this->triggered = true;
+			onExpiration();
+		};
+
+		this->timer.Start(trigger.holdTime, expired);
+
+		return false;
+	}
+
+	/// Called when an unsolicited fragment is sent. If every event of the class was written, the hold ends once it is confirmed
+	void OnReport(bool allWritten)
+	{
+		this->pending = this->triggered && allWritten;
+	}
+
+	/// Called when an unsolicited fragment is confirmed. Events that arrived in the meantime start a new hold
+	void OnConfirm()
+	{
+		if (pending)
+		{
+			this->Reset();
+		}
+	}
+
+	/// Called when an unsolicited confirm times out. The events are retried without waiting for another hold time
+	void OnConfirmTimeout()
+	{
+		this->pending = false;
+	}
+
+	void Reset()
+	{
+		this->timer.Cancel();
+		this->triggered = false;
+		this->pending = false;
+	}
+
+private:
+
+	StackStatistics::Unsolicited* statistics;
+	openpal::TimerRef timer;
+
+	// the hold time has ended and the events of the class are reported as soon as possible
+	bool triggered = false;
+
+	// the class was completely written into a fragment that has not been confirmed yet
+	bool pending = false;
+};
+
+}
+
+#endif
@@ -25,7 +25,9 @@
 namespace opendnp3
 {
 
-EventBuffer::EventBuffer(const EventBufferConfig& config) : storage(config)
+EventBuffer::EventBuffer(const EventBufferConfig& config, openpal::IMonotonicTimeSource* clock) :
+	clock(clock),
+	storage(config)
 {}
 
 
@@ -213,6 +215,11 @@ ClassField EventBuffer::UnwrittenClassField() const
 	       );
 }
 
+uint32_t EventBuffer::NumUnwritten(EventClass clazz) const
+{
+	return storage.NumUnwritten(clazz);
+}
+
 bool EventBuffer::IsOverflown()
 {
 	if (overflow && !this->storage.IsAnyTypeFull())
@@ -233,4 +240,9 @@ void EventBuffer::ClearWritten()
 	this->storage.ClearWritten();
 }
 
+void EventBuffer::ClearWritten(const openpal::MonotonicTimestamp& transmitted, LatencyHistogram& latency)
+{
+	this->storage.ClearWritten(transmitted, latency);
+}
+
 }
@@ -27,6 +27,8 @@
 #include "opendnp3/outstation/EventBufferConfig.h"
 #include "opendnp3/app/ClassField.h"
 
+#include <openpal/executor/IMonotonicTimeSource.h>
+
 #include "EventStorage.h"
 
 namespace opendnp3
@@ -47,7 +49,11 @@ class EventBuffer final : public IEventReceiver, public IEventSelector, public I
 
 public:
 
-	explicit EventBuffer(const EventBufferConfig& config);
+	/**
+	* @param config maximum number of events of each type
+	* @param clock optional time source used to timestamp events for latency measurement
+	*/
+	explicit EventBuffer(const EventBufferConfig& config, openpal::IMonotonicTimeSource* clock = nullptr);
 
 	// ------- IEventReceiver ------
 
@@ -78,8 +84,13 @@ public:
 
 	void ClearWritten(); // called when a transmission succeeds
 
+	// called when a transmission succeeds, recording the latency of each removed event
+	void ClearWritten(const openpal::MonotonicTimestamp& transmitted, LatencyHistogram& latency);
+
 	ClassField UnwrittenClassField() const;
 
+	uint32_t NumUnwritten(EventClass clazz) const;
+
 	bool IsOverflown();
 
 	void SelectAllByClass(const ClassField& clazz);
@@ -87,6 +98,7 @@ public:
 private:
 
 	bool overflow = false;
+	openpal::IMonotonicTimeSource* clock;
 	EventStorage storage;
 
 	IINField SelectMaxCount(GroupVariation gv, uint32_t maximum);
@@ -101,7 +113,7 @@ private:
 	template <class T>
 	void UpdateAny(const Event<T>& evt)
 	{
-		if (this->storage.Update(evt))
+		if (this->storage.Update(evt, this->clock ? this->clock->GetTime() : openpal::MonotonicTimestamp()))
 		{
 			this->overflow = true;
 		}
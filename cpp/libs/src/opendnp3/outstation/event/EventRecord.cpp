@@ -26,11 +26,13 @@ namespace opendnp3
 
 EventRecord::EventRecord(
     uint16_t index,
-    EventClass clazz
+    EventClass clazz,
+    const openpal::MonotonicTimestamp& created
 ) :
 
 	index(index),
-	clazz(clazz)
+	clazz(clazz),
+	created(created)
 {}
 
 }
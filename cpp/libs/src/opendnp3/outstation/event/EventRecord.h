@@ -24,6 +24,8 @@
 
 #include "opendnp3/app/EventType.h"
 
+#include <openpal/executor/MonotonicTimestamp.h>
+
 #include "IEventType.h"
 #include "EventState.h"
 
@@ -40,12 +42,15 @@ class EventRecord
 public:
 
 	EventRecord() = default;
-	EventRecord(uint16_t index, EventClass clazz);
+	EventRecord(uint16_t index, EventClass clazz, const openpal::MonotonicTimestamp& created);
 
 	uint16_t index = 0;
 	EventClass clazz = EventClass::EC1;
 	EventState state = EventState::unselected;
 
+	// when the event was added to the buffer
+	openpal::MonotonicTimestamp created;
+
 	// always set as a unit
 	IEventType* type = nullptr;
 	void* storage_node = nullptr;
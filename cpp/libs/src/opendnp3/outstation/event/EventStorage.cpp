@@ -47,44 +47,44 @@ uint32_t EventStorage::NumUnwritten(EventClass clazz) const
 	return this->state.counters.total.Get(clazz) - this->state.counters.written.Get(clazz);
 }
 
-bool EventStorage::Update(const Event<BinarySpec>& evt)
+bool EventStorage::Update(const Event<BinarySpec>& evt, const openpal::MonotonicTimestamp& created)
 {
-	return EventUpdate::Update(state, evt);
+	return EventUpdate::Update(state, evt, created);
 }
 
-bool EventStorage::Update(const Event<DoubleBitBinarySpec>& evt)
+bool EventStorage::Update(const Event<DoubleBitBinarySpec>& evt, const openpal::MonotonicTimestamp& created)
 {
-	return EventUpdate::Update(state, evt);
+	return EventUpdate::Update(state, evt, created);
 }
 
-bool EventStorage::Update(const Event<AnalogSpec>& evt)
+bool EventStorage::Update(const Event<AnalogSpec>& evt, const openpal::MonotonicTimestamp& created)
 {
-	return EventUpdate::Update(state, evt);
+	return EventUpdate::Update(state, evt, created);
 }
 
-bool EventStorage::Update(const Event<CounterSpec>& evt)
+bool EventStorage::Update(const Event<CounterSpec>& evt, const openpal::MonotonicTimestamp& created)
 {
-	return EventUpdate::Update(state, evt);
+	return EventUpdate::Update(state, evt, created);
 }
 
-bool EventStorage::Update(const Event<FrozenCounterSpec>& evt)
+bool EventStorage::Update(const Event<FrozenCounterSpec>& evt, const openpal::MonotonicTimestamp& created)
 {
-	return EventUpdate::Update(state, evt);
+	return EventUpdate::Update(state, evt, created);
 }
 
-bool EventStorage::Update(const Event<BinaryOutputStatusSpec>& evt)
+bool EventStorage::Update(const Event<BinaryOutputStatusSpec>& evt, const openpal::MonotonicTimestamp& created)
 {
-	return EventUpdate::Update(state, evt);
+	return EventUpdate::Update(state, evt, created);
 }
 
-bool EventStorage::Update(const Event<AnalogOutputStatusSpec>& evt)
+bool EventStorage::Update(const Event<AnalogOutputStatusSpec>& evt, const openpal::MonotonicTimestamp& created)
 {
-	return EventUpdate::Update(state, evt);
+	return EventUpdate::Update(state, evt, created);
 }
 
-bool EventStorage::Update(const Event<OctetStringSpec>& evt)
+bool EventStorage::Update(const Event<OctetStringSpec>& evt, const openpal::MonotonicTimestamp& created)
 {
-	return EventUpdate::Update(state, evt);
+	return EventUpdate::Update(state, evt, created);
 }
 
 uint32_t EventStorage::SelectByType(EventBinaryVariation variation, uint32_t max)
@@ -204,6 +204,26 @@ uint32_t EventStorage::ClearWritten()
 	return this->state.events.RemoveAll(written);
 }
 
+uint32_t EventStorage::ClearWritten(const openpal::MonotonicTimestamp& transmitted, LatencyHistogram& latency)
+{
+	auto written = [this, &transmitted, &latency](EventRecord & record) -> bool
+	{
+		if (record.state == EventState::written)
+		{
+			latency.Record(transmitted.milliseconds - record.created.milliseconds);
+			record.type->RemoveTypeFromStorage(record, this->state);
+			this->state.counters.OnRemove(record.clazz, record.state);
+			return true;
+		}
+		else
+		{
+			return false;
+		}
+	};
+
+	return this->state.events.RemoveAll(written);
+}
+
 void EventStorage::Unselect()
 {
 	auto clear = [](EventRecord& record) -> void
@@ -23,6 +23,7 @@
 
 #include "opendnp3/outstation/Event.h"
 #include "opendnp3/app/ClassField.h"
+#include "opendnp3/LatencyHistogram.h"
 
 #include "IEventWriteHandler.h"
 #include "EventLists.h"
@@ -60,19 +61,22 @@ public:
 	// all written events go back to unselected state
 	uint32_t ClearWritten();
 
+	// same as above, but also records the time from their creation until the transmission that delivered them
+	uint32_t ClearWritten(const openpal::MonotonicTimestamp& transmitted, LatencyHistogram& latency);
+
 	// all written and selected events are reverted to unselected state
 	void Unselect();
 
 	// ---- these functions return true if an overflow occurs ----
 
-	bool Update(const Event<BinarySpec>& evt);
-	bool Update(const Event<DoubleBitBinarySpec>& evt);
-	bool Update(const Event<AnalogSpec>& evt);
-	bool Update(const Event<CounterSpec>& evt);
-	bool Update(const Event<FrozenCounterSpec>& evt);
-	bool Update(const Event<BinaryOutputStatusSpec>& evt);
-	bool Update(const Event<AnalogOutputStatusSpec>& evt);
-	bool Update(const Event<OctetStringSpec>& evt);
+	bool Update(const Event<BinarySpec>& evt, const openpal::MonotonicTimestamp& created = openpal::MonotonicTimestamp());
+	bool Update(const Event<DoubleBitBinarySpec>& evt, const openpal::MonotonicTimestamp& created = openpal::MonotonicTimestamp());
+	bool Update(const Event<AnalogSpec>& evt, const openpal::MonotonicTimestamp& created = openpal::MonotonicTimestamp());
+	bool Update(const Event<CounterSpec>& evt, const openpal::MonotonicTimestamp& created = openpal::MonotonicTimestamp());
+	bool Update(const Event<FrozenCounterSpec>& evt, const openpal::MonotonicTimestamp& created = openpal::MonotonicTimestamp());
+	bool Update(const Event<BinaryOutputStatusSpec>& evt, const openpal::MonotonicTimestamp& created = openpal::MonotonicTimestamp());
+	bool Update(const Event<AnalogOutputStatusSpec>& evt, const openpal::MonotonicTimestamp& created = openpal::MonotonicTimestamp());
+	bool Update(const Event<OctetStringSpec>& evt, const openpal::MonotonicTimestamp& created = openpal::MonotonicTimestamp());
 
 	// ---- function used to select distinct types ----
 
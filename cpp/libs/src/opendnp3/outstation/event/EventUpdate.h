@@ -32,11 +32,11 @@ namespace opendnp3
 struct EventUpdate : private openpal::StaticOnly
 {
 	template <class T>
-	static bool Update(EventLists& lists, const Event<T>& event);
+	static bool Update(EventLists& lists, const Event<T>& event, const openpal::MonotonicTimestamp& created);
 };
 
 template <class T>
-bool EventUpdate::Update(EventLists& lists, const Event<T>& event)
+bool EventUpdate::Update(EventLists& lists, const Event<T>& event, const openpal::MonotonicTimestamp& created)
 {
 	auto& list = lists.GetList<T>();
 
@@ -66,7 +66,8 @@ bool EventUpdate::Update(EventLists& lists, const Event<T>& event)
 	const auto record_node = lists.events.Add(
 	                             EventRecord(
 	                                 event.index,
-	                                 event.clazz
+	                                 event.clazz,
+	                                 created
 	                             )
 	                         );
 
@@ -58,24 +58,80 @@ public:
 
 private:
 
+	/**
+	* Accepts events while they fit in the space remaining after the header was started
+	* and serializes them to the iterator in batches
+	*/
+	template <class T>
+	class EventBatch
+	{
+		static const uint32_t MAX_BATCH = 32;
+
+		PrefixedWriteIterator<openpal::UInt16, T>& iterator;
+		uint32_t capacity;
+		uint32_t num;
+
+		T values[MAX_BATCH];
+		uint16_t indices[MAX_BATCH];
+
+	public:
+
+		EventBatch(PrefixedWriteIterator<openpal::UInt16, T>& iterator) :
+			iterator(iterator),
+			capacity(iterator.Remaining()),
+			num(0)
+		{}
+
+		bool Add(const T& meas, uint16_t index)
+		{
+			if (capacity == 0) return false;
+
+			values[num] = meas;
+			indices[num] = index;
+			++num;
+			--capacity;
+
+			if (num == MAX_BATCH)
+			{
+				this->Flush();
+			}
+
+			return true;
+		}
+
+		void Flush()
+		{
+			iterator.WriteMany(openpal::StridedView<T>(values), indices, num);
+			num = 0;
+		}
+	};
+
 	template <class T>
 	class BasicEventWriter final : public IEventWriter<T>
 	{
 		PrefixedWriteIterator<openpal::UInt16, T> iterator;
+		EventBatch<T> batch;
 
 	public:
 
 		BasicEventWriter(HeaderWriter& writer, const DNP3Serializer<T>& serializer) :
 			iterator(
 			    writer.IterateOverCountWithPrefix<openpal::UInt16, T>(QualifierCode::UINT16_CNT_UINT16_INDEX, serializer)
-			)
+			),
+			batch(iterator)
 		{
 
 		}
 
+		~BasicEventWriter()
+		{
+			// must be serialized before the iterator writes the count
+			batch.Flush();
+		}
+
 		virtual bool Write(const T& meas, uint16_t index) override
 		{
-			return iterator.IsValid() ? iterator.Write(meas, index) : false;
+			return batch.Add(meas, index);
 		}
 	};
 
@@ -84,6 +140,7 @@ private:
 	{
 		const DNPTime cto;
 		PrefixedWriteIterator<openpal::UInt16, T> iterator;
+		EventBatch<T> batch;
 
 	public:
 
@@ -91,15 +148,19 @@ private:
 			cto(cto.time),
 			iterator(
 			    writer.IterateOverCountWithPrefixAndCTO<openpal::UInt16, T, U>(QualifierCode::UINT16_CNT_UINT16_INDEX, serializer, cto)
-			)
+			),
+			batch(iterator)
 		{
 
 		}
 
-		virtual bool Write(const T& meas, uint16_t index) override
+		~CTOEventWriter()
 		{
+			batch.Flush();
+		}
 
-			if (!this->iterator.IsValid()) return false;
+		virtual bool Write(const T& meas, uint16_t index) override
+		{
 
 			// can't encode timestamps that go backwards
 			if (meas.time < this->cto.value) return false;
@@ -112,7 +173,7 @@ private:
 			auto copy = meas;
 			copy.time.value = diff;
 
-			return this->iterator.Write(copy, index);
+			return this->batch.Add(copy, index);
 		}
 	};
 };
@@ -43,6 +43,14 @@ TransportLayer::TransportLayer(const openpal::Logger& logger, uint32_t maxRxFrag
 
 }
 
+TransportLayer::TransportLayer(const openpal::Logger& logger, const std::shared_ptr<openpal::Buffer>& rxBuffer) :
+	logger(logger),
+	receiver(logger, rxBuffer),
+	transmitter(logger)
+{
+
+}
+
 ///////////////////////////////////////
 // Actions
 ///////////////////////////////////////
@@ -44,6 +44,8 @@ public:
 
 	TransportLayer(const openpal::Logger& logger, uint32_t maxRxFragSize);
 
+	TransportLayer(const openpal::Logger& logger, const std::shared_ptr<openpal::Buffer>& rxBuffer);
+
 	// ------ ILowerLayer ------
 
 	virtual bool BeginTransmit(const Message& message) override;
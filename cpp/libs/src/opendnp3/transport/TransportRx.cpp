@@ -37,7 +37,15 @@ namespace opendnp3
 
 TransportRx::TransportRx(const Logger& logger, uint32_t maxRxFragSize) :
 	logger(logger),
-	rxBuffer(maxRxFragSize),
+	rxBuffer(std::make_shared<openpal::Buffer>(maxRxFragSize)),
+	numBytesRead(0)
+{
+
+}
+
+TransportRx::TransportRx(const Logger& logger, const std::shared_ptr<openpal::Buffer>& rxBuffer) :
+	logger(logger),
+	rxBuffer(rxBuffer),
 	numBytesRead(0)
 {
 
@@ -55,7 +63,7 @@ void TransportRx::ClearRxBuffer()
 
 openpal::WSlice TransportRx::GetAvailable()
 {
-	return rxBuffer.GetWSlice().Skip(numBytesRead);
+	return rxBuffer->GetWSlice().Skip(numBytesRead);
 }
 
 Message TransportRx::ProcessReceive(const Message& segment)
@@ -136,7 +144,7 @@ Message TransportRx::ProcessReceive(const Message& segment)
 
 	if(header.fin)
 	{
-		const auto ret = rxBuffer.ToRSlice().Take(numBytesRead);
+		const auto ret = rxBuffer->ToRSlice().Take(numBytesRead);
 		this->numBytesRead = 0;
 		return Message(segment.addresses, ret);
 	}
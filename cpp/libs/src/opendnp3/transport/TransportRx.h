@@ -28,6 +28,8 @@
 
 #include <openpal/container/RSlice.h>
 #include <openpal/container/Buffer.h>
+
+#include <memory>
 #include <openpal/logging/Logger.h>
 
 namespace opendnp3
@@ -43,6 +45,9 @@ public:
 
 	TransportRx(const openpal::Logger&, uint32_t maxRxFragSize);
 
+	/// Reassemble into a buffer supplied by the caller, e.g. one recycled from a pool. The buffer size is the maximum fragment size.
+	TransportRx(const openpal::Logger&, const std::shared_ptr<openpal::Buffer>& rxBuffer);
+
 	Message ProcessReceive(const Message& segment);
 
 	void Reset();
@@ -61,7 +66,7 @@ private:
 	openpal::Logger logger;
 	StackStatistics::Transport::Rx statistics;
 
-	openpal::Buffer rxBuffer;
+	const std::shared_ptr<openpal::Buffer> rxBuffer;
 	uint32_t numBytesRead;
 	Addresses lastAddresses;
 
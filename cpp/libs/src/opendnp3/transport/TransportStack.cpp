@@ -38,4 +38,17 @@ TransportStack::TransportStack(
 	transport->SetLinkLayer(*link);
 }
 
+TransportStack::TransportStack(
+    const openpal::Logger& logger,
+    const std::shared_ptr<openpal::IExecutor>& executor,
+    const std::shared_ptr<opendnp3::ILinkListener>& listener,
+    const std::shared_ptr<openpal::Buffer>& rxBuffer,
+    const LinkLayerConfig& config
+) :
+	transport(std::make_shared<TransportLayer>(logger, rxBuffer)),
+	link(std::make_shared<LinkLayer>(logger, executor, transport, listener, config))
+{
+	transport->SetLinkLayer(*link);
+}
+
 }
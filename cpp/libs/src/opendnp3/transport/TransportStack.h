@@ -41,6 +41,14 @@ public:
 	    const LinkLayerConfig& config
 	);
 
+	TransportStack(
+	    const openpal::Logger& logger,
+	    const std::shared_ptr<openpal::IExecutor>& executor,
+	    const std::shared_ptr<opendnp3::ILinkListener>& listener,
+	    const std::shared_ptr<openpal::Buffer>& rxBuffer,
+	    const LinkLayerConfig& config
+	);
+
 	std::shared_ptr<TransportLayer> transport;
 	std::shared_ptr<LinkLayer> link;
 };
@@ -40,6 +40,11 @@ TimeDuration TimeDuration::Zero()
 	return TimeDuration(0);
 }
 
+bool TimeDuration::IsPostive() const
+{
+	return milliseconds > 0;
+}
+
 TimeDuration TimeDuration::Milliseconds(int64_t milliseconds)
 {
 	return TimeDuration(milliseconds);
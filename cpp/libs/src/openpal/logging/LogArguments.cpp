@@ -0,0 +1,282 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "openpal/logging/LogArguments.h"
+
+#include <cstdio>
+
+namespace openpal
+{
+
+namespace
+{
+
+struct Argument
+{
+	bool valid = false;
+	LogArgKind kind = LogArgKind::Signed;
+	uint8_t size = 0;
+	uint64_t value = 0;
+	std::string text;
+};
+
+bool ReadArgument(RSlice& input, Argument& arg)
+{
+	arg.valid = false;
+
+	if (input.IsEmpty())
+	{
+		return false;
+	}
+
+	const uint8_t tag = input[0];
+	input.Advance(1);
+
+	arg.kind = static_cast<LogArgKind>(tag >> 4);
+	arg.size = tag & 0x0F;
+
+	if (input.Size() < arg.size)
+	{
+		input.Clear();
+		return false;
+	}
+
+	if (arg.kind == LogArgKind::String)
+	{
+		// strings use the low nibble as a flag and are prefixed with a 1-byte length
+		if (input.IsEmpty() || input.Size() < (1u + input[0]))
+		{
+			input.Clear();
+			return false;
+		}
+		const uint8_t length = input[0];
+		arg.text.assign(reinterpret_cast<const char*>(static_cast<const uint8_t*>(input) + 1), length);
+		input.Advance(1 + length);
+	}
+	else
+	{
+		arg.value = 0;
+		for (uint8_t i = 0; i < arg.size; ++i)
+		{
+			arg.value |= static_cast<uint64_t>(input[i]) << (8 * i);
+		}
+		input.Advance(arg.size);
+	}
+
+	arg.valid = true;
+	return true;
+}
+
+int64_t AsSigned(const Argument& arg)
+{
+	if (arg.kind == LogArgKind::Signed && arg.size > 0 && arg.size < 8)
+	{
+		// sign extend from the native width
+		const auto shift = 64 - 8 * arg.size;
+		return static_cast<int64_t>(arg.value << shift) >> shift;
+	}
+	return static_cast<int64_t>(arg.value);
+}
+
+double AsDouble(const Argument& arg)
+{
+	if (arg.kind == LogArgKind::Float)
+	{
+		double value;
+		memcpy(&value, &arg.value, sizeof(value));
+		return value;
+	}
+	return static_cast<double>(AsSigned(arg));
+}
+
+template <class T>
+void Append(std::string& output, const std::string& spec, T value)
+{
+	char buffer[128];
+	const int size = snprintf(buffer, sizeof(buffer), spec.c_str(), value);
+	if (size > 0)
+	{
+		output.append(buffer, (static_cast<size_t>(size) < sizeof(buffer)) ? size : (sizeof(buffer) - 1));
+	}
+}
+
+bool IsFlag(char c)
+{
+	return c == '-' || c == '+' || c == ' ' || c == '#' || c == '0';
+}
+
+bool IsDigit(char c)
+{
+	return c >= '0' && c <= '9';
+}
+
+bool IsLength(char c)
+{
+	return c == 'h' || c == 'l' || c == 'L' || c == 'z' || c == 'j' || c == 't' || c == 'q';
+}
+
+}
+
+bool LogArguments::WriteInteger(WSlice& dest, LogArgKind kind, uint64_t value, uint8_t size)
+{
+	if (dest.Size() < (1u + size))
+	{
+		return false;
+	}
+
+	dest[0] = static_cast<uint8_t>((static_cast<uint8_t>(kind) << 4) | size);
+	for (uint8_t i = 0; i < size; ++i)
+	{
+		dest[1 + i] = static_cast<uint8_t>(value >> (8 * i));
+	}
+	dest.Advance(1 + size);
+	return true;
+}
+
+bool LogArguments::WriteString(WSlice& dest, const char* value)
+{
+	if (!value)
+	{
+		value = "(null)";
+	}
+
+	const auto length = strnlen(value, 255);
+	if (dest.Size() < (2 + length))
+	{
+		return false;
+	}
+
+	dest[0] = static_cast<uint8_t>(static_cast<uint8_t>(LogArgKind::String) << 4);
+	dest[1] = static_cast<uint8_t>(length);
+	memcpy(static_cast<uint8_t*>(dest) + 2, value, length);
+	dest.Advance(static_cast<uint32_t>(2 + length));
+	return true;
+}
+
+void LogArguments::Render(const char* format, RSlice arguments, std::string& output)
+{
+	const char* pos = format;
+
+	while (*pos)
+	{
+		if (*pos != '%')
+		{
+			output.push_back(*pos);
+			++pos;
+			continue;
+		}
+
+		if (pos[1] == '%')
+		{
+			output.push_back('%');
+			pos += 2;
+			continue;
+		}
+
+		// rebuild the conversion spec with a length modifier that matches the widened argument
+		std::string spec("%");
+		++pos;
+		while (IsFlag(*pos))
+		{
+			spec.push_back(*pos++);
+		}
+		while (IsDigit(*pos) || *pos == '.')
+		{
+			spec.push_back(*pos++);
+		}
+		while (IsLength(*pos))
+		{
+			++pos;
+		}
+
+		const char conversion = *pos;
+		if (!conversion)
+		{
+			break;
+		}
+		++pos;
+
+		Argument arg;
+		ReadArgument(arguments, arg);
+
+		if (!arg.valid)
+		{
+			output.append("<?>");
+			continue;
+		}
+
+		switch (conversion)
+		{
+		case('d'):
+		case('i'):
+			spec.append("ll");
+			spec.push_back(conversion);
+			Append(output, spec, static_cast<long long>(AsSigned(arg)));
+			break;
+		case('u'):
+		case('o'):
+		case('x'):
+		case('X'):
+			{
+				// unsigned conversions of signed values wrap at the native width, i.e. %u of (int) -1
+				const uint64_t mask = (arg.size >= 8 || arg.size == 0) ? ~0ull : ((1ull << (8 * arg.size)) - 1);
+				spec.append("ll");
+				spec.push_back(conversion);
+				Append(output, spec, static_cast<unsigned long long>(arg.value & mask));
+				break;
+			}
+		case('c'):
+			spec.push_back(conversion);
+			Append(output, spec, static_cast<int>(AsSigned(arg)));
+			break;
+		case('f'):
+		case('F'):
+		case('e'):
+		case('E'):
+		case('g'):
+		case('G'):
+		case('a'):
+		case('A'):
+			spec.push_back(conversion);
+			Append(output, spec, AsDouble(arg));
+			break;
+		case('s'):
+			if (arg.kind == LogArgKind::String)
+			{
+				spec.push_back(conversion);
+				Append(output, spec, arg.text.c_str());
+			}
+			else
+			{
+				output.append("<?>");
+			}
+			break;
+		case('p'):
+			spec.push_back(conversion);
+			Append(output, spec, reinterpret_cast<void*>(static_cast<uintptr_t>(arg.value)));
+			break;
+		default:
+			output.append("<?>");
+			break;
+		}
+	}
+}
+
+}
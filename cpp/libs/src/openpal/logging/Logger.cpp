@@ -26,7 +26,8 @@ namespace openpal
 
 Logger::Logger(const std::shared_ptr<ILogHandler>& backend, const std::string& id, openpal::LogFilters levels) :
 	backend(backend),
-	settings(std::make_shared<Settings>(id, levels))
+	settings(std::make_shared<Settings>(id, levels)),
+	binary(backend && backend->IsBinary())
 {}
 
 bool Logger::IsEnabled(const LogFilters& filters) const
@@ -49,5 +50,18 @@ void Logger::Log(const LogFilters& filters, const char* location, const char* me
 	}
 }
 
+void Logger::LogBinaryHex(const LogFilters& filters, const char* location, const RSlice& bytes, uint32_t firstRowSize, uint32_t otherRowSize)
+{
+	backend->LogBinary(
+	    BinaryLogEntry(
+	        this->settings->id.c_str(),
+	        filters,
+	        location,
+	        bytes,
+	        firstRowSize,
+	        otherRowSize
+	    )
+	);
 }
 
+}
@@ -0,0 +1,205 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <asiodnp3/DNP3Manager.h>
+
+#include <opendnp3/LogLevels.h>
+
+#include <asio.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace opendnp3;
+using namespace asiodnp3;
+using namespace asiopal;
+
+/**
+* Measures how quickly a master listener accepts a burst of loopback connections, comparing
+* a single acceptor with several SO_REUSEPORT acceptors, and how many short-lived connections
+* per second it can accept and tear down. Hidden because it opens thousands of sockets
+* (ulimit -n 4096). Run it with: testasiodnp3 "[.benchmark]"
+*/
+
+#define SUITE(name) "AcceptRateBenchmark - " name
+
+namespace
+{
+
+const size_t NUM_CONNECTIONS = 1000;
+const size_t NUM_CHURN_CONNECTIONS = 5000;
+const uint32_t CLIENT_THREADS = 2;
+const auto ACCEPT_TIMEOUT = std::chrono::seconds(60);
+
+class CountingListenCallbacks final : public IListenCallbacks
+{
+public:
+
+	bool AcceptConnection(uint64_t sessionid, const std::string& ipaddress) override
+	{
+		++numAccepted;
+		return true;
+	}
+
+	bool AcceptCertificate(uint64_t sessionid, const X509Info& info) override
+	{
+		return true;
+	}
+
+	openpal::TimeDuration GetFirstFrameTimeout() override
+	{
+		return openpal::TimeDuration::Seconds(60);
+	}
+
+	void OnFirstFrame(uint64_t sessionid, const opendnp3::LinkHeaderFields& header, ISessionAcceptor& acceptor) override {}
+
+	void OnConnectionClose(uint64_t sessionid, const std::shared_ptr<IMasterSession>& session) override
+	{
+		++numClosed;
+	}
+
+	void OnCertificateError(uint64_t sessionid, const X509Info& info, int error) override {}
+
+	std::atomic<size_t> numAccepted{ 0 };
+	std::atomic<size_t> numClosed{ 0 };
+};
+
+// returns the number of accepts per second
+double MeasureAcceptRate(uint16_t port, uint32_t numAcceptors)
+{
+	DNP3Manager manager(std::thread::hardware_concurrency());
+
+	auto callbacks = std::make_shared<CountingListenCallbacks>();
+
+	std::error_code ec;
+	auto listener = manager.CreateListener("listener", levels::NORMAL, IPEndpoint::Localhost(port), numAcceptors, callbacks, ec);
+	if (ec)
+	{
+		throw std::system_error(ec);
+	}
+
+	asio::io_context clientIO;
+	std::vector<std::unique_ptr<asio::ip::tcp::socket>> clients;
+	for (size_t i = 0; i < NUM_CONNECTIONS; ++i)
+	{
+		clients.push_back(std::make_unique<asio::ip::tcp::socket>(clientIO));
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+
+	for (auto& client : clients)
+	{
+		client->async_connect(asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), port), [](const std::error_code&) {});
+	}
+
+	std::vector<std::thread> threads;
+	for (uint32_t i = 0; i < CLIENT_THREADS; ++i)
+	{
+		threads.emplace_back([&]()
+		{
+			clientIO.run();
+		});
+	}
+
+	while (callbacks->numAccepted < NUM_CONNECTIONS && (std::chrono::steady_clock::now() - start) < ACCEPT_TIMEOUT)
+	{
+		std::this_thread::sleep_for(std::chrono::microseconds(100));
+	}
+
+	const auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() - start).count();
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	REQUIRE(callbacks->numAccepted == NUM_CONNECTIONS);
+
+	std::cout << numAcceptors << " acceptor(s): " << NUM_CONNECTIONS << " connections accepted in "
+	          << static_cast<uint64_t>(elapsed * 1000) << " ms (" << static_cast<uint64_t>(NUM_CONNECTIONS / elapsed) << " / sec)" << std::endl;
+
+	listener->Shutdown();
+
+	return NUM_CONNECTIONS / elapsed;
+}
+
+// returns the number of connections per second that are accepted and closed again
+double MeasureChurnRate(uint16_t port)
+{
+	DNP3Manager manager(std::thread::hardware_concurrency());
+
+	auto callbacks = std::make_shared<CountingListenCallbacks>();
+
+	std::error_code ec;
+	auto listener = manager.CreateListener("listener", levels::NORMAL, IPEndpoint::Localhost(port), callbacks, ec);
+	if (ec)
+	{
+		throw std::system_error(ec);
+	}
+
+	asio::io_context clientIO;
+	const auto start = std::chrono::steady_clock::now();
+
+	// each client connects and hangs up immediately, like a flapping modem
+	for (size_t i = 0; i < NUM_CHURN_CONNECTIONS; ++i)
+	{
+		asio::ip::tcp::socket client(clientIO);
+		client.connect(asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), port));
+		client.close();
+	}
+
+	while (callbacks->numClosed < NUM_CHURN_CONNECTIONS && (std::chrono::steady_clock::now() - start) < ACCEPT_TIMEOUT)
+	{
+		std::this_thread::sleep_for(std::chrono::microseconds(100));
+	}
+
+	const auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() - start).count();
+
+	REQUIRE(callbacks->numClosed == NUM_CHURN_CONNECTIONS);
+
+	std::cout << "churn: " << NUM_CHURN_CONNECTIONS << " connections accepted and closed in "
+	          << static_cast<uint64_t>(elapsed * 1000) << " ms (" << static_cast<uint64_t>(NUM_CHURN_CONNECTIONS / elapsed) << " connects / sec)" << std::endl;
+
+	listener->Shutdown();
+
+	return NUM_CHURN_CONNECTIONS / elapsed;
+}
+
+}
+
+TEST_CASE(SUITE("loopback connection burst with one and several acceptors"), "[.benchmark]")
+{
+	const auto numAcceptors = std::max<uint32_t>(std::thread::hardware_concurrency(), 2);
+
+	MeasureAcceptRate(20020, 1);
+	MeasureAcceptRate(20021, numAcceptors);
+}
+
+TEST_CASE(SUITE("connect and close churn"), "[.benchmark]")
+{
+	MeasureChurnRate(20022);
+}
@@ -0,0 +1,185 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+
+#include <catch.hpp>
+
+#include <asiodnp3/AsyncLogger.h>
+
+#include <opendnp3/LogLevels.h>
+#include <openpal/logging/Logger.h>
+#include <openpal/logging/LogMacros.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace opendnp3;
+using namespace openpal;
+using namespace asiodnp3;
+
+#define SUITE(name) "AsyncLoggerTestSuite - " name
+
+const char* const LOG_FILE = "async-logger-test.log";
+
+size_t CountLines(const char* path)
+{
+	std::ifstream file(path);
+	std::string line;
+	size_t count = 0;
+	while (std::getline(file, line))
+	{
+		++count;
+	}
+	return count;
+}
+
+void LogFromThreads(const std::shared_ptr<ILogHandler>& handler, int numThreads, int numPerThread)
+{
+	std::vector<std::thread> threads;
+	for (int t = 0; t < numThreads; ++t)
+	{
+		threads.push_back(std::thread([ = ]()
+		{
+			Logger logger(handler, "thread-" + std::to_string(t), levels::ALL);
+			for (int i = 0; i < numPerThread; ++i)
+			{
+				FORMAT_LOG_BLOCK(logger, flags::APP_HEADER_RX, "FIR: 1 FIN: 1 CON: 0 UNS: 0 SEQ: %d FUNC: READ", i % 16);
+			}
+		}));
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+}
+
+TEST_CASE(SUITE("BlockingPolicyWritesEveryEntry"))
+{
+	std::remove(LOG_FILE);
+
+	AsyncLoggerConfig config;
+	config.capacity = 16;
+	config.overflowPolicy = LogOverflowPolicy::Block;
+
+	std::error_code ec;
+	auto logger = AsyncLogger::CreateFile(LOG_FILE, config, ec);
+	REQUIRE_FALSE(ec);
+
+	LogFromThreads(logger, 4, 1000);
+	logger->Shutdown();
+
+	const auto stats = logger->GetStatistics();
+	REQUIRE(stats.numQueued == 4000);
+	REQUIRE(stats.numDropped == 0);
+	REQUIRE(stats.numWritten == 4000);
+	REQUIRE(CountLines(LOG_FILE) == 4000);
+
+	std::remove(LOG_FILE);
+}
+
+TEST_CASE(SUITE("DropPolicyAccountsForEveryEntry"))
+{
+	std::remove(LOG_FILE);
+
+	AsyncLoggerConfig config;
+	config.capacity = 2;
+	config.overflowPolicy = LogOverflowPolicy::DropNewest;
+
+	std::error_code ec;
+	auto logger = AsyncLogger::CreateFile(LOG_FILE, config, ec);
+	REQUIRE_FALSE(ec);
+
+	LogFromThreads(logger, 4, 1000);
+	logger->Shutdown();
+
+	const auto stats = logger->GetStatistics();
+	REQUIRE((stats.numQueued + stats.numDropped) == 4000);
+	REQUIRE(stats.numWritten == stats.numQueued);
+	REQUIRE(CountLines(LOG_FILE) == stats.numWritten);
+
+	std::remove(LOG_FILE);
+}
+
+TEST_CASE(SUITE("EntriesAfterShutdownAreDropped"))
+{
+	std::remove(LOG_FILE);
+
+	std::error_code ec;
+	auto logger = AsyncLogger::CreateFile(LOG_FILE, AsyncLoggerConfig(), ec);
+	REQUIRE_FALSE(ec);
+
+	logger->Shutdown();
+	LogFromThreads(logger, 1, 10);
+
+	const auto stats = logger->GetStatistics();
+	REQUIRE(stats.numQueued == 0);
+	REQUIRE(stats.numDropped == 10);
+	REQUIRE(stats.numWritten == 0);
+
+	std::remove(LOG_FILE);
+}
+
+TEST_CASE(SUITE("CreateFileReportsErrors"))
+{
+	std::error_code ec;
+	auto logger = AsyncLogger::CreateFile("./does/not/exist/test.log", AsyncLoggerConfig(), ec);
+	REQUIRE(ec);
+	REQUIRE(logger == nullptr);
+}
+
+TEST_CASE(SUITE("EntriesPerSecond"), "[.benchmark]")
+{
+	const int NUM_PRODUCERS = 16;
+	const int NUM_PER_PRODUCER = 50000;
+
+	std::remove(LOG_FILE);
+
+	AsyncLoggerConfig config;
+	config.overflowPolicy = LogOverflowPolicy::Block;
+
+	std::error_code ec;
+	auto logger = AsyncLogger::CreateFile(LOG_FILE, config, ec);
+	REQUIRE_FALSE(ec);
+
+	const auto start = std::chrono::steady_clock::now();
+	LogFromThreads(logger, NUM_PRODUCERS, NUM_PER_PRODUCER);
+	const auto produced = std::chrono::steady_clock::now();
+	logger->Shutdown();
+	const auto written = std::chrono::steady_clock::now();
+
+	const auto stats = logger->GetStatistics();
+	REQUIRE(stats.numWritten == static_cast<uint64_t>(NUM_PRODUCERS) * NUM_PER_PRODUCER);
+
+	const auto produceMs = std::max<int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(produced - start).count(), 1);
+	const auto writeMs = std::max<int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(written - start).count(), 1);
+
+	std::cout << stats.numWritten << " entries from " << NUM_PRODUCERS << " threads: "
+	          << (stats.numWritten * 1000) / produceMs << " logged per/sec, "
+	          << (stats.numWritten * 1000) / writeMs << " written per/sec in "
+	          << stats.numBatches << " batches" << std::endl;
+
+	std::remove(LOG_FILE);
+}
@@ -33,6 +33,10 @@
 
 #include <dnp3mocks/NullSOEHandler.h>
 
+#include "mocks/QueuedChannelListener.h"
+
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 #include <iostream>
 
@@ -58,6 +62,48 @@ struct Channels
 	std::shared_ptr<IChannel> server;
 };
 
+// records the messages logged by one logger id, e.g. "server"
+class MessageRecorder final : public ILogHandler
+{
+public:
+
+	explicit MessageRecorder(const std::string& loggerid) : loggerid(loggerid)
+	{}
+
+	virtual void Log(const LogEntry& entry) override
+	{
+		if (loggerid == entry.loggerid)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			messages.push_back(entry.message);
+			condition.notify_all();
+		}
+	}
+
+	bool WaitForPrefix(const std::string& prefix, std::chrono::steady_clock::duration timeout)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		return condition.wait_for(lock, timeout, [&]()
+		{
+			for (auto& message : messages)
+			{
+				if (message.compare(0, prefix.size(), prefix) == 0)
+				{
+					return true;
+				}
+			}
+			return false;
+		});
+	}
+
+private:
+
+	const std::string loggerid;
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::vector<std::string> messages;
+};
+
 struct Components : Channels
 {
 	Components(DNP3Manager& manager) :
@@ -132,7 +178,96 @@ TEST_CASE(SUITE("ManualChannelShutdown"))
 	}
 }
 
+TEST_CASE(SUITE("OutstationServerLogsAcceptedConnection"))
+{
+	auto recorder = std::make_shared<MessageRecorder>("server");
+
+	DNP3Manager manager(std::thread::hardware_concurrency(), recorder);
+	Components components(manager);
+	components.Enable();
+
+	REQUIRE(recorder->WaitForPrefix("Accepted connection from: 127.0.0.1:", std::chrono::seconds(5)));
+}
+
+TEST_CASE(SUITE("LoopbackConstructionDestruction"))
+{
+	for (int i = 0; i < ITERATIONS; ++i)
+	{
+		DNP3Manager manager(std::thread::hardware_concurrency());
+
+		auto client = manager.AddLoopback("client", levels::ALL, "link", LoopbackConfig(), nullptr);
+		auto server = manager.AddLoopback("server", levels::ALL, "link", LoopbackConfig(), nullptr);
 
+		server->AddOutstation("outstation", SuccessCommandHandler::Create(), DefaultOutstationApplication::Create(), OutstationStackConfig(DatabaseSizes::Empty()))->Enable();
+		client->AddMaster("master", NullSOEHandler::Create(), asiodnp3::DefaultMasterApplication::Create(), MasterStackConfig())->Enable();
+	}
+}
 
+TEST_CASE(SUITE("LoopbackChannelReconnectsToNewPeer"))
+{
+	const auto timeout = std::chrono::seconds(5);
 
+	DNP3Manager manager(std::thread::hardware_concurrency());
 
+	auto serverListener = std::make_shared<QueuedChannelListener>();
+	auto server = manager.AddLoopback("server", levels::ALL, "link", LoopbackConfig(), serverListener);
+	server->AddOutstation("outstation", SuccessCommandHandler::Create(), DefaultOutstationApplication::Create(), OutstationStackConfig(DatabaseSizes::Empty()))->Enable();
+
+	for (int i = 0; i < 3; ++i)
+	{
+		auto clientListener = std::make_shared<QueuedChannelListener>();
+		auto client = manager.AddLoopback("client", levels::ALL, "link", LoopbackConfig(), clientListener);
+		client->AddMaster("master", NullSOEHandler::Create(), asiodnp3::DefaultMasterApplication::Create(), MasterStackConfig())->Enable();
+
+		REQUIRE(clientListener->WaitForState(ChannelState::OPEN, timeout));
+		REQUIRE(serverListener->WaitForState(ChannelState::OPEN, timeout));
+
+		client->Shutdown();
+
+		// the server waits for the next peer with the same name
+		REQUIRE(serverListener->WaitForState(ChannelState::OPENING, timeout));
+	}
+}
+
+TEST_CASE(SUITE("FrameRxLatencyIsRecordedInMicroseconds"))
+{
+	DNP3Manager manager(std::thread::hardware_concurrency());
+
+	// a tiny pipe clocked at 20k bytes/sec delivers every link frame in 8 byte reads ~400us apart
+	LoopbackConfig config;
+	config.bufferSize = 8;
+	config.bytesPerSecond = 20000;
+
+	auto server = manager.AddLoopback("server", levels::NORMAL, "link", config, nullptr);
+	auto client = manager.AddLoopback("client", levels::NORMAL, "link", config, nullptr);
+
+	server->AddOutstation("outstation", SuccessCommandHandler::Create(), DefaultOutstationApplication::Create(), OutstationStackConfig(DatabaseSizes::Empty()))->Enable();
+	client->AddMaster("master", NullSOEHandler::Create(), asiodnp3::DefaultMasterApplication::Create(), MasterStackConfig())->Enable();
+
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while (server->GetStatistics().latency.frameRx.Count() == 0 && std::chrono::steady_clock::now() < deadline)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	const auto frameRx = server->GetStatistics().latency.frameRx;
+	REQUIRE(frameRx.Count() > 0);
+
+	// every frame spans at least two reads, which a millisecond resolution would mostly record as 0
+	REQUIRE(frameRx.Min() > 0);
+	REQUIRE(frameRx.Min() < 100000);
+}
+
+TEST_CASE(SUITE("OutstationLogsChatterFilterForMissingPoint"))
+{
+	auto recorder = std::make_shared<MessageRecorder>("outstation");
+
+	DNP3Manager manager(std::thread::hardware_concurrency(), recorder);
+	auto server = manager.AddTCPServer("server", levels::ALL, ServerAcceptMode::CloseExisting, "0.0.0.0", 20000, nullptr);
+
+	OutstationStackConfig config(DatabaseSizes::BinaryOnly(1));
+	config.dbConfig.chatterFilters.push_back(ChatterFilterPoint(EventType::Binary, 5, ChatterFilterConfig()));
+	server->AddOutstation("outstation", SuccessCommandHandler::Create(), DefaultOutstationApplication::Create(), config);
+
+	REQUIRE(recorder->WaitForPrefix("Ignoring chatter filter for non-existent point, type: 0, index: 5", std::chrono::seconds(5)));
+}
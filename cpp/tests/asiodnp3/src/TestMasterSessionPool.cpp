@@ -0,0 +1,134 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include "asiodnp3/MasterSessionPool.h"
+
+using namespace asiodnp3;
+
+#define SUITE(name) "MasterSessionPoolTestSuite - " name
+
+namespace
+{
+MasterSessionPoolConfig GetConfig(uint32_t numSessions, uint32_t maxRxFragSize = 2048, uint32_t maxTxFragSize = 2048)
+{
+	MasterSessionPoolConfig config;
+	config.numSessions = numSessions;
+	config.maxRxFragSize = maxRxFragSize;
+	config.maxTxFragSize = maxTxFragSize;
+	return config;
+}
+}
+
+TEST_CASE(SUITE("disabled pool does not provide buffers"))
+{
+	auto pool = MasterSessionPool::Create();
+
+	auto buffers = pool->CheckOut(2048, 2048);
+
+	REQUIRE_FALSE(buffers.rx);
+	REQUIRE_FALSE(buffers.tx);
+	REQUIRE(pool->GetStatistics().numCheckedOut == 0);
+}
+
+TEST_CASE(SUITE("buffers are pre-allocated and returned when released"))
+{
+	auto pool = MasterSessionPool::Create();
+	pool->Configure(GetConfig(2, 4096, 1024));
+	REQUIRE(pool->GetStatistics().numAvailable == 2);
+
+	auto buffers = pool->CheckOut(4096, 1024);
+	REQUIRE(buffers.rx->Size() == 4096);
+	REQUIRE(buffers.tx->Size() == 1024);
+
+	auto stats = pool->GetStatistics();
+	REQUIRE(stats.numAvailable == 1);
+	REQUIRE(stats.numCheckedOut == 1);
+	REQUIRE(stats.numReused == 1);
+
+	const auto address = buffers.rx.get();
+	buffers = MasterSessionPool::Buffers();
+
+	stats = pool->GetStatistics();
+	REQUIRE(stats.numAvailable == 2);
+	REQUIRE(stats.numCheckedOut == 0);
+
+	// the most recently returned buffer is handed out first
+	REQUIRE(pool->CheckOut(4096, 1024).rx.get() == address);
+}
+
+TEST_CASE(SUITE("sessions with other fragment sizes are not served"))
+{
+	auto pool = MasterSessionPool::Create();
+	pool->Configure(GetConfig(1));
+
+	REQUIRE_FALSE(pool->CheckOut(4096, 2048).rx);
+	REQUIRE_FALSE(pool->CheckOut(2048, 4096).tx);
+	REQUIRE(pool->GetStatistics().numAvailable == 1);
+}
+
+TEST_CASE(SUITE("pool grows to the demand and retains the configured number of sessions"))
+{
+	auto pool = MasterSessionPool::Create();
+	pool->Configure(GetConfig(1));
+
+	auto first = pool->CheckOut(2048, 2048);
+	auto second = pool->CheckOut(2048, 2048);
+	REQUIRE(second.rx);
+
+	auto stats = pool->GetStatistics();
+	REQUIRE(stats.numReused == 1);
+	REQUIRE(stats.numAllocated == 1);
+	REQUIRE(stats.numCheckedOut == 2);
+
+	first = MasterSessionPool::Buffers();
+	second = MasterSessionPool::Buffers();
+
+	stats = pool->GetStatistics();
+	REQUIRE(stats.numAvailable == 1);
+	REQUIRE(stats.numCheckedOut == 0);
+}
+
+TEST_CASE(SUITE("reconfiguring releases buffers of the old size"))
+{
+	auto pool = MasterSessionPool::Create();
+	pool->Configure(GetConfig(2));
+
+	auto buffers = pool->CheckOut(2048, 2048);
+
+	pool->Configure(GetConfig(2, 8192, 8192));
+	REQUIRE(pool->GetStatistics().numAvailable == 2);
+
+	buffers = MasterSessionPool::Buffers();
+	REQUIRE(pool->GetStatistics().numAvailable == 2);
+
+	REQUIRE(pool->CheckOut(8192, 8192).rx->Size() == 8192);
+}
+
+TEST_CASE(SUITE("buffers outliving the pool are released"))
+{
+	auto pool = MasterSessionPool::Create();
+	pool->Configure(GetConfig(1));
+
+	auto buffers = pool->CheckOut(2048, 2048);
+	pool.reset();
+	buffers = MasterSessionPool::Buffers();
+}
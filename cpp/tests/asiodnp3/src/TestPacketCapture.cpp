@@ -0,0 +1,138 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+
+#include <catch.hpp>
+
+#include <asiodnp3/PacketCapture.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+using namespace openpal;
+using namespace asiodnp3;
+
+#define SUITE(name) "PacketCaptureTestSuite - " name
+
+const char* const CAPTURE_FILE = "packet-capture-test.pcap";
+
+std::vector<uint8_t> ReadFile(const char* path)
+{
+	std::ifstream file(path, std::ios::binary);
+	return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+uint32_t ReadNative32(const std::vector<uint8_t>& bytes, size_t pos)
+{
+	uint32_t value;
+	memcpy(&value, bytes.data() + pos, sizeof(value));
+	return value;
+}
+
+uint32_t ReadBE32(const std::vector<uint8_t>& bytes, size_t pos)
+{
+	return (bytes[pos] << 24) | (bytes[pos + 1] << 16) | (bytes[pos + 2] << 8) | bytes[pos + 3];
+}
+
+TEST_CASE(SUITE("WritesSyntheticTCPSegments"))
+{
+	std::remove(CAPTURE_FILE);
+
+	std::error_code ec;
+	auto capture = PacketCapture::Create(CAPTURE_FILE, PacketCaptureConfig(), ec);
+	REQUIRE_FALSE(ec);
+
+	const uint8_t request[] = { 0x05, 0x64, 0x05, 0xC9, 0x01, 0x00, 0x00, 0x04, 0xE9, 0x21 };
+	const uint8_t response[] = { 0x05, 0x64, 0x05, 0x0B, 0x00, 0x04, 0x01, 0x00 };
+
+	const auto stream = capture->NextStreamId();
+	capture->Record(stream, CaptureDirection::Tx, 0, 0, RSlice(request, sizeof(request)));
+	capture->Record(stream, CaptureDirection::Rx, 0, sizeof(request), RSlice(response, sizeof(response)));
+	capture->Shutdown();
+
+	const auto stats = capture->GetStatistics();
+	REQUIRE(stats.numCaptured == 2);
+	REQUIRE(stats.numDropped == 0);
+	REQUIRE(stats.numWritten == 2);
+
+	const auto bytes = ReadFile(CAPTURE_FILE);
+	REQUIRE(bytes.size() == 24 + (16 + 40 + sizeof(request)) + (16 + 40 + sizeof(response)));
+
+	REQUIRE(ReadNative32(bytes, 0) == 0xa1b2c3d4);
+	REQUIRE(ReadNative32(bytes, 20) == 101); // LINKTYPE_RAW
+
+	// first record is the transmitted request
+	size_t pos = 24;
+	REQUIRE(ReadNative32(bytes, pos + 8) == 40 + sizeof(request));
+	REQUIRE(ReadNative32(bytes, pos + 12) == 40 + sizeof(request));
+	pos += 16;
+	REQUIRE(bytes[pos] == 0x45);
+	REQUIRE(bytes[pos + 9] == 6);
+	REQUIRE(memcmp(bytes.data() + pos + 40, request, sizeof(request)) == 0);
+
+	// second record flows in the opposite direction and acknowledges the request
+	pos += 40 + sizeof(request);
+	REQUIRE(ReadBE32(bytes, 24 + 16 + 12) == ReadBE32(bytes, pos + 16 + 16)); // source of tx == destination of rx
+	REQUIRE(ReadBE32(bytes, pos + 16 + 20 + 8) == sizeof(request));
+	REQUIRE(memcmp(bytes.data() + pos + 16 + 40, response, sizeof(response)) == 0);
+
+	std::remove(CAPTURE_FILE);
+}
+
+TEST_CASE(SUITE("DropsWhenFullWithoutBlocking"))
+{
+	std::remove(CAPTURE_FILE);
+
+	PacketCaptureConfig config;
+	config.capacity = 2;
+
+	std::error_code ec;
+	auto capture = PacketCapture::Create(CAPTURE_FILE, config, ec);
+	REQUIRE_FALSE(ec);
+
+	const uint8_t frame[292] = { 0x05, 0x64 };
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t)
+	{
+		threads.push_back(std::thread([&]()
+		{
+			const auto stream = capture->NextStreamId();
+			for (uint32_t i = 0; i < 1000; ++i)
+			{
+				capture->Record(stream, CaptureDirection::Rx, i * sizeof(frame), 0, RSlice(frame, sizeof(frame)));
+			}
+		}));
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+	capture->Shutdown();
+
+	const auto stats = capture->GetStatistics();
+	REQUIRE((stats.numCaptured + stats.numDropped) == 4000);
+	REQUIRE(stats.numWritten == stats.numCaptured);
+
+	std::remove(CAPTURE_FILE);
+}
@@ -24,6 +24,7 @@
 #include <asiodnp3/DNP3Manager.h>
 #include <asiodnp3/ConsoleLogger.h>
 
+#include <algorithm>
 #include <memory>
 #include <iostream>
 #include <thread>
@@ -35,7 +36,10 @@ using namespace asiodnp3;
 
 #define SUITE(name) "PerformanceTestSuite - " name
 
-TEST_CASE(SUITE("PointsPerSecond"))
+namespace
+{
+
+void MeasurePointsPerSecond(PerformanceTransport transport)
 {
 	const uint16_t START_PORT = 20000;
 	const uint16_t NUM_STACK_PAIRS = 10;
@@ -60,7 +64,7 @@ TEST_CASE(SUITE("PointsPerSecond"))
 
 	for (uint16_t i = 0; i < NUM_STACK_PAIRS; ++i)
 	{
-		auto pair = std::make_unique<PerformanceStackPair>(LEVELS, STACK_TIMEOUT, manager, START_PORT + i, NUM_POINTS_PER_TYPE, EVENTS_PER_ITERATION);
+		auto pair = std::make_unique<PerformanceStackPair>(LEVELS, STACK_TIMEOUT, manager, START_PORT + i, NUM_POINTS_PER_TYPE, EVENTS_PER_ITERATION, transport);
 		pairs.push_back(std::move(pair));
 	}
 
@@ -91,8 +95,19 @@ TEST_CASE(SUITE("PointsPerSecond"))
 
 	const auto total_events_transferred = static_cast<uint64_t>(NUM_STACK_PAIRS) * static_cast<uint64_t>(EVENTS_PER_ITERATION) * static_cast<uint64_t>(NUM_ITERATIONS);
 
-	const auto rate = (total_events_transferred * 1000) / milliseconds.count();
+	const auto rate = (total_events_transferred * 1000) / std::max<int64_t>(milliseconds.count(), 1);
 
 	std::cout << total_events_transferred << " in " << milliseconds.count() << " ms == " << rate << " events per/sec" << std::endl;
 }
 
+}
+
+TEST_CASE(SUITE("PointsPerSecond"))
+{
+	MeasurePointsPerSecond(PerformanceTransport::TCP);
+}
+
+TEST_CASE(SUITE("PointsPerSecond over loopback channels"))
+{
+	MeasurePointsPerSecond(PerformanceTransport::Loopback);
+}
@@ -43,8 +43,47 @@ TEST_CASE(SUITE("builder is cleared after building"))
     }
 }
 
+TEST_CASE(SUITE("batches are applied in order with their event mode"))
+{
+    class AnalogRecorder final : public IUpdateHandler
+    {
+    public:
 
+        virtual bool Update(const Binary& meas, uint16_t index, EventMode mode) override { return false; }
+        virtual bool Update(const DoubleBitBinary& meas, uint16_t index, EventMode mode) override { return false; }
+        virtual bool Update(const Analog& meas, uint16_t index, EventMode mode) override
+        {
+            values.push_back(WithIndex(meas, index));
+            modes.push_back(mode);
+            return true;
+        }
+        virtual bool Update(const Counter& meas, uint16_t index, EventMode mode) override { return false; }
+        virtual bool Update(const FrozenCounter& meas, uint16_t index, EventMode mode) override { return false; }
+        virtual bool Update(const BinaryOutputStatus& meas, uint16_t index, EventMode mode) override { return false; }
+        virtual bool Update(const AnalogOutputStatus& meas, uint16_t index, EventMode mode) override { return false; }
+        virtual bool Update(const OctetString& meas, uint16_t index, EventMode mode) override { return false; }
+        virtual bool Update(const TimeAndInterval& meas, uint16_t index) override { return false; }
+        virtual bool Modify(FlagsType type, uint16_t start, uint16_t stop, uint8_t flags) override { return false; }
 
+        std::vector<Indexed<Analog>> values;
+        std::vector<EventMode> modes;
+    };
 
+    UpdateBuilder builder;
+    builder.Update(Analog(1.0), 7);
+    builder.Update(std::vector<Indexed<Analog>> { WithIndex(Analog(2.0), 3), WithIndex(Analog(3.0), 1) }, EventMode::Force);
+    builder.Update(std::vector<Indexed<Analog>>());
 
+    AnalogRecorder recorder;
+    builder.Build().Apply(recorder);
 
+    REQUIRE(recorder.values.size() == 3);
+    REQUIRE(recorder.values[0].index == 7);
+    REQUIRE(recorder.values[1].index == 3);
+    REQUIRE(recorder.values[1].value.value == 2.0);
+    REQUIRE(recorder.values[2].index == 1);
+    REQUIRE(recorder.values[2].value.value == 3.0);
+    REQUIRE(recorder.modes[0] == EventMode::Detect);
+    REQUIRE(recorder.modes[1] == EventMode::Force);
+    REQUIRE(recorder.modes[2] == EventMode::Force);
+}
@@ -33,14 +33,14 @@ using namespace opendnp3;
 namespace asiodnp3
 {
 
-PerformanceStackPair::PerformanceStackPair(uint32_t levels, openpal::TimeDuration timeout, DNP3Manager& manager, uint16_t port, uint16_t numPointsPerType, uint32_t eventsPerIteration) :
+PerformanceStackPair::PerformanceStackPair(uint32_t levels, openpal::TimeDuration timeout, DNP3Manager& manager, uint16_t port, uint16_t numPointsPerType, uint32_t eventsPerIteration, PerformanceTransport transport) :
 	NUM_POINTS_PER_TYPE(numPointsPerType),
 	EVENTS_PER_ITERATION(eventsPerIteration),
 	soeHandler(std::make_shared<CountingSOEHandler>()),
 	clientListener(std::make_shared<QueuedChannelListener>()),
 	serverListener(std::make_shared<QueuedChannelListener>()),
-	master(CreateMaster(levels, timeout, manager, port, this->soeHandler, this->clientListener)),
-	outstation(CreateOutstation(levels, timeout, manager, port, numPointsPerType, 3 * eventsPerIteration, this->serverListener))
+	master(CreateMaster(levels, timeout, transport, manager, port, this->soeHandler, this->clientListener)),
+	outstation(CreateOutstation(levels, timeout, transport, manager, port, numPointsPerType, 3 * eventsPerIteration, this->serverListener))
 {
 	this->outstation->Enable();
 	this->master->Enable();
@@ -128,17 +128,44 @@ MasterStackConfig PerformanceStackPair::GetMasterStackConfig(openpal::TimeDurati
 	return config;
 }
 
-std::shared_ptr<IMaster> PerformanceStackPair::CreateMaster(uint32_t levels, openpal::TimeDuration timeout, DNP3Manager& manager, uint16_t port, std::shared_ptr<ISOEHandler> soehandler, std::shared_ptr<IChannelListener> listener)
+std::shared_ptr<IChannel> PerformanceStackPair::CreateClientChannel(uint32_t levels, PerformanceTransport transport, DNP3Manager& manager, uint16_t port, std::shared_ptr<IChannelListener> listener)
 {
-	auto channel = manager.AddTCPClient(
-	                   GetId("client", port).c_str(),
-	                   levels,
-	                   asiopal::ChannelRetry::Default(),
-	                   "127.0.0.1",
-	                   "127.0.0.1",
-	                   port,
-	                   listener
-	               );
+	if (transport == PerformanceTransport::Loopback)
+	{
+		return manager.AddLoopback(GetId("client", port), levels, GetId("link", port), asiopal::LoopbackConfig(), listener);
+	}
+
+	return manager.AddTCPClient(
+	           GetId("client", port).c_str(),
+	           levels,
+	           asiopal::ChannelRetry::Default(),
+	           "127.0.0.1",
+	           "127.0.0.1",
+	           port,
+	           listener
+	       );
+}
+
+std::shared_ptr<IChannel> PerformanceStackPair::CreateServerChannel(uint32_t levels, PerformanceTransport transport, DNP3Manager& manager, uint16_t port, std::shared_ptr<IChannelListener> listener)
+{
+	if (transport == PerformanceTransport::Loopback)
+	{
+		return manager.AddLoopback(GetId("server", port), levels, GetId("link", port), asiopal::LoopbackConfig(), listener);
+	}
+
+	return manager.AddTCPServer(
+	           GetId("server", port).c_str(),
+	           levels,
+	           ServerAcceptMode::CloseExisting,
+	           "127.0.0.1",
+	           port,
+	           listener
+	       );
+}
+
+std::shared_ptr<IMaster> PerformanceStackPair::CreateMaster(uint32_t levels, openpal::TimeDuration timeout, PerformanceTransport transport, DNP3Manager& manager, uint16_t port, std::shared_ptr<ISOEHandler> soehandler, std::shared_ptr<IChannelListener> listener)
+{
+	auto channel = CreateClientChannel(levels, transport, manager, port, listener);
 
 	return channel->AddMaster(
 	           GetId("master", port).c_str(),
@@ -148,16 +175,9 @@ std::shared_ptr<IMaster> PerformanceStackPair::CreateMaster(uint32_t levels, ope
 	       );
 }
 
-std::shared_ptr<IOutstation> PerformanceStackPair::CreateOutstation(uint32_t levels, openpal::TimeDuration timeout, DNP3Manager& manager, uint16_t port, uint16_t numPointsPerType, uint16_t eventBufferSize, std::shared_ptr<IChannelListener> listener)
+std::shared_ptr<IOutstation> PerformanceStackPair::CreateOutstation(uint32_t levels, openpal::TimeDuration timeout, PerformanceTransport transport, DNP3Manager& manager, uint16_t port, uint16_t numPointsPerType, uint16_t eventBufferSize, std::shared_ptr<IChannelListener> listener)
 {
-	auto channel = manager.AddTCPServer(
-	                   GetId("server", port).c_str(),
-	                   levels,
-	                   ServerAcceptMode::CloseExisting,
-	                   "127.0.0.1",
-	                   port,
-	                   listener
-	               );
+	auto channel = CreateServerChannel(levels, transport, manager, port, listener);
 
 	return channel->AddOutstation(
 	           GetId("outstation", port).c_str(),
@@ -37,6 +37,14 @@
 namespace asiodnp3
 {
 
+enum class PerformanceTransport
+{
+	// master and outstation are connected over a localhost TCP socket
+	TCP,
+	// master and outstation are connected by an in-memory loopback channel
+	Loopback
+};
+
 class PerformanceStackPair final : openpal::Uncopyable
 {
 	const uint16_t NUM_POINTS_PER_TYPE;
@@ -53,15 +61,18 @@ class PerformanceStackPair final : openpal::Uncopyable
 	static OutstationStackConfig GetOutstationStackConfig(uint16_t numPointsPerType, uint16_t eventBufferSize, openpal::TimeDuration timeout);
 	static MasterStackConfig GetMasterStackConfig(openpal::TimeDuration timeout);
 
-	static std::shared_ptr<IMaster> CreateMaster(uint32_t levels, openpal::TimeDuration timeout, DNP3Manager&, uint16_t port, std::shared_ptr<opendnp3::ISOEHandler>, std::shared_ptr<IChannelListener> listener);
-	static std::shared_ptr<IOutstation> CreateOutstation(uint32_t levels, openpal::TimeDuration timeout, DNP3Manager&, uint16_t port, uint16_t numPointsPerType, uint16_t eventBufferSize, std::shared_ptr<IChannelListener> listener);
+	static std::shared_ptr<IChannel> CreateClientChannel(uint32_t levels, PerformanceTransport transport, DNP3Manager&, uint16_t port, std::shared_ptr<IChannelListener> listener);
+	static std::shared_ptr<IChannel> CreateServerChannel(uint32_t levels, PerformanceTransport transport, DNP3Manager&, uint16_t port, std::shared_ptr<IChannelListener> listener);
+
+	static std::shared_ptr<IMaster> CreateMaster(uint32_t levels, openpal::TimeDuration timeout, PerformanceTransport transport, DNP3Manager&, uint16_t port, std::shared_ptr<opendnp3::ISOEHandler>, std::shared_ptr<IChannelListener> listener);
+	static std::shared_ptr<IOutstation> CreateOutstation(uint32_t levels, openpal::TimeDuration timeout, PerformanceTransport transport, DNP3Manager&, uint16_t port, uint16_t numPointsPerType, uint16_t eventBufferSize, std::shared_ptr<IChannelListener> listener);
 
 	static std::string GetId(const char* name, uint16_t port);
 	void AddValue(uint32_t i, UpdateBuilder& builder);
 
 public:
 
-	PerformanceStackPair(uint32_t levels, openpal::TimeDuration timeout, DNP3Manager&, uint16_t port, uint16_t numPointsPerType, uint32_t eventsPerIteration);
+	PerformanceStackPair(uint32_t levels, openpal::TimeDuration timeout, DNP3Manager&, uint16_t port, uint16_t numPointsPerType, uint32_t eventsPerIteration, PerformanceTransport transport = PerformanceTransport::TCP);
 
 	void WaitForChannelsOnline(std::chrono::steady_clock::duration timeout);
 
@@ -0,0 +1,212 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include "asiopal/ConnectionThrottle.h"
+
+#include "mocks/MockIO.h"
+
+#include <vector>
+
+using namespace asiopal;
+
+#define SUITE(name) "ConnectionThrottleTestSuite - " name
+
+namespace
+{
+ConnectionThrottleConfig Limit(uint32_t maxConcurrentAttempts, uint32_t maxAttemptsPerSecond = 0, uint32_t burstSize = 1)
+{
+	ConnectionThrottleConfig config;
+	config.maxConcurrentAttempts = maxConcurrentAttempts;
+	config.maxAttemptsPerSecond = maxAttemptsPerSecond;
+	config.burstSize = burstSize;
+	return config;
+}
+}
+
+TEST_CASE(SUITE("attempts start immediately when unlimited"))
+{
+	auto io = MockIO::Create();
+	auto throttle = ConnectionThrottle::Create(io);
+
+	size_t started = 0;
+	for (int i = 0; i < 10; ++i)
+	{
+		throttle->Request(io->GetExecutor(), [&](const std::shared_ptr<ConnectionThrottle::Permit>&)
+		{
+			++started;
+		});
+	}
+
+	io->RunUntilOutOfWork();
+
+	REQUIRE(started == 10);
+	const auto stats = throttle->GetStatistics();
+	REQUIRE(stats.numStarted == 10);
+	REQUIRE(stats.numDelayed == 0);
+	REQUIRE(stats.numActive == 0);
+}
+
+TEST_CASE(SUITE("concurrency limit queues attempts in FIFO order"))
+{
+	auto io = MockIO::Create();
+	auto throttle = ConnectionThrottle::Create(io);
+	throttle->Configure(Limit(2));
+
+	std::vector<int> order;
+	std::vector<std::shared_ptr<ConnectionThrottle::Permit>> permits;
+
+	for (int i = 0; i < 5; ++i)
+	{
+		throttle->Request(io->GetExecutor(), [&, i](const std::shared_ptr<ConnectionThrottle::Permit>& permit)
+		{
+			order.push_back(i);
+			permits.push_back(permit);
+		});
+	}
+
+	io->RunUntilOutOfWork();
+
+	REQUIRE(order == std::vector<int>({ 0, 1 }));
+	auto stats = throttle->GetStatistics();
+	REQUIRE(stats.numActive == 2);
+	REQUIRE(stats.numQueued == 3);
+	REQUIRE(stats.numDelayed == 3);
+
+	permits[0]->Release();
+	permits[0]->Release(); // idempotent
+	io->RunUntilOutOfWork();
+
+	REQUIRE(order == std::vector<int>({ 0, 1, 2 }));
+	REQUIRE(throttle->GetStatistics().numActive == 2);
+
+	// destroying the permits returns the remaining slots
+	permits.clear();
+	io->RunUntilOutOfWork();
+	permits.clear();
+
+	REQUIRE(order == std::vector<int>({ 0, 1, 2, 3, 4 }));
+	stats = throttle->GetStatistics();
+	REQUIRE(stats.numActive == 0);
+	REQUIRE(stats.numQueued == 0);
+	REQUIRE(stats.numStarted == 5);
+}
+
+TEST_CASE(SUITE("rate limit spreads attempts using the token bucket"))
+{
+	auto io = MockIO::Create();
+	auto throttle = ConnectionThrottle::Create(io);
+	throttle->Configure(Limit(0, 100, 2));
+
+	size_t started = 0;
+	for (int i = 0; i < 4; ++i)
+	{
+		throttle->Request(io->GetExecutor(), [&](const std::shared_ptr<ConnectionThrottle::Permit>&)
+		{
+			++started;
+		});
+	}
+
+	// the burst starts right away, the rest wait for tokens
+	io->RunUntilTimeout([&]()
+	{
+		return started == 2;
+	});
+	REQUIRE(throttle->GetStatistics().numQueued == 2);
+
+	io->RunUntilTimeout([&]()
+	{
+		return started == 4;
+	});
+	REQUIRE(throttle->GetStatistics().numQueued == 0);
+}
+
+TEST_CASE(SUITE("shutdown discards queued attempts"))
+{
+	auto io = MockIO::Create();
+	auto throttle = ConnectionThrottle::Create(io);
+	throttle->Configure(Limit(1));
+
+	size_t started = 0;
+	std::shared_ptr<ConnectionThrottle::Permit> held;
+	for (int i = 0; i < 3; ++i)
+	{
+		throttle->Request(io->GetExecutor(), [&](const std::shared_ptr<ConnectionThrottle::Permit>& permit)
+		{
+			++started;
+			held = permit;
+		});
+	}
+
+	io->RunUntilOutOfWork();
+	REQUIRE(started == 1);
+
+	throttle->Shutdown();
+	held.reset();
+	io->RunUntilOutOfWork();
+
+	REQUIRE(started == 1);
+	REQUIRE(throttle->GetStatistics().numQueued == 0);
+}
+
+TEST_CASE(SUITE("cancel discards the queued attempts of one executor and releases them"))
+{
+	auto io = MockIO::Create();
+	auto throttle = ConnectionThrottle::Create(io);
+	throttle->Configure(Limit(1));
+
+	auto first = io->GetExecutor();
+	auto second = io->GetExecutor();
+
+	std::vector<int> started;
+	std::shared_ptr<ConnectionThrottle::Permit> held;
+	auto owner = std::make_shared<int>(0);
+
+	throttle->Request(first, [&](const std::shared_ptr<ConnectionThrottle::Permit>& permit)
+	{
+		started.push_back(0);
+		held = permit;
+	});
+	throttle->Request(first, [&, owner](const std::shared_ptr<ConnectionThrottle::Permit>& permit)
+	{
+		started.push_back(1);
+		held = permit;
+	});
+	throttle->Request(second, [&](const std::shared_ptr<ConnectionThrottle::Permit>& permit)
+	{
+		started.push_back(2);
+		held = permit;
+	});
+
+	io->RunUntilOutOfWork();
+	REQUIRE(started == std::vector<int>({ 0 }));
+	REQUIRE(owner.use_count() == 2);
+
+	throttle->Cancel(first);
+	REQUIRE(owner.use_count() == 1);
+	REQUIRE(throttle->GetStatistics().numQueued == 1);
+
+	held.reset();
+	io->RunUntilOutOfWork();
+
+	REQUIRE(started == std::vector<int>({ 0, 2 }));
+	REQUIRE(throttle->GetStatistics().numQueued == 0);
+}
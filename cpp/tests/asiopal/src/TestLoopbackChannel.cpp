@@ -0,0 +1,243 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include "mocks/MockIO.h"
+
+#include "asiopal/LoopbackChannel.h"
+
+#include <string>
+
+using namespace asiopal;
+using namespace openpal;
+
+#define SUITE(name) "LoopbackChannelTestSuite - " name
+
+namespace
+{
+
+class Callbacks final : public IChannelCallbacks
+{
+
+public:
+
+	virtual void OnReadComplete(const std::error_code& ec, size_t num) override
+	{
+		if (ec)
+		{
+			readErrors.push_back(ec);
+		}
+		else
+		{
+			rx.append(reinterpret_cast<const char*>(buffer), num);
+		}
+	}
+
+	virtual void OnWriteComplete(const std::error_code& ec, size_t num) override
+	{
+		if (ec)
+		{
+			writeErrors.push_back(ec);
+		}
+		else
+		{
+			numWritten += num;
+			++numWrites;
+		}
+	}
+
+	WSlice Buffer()
+	{
+		return WSlice(buffer, sizeof(buffer));
+	}
+
+	uint8_t buffer[64];
+	std::string rx;
+	size_t numWritten = 0;
+	size_t numWrites = 0;
+	std::vector<std::error_code> readErrors;
+	std::vector<std::error_code> writeErrors;
+};
+
+RSlice ToSlice(const std::string& data)
+{
+	return RSlice(reinterpret_cast<const uint8_t*>(data.data()), static_cast<uint32_t>(data.size()));
+}
+
+struct LoopbackFixture
+{
+	LoopbackFixture(const LoopbackConfig& config = LoopbackConfig()) :
+		io(MockIO::Create()),
+		channels(LoopbackChannel::CreatePair(io->GetExecutor(), io->GetExecutor(), config)),
+		first(std::make_shared<Callbacks>()),
+		second(std::make_shared<Callbacks>())
+	{
+		channels.first->SetCallbacks(first);
+		channels.second->SetCallbacks(second);
+	}
+
+	~LoopbackFixture()
+	{
+		// run any notifications still in flight so that the channels are released
+		channels.first->Shutdown();
+		channels.second->Shutdown();
+		io->RunUntilOutOfWork();
+	}
+
+	// keep reading on the second channel until the expected number of bytes have arrived
+	void ReadAll(size_t num)
+	{
+		auto condition = [&]()
+		{
+			if (second->rx.size() < num && channels.second->CanRead())
+			{
+				channels.second->BeginRead(second->Buffer());
+			}
+			return second->rx.size() == num;
+		};
+
+		io->RunUntilTimeout(condition, std::chrono::seconds(5));
+	}
+
+	std::shared_ptr<MockIO> io;
+	LoopbackChannel::pair_t channels;
+	std::shared_ptr<Callbacks> first;
+	std::shared_ptr<Callbacks> second;
+};
+
+}
+
+TEST_CASE(SUITE("data written to one end is read from the other"))
+{
+	LoopbackFixture fixture;
+
+	REQUIRE(fixture.channels.first->BeginWrite(ToSlice("hello")));
+	REQUIRE(fixture.channels.second->BeginRead(fixture.second->Buffer()));
+	fixture.io->RunUntilOutOfWork();
+
+	REQUIRE(fixture.first->numWritten == 5);
+	REQUIRE(fixture.second->rx == "hello");
+
+	REQUIRE(fixture.channels.first->BeginRead(fixture.first->Buffer()));
+	REQUIRE(fixture.channels.second->BeginWrite(ToSlice("world")));
+	fixture.io->RunUntilOutOfWork();
+
+	REQUIRE(fixture.first->rx == "world");
+}
+
+TEST_CASE(SUITE("writes larger than the ring buffer complete as the peer reads"))
+{
+	LoopbackConfig config;
+	config.bufferSize = 16;
+	LoopbackFixture fixture(config);
+
+	std::string data;
+	for (int i = 0; i < 1000; ++i)
+	{
+		data.push_back(static_cast<char>('a' + (i % 26)));
+	}
+
+	REQUIRE(fixture.channels.first->BeginWrite(ToSlice(data)));
+	fixture.io->RunUntilOutOfWork();
+
+	// the ring is full and nobody is reading
+	REQUIRE(fixture.first->numWrites == 0);
+
+	fixture.ReadAll(data.size());
+
+	REQUIRE(fixture.second->rx == data);
+	REQUIRE(fixture.first->numWritten == data.size());
+}
+
+TEST_CASE(SUITE("peer shutdown is reported as end of file after buffered data"))
+{
+	LoopbackFixture fixture;
+
+	REQUIRE(fixture.channels.first->BeginWrite(ToSlice("bye")));
+	fixture.io->RunUntilOutOfWork();
+	fixture.channels.first->Shutdown();
+	fixture.io->RunUntilOutOfWork();
+
+	REQUIRE(fixture.channels.second->BeginRead(fixture.second->Buffer()));
+	fixture.io->RunUntilOutOfWork();
+	REQUIRE(fixture.second->rx == "bye");
+
+	REQUIRE(fixture.channels.second->BeginRead(fixture.second->Buffer()));
+	fixture.io->RunUntilOutOfWork();
+	REQUIRE(fixture.second->readErrors.size() == 1);
+
+	REQUIRE(fixture.channels.second->BeginWrite(ToSlice("hello?")));
+	fixture.io->RunUntilOutOfWork();
+	REQUIRE(fixture.second->writeErrors.size() == 1);
+}
+
+TEST_CASE(SUITE("shutdown completes a pending read"))
+{
+	LoopbackFixture fixture;
+
+	REQUIRE(fixture.channels.second->BeginRead(fixture.second->Buffer()));
+	fixture.io->RunUntilOutOfWork();
+	REQUIRE_FALSE(fixture.channels.second->CanRead());
+
+	fixture.channels.second->Shutdown();
+	fixture.io->RunUntilOutOfWork();
+
+	// the channel is shut down once its read has completed and it no longer reports to the callbacks
+	REQUIRE(fixture.second->readErrors.empty());
+	REQUIRE_FALSE(fixture.channels.second->CanRead());
+	REQUIRE(fixture.channels.second.use_count() == 1);
+}
+
+TEST_CASE(SUITE("rate shaping delays write completion"))
+{
+	LoopbackConfig config;
+	config.bytesPerSecond = 10000;
+	LoopbackFixture fixture(config);
+
+	const std::string data(500, 'x');
+
+	const auto start = steady_clock_t::now();
+	REQUIRE(fixture.channels.first->BeginWrite(ToSlice(data)));
+	fixture.ReadAll(data.size());
+	fixture.io->RunUntilTimeout([&]() { return fixture.first->numWrites == 1; });
+
+	// 500 bytes at 10 kB/s
+	REQUIRE((steady_clock_t::now() - start) >= std::chrono::milliseconds(50));
+	REQUIRE(fixture.second->rx == data);
+}
+
+TEST_CASE(SUITE("latency shaping delays delivery but not write completion"))
+{
+	LoopbackConfig config;
+	config.latency = TimeDuration::Milliseconds(50);
+	LoopbackFixture fixture(config);
+
+	const auto start = steady_clock_t::now();
+	REQUIRE(fixture.channels.first->BeginWrite(ToSlice("ping")));
+	REQUIRE(fixture.channels.second->BeginRead(fixture.second->Buffer()));
+
+	fixture.io->RunUntilTimeout([&]() { return fixture.first->numWrites == 1; });
+	REQUIRE(fixture.second->rx.empty());
+
+	fixture.io->RunUntilTimeout([&]() { return fixture.second->rx.size() == 4; });
+	REQUIRE(fixture.second->rx == "ping");
+	REQUIRE((steady_clock_t::now() - start) >= std::chrono::milliseconds(50));
+}
@@ -0,0 +1,85 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include "asiopal/IOpenDelayStrategy.h"
+
+using namespace asiopal;
+using namespace openpal;
+
+#define SUITE(name) "OpenDelayStrategyTestSuite - " name
+
+TEST_CASE(SUITE("exponential backoff doubles up to the maximum without jitter"))
+{
+	auto& strategy = ExponentialBackoffStrategy::Instance();
+
+	REQUIRE(strategy.GetNextDelay(TimeDuration::Seconds(1), TimeDuration::Seconds(3)) == TimeDuration::Seconds(2));
+	REQUIRE(strategy.GetNextDelay(TimeDuration::Seconds(2), TimeDuration::Seconds(3)) == TimeDuration::Seconds(3));
+	REQUIRE(strategy.GetWaitTime(TimeDuration::Seconds(2)) == TimeDuration::Seconds(2));
+}
+
+TEST_CASE(SUITE("full jitter waits are within zero and the delay"))
+{
+	auto& strategy = FullJitterBackoffStrategy::Instance();
+
+	REQUIRE(strategy.GetNextDelay(TimeDuration::Seconds(1), TimeDuration::Seconds(60)) == TimeDuration::Seconds(2));
+
+	const auto delay = TimeDuration::Seconds(10);
+	bool varies = false;
+	auto first = strategy.GetWaitTime(delay);
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		const auto wait = strategy.GetWaitTime(delay);
+		REQUIRE(wait.GetMilliseconds() >= 0);
+		REQUIRE(wait.GetMilliseconds() <= delay.GetMilliseconds());
+		varies |= !(wait == first);
+	}
+
+	REQUIRE(varies);
+}
+
+TEST_CASE(SUITE("decorrelated jitter stays within the minimum and three times the current delay"))
+{
+	auto& strategy = DecorrelatedJitterStrategy::Instance();
+
+	const auto min = TimeDuration::Seconds(1);
+	const auto max = TimeDuration::Seconds(60);
+	auto current = min;
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		const auto next = strategy.GetNextDelay(current, min, max);
+		REQUIRE(next.GetMilliseconds() >= min.GetMilliseconds());
+		REQUIRE(next.GetMilliseconds() <= std::min<int64_t>(3 * current.GetMilliseconds(), max.GetMilliseconds()));
+		REQUIRE(strategy.GetWaitTime(next) == next);
+		current = next;
+	}
+}
+
+TEST_CASE(SUITE("strategies without a minimum ignore it when called through the concrete type"))
+{
+	const auto& exponential = static_cast<const ExponentialBackoffStrategy&>(ExponentialBackoffStrategy::Instance());
+	const auto& jitter = static_cast<const FullJitterBackoffStrategy&>(FullJitterBackoffStrategy::Instance());
+
+	REQUIRE(exponential.GetNextDelay(TimeDuration::Seconds(1), TimeDuration::Seconds(5), TimeDuration::Seconds(60)) == TimeDuration::Seconds(2));
+	REQUIRE(jitter.GetNextDelay(TimeDuration::Seconds(1), TimeDuration::Seconds(5), TimeDuration::Seconds(60)) == TimeDuration::Seconds(2));
+}
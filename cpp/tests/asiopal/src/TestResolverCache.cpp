@@ -0,0 +1,78 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include "asiopal/ResolverCache.h"
+
+using namespace asiopal;
+using namespace openpal;
+
+#define SUITE(name) "ResolverCacheTestSuite - " name
+
+namespace
+{
+ResolverCache::endpoints_t GetEndpoints(const std::string& address, uint16_t port)
+{
+	return { asio::ip::tcp::endpoint(asio::ip::address::from_string(address), port) };
+}
+}
+
+TEST_CASE(SUITE("stored addresses can be retrieved until they expire"))
+{
+	ResolverCache cache(TimeDuration::Seconds(10));
+	const auto now = steady_clock_t::now();
+
+	cache.Store("outstation", 20000, GetEndpoints("192.168.0.1", 20000), now);
+
+	ResolverCache::endpoints_t endpoints;
+	REQUIRE(cache.Lookup("outstation", 20000, now + std::chrono::seconds(9), endpoints));
+	REQUIRE(endpoints == GetEndpoints("192.168.0.1", 20000));
+
+	REQUIRE_FALSE(cache.Lookup("outstation", 20000, now + std::chrono::seconds(10), endpoints));
+	REQUIRE(cache.Size() == 0);
+}
+
+TEST_CASE(SUITE("entries are keyed by host and port"))
+{
+	ResolverCache cache(TimeDuration::Seconds(10));
+
+	cache.Store("outstation", 20000, GetEndpoints("192.168.0.1", 20000));
+
+	ResolverCache::endpoints_t endpoints;
+	REQUIRE_FALSE(cache.Lookup("outstation", 20001, endpoints));
+	REQUIRE_FALSE(cache.Lookup("backup", 20000, endpoints));
+	REQUIRE(cache.Lookup("outstation", 20000, endpoints));
+}
+
+TEST_CASE(SUITE("removed and empty entries are not cached"))
+{
+	ResolverCache cache(TimeDuration::Seconds(10));
+
+	cache.Store("outstation", 20000, GetEndpoints("192.168.0.1", 20000));
+	cache.Store("backup", 20000, ResolverCache::endpoints_t());
+	REQUIRE(cache.Size() == 1);
+
+	cache.Remove("outstation", 20000);
+
+	ResolverCache::endpoints_t endpoints;
+	REQUIRE_FALSE(cache.Lookup("outstation", 20000, endpoints));
+	REQUIRE(cache.Size() == 0);
+}
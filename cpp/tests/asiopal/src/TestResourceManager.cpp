@@ -0,0 +1,202 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include "asiopal/ResourceManager.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace asiopal;
+
+#define SUITE(name) "ResourceManagerTestSuite - " name
+
+namespace
+{
+class MockResource final : public IResource
+{
+public:
+
+	virtual void Shutdown() override
+	{
+		++numShutdown;
+	}
+
+	size_t numShutdown = 0;
+};
+
+std::shared_ptr<MockResource> Bind(ResourceManager& manager)
+{
+	return manager.Bind<MockResource>([]()
+	{
+		return std::make_shared<MockResource>();
+	});
+}
+
+// each thread repeatedly binds and detaches resources, returns the number of binds per second
+double Churn(size_t numThreads, size_t numIterations)
+{
+	auto manager = ResourceManager::Create();
+
+	const auto start = std::chrono::steady_clock::now();
+
+	std::vector<std::thread> threads;
+	for (size_t i = 0; i < numThreads; ++i)
+	{
+		threads.emplace_back([&]()
+		{
+			for (size_t j = 0; j < numIterations; ++j)
+			{
+				auto resource = Bind(*manager);
+				manager->Detach(resource);
+			}
+		});
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	const auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() - start).count();
+
+	REQUIRE(manager->Size() == 0);
+
+	return (numThreads * numIterations) / elapsed;
+}
+}
+
+TEST_CASE(SUITE("shutdown sweeps every bound resource"))
+{
+	ResourceManager manager;
+
+	std::vector<std::shared_ptr<MockResource>> resources;
+	for (int i = 0; i < 100; ++i)
+	{
+		resources.push_back(Bind(manager));
+	}
+
+	manager.Detach(resources[0]);
+	REQUIRE(manager.Size() == 99);
+
+	manager.Shutdown();
+
+	REQUIRE(resources[0]->numShutdown == 0);
+	for (size_t i = 1; i < resources.size(); ++i)
+	{
+		REQUIRE(resources[i]->numShutdown == 1);
+	}
+	REQUIRE(manager.Size() == 0);
+}
+
+TEST_CASE(SUITE("nothing is created after shutdown"))
+{
+	ResourceManager manager;
+	manager.Shutdown();
+
+	bool created = false;
+	auto resource = manager.Bind<MockResource>([&]()
+	{
+		created = true;
+		return std::make_shared<MockResource>();
+	});
+
+	REQUIRE_FALSE(created);
+	REQUIRE_FALSE(resource);
+}
+
+TEST_CASE(SUITE("resource that detaches before the bind completes is not tracked"))
+{
+	ResourceManager manager;
+
+	auto resource = manager.Bind<MockResource>([&]()
+	{
+		auto item = std::make_shared<MockResource>();
+		// e.g. the connection closed on another thread while the session was being created
+		manager.Detach(item);
+		return item;
+	});
+
+	REQUIRE(resource);
+	REQUIRE(manager.Size() == 0);
+
+	manager.Shutdown();
+	REQUIRE(resource->numShutdown == 0);
+}
+
+TEST_CASE(SUITE("early detach does not affect resources bound later"))
+{
+	ResourceManager manager;
+
+	for (int i = 0; i < 10; ++i)
+	{
+		// the allocator is likely to reuse the address of the previous resource
+		manager.Bind<MockResource>([&]()
+		{
+			auto item = std::make_shared<MockResource>();
+			manager.Detach(item);
+			return item;
+		});
+
+		auto resource = Bind(manager);
+		REQUIRE(manager.Size() == 1);
+		manager.Detach(resource);
+		REQUIRE(manager.Size() == 0);
+	}
+}
+
+TEST_CASE(SUITE("repeated detach does not affect resources bound later"))
+{
+	ResourceManager manager;
+
+	for (int i = 0; i < 10; ++i)
+	{
+		auto resource = Bind(manager);
+		manager.Detach(resource);
+		manager.Detach(resource);
+		resource.reset();
+
+		// the allocator is likely to reuse the address of the previous resource
+		auto next = Bind(manager);
+		REQUIRE(manager.Size() == 1);
+		manager.Detach(next);
+		REQUIRE(manager.Size() == 0);
+	}
+}
+
+TEST_CASE(SUITE("concurrent binds and detaches leave the registry empty"))
+{
+	Churn(4, 10000);
+}
+
+TEST_CASE(SUITE("bind and detach churn"), "[.benchmark]")
+{
+	const size_t NUM_ITERATIONS = 250000;
+
+	for (size_t numThreads : { 1u, 2u, 4u, 8u })
+	{
+		const auto rate = Churn(numThreads, NUM_ITERATIONS);
+		std::cout << numThreads << " thread(s): " << static_cast<uint64_t>(rate) << " bind + detach / sec" << std::endl;
+	}
+}
@@ -0,0 +1,282 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include "mocks/MockIO.h"
+
+#include "asiopal/ASIOSerialHelpers.h"
+#include "asiopal/SerialChannel.h"
+
+#ifdef __linux__
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <cstdlib>
+#endif
+
+#include <deque>
+
+using namespace asiopal;
+using namespace openpal;
+using namespace opendnp3;
+
+#define SUITE(name) "SerialChannelTestSuite - " name
+
+TEST_CASE(SUITE("character time includes start, parity, and stop bits"))
+{
+	SerialSettings settings;
+	settings.baud = 9600;
+
+	// 8/N/1 is 10 bits per character
+	REQUIRE(GetCharacterTime(settings) == std::chrono::nanoseconds(1041666));
+
+	settings.parity = Parity::Even;
+	settings.stopBits = StopBits::Two;
+
+	// 1 + 8 + 1 + 2
+	REQUIRE(GetCharacterTime(settings) == std::chrono::nanoseconds(1250000));
+
+	settings.parity = Parity::None;
+	settings.stopBits = StopBits::OnePointFive;
+
+	// 1 + 8 + 1.5
+	REQUIRE(GetCharacterTime(settings) == std::chrono::nanoseconds(1093750));
+}
+
+#ifdef __linux__
+
+namespace
+{
+
+class PtyPair
+{
+
+public:
+
+	PtyPair() : fd(posix_openpt(O_RDWR | O_NOCTTY))
+	{
+		if (fd >= 0 && grantpt(fd) == 0 && unlockpt(fd) == 0)
+		{
+			const auto name = ptsname(fd);
+			if (name)
+			{
+				this->slave = name;
+			}
+		}
+	}
+
+	~PtyPair()
+	{
+		if (fd >= 0)
+		{
+			close(fd);
+		}
+	}
+
+	bool IsOpen() const
+	{
+		return fd >= 0 && !slave.empty();
+	}
+
+	void Write(const std::string& data)
+	{
+		REQUIRE(write(fd, data.data(), data.size()) == static_cast<ssize_t>(data.size()));
+	}
+
+	std::string Read()
+	{
+		const auto flags = fcntl(fd, F_GETFL);
+		fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+
+		std::string output;
+		char buffer[256];
+		ssize_t num = 0;
+		while ((num = read(fd, buffer, sizeof(buffer))) > 0)
+		{
+			output.append(buffer, static_cast<size_t>(num));
+		}
+
+		fcntl(fd, F_SETFL, flags);
+		return output;
+	}
+
+	const int fd;
+	std::string slave;
+};
+
+class Callbacks final : public IChannelCallbacks
+{
+
+public:
+
+	virtual void OnReadComplete(const std::error_code& ec, size_t num) override
+	{
+		REQUIRE_FALSE(ec);
+		rx.append(reinterpret_cast<const char*>(buffer), num);
+		readTimes.push_back(steady_clock_t::now());
+	}
+
+	virtual void OnWriteComplete(const std::error_code& ec, size_t num) override
+	{
+		REQUIRE_FALSE(ec);
+		writeTimes.push_back(steady_clock_t::now());
+	}
+
+	uint8_t buffer[256];
+	std::string rx;
+	std::deque<steady_clock_t::time_point> readTimes;
+	std::deque<steady_clock_t::time_point> writeTimes;
+};
+
+SerialSettings GetSettings(const PtyPair& pty)
+{
+	SerialSettings settings;
+	settings.deviceName = pty.slave;
+	settings.baud = 115200;
+	settings.lowLatency = true;
+	return settings;
+}
+
+}
+
+TEST_CASE(SUITE("low latency channel exchanges data over a pty pair"))
+{
+	PtyPair pty;
+	REQUIRE(pty.IsOpen());
+
+	auto io = MockIO::Create();
+	auto channel = SerialChannel::Create(io->GetExecutor());
+	auto callbacks = std::make_shared<Callbacks>();
+	channel->SetCallbacks(callbacks);
+
+	std::error_code ec;
+	REQUIRE(channel->Open(GetSettings(pty), ec));
+	REQUIRE_FALSE(ec);
+
+	REQUIRE(channel->BeginRead(WSlice(callbacks->buffer, sizeof(callbacks->buffer))));
+	pty.Write("hello");
+	io->RunUntilTimeout([&]() { return callbacks->rx.size() == 5; });
+	REQUIRE(callbacks->rx == "hello");
+
+	const std::string tx = "world";
+	REQUIRE(channel->BeginWrite(RSlice(reinterpret_cast<const uint8_t*>(tx.data()), static_cast<uint32_t>(tx.size()))));
+	io->RunUntilTimeout([&]() { return callbacks->writeTimes.size() == 1; });
+	REQUIRE(pty.Read() == tx);
+
+	channel->Shutdown();
+	io->RunUntilOutOfWork();
+}
+
+TEST_CASE(SUITE("consecutive writes are separated by the minimum inter-frame gap"))
+{
+	PtyPair pty;
+	REQUIRE(pty.IsOpen());
+
+	auto io = MockIO::Create();
+	auto channel = SerialChannel::Create(io->GetExecutor());
+	auto callbacks = std::make_shared<Callbacks>();
+	channel->SetCallbacks(callbacks);
+
+	auto settings = GetSettings(pty);
+	settings.minInterFrameGap = TimeDuration::Milliseconds(50);
+
+	std::error_code ec;
+	REQUIRE(channel->Open(settings, ec));
+
+	const uint8_t frame[] = { 0x05, 0x64 };
+
+	REQUIRE(channel->BeginWrite(RSlice(frame, sizeof(frame))));
+	io->RunUntilTimeout([&]() { return callbacks->writeTimes.size() == 1; });
+
+	REQUIRE(channel->BeginWrite(RSlice(frame, sizeof(frame))));
+	io->RunUntilTimeout([&]() { return callbacks->writeTimes.size() == 2; });
+
+	REQUIRE(callbacks->writeTimes.size() == 2);
+	REQUIRE((callbacks->writeTimes[1] - callbacks->writeTimes[0]) >= std::chrono::milliseconds(50));
+	REQUIRE(pty.Read().size() == 4);
+
+	channel->Shutdown();
+	io->RunUntilOutOfWork();
+}
+
+TEST_CASE(SUITE("a response is delayed by the turnaround time after the last received byte"))
+{
+	PtyPair pty;
+	REQUIRE(pty.IsOpen());
+
+	auto io = MockIO::Create();
+	auto channel = SerialChannel::Create(io->GetExecutor());
+	auto callbacks = std::make_shared<Callbacks>();
+	channel->SetCallbacks(callbacks);
+
+	auto settings = GetSettings(pty);
+	settings.turnaroundDelay = TimeDuration::Milliseconds(50);
+
+	std::error_code ec;
+	REQUIRE(channel->Open(settings, ec));
+
+	REQUIRE(channel->BeginRead(WSlice(callbacks->buffer, sizeof(callbacks->buffer))));
+	pty.Write("request");
+	io->RunUntilTimeout([&]() { return callbacks->rx.size() == 7; });
+	REQUIRE(callbacks->readTimes.size() == 1);
+
+	const uint8_t response[] = { 0x05, 0x64 };
+	REQUIRE(channel->BeginWrite(RSlice(response, sizeof(response))));
+	io->RunUntilTimeout([&]() { return callbacks->writeTimes.size() == 1; });
+
+	REQUIRE(callbacks->writeTimes.size() == 1);
+	REQUIRE((callbacks->writeTimes[0] - callbacks->readTimes[0]) >= std::chrono::milliseconds(50));
+
+	channel->Shutdown();
+	io->RunUntilOutOfWork();
+}
+
+TEST_CASE(SUITE("shutdown cancels a write that is waiting for the line"))
+{
+	PtyPair pty;
+	REQUIRE(pty.IsOpen());
+
+	auto io = MockIO::Create();
+	auto channel = SerialChannel::Create(io->GetExecutor());
+	auto callbacks = std::make_shared<Callbacks>();
+	channel->SetCallbacks(callbacks);
+
+	auto settings = GetSettings(pty);
+	settings.turnaroundDelay = TimeDuration::Seconds(10);
+
+	std::error_code ec;
+	REQUIRE(channel->Open(settings, ec));
+
+	REQUIRE(channel->BeginRead(WSlice(callbacks->buffer, sizeof(callbacks->buffer))));
+	pty.Write("request");
+	io->RunUntilTimeout([&]() { return callbacks->rx.size() == 7; });
+
+	const uint8_t response[] = { 0x05, 0x64 };
+	REQUIRE(channel->BeginWrite(RSlice(response, sizeof(response))));
+
+	channel->Shutdown();
+	io->RunUntilOutOfWork();
+
+	// the channel stops reporting once it is shutting down
+	REQUIRE(callbacks->writeTimes.empty());
+	REQUIRE(pty.Read().empty());
+}
+
+#endif
@@ -23,6 +23,7 @@
 #include "mocks/MockTCPPair.h"
 
 #include <iostream>
+#include <set>
 
 using namespace asiopal;
 
@@ -57,12 +58,63 @@ TEST_CASE(SUITE("Client and server can connect"))
 	}
 }
 
+TEST_CASE(SUITE("Client races remotes and connects to the backup when the primary is a blackhole"))
+{
+	WithIO([](const std::shared_ptr<MockIO>& io)
+	{
+		MockTCPPair pair(io, 20000);
 
+		// nothing answers on this non-routable address, a sequential connect would wait for the OS timeout
+		const std::vector<IPEndpoint> remotes = { IPEndpoint("10.255.255.1", 20000), IPEndpoint::Localhost(20000) };
 
+		const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(pair.Connect(remotes, openpal::TimeDuration::Milliseconds(100))).count();
 
+		std::cout << "time to online with a blackholed primary: " << elapsed << " ms" << std::endl;
 
+		REQUIRE(elapsed < 1000);
+	});
+}
 
 
+TEST_CASE(SUITE("Acceptor shards share a port and interleave session ids"))
+{
+	WithIO([](const std::shared_ptr<MockIO>& io)
+	{
+		const uint32_t NUM_SHARDS = 2;
+		const size_t NUM_CLIENTS = 20;
 
+		std::vector<std::shared_ptr<MockTCPServer>> servers;
+		for (uint32_t i = 0; i < NUM_SHARDS; ++i)
+		{
+			std::error_code ec;
+			servers.push_back(MockTCPServer::Create(openpal::Logger::Empty(), io->GetExecutor(), IPEndpoint::Localhost(20000), AcceptorShard(i, NUM_SHARDS), ec));
+			REQUIRE_FALSE(ec);
+		}
+
+		// the kernel completes loopback connects from the listen backlog
+		std::vector<std::unique_ptr<asio::ip::tcp::socket>> clients;
+		for (size_t i = 0; i < NUM_CLIENTS; ++i)
+		{
+			clients.push_back(std::make_unique<asio::ip::tcp::socket>(io->service));
+			clients.back()->connect(asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 20000));
+		}
 
+		io->RunUntilTimeout([&]()
+		{
+			return (servers[0]->sessionids.size() + servers[1]->sessionids.size()) == NUM_CLIENTS;
+		});
 
+		std::set<uint64_t> ids;
+		for (uint32_t i = 0; i < NUM_SHARDS; ++i)
+		{
+			for (auto id : servers[i]->sessionids)
+			{
+				REQUIRE((id % NUM_SHARDS) == i);
+				ids.insert(id);
+			}
+			servers[i]->Shutdown();
+		}
+
+		REQUIRE(ids.size() == NUM_CLIENTS);
+	});
+}
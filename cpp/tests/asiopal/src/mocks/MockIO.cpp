@@ -118,14 +118,15 @@ size_t MockIO::RunUntilOutOfWork()
 		const auto num = this->service.poll_one(ec);
 		if (ec) throw std::logic_error(ec.message());
 
+		// running out of work stops the io_context, always leave it ready to run again
+		this->service.reset();
+
 		if (num == 0)
 		{
 			return iterations;
 		}
 
 		++iterations;
-
-		this->service.reset();
 	}
 }
 
@@ -64,6 +64,30 @@ void MockTCPPair::Connect(size_t num)
 	io->CompleteInXIterations(2, connected);
 }
 
+std::chrono::steady_clock::duration MockTCPPair::Connect(const std::vector<IPEndpoint>& remotes, const openpal::TimeDuration& attemptDelay)
+{
+	auto callback = [handler = this->chandler](const std::shared_ptr<Executor>& executor, asio::ip::tcp::socket socket, const std::error_code & ec)
+	{
+		handler->OnConnect(executor, std::move(socket), ec);
+	};
+
+	const auto start = std::chrono::steady_clock::now();
+
+	if (!this->client->BeginConnect(remotes, attemptDelay, callback))
+	{
+		throw std::logic_error("BeginConnect returned false");
+	}
+
+	auto connected = [this]() -> bool
+	{
+		return this->NumConnectionsEqual(1);
+	};
+
+	io->RunUntilTimeout(connected, std::chrono::seconds(2));
+
+	return std::chrono::steady_clock::now() - start;
+}
+
 bool MockTCPPair::NumConnectionsEqual(size_t num) const
 {
 	return (this->server->channels.size() == num) && (this->chandler->channels.size() == num);
@@ -30,6 +30,9 @@
 
 #include "testlib/MockLogHandler.h"
 
+#include <chrono>
+#include <vector>
+
 namespace asiopal
 {
 
@@ -44,6 +47,9 @@ public:
 
 	void Connect(size_t num = 1);
 
+	/// Race connections to several remotes, returns the time it took to connect
+	std::chrono::steady_clock::duration Connect(const std::vector<IPEndpoint>& remotes, const openpal::TimeDuration& attemptDelay);
+
 	bool NumConnectionsEqual(size_t num) const;
 
 private:
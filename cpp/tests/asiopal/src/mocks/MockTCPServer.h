@@ -46,13 +46,34 @@ public:
 
 	}
 
+	MockTCPServer(
+	    const openpal::Logger& logger,
+	    std::shared_ptr<Executor> executor,
+	    IPEndpoint endpoint,
+	    const AcceptorShard& shard,
+	    std::error_code& ec
+	) : TCPServer(logger, executor, endpoint, shard, ec)
+	{
+
+	}
+
+	static std::shared_ptr<MockTCPServer> Create(
+	    const openpal::Logger& logger,
+	    std::shared_ptr<Executor> executor,
+	    IPEndpoint endpoint,
+	    std::error_code& ec)
+	{
+		return Create(logger, executor, endpoint, AcceptorShard(), ec);
+	}
+
 	static std::shared_ptr<MockTCPServer> Create(
 	    const openpal::Logger& logger,
 	    std::shared_ptr<Executor> executor,
 	    IPEndpoint endpoint,
+	    const AcceptorShard& shard,
 	    std::error_code& ec)
 	{
-		auto server = std::make_shared<MockTCPServer>(logger, executor, endpoint, ec);
+		auto server = std::make_shared<MockTCPServer>(logger, executor, endpoint, shard, ec);
 
 		if (!ec)
 		{
@@ -63,8 +84,9 @@ public:
 	}
 
 
-	virtual void AcceptConnection(uint64_t sessionid, const std::shared_ptr<Executor>& executor, asio::ip::tcp::socket socket) override
+	virtual void AcceptConnection(uint64_t sessionid, const std::shared_ptr<Executor>& executor, asio::ip::tcp::socket socket, const asio::ip::tcp::endpoint& remote) override
 	{
+		this->sessionids.push_back(sessionid);
 		this->channels.push_back(SocketChannel::Create(executor, std::move(socket)));
 	}
 
@@ -79,6 +101,7 @@ public:
 	}
 
 	std::deque<std::shared_ptr<IAsyncChannel>> channels;
+	std::deque<uint64_t> sessionids;
 };
 
 }
@@ -88,12 +88,110 @@ TEST_CASE(SUITE("client and server can connect"))
 	}
 }
 
+bool have_test_certificates()
+{
+	if (exists(get_path("entity1_key.pem")) && exists(get_path("entity2_key.pem")) && exists(get_path("entity1_cert.pem")) && exists(get_path("entity2_cert.pem")))
+	{
+		return true;
+	}
+
+	std::cout << "Could not locate one or more of the test TLS certificates. Expected to be run from the project root directory." << std::endl;
+	std::cout << "This test will be skipped." << std::endl;
+	return false;
+}
+
+template <class F>
+void WithReconnect(TLSConfig& client, TLSConfig& server, const F& verify)
+{
+	auto test = [&](const std::shared_ptr<MockIO>& io)
+	{
+		MockTLSPair pair(io, 20001, client, server);
+
+		pair.Connect(1);
+		io->RunUntilOutOfWork(); // process any session tickets sent after the handshake
+		pair.Connect(2);
+
+		verify(pair.GetClientStatistics(), pair.GetServerStatistics());
+	};
+
+	WithIO(test);
+}
+
+TEST_CASE(SUITE("every handshake is a full handshake when resumption is disabled"))
+{
+	if (!have_test_certificates()) return;
+
+	TLSConfig cfg1(get_path("entity2_cert.pem"), get_path("entity1_cert.pem"), get_path("entity1_key.pem"));
+	TLSConfig cfg2(get_path("entity1_cert.pem"), get_path("entity2_cert.pem"), get_path("entity2_key.pem"));
 
+	WithReconnect(cfg1, cfg2, [](const TLSStatistics & client, const TLSStatistics & server)
+	{
+		REQUIRE(client.numFullHandshake == 2);
+		REQUIRE(client.numResumedHandshake == 0);
+		REQUIRE(server.numFullHandshake == 2);
+		REQUIRE(server.numResumedHandshake == 0);
+	});
+}
 
+TEST_CASE(SUITE("client resumes the session from the server cache on reconnect"))
+{
+	if (!have_test_certificates()) return;
 
+	TLSConfig cfg1(get_path("entity2_cert.pem"), get_path("entity1_cert.pem"), get_path("entity1_key.pem"));
+	TLSConfig cfg2(get_path("entity1_cert.pem"), get_path("entity2_cert.pem"), get_path("entity2_key.pem"));
+	cfg1.allowSessionResumption = cfg2.allowSessionResumption = true;
 
+	WithReconnect(cfg1, cfg2, [](const TLSStatistics & client, const TLSStatistics & server)
+	{
+		REQUIRE(client.numFullHandshake == 1);
+		REQUIRE(client.numResumedHandshake == 1);
+		REQUIRE(server.numFullHandshake == 1);
+		REQUIRE(server.numResumedHandshake == 1);
+		REQUIRE(client.lastHandshakeResumed);
+	});
+}
 
+TEST_CASE(SUITE("client resumes the session from a ticket on reconnect"))
+{
+	if (!have_test_certificates()) return;
 
+	TLSConfig cfg1(get_path("entity2_cert.pem"), get_path("entity1_cert.pem"), get_path("entity1_key.pem"));
+	TLSConfig cfg2(get_path("entity1_cert.pem"), get_path("entity2_cert.pem"), get_path("entity2_key.pem"));
+	cfg1.allowSessionResumption = cfg2.allowSessionResumption = true;
+	cfg1.allowSessionTickets = cfg2.allowSessionTickets = true;
 
+	WithReconnect(cfg1, cfg2, [](const TLSStatistics & client, const TLSStatistics & server)
+	{
+		REQUIRE(client.numFullHandshake == 1);
+		REQUIRE(client.numResumedHandshake == 1);
+		REQUIRE(server.numResumedHandshake == 1);
+	});
+}
 
+TEST_CASE(SUITE("a new client resumes the session negotiated by the client it replaces"))
+{
+	if (!have_test_certificates()) return;
 
+	TLSConfig cfg1(get_path("entity2_cert.pem"), get_path("entity1_cert.pem"), get_path("entity1_key.pem"));
+	TLSConfig cfg2(get_path("entity1_cert.pem"), get_path("entity2_cert.pem"), get_path("entity2_key.pem"));
+	cfg1.allowSessionResumption = cfg2.allowSessionResumption = true;
+
+	auto test = [&](const std::shared_ptr<MockIO>& io)
+	{
+		MockTLSPair pair(io, 20001, cfg1, cfg2);
+
+		pair.Connect(1);
+		io->RunUntilOutOfWork();
+
+		// this is what a TLS client channel does on every reconnect
+		pair.RecreateClient();
+		pair.Connect(2);
+
+		REQUIRE(pair.GetClientStatistics().numFullHandshake == 0);
+		REQUIRE(pair.GetClientStatistics().numResumedHandshake == 1);
+		REQUIRE(pair.GetServerStatistics().numFullHandshake == 1);
+		REQUIRE(pair.GetServerStatistics().numResumedHandshake == 1);
+	};
+
+	WithIO(test);
+}
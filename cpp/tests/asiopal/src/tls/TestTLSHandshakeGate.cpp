@@ -0,0 +1,216 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include "../mocks/MockIO.h"
+
+#include "asiopal/tls/TLSHandshakeGate.h"
+
+#include <vector>
+
+using namespace asiopal;
+using namespace openpal;
+
+#define SUITE(name) "TLSHandshakeGateTestSuite - " name
+
+namespace
+{
+const int OWNER = 0;
+
+void NoAbort() {}
+}
+
+TEST_CASE(SUITE("unlimited gate starts every handshake on its own strand"))
+{
+	auto io = MockIO::Create();
+	auto executor = io->GetExecutor();
+	auto gate = TLSHandshakeGate::Create(nullptr, 0);
+
+	std::vector<std::shared_ptr<Executor>> strands;
+
+	for (int i = 0; i < 3; ++i)
+	{
+		gate->Submit(&OWNER, executor, TimeDuration::Zero(), [&](const std::shared_ptr<Executor>& strand, const TLSHandshakeGate::release_t&)
+		{
+			REQUIRE(strand->strand.running_in_this_thread());
+			strands.push_back(strand);
+		}, NoAbort);
+	}
+
+	REQUIRE(gate->NumActive() == 3);
+	REQUIRE(gate->NumQueued() == 0);
+	REQUIRE(strands.empty()); // handshakes always start asynchronously
+
+	io->RunUntilOutOfWork();
+
+	REQUIRE(strands.size() == 3);
+	REQUIRE(strands[0] != executor);
+	REQUIRE(strands[0] != strands[1]);
+	REQUIRE(strands[1] != strands[2]);
+}
+
+TEST_CASE(SUITE("handshakes beyond the limit are queued and started in order as slots are released"))
+{
+	auto io = MockIO::Create();
+	auto executor = io->GetExecutor();
+	auto gate = TLSHandshakeGate::Create(nullptr, 2);
+
+	std::vector<int> started;
+	std::vector<TLSHandshakeGate::release_t> releases;
+
+	for (int i = 0; i < 5; ++i)
+	{
+		gate->Submit(&OWNER, executor, TimeDuration::Zero(), [&started, &releases, i](const std::shared_ptr<Executor>&, const TLSHandshakeGate::release_t& release)
+		{
+			started.push_back(i);
+			releases.push_back(release);
+		}, NoAbort);
+	}
+
+	io->RunUntilOutOfWork();
+
+	REQUIRE(started == std::vector<int>({ 0, 1 }));
+	REQUIRE(gate->NumActive() == 2);
+	REQUIRE(gate->NumQueued() == 3);
+
+	releases[0]();
+	releases[0](); // only the first call gives up the slot
+	io->RunUntilOutOfWork();
+
+	REQUIRE(started == std::vector<int>({ 0, 1, 2 }));
+	REQUIRE(gate->NumActive() == 2);
+	REQUIRE(gate->NumQueued() == 2);
+
+	releases[1]();
+	releases[2]();
+	io->RunUntilOutOfWork();
+
+	REQUIRE(started == std::vector<int>({ 0, 1, 2, 3, 4 }));
+	REQUIRE(gate->NumQueued() == 0);
+
+	releases[3]();
+	releases[4]();
+
+	REQUIRE(gate->NumActive() == 0);
+	REQUIRE(gate->PeakActive() == 2);
+}
+
+TEST_CASE(SUITE("clearing the gate discards the queued handshakes of one owner"))
+{
+	auto io = MockIO::Create();
+	auto executor = io->GetExecutor();
+	auto gate = TLSHandshakeGate::Create(nullptr, 1);
+
+	const int OTHER = 0;
+	auto resource = std::make_shared<int>(0);
+	std::vector<const int*> started;
+	std::vector<TLSHandshakeGate::release_t> releases;
+
+	for (auto owner : { &OWNER, &OWNER, &OTHER, &OWNER })
+	{
+		gate->Submit(owner, executor, TimeDuration::Zero(), [&started, &releases, owner, resource](const std::shared_ptr<Executor>&, const TLSHandshakeGate::release_t& release)
+		{
+			started.push_back(owner);
+			releases.push_back(release);
+		}, NoAbort);
+	}
+
+	io->RunUntilOutOfWork();
+	REQUIRE(started.size() == 1);
+
+	gate->Clear(&OWNER);
+	REQUIRE(gate->NumQueued() == 1);
+	REQUIRE(resource.use_count() == 2); // only the handshake queued by the other owner retains it
+
+	releases[0]();
+	io->RunUntilOutOfWork();
+
+	REQUIRE(started == std::vector<const int*>({ &OWNER, &OTHER }));
+
+	releases[1]();
+	REQUIRE(gate->NumActive() == 0);
+}
+
+TEST_CASE(SUITE("handshakes run on the dedicated io_context when one is supplied"))
+{
+	auto io = MockIO::Create();
+	auto handshakeIO = MockIO::Create();
+	auto gate = TLSHandshakeGate::Create(handshakeIO, 0);
+
+	bool started = false;
+
+	gate->Submit(&OWNER, io->GetExecutor(), TimeDuration::Zero(), [&](const std::shared_ptr<Executor>&, const TLSHandshakeGate::release_t&)
+	{
+		started = true;
+	}, NoAbort);
+
+	REQUIRE(io->RunUntilOutOfWork() == 0);
+	REQUIRE_FALSE(started);
+
+	REQUIRE(handshakeIO->RunUntilOutOfWork() > 0);
+	REQUIRE(started);
+}
+
+TEST_CASE(SUITE("a handshake that exceeds its deadline is aborted and its slot goes to the next handshake"))
+{
+	auto io = MockIO::Create();
+	auto executor = io->GetExecutor();
+	auto gate = TLSHandshakeGate::Create(nullptr, 1);
+
+	int num_aborted = 0;
+	std::vector<int> started;
+	std::vector<TLSHandshakeGate::release_t> releases;
+
+	for (int i = 0; i < 2; ++i)
+	{
+		gate->Submit(&OWNER, executor, TimeDuration::Milliseconds(10), [&started, &releases, i](const std::shared_ptr<Executor>&, const TLSHandshakeGate::release_t& release)
+		{
+			started.push_back(i);
+			releases.push_back(release);
+		}, [&num_aborted]()
+		{
+			++num_aborted;
+		});
+	}
+
+	// the first handshake never completes
+	io->RunUntilTimeout([&]()
+	{
+		return started.size() == 2;
+	});
+
+	REQUIRE(started == std::vector<int>({ 0, 1 }));
+	REQUIRE(num_aborted == 1);
+	REQUIRE(gate->NumTimeouts() == 1);
+	REQUIRE(gate->NumActive() == 1);
+
+	// the aborted handshake completes with an error afterwards, which must not give up the slot of the second
+	releases[0]();
+	REQUIRE(gate->NumActive() == 1);
+
+	// completing in time cancels the deadline
+	releases[1]();
+	REQUIRE(gate->NumActive() == 0);
+
+	io->RunUntilOutOfWork();
+	REQUIRE(num_aborted == 1);
+	REQUIRE(gate->NumTimeouts() == 1);
+}
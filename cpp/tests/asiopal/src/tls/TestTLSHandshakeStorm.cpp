@@ -0,0 +1,407 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include "asiopal/ThreadPool.h"
+#include "asiopal/tls/TLSClient.h"
+#include "asiopal/tls/TLSServer.h"
+#include "asiopal/tls/TLSStreamChannel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace asiopal;
+using namespace openpal;
+
+/**
+* Measures the round trip latency of polls on established TLS sessions while 1000 new
+* connections handshake with the same server. The test is hidden because it needs the
+* test certificates, several seconds of CPU, and more file descriptors than the default
+* limit on many systems (ulimit -n 4096). Run it with: testasiopal "[.benchmark]"
+*/
+
+#define SUITE(name) "TLSHandshakeStormBenchmark - " name
+
+namespace
+{
+
+const uint16_t PORT = 20010;
+const size_t NUM_POLLED_SESSIONS = 4;
+const size_t NUM_STORM_CONNECTIONS = 1000;
+const uint32_t DATA_PLANE_THREADS = 2;
+const uint32_t CLIENT_THREADS = 2;
+const auto POLL_PERIOD = std::chrono::milliseconds(5);
+const auto STORM_TIMEOUT = std::chrono::seconds(120);
+
+std::string storm_cert_path(const std::string& file)
+{
+	return "../cpp/tests/asiopal/tls-certs/" + file;
+}
+
+bool have_storm_certificates()
+{
+	for (auto& file : { "entity1_key.pem", "entity2_key.pem", "entity1_cert.pem", "entity2_cert.pem" })
+	{
+		if (!std::ifstream(storm_cert_path(file)).good())
+		{
+			std::cout << "Could not locate the test TLS certificates, skipping the handshake storm benchmark" << std::endl;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// writes back everything it reads
+class Echo final : public IChannelCallbacks
+{
+
+public:
+
+	explicit Echo(const std::shared_ptr<IAsyncChannel>& channel) : channel(channel)
+	{}
+
+	void Start()
+	{
+		this->channel->BeginRead(WSlice(this->buffer, sizeof(this->buffer)));
+	}
+
+	void Stop()
+	{
+		auto channel = std::move(this->channel);
+		channel->Shutdown();
+	}
+
+	virtual void OnReadComplete(const std::error_code& ec, size_t num) override
+	{
+		if (!ec) this->channel->BeginWrite(RSlice(this->buffer, static_cast<uint32_t>(num)));
+	}
+
+	virtual void OnWriteComplete(const std::error_code& ec, size_t num) override
+	{
+		if (!ec) this->Start();
+	}
+
+	std::shared_ptr<IAsyncChannel> channel;
+
+private:
+
+	uint8_t buffer[64];
+};
+
+class StormServer final : public TLSServer
+{
+
+public:
+
+	StormServer(const Logger& logger, const std::shared_ptr<Executor>& executor, const std::shared_ptr<TLSHandshakeGate>& gate, const TLSConfig& config, std::error_code& ec) :
+		TLSServer(logger, executor, gate, IPEndpoint::Localhost(PORT), config, ec)
+	{}
+
+	static std::shared_ptr<StormServer> Create(const Logger& logger, const std::shared_ptr<Executor>& executor, const std::shared_ptr<TLSHandshakeGate>& gate, const TLSConfig& config)
+	{
+		std::error_code ec;
+		auto server = std::make_shared<StormServer>(logger, executor, gate, config, ec);
+		if (!ec) server->StartAccept(ec);
+		if (ec) throw std::logic_error(ec.message());
+		return server;
+	}
+
+	void Close()
+	{
+		auto close = [self = std::static_pointer_cast<StormServer>(shared_from_this())]()
+		{
+			self->Shutdown();
+			for (auto& session : self->sessions)
+			{
+				session->channel->executor->strand.post([session]()
+				{
+					session->Stop();
+				});
+			}
+			self->sessions.clear();
+		};
+
+		this->executor->strand.post(close);
+	}
+
+	std::atomic<size_t> numAccepted{ 0 };
+
+private:
+
+	virtual bool AcceptConnection(uint64_t sessionid, const asio::ip::tcp::endpoint& remote) override
+	{
+		return true;
+	}
+
+	virtual bool VerifyCallback(uint64_t sessionid, bool preverified, asio::ssl::verify_context& ctx) override
+	{
+		return preverified;
+	}
+
+	virtual void AcceptStream(uint64_t sessionid, const std::shared_ptr<Executor>& executor, std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>> stream) override
+	{
+		// every session runs on its own strand of the data-plane, just like a LinkSession
+		auto channel = TLSStreamChannel::Create(executor->Fork(), stream);
+		auto echo = std::make_shared<Echo>(channel);
+		channel->SetCallbacks(echo);
+		channel->executor->strand.post([echo]()
+		{
+			echo->Start();
+		});
+
+		this->sessions.push_back(echo);
+		++this->numAccepted;
+	}
+
+	virtual void OnShutdown() override {}
+
+	std::vector<std::shared_ptr<Echo>> sessions;
+};
+
+// client side of an established session that periodically sends a 1 byte poll and times the echo
+class Poller final : public IChannelCallbacks
+{
+
+public:
+
+	void Poll()
+	{
+		if (this->inFlight.exchange(true)) return;
+
+		this->channel->executor->strand.post([this]()
+		{
+			this->start = std::chrono::steady_clock::now();
+			this->channel->BeginWrite(RSlice(&this->request, 1));
+		});
+	}
+
+	virtual void OnWriteComplete(const std::error_code& ec, size_t num) override
+	{
+		if (!ec) this->channel->BeginRead(WSlice(this->reply, sizeof(this->reply)));
+	}
+
+	virtual void OnReadComplete(const std::error_code& ec, size_t num) override
+	{
+		if (ec) return;
+
+		const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - this->start).count();
+
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->samples.push_back(elapsed);
+		}
+
+		this->inFlight = false;
+	}
+
+	std::vector<int64_t> TakeSamples()
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		return std::move(this->samples);
+	}
+
+	std::shared_ptr<IAsyncChannel> channel;
+
+private:
+
+	std::atomic<bool> inFlight{ false };
+	std::chrono::steady_clock::time_point start;
+	uint8_t request = 0xC0;
+	uint8_t reply[4];
+
+	std::mutex mutex;
+	std::vector<int64_t> samples;
+};
+
+class Reader final : public IChannelCallbacks
+{
+	virtual void OnReadComplete(const std::error_code& ec, size_t num) override {}
+	virtual void OnWriteComplete(const std::error_code& ec, size_t num) override {}
+};
+
+struct StormResult
+{
+	std::chrono::milliseconds duration;
+	size_t numAccepted;
+	std::vector<int64_t> samples;
+
+	int64_t Percentile(double percent) const
+	{
+		if (samples.empty()) return 0;
+		const auto index = static_cast<size_t>((percent / 100.0) * (samples.size() - 1));
+		return samples[index];
+	}
+};
+
+StormResult RunStorm(uint32_t handshakeThreads, uint32_t maxConcurrentHandshakes)
+{
+	auto logger = Logger::Empty();
+
+	TLSConfig clientConfig(storm_cert_path("entity2_cert.pem"), storm_cert_path("entity1_cert.pem"), storm_cert_path("entity1_key.pem"));
+	TLSConfig serverConfig(storm_cert_path("entity1_cert.pem"), storm_cert_path("entity2_cert.pem"), storm_cert_path("entity2_key.pem"));
+
+	auto dataIO = std::make_shared<IO>();
+	ThreadPool dataPool(logger, dataIO, DATA_PLANE_THREADS);
+
+	auto handshakeIO = handshakeThreads ? std::make_shared<IO>() : nullptr;
+	std::unique_ptr<ThreadPool> handshakePool(handshakeThreads ? new ThreadPool(logger, handshakeIO, handshakeThreads) : nullptr);
+
+	auto clientIO = std::make_shared<IO>();
+	ThreadPool clientPool(logger, clientIO, CLIENT_THREADS);
+
+	auto server = StormServer::Create(logger, Executor::Create(dataIO), TLSHandshakeGate::Create(handshakeIO, maxConcurrentHandshakes), serverConfig);
+
+	std::mutex mutex;
+	std::vector<std::shared_ptr<TLSClient>> clients;
+	std::vector<std::shared_ptr<IAsyncChannel>> channels;
+	const auto reader = std::make_shared<Reader>();
+
+	auto connect = [&](const TLSClient::connect_callback_t& callback)
+	{
+		std::error_code ec;
+		auto client = TLSClient::Create(logger, Executor::Create(clientIO), nullptr, "127.0.0.1", clientConfig, nullptr, ec);
+		if (ec) throw std::logic_error(ec.message());
+		client->BeginConnect(IPEndpoint::Localhost(PORT), callback);
+		clients.push_back(client);
+	};
+
+	auto wait_for_accepted = [&](size_t num, std::function<void ()> action)
+	{
+		const auto deadline = std::chrono::steady_clock::now() + STORM_TIMEOUT;
+		while (server->numAccepted < num)
+		{
+			if (std::chrono::steady_clock::now() > deadline) return false;
+			action();
+			std::this_thread::sleep_for(POLL_PERIOD);
+		}
+		return true;
+	};
+
+	// establish the sessions that are polled during the storm
+	std::vector<std::shared_ptr<Poller>> pollers;
+	for (size_t i = 0; i < NUM_POLLED_SESSIONS; ++i)
+	{
+		auto poller = std::make_shared<Poller>();
+		pollers.push_back(poller);
+
+		connect([poller](const std::shared_ptr<Executor>& executor, const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream, const std::error_code & ec)
+		{
+			if (ec) return;
+			poller->channel = TLSStreamChannel::Create(executor, stream);
+			poller->channel->SetCallbacks(poller);
+		});
+	}
+
+	REQUIRE(wait_for_accepted(NUM_POLLED_SESSIONS, [] {}));
+	std::this_thread::sleep_for(std::chrono::milliseconds(100)); // let the client callbacks finish
+	for (auto& poller : pollers)
+	{
+		REQUIRE(poller->channel);
+	}
+
+	auto poll_all = [&]()
+	{
+		for (auto& poller : pollers) poller->Poll();
+	};
+
+	// discard the samples of the warm-up polls
+	for (int i = 0; i < 10; ++i)
+	{
+		poll_all();
+		std::this_thread::sleep_for(POLL_PERIOD);
+	}
+	for (auto& poller : pollers) poller->TakeSamples();
+
+	const auto start = std::chrono::steady_clock::now();
+
+	for (size_t i = 0; i < NUM_STORM_CONNECTIONS; ++i)
+	{
+		connect([&mutex, &channels, reader](const std::shared_ptr<Executor>& executor, const std::shared_ptr<asio::ssl::stream<asio::ip::tcp::socket>>& stream, const std::error_code & ec)
+		{
+			if (ec) return;
+			auto channel = TLSStreamChannel::Create(executor, stream);
+			channel->SetCallbacks(reader);
+			std::lock_guard<std::mutex> lock(mutex);
+			channels.push_back(channel);
+		});
+	}
+
+	wait_for_accepted(NUM_POLLED_SESSIONS + NUM_STORM_CONNECTIONS, poll_all);
+
+	StormResult result;
+	result.duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+	result.numAccepted = server->numAccepted - NUM_POLLED_SESSIONS;
+
+	for (auto& poller : pollers)
+	{
+		auto samples = poller->TakeSamples();
+		result.samples.insert(result.samples.end(), samples.begin(), samples.end());
+	}
+	std::sort(result.samples.begin(), result.samples.end());
+
+	// tear down before the thread pools are joined
+	server->Close();
+	for (auto& client : clients)
+	{
+		client->Cancel();
+	}
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		for (auto& poller : pollers)
+		{
+			channels.push_back(poller->channel);
+		}
+		for (auto& channel : channels)
+		{
+			channel->executor->strand.post([channel]()
+			{
+				channel->Shutdown();
+			});
+		}
+	}
+
+	return result;
+}
+
+void Report(const char* name, const StormResult& result)
+{
+	std::cout << name << ": " << result.numAccepted << " handshakes in " << result.duration.count() << " ms, "
+	          << result.samples.size() << " polls, latency (us) p50: " << result.Percentile(50)
+	          << " p99: " << result.Percentile(99) << " max: " << result.Percentile(100) << std::endl;
+}
+
+}
+
+TEST_CASE(SUITE("poll latency on established sessions during a handshake storm"), "[.benchmark]")
+{
+	if (!have_storm_certificates()) return;
+
+	Report("handshakes on data-plane strands, unlimited", RunStorm(0, 0));
+	Report("handshakes on data-plane strands, max 1", RunStorm(0, 1));
+	Report("handshakes on 1 dedicated thread, max 4", RunStorm(1, 4));
+}
@@ -34,6 +34,14 @@ namespace asiopal
 
 class MockTLSClientHandler final
 {
+	// keeps a read outstanding so that post-handshake messages like TLS 1.3 session tickets are processed
+	struct ReadCallbacks final : public IChannelCallbacks
+	{
+		virtual void OnReadComplete(const std::error_code& ec, size_t num) override {}
+		virtual void OnWriteComplete(const std::error_code& ec, size_t num) override {}
+
+		uint8_t buffer[64];
+	};
 
 public:
 
@@ -46,7 +54,10 @@ public:
 		}
 		else
 		{
-			channels.push_back(TLSStreamChannel::Create(executor, stream));
+			auto channel = TLSStreamChannel::Create(executor, stream);
+			channel->SetCallbacks(callbacks);
+			channel->BeginRead(openpal::WSlice(callbacks->buffer, sizeof(callbacks->buffer)));
+			channels.push_back(channel);
 		}
 	}
 
@@ -60,6 +71,8 @@ public:
 
 	size_t num_error = 0;
 
+	const std::shared_ptr<ReadCallbacks> callbacks = std::make_shared<ReadCallbacks>();
+
 	std::deque<std::shared_ptr<IAsyncChannel>> channels;
 
 };
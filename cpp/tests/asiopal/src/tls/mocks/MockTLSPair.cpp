@@ -29,8 +29,10 @@ MockTLSPair::MockTLSPair(std::shared_ptr<MockIO> io, uint16_t port, const TLSCon
 	log(),
 	io(io),
 	port(port),
+	clientConfig(client),
+	sessions(std::make_shared<TLSSessionCache>()),
 	chandler(std::make_shared<MockTLSClientHandler>()),
-	client(TLSClient::Create(log.logger, io->GetExecutor(), "127.0.0.1", client, ec)),
+	client(TLSClient::Create(log.logger, io->GetExecutor(), nullptr, "127.0.0.1", client, sessions, ec)),
 	server(ec ? nullptr : MockTLSServer::Create(log.logger, io->GetExecutor(), IPEndpoint::Localhost(port), server, ec))
 {
 	if (ec)
@@ -65,7 +67,21 @@ void MockTLSPair::Connect(size_t num)
 		return this->NumConnectionsEqual(num);
 	};
 
-	io->CompleteInXIterations(10, connected);
+	// the number of iterations depends on how many strands the handshakes hop across
+	io->RunUntilTimeout(connected);
+}
+
+void MockTLSPair::RecreateClient()
+{
+	this->client->Cancel();
+
+	std::error_code ec;
+	this->client = TLSClient::Create(log.logger, io->GetExecutor(), nullptr, "127.0.0.1", this->clientConfig, this->sessions, ec);
+
+	if (ec)
+	{
+		throw std::logic_error(ec.message());
+	}
 }
 
 bool MockTLSPair::NumConnectionsEqual(size_t num) const
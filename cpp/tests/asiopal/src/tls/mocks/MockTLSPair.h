@@ -44,14 +44,29 @@ public:
 
 	void Connect(size_t num = 1);
 
+	/// Cancel the client and replace it with a new one that shares the TLS session cache of the old one
+	void RecreateClient();
+
 	bool NumConnectionsEqual(size_t num) const;
 
+	const TLSStatistics& GetClientStatistics() const
+	{
+		return client->GetStatistics();
+	}
+
+	const TLSStatistics& GetServerStatistics() const
+	{
+		return server->GetStatistics();
+	}
+
 	testlib::MockLogHandler log;
 
 private:
 
 	std::shared_ptr<MockIO> io;
 	uint16_t port;
+	const TLSConfig clientConfig;
+	const std::shared_ptr<TLSSessionCache> sessions;
 	std::shared_ptr<MockTLSClientHandler> chandler;
 	std::shared_ptr<TLSClient> client;
 	std::shared_ptr<MockTLSServer> server;
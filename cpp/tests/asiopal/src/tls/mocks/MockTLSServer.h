@@ -42,7 +42,7 @@ public:
 	    IPEndpoint endpoint,
 	    const TLSConfig& config,
 	    std::error_code& ec
-	) : TLSServer(logger, executor, endpoint, config, ec)
+	) : TLSServer(logger, executor, nullptr, endpoint, config, ec)
 	{
 
 	}
@@ -0,0 +1,363 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "BenchReport.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace asiodnp3
+{
+
+namespace
+{
+
+// latency changes smaller than this are considered noise regardless of the tolerance
+const uint64_t MIN_LATENCY_REGRESSION_MICROS = 1000;
+
+/**
+* Just enough of a JSON reader to load the reports written below
+*/
+struct JsonValue
+{
+	enum class Type { Null, Bool, Number, String, Array, Object };
+
+	Type type = Type::Null;
+	bool boolean = false;
+	double number = 0;
+	std::string string;
+	std::vector<JsonValue> array;
+	std::vector<std::pair<std::string, JsonValue>> object;
+
+	const JsonValue* Find(const std::string& key) const
+	{
+		for (auto& member : object)
+		{
+			if (member.first == key) return &member.second;
+		}
+		return nullptr;
+	}
+};
+
+class JsonParser
+{
+
+public:
+
+	explicit JsonParser(const std::string& text) : text(text)
+	{}
+
+	bool Parse(JsonValue& value)
+	{
+		return ParseValue(value) && (SkipSpace(), pos == text.size());
+	}
+
+private:
+
+	void SkipSpace()
+	{
+		while (pos < text.size() && isspace(static_cast<unsigned char>(text[pos]))) ++pos;
+	}
+
+	bool Consume(char c)
+	{
+		SkipSpace();
+		if (pos < text.size() && text[pos] == c)
+		{
+			++pos;
+			return true;
+		}
+		return false;
+	}
+
+	bool ConsumeWord(const char* word)
+	{
+		const std::string expected(word);
+		if (text.compare(pos, expected.size(), expected) == 0)
+		{
+			pos += expected.size();
+			return true;
+		}
+		return false;
+	}
+
+	bool ParseValue(JsonValue& value)
+	{
+		SkipSpace();
+		if (pos >= text.size()) return false;
+
+		switch (text[pos])
+		{
+		case('{'):
+			return ParseObject(value);
+		case('['):
+			return ParseArray(value);
+		case('"'):
+			value.type = JsonValue::Type::String;
+			return ParseString(value.string);
+		case('t'):
+			value.type = JsonValue::Type::Bool;
+			value.boolean = true;
+			return ConsumeWord("true");
+		case('f'):
+			value.type = JsonValue::Type::Bool;
+			return ConsumeWord("false");
+		case('n'):
+			return ConsumeWord("null");
+		default:
+			return ParseNumber(value);
+		}
+	}
+
+	bool ParseNumber(JsonValue& value)
+	{
+		const char* begin = text.c_str() + pos;
+		char* end = nullptr;
+		value.number = strtod(begin, &end);
+		if (end == begin) return false;
+		value.type = JsonValue::Type::Number;
+		pos += static_cast<size_t>(end - begin);
+		return true;
+	}
+
+	bool ParseString(std::string& output)
+	{
+		if (!Consume('"')) return false;
+
+		while (pos < text.size())
+		{
+			const char c = text[pos++];
+			if (c == '"') return true;
+			if (c == '\\')
+			{
+				if (pos >= text.size()) return false;
+				const char escaped = text[pos++];
+				switch (escaped)
+				{
+				case('n'):
+					output.push_back('\n');
+					break;
+				case('t'):
+					output.push_back('\t');
+					break;
+				default:
+					// the reports never contain unicode escapes
+					output.push_back(escaped);
+					break;
+				}
+			}
+			else
+			{
+				output.push_back(c);
+			}
+		}
+
+		return false;
+	}
+
+	bool ParseArray(JsonValue& value)
+	{
+		value.type = JsonValue::Type::Array;
+		Consume('[');
+		if (Consume(']')) return true;
+
+		do
+		{
+			JsonValue item;
+			if (!ParseValue(item)) return false;
+			value.array.push_back(std::move(item));
+		}
+		while (Consume(','));
+
+		return Consume(']');
+	}
+
+	bool ParseObject(JsonValue& value)
+	{
+		value.type = JsonValue::Type::Object;
+		Consume('{');
+		if (Consume('}')) return true;
+
+		do
+		{
+			std::string key;
+			SkipSpace();
+			if (!ParseString(key) || !Consume(':')) return false;
+
+			JsonValue member;
+			if (!ParseValue(member)) return false;
+			value.object.emplace_back(std::move(key), std::move(member));
+		}
+		while (Consume(','));
+
+		return Consume('}');
+	}
+
+	const std::string& text;
+	size_t pos = 0;
+};
+
+double GetNumber(const JsonValue& object, const char* key)
+{
+	const auto value = object.Find(key);
+	return (value && value->type == JsonValue::Type::Number) ? value->number : 0;
+}
+
+}
+
+Comparison Compare(const BenchResult& result, const Baseline& baseline, double tolerance)
+{
+	Comparison comparison;
+
+	const auto iter = baseline.entries.find(result.scenario.Name());
+	if (iter == baseline.entries.end())
+	{
+		return comparison;
+	}
+
+	comparison.hasBaseline = true;
+	comparison.baseline = iter->second;
+
+	if (comparison.baseline.eventsPerSecond > 0)
+	{
+		comparison.throughputChange = (result.eventsPerSecond / comparison.baseline.eventsPerSecond) - 1.0;
+		comparison.regression |= comparison.throughputChange < -tolerance;
+	}
+
+	if (comparison.baseline.p99LatencyMicros > 0)
+	{
+		comparison.latencyChange = (static_cast<double>(result.p99LatencyMicros) / comparison.baseline.p99LatencyMicros) - 1.0;
+		const bool significant = result.p99LatencyMicros > (comparison.baseline.p99LatencyMicros + MIN_LATENCY_REGRESSION_MICROS);
+		comparison.regression |= significant && (comparison.latencyChange > tolerance);
+	}
+
+	return comparison;
+}
+
+void WriteReport(std::ostream& output, const std::string& transport, const std::vector<BenchResult>& results, const Baseline& baseline, double tolerance)
+{
+	output << std::fixed << std::setprecision(3);
+
+	output << "{" << std::endl;
+	output << "  \"version\": 1," << std::endl;
+	output << "  \"transport\": \"" << transport << "\"," << std::endl;
+	output << "  \"results\": [";
+
+	bool first = true;
+	for (auto& result : results)
+	{
+		const auto& s = result.scenario;
+
+		output << (first ? "" : ",") << std::endl;
+		first = false;
+
+		output << "    {" << std::endl;
+		output << "      \"name\": \"" << s.Name() << "\"," << std::endl;
+		output << "      \"pairs\": " << s.numPairs << "," << std::endl;
+		output << "      \"threads\": " << s.numThreads << "," << std::endl;
+		output << "      \"points_per_type\": " << s.numPointsPerType << "," << std::endl;
+		output << "      \"events_per_batch\": " << s.eventsPerBatch << "," << std::endl;
+		output << "      \"offered_events_per_sec\": " << s.eventsPerSecond << "," << std::endl;
+		output << "      \"max_frag_size\": " << s.maxFragSize << "," << std::endl;
+		output << "      \"mode\": \"" << BenchModeToString(s.mode) << "\"," << std::endl;
+		output << "      \"batches\": " << s.numBatches << "," << std::endl;
+		output << "      \"runs\": " << result.numRuns << "," << std::endl;
+		output << "      \"events\": " << result.numEvents << "," << std::endl;
+		output << "      \"seconds\": " << result.seconds << "," << std::endl;
+		output << "      \"events_per_sec\": " << result.eventsPerSecond << "," << std::endl;
+		output << "      \"p50_latency_us\": " << result.p50LatencyMicros << "," << std::endl;
+		output << "      \"p99_latency_us\": " << result.p99LatencyMicros << "," << std::endl;
+		output << "      \"max_latency_us\": " << result.maxLatencyMicros << "," << std::endl;
+		output << "      \"cpu_seconds\": " << result.cpuSeconds << "," << std::endl;
+		output << "      \"rss_kb\": " << result.rssKB << "," << std::endl;
+		output << "      \"max_rss_kb\": " << result.maxRssKB;
+
+		const auto comparison = Compare(result, baseline, tolerance);
+		if (comparison.hasBaseline)
+		{
+			output << "," << std::endl;
+			output << "      \"baseline_events_per_sec\": " << comparison.baseline.eventsPerSecond << "," << std::endl;
+			output << "      \"baseline_p99_latency_us\": " << comparison.baseline.p99LatencyMicros << "," << std::endl;
+			output << "      \"throughput_change_pct\": " << (100.0 * comparison.throughputChange) << "," << std::endl;
+			output << "      \"p99_latency_change_pct\": " << (100.0 * comparison.latencyChange) << "," << std::endl;
+			output << "      \"regression\": " << (comparison.regression ? "true" : "false");
+		}
+
+		output << std::endl << "    }";
+	}
+
+	output << std::endl << "  ]" << std::endl;
+	output << "}" << std::endl;
+}
+
+bool ReadBaseline(const std::string& path, Baseline& baseline, std::string& error)
+{
+	std::ifstream file(path);
+	if (!file)
+	{
+		error = "unable to open " + path;
+		return false;
+	}
+
+	std::stringstream buffer;
+	buffer << file.rdbuf();
+	const auto text = buffer.str();
+
+	JsonValue root;
+	if (!JsonParser(text).Parse(root) || root.type != JsonValue::Type::Object)
+	{
+		error = "malformed JSON in " + path;
+		return false;
+	}
+
+	const auto transport = root.Find("transport");
+	if (!transport || transport->type != JsonValue::Type::String)
+	{
+		error = "no transport in " + path;
+		return false;
+	}
+
+	baseline.transport = transport->string;
+
+	const auto results = root.Find("results");
+	if (!results || results->type != JsonValue::Type::Array)
+	{
+		error = "no results in " + path;
+		return false;
+	}
+
+	for (auto& item : results->array)
+	{
+		const auto name = item.Find("name");
+		if (!name || name->type != JsonValue::Type::String) continue;
+
+		BaselineEntry entry;
+		entry.eventsPerSecond = GetNumber(item, "events_per_sec");
+		entry.p99LatencyMicros = static_cast<uint64_t>(GetNumber(item, "p99_latency_us"));
+		baseline.entries[name->string] = entry;
+	}
+
+	return true;
+}
+
+}
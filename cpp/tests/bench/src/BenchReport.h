@@ -0,0 +1,88 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_BENCHREPORT_H
+#define ASIODNP3_BENCHREPORT_H
+
+#include "BenchTypes.h"
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace asiodnp3
+{
+
+/**
+* Reference measurements of a scenario loaded from a previous report
+*/
+struct BaselineEntry
+{
+	double eventsPerSecond = 0;
+	uint64_t p99LatencyMicros = 0;
+};
+
+/**
+* Results of a previous report, keyed by scenario name
+*/
+struct Baseline
+{
+	/// transport the baseline was measured with, results are only comparable on the same transport
+	std::string transport;
+
+	std::map<std::string, BaselineEntry> entries;
+};
+
+/**
+* Result of comparing a scenario with its baseline
+*/
+struct Comparison
+{
+	bool hasBaseline = false;
+	BaselineEntry baseline;
+
+	/// relative change in throughput, e.g. -0.15 == 15% slower
+	double throughputChange = 0;
+
+	/// relative change in p99 latency, e.g. 0.2 == 20% higher
+	double latencyChange = 0;
+
+	/// true if either change exceeds the tolerance in the wrong direction
+	bool regression = false;
+};
+
+Comparison Compare(const BenchResult& result, const Baseline& baseline, double tolerance);
+
+/**
+* Write the results as JSON, annotated with the comparison against the baseline if it isn't empty
+*/
+void WriteReport(std::ostream& output, const std::string& transport, const std::vector<BenchResult>& results, const Baseline& baseline, double tolerance);
+
+/**
+* Load the results of a report written by WriteReport
+*
+* @return false and set the error message if the file can't be read or parsed
+*/
+bool ReadBaseline(const std::string& path, Baseline& baseline, std::string& error);
+
+}
+
+#endif
@@ -0,0 +1,245 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "BenchStackPair.h"
+
+#include <asiodnp3/DefaultMasterApplication.h>
+#include <asiodnp3/UpdateBuilder.h>
+
+#include <opendnp3/LogLevels.h>
+#include <opendnp3/outstation/SimpleCommandHandler.h>
+
+#include <algorithm>
+#include <string>
+
+using namespace opendnp3;
+
+namespace asiodnp3
+{
+
+LatencySOEHandler::LatencySOEHandler(size_t numEvents) : sendTimes(numEvents)
+{}
+
+void LatencySOEHandler::OnSent(uint32_t begin, uint32_t end, std::chrono::steady_clock::time_point time)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::fill(sendTimes.begin() + begin, sendTimes.begin() + end, time);
+}
+
+bool LatencySOEHandler::WaitForCount(uint64_t num, std::chrono::steady_clock::duration timeout)
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	return condition.wait_for(lock, timeout, [this, num]()
+	{
+		return this->count >= num;
+	});
+}
+
+LatencyHistogram LatencySOEHandler::GetLatency()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return latency;
+}
+
+void LatencySOEHandler::Start()
+{
+	mutex.lock();
+	now = std::chrono::steady_clock::now();
+}
+
+void LatencySOEHandler::End()
+{
+	mutex.unlock();
+	condition.notify_all();
+}
+
+void LatencySOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values)
+{
+	values.ForeachItem([&](const Indexed<Analog>& item)
+	{
+		this->OnReceived(info, item.value.value);
+	});
+}
+
+void LatencySOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values)
+{
+	values.ForeachItem([&](const Indexed<Counter>& item)
+	{
+		this->OnReceived(info, item.value.value);
+	});
+}
+
+void LatencySOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values)
+{
+	values.ForeachItem([&](const Indexed<FrozenCounter>& item)
+	{
+		this->OnReceived(info, item.value.value);
+	});
+}
+
+void LatencySOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values)
+{
+	values.ForeachItem([&](const Indexed<AnalogOutputStatus>& item)
+	{
+		this->OnReceived(info, item.value.value);
+	});
+}
+
+void LatencySOEHandler::OnReceived(const HeaderInfo& info, double value)
+{
+	// static values from an integrity poll aren't events
+	if (!info.isEventVariation) return;
+
+	const auto seq = static_cast<size_t>(value);
+	if (seq < sendTimes.size())
+	{
+		++count;
+		latency.Record(std::chrono::duration_cast<std::chrono::microseconds>(now - sendTimes[seq]).count());
+	}
+}
+
+namespace
+{
+
+std::string GetId(const char* name, uint16_t port)
+{
+	return std::string(name) + ":" + std::to_string(port);
+}
+
+OutstationStackConfig GetOutstationConfig(const BenchScenario& scenario)
+{
+	OutstationStackConfig config(DatabaseSizes::AllTypes(scenario.numPointsPerType));
+
+	const auto bufferSize = static_cast<uint16_t>(std::min<uint32_t>(3 * scenario.eventsPerBatch, 65535));
+	config.outstation.eventBufferConfig = EventBufferConfig::AllTypes(bufferSize);
+	config.outstation.params.allowUnsolicited = (scenario.mode == BenchMode::Unsolicited);
+	config.outstation.params.maxTxFragSize = scenario.maxFragSize;
+	config.outstation.params.unsolConfirmTimeout = openpal::TimeDuration::Seconds(5);
+
+	return config;
+}
+
+MasterStackConfig GetMasterConfig(const BenchScenario& scenario)
+{
+	MasterStackConfig config;
+
+	config.master.responseTimeout = openpal::TimeDuration::Seconds(5);
+	config.master.taskRetryPeriod = openpal::TimeDuration::Seconds(1);
+	config.master.startupIntegrityClassMask = ClassField::None();
+	config.master.maxRxFragSize = scenario.maxFragSize;
+
+	if (scenario.mode == BenchMode::Unsolicited)
+	{
+		config.master.disableUnsolOnStartup = false;
+		config.master.unsolClassMask = ClassField::AllEventClasses();
+	}
+	else
+	{
+		config.master.disableUnsolOnStartup = true;
+		config.master.unsolClassMask = ClassField::None();
+	}
+
+	return config;
+}
+
+std::shared_ptr<IChannel> CreateChannel(DNP3Manager& manager, BenchTransport transport, bool client, uint16_t port, std::shared_ptr<IChannelListener> listener)
+{
+	const auto levels = flags::ERR | flags::WARN;
+	const auto id = GetId(client ? "client" : "server", port);
+
+	if (transport == BenchTransport::Loopback)
+	{
+		return manager.AddLoopback(id, levels, GetId("link", port), asiopal::LoopbackConfig(), listener);
+	}
+
+	if (client)
+	{
+		return manager.AddTCPClient(id, levels, asiopal::ChannelRetry::Default(), "127.0.0.1", "127.0.0.1", port, listener);
+	}
+
+	return manager.AddTCPServer(id, levels, ServerAcceptMode::CloseExisting, "127.0.0.1", port, listener);
+}
+
+}
+
+BenchStackPair::BenchStackPair(DNP3Manager& manager, const BenchScenario& scenario, BenchTransport transport, uint16_t port) :
+	scenario(scenario),
+	soeHandler(std::make_shared<LatencySOEHandler>(static_cast<size_t>(scenario.eventsPerBatch) * scenario.numBatches)),
+	clientListener(std::make_shared<BenchChannelListener>()),
+	serverListener(std::make_shared<BenchChannelListener>())
+{
+	auto server = CreateChannel(manager, transport, false, port, serverListener);
+	auto client = CreateChannel(manager, transport, true, port, clientListener);
+
+	this->outstation = server->AddOutstation(GetId("outstation", port), SuccessCommandHandler::Create(), DefaultOutstationApplication::Create(), GetOutstationConfig(scenario));
+	this->master = client->AddMaster(GetId("master", port), soeHandler, DefaultMasterApplication::Create(), GetMasterConfig(scenario));
+
+	this->outstation->Enable();
+	this->master->Enable();
+}
+
+bool BenchStackPair::WaitForChannelsOnline(std::chrono::steady_clock::duration timeout)
+{
+	return this->clientListener->WaitForOpen(timeout) && this->serverListener->WaitForOpen(timeout);
+}
+
+void BenchStackPair::SendBatch()
+{
+	const auto begin = this->numSent;
+	const auto end = begin + scenario.eventsPerBatch;
+
+	UpdateBuilder builder;
+	for (uint32_t seq = begin; seq < end; ++seq)
+	{
+		// the value of each event is its sequence number
+		const auto index = static_cast<uint16_t>(seq % scenario.numPointsPerType);
+		switch (seq % 4)
+		{
+		case(0):
+			builder.Update(Analog(seq), index, EventMode::Force);
+			break;
+		case(1):
+			builder.Update(Counter(seq), index, EventMode::Force);
+			break;
+		case(2):
+			builder.Update(FrozenCounter(seq), index, EventMode::Force);
+			break;
+		default:
+			builder.Update(AnalogOutputStatus(seq), index, EventMode::Force);
+			break;
+		}
+	}
+
+	this->soeHandler->OnSent(begin, end, std::chrono::steady_clock::now());
+	this->outstation->Apply(builder.Build());
+	this->numSent = end;
+
+	if (scenario.mode == BenchMode::Polled)
+	{
+		this->master->ScanClasses(ClassField::AllEventClasses());
+	}
+}
+
+bool BenchStackPair::WaitForBatch(std::chrono::steady_clock::duration timeout)
+{
+	return this->soeHandler->WaitForCount(this->numSent, timeout);
+}
+
+}
@@ -0,0 +1,163 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_BENCHSTACKPAIR_H
+#define ASIODNP3_BENCHSTACKPAIR_H
+
+#include "BenchTypes.h"
+
+#include <asiodnp3/DNP3Manager.h>
+
+#include <opendnp3/LatencyHistogram.h>
+#include <opendnp3/master/ISOEHandler.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+namespace asiodnp3
+{
+
+/**
+* Counts received events and measures their latency. The value of every event is
+* the sequence number of the event, which identifies the time it was applied.
+*/
+class LatencySOEHandler final : public opendnp3::ISOEHandler
+{
+
+public:
+
+	explicit LatencySOEHandler(size_t numEvents);
+
+	// record the time at which a range of sequence numbers was applied on the outstation
+	void OnSent(uint32_t begin, uint32_t end, std::chrono::steady_clock::time_point time);
+
+	// wait until the specified total number of events have been received
+	bool WaitForCount(uint64_t num, std::chrono::steady_clock::duration timeout);
+
+	opendnp3::LatencyHistogram GetLatency();
+
+	virtual void Start() override;
+	virtual void End() override;
+
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::Analog>>& values) override;
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::Counter>>& values) override;
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::FrozenCounter>>& values) override;
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::AnalogOutputStatus>>& values) override;
+
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::Binary>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::DoubleBitBinary>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::BinaryOutputStatus>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::OctetString>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::TimeAndInterval>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::BinaryCommandEvent>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::AnalogCommandEvent>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::SecurityStat>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::DNPTime>& values) override {}
+
+private:
+
+	void OnReceived(const opendnp3::HeaderInfo& info, double value);
+
+	std::mutex mutex;
+	std::condition_variable condition;
+
+	uint64_t count = 0;
+	std::vector<std::chrono::steady_clock::time_point> sendTimes;
+	std::chrono::steady_clock::time_point now;
+	opendnp3::LatencyHistogram latency;
+};
+
+/**
+* Signals when a channel has opened
+*/
+class BenchChannelListener final : public IChannelListener
+{
+
+public:
+
+	virtual void OnStateChange(opendnp3::ChannelState state) override
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		this->state = state;
+		condition.notify_all();
+	}
+
+	bool WaitForOpen(std::chrono::steady_clock::duration timeout)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		return condition.wait_for(lock, timeout, [this]()
+		{
+			return this->state == opendnp3::ChannelState::OPEN;
+		});
+	}
+
+private:
+
+	std::mutex mutex;
+	std::condition_variable condition;
+	opendnp3::ChannelState state = opendnp3::ChannelState::CLOSED;
+};
+
+/**
+* A master and an outstation connected over TCP or a loopback channel
+*/
+class BenchStackPair final : openpal::Uncopyable
+{
+
+public:
+
+	BenchStackPair(DNP3Manager& manager, const BenchScenario& scenario, BenchTransport transport, uint16_t port);
+
+	bool WaitForChannelsOnline(std::chrono::steady_clock::duration timeout);
+
+	// apply the next batch of events to the outstation
+	void SendBatch();
+
+	// wait for all of the events sent so far
+	bool WaitForBatch(std::chrono::steady_clock::duration timeout);
+
+	opendnp3::LatencyHistogram GetLatency()
+	{
+		return soeHandler->GetLatency();
+	}
+
+	uint64_t NumSent() const
+	{
+		return numSent;
+	}
+
+private:
+
+	const BenchScenario scenario;
+	const std::shared_ptr<LatencySOEHandler> soeHandler;
+	const std::shared_ptr<BenchChannelListener> clientListener;
+	const std::shared_ptr<BenchChannelListener> serverListener;
+
+	std::shared_ptr<IMaster> master;
+	std::shared_ptr<IOutstation> outstation;
+
+	uint32_t numSent = 0;
+};
+
+}
+
+#endif
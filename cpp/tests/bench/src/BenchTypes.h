@@ -0,0 +1,107 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_BENCHTYPES_H
+#define ASIODNP3_BENCHTYPES_H
+
+#include <cstdint>
+#include <string>
+
+namespace asiodnp3
+{
+
+enum class BenchMode
+{
+	// events are reported by unsolicited responses
+	Unsolicited,
+	// the master reads the events with a class 1/2/3 scan after each batch
+	Polled
+};
+
+enum class BenchTransport
+{
+	TCP,
+	Loopback
+};
+
+/**
+* One point in the benchmark matrix
+*/
+struct BenchScenario
+{
+	/// number of independent master / outstation pairs
+	uint16_t numPairs = 10;
+
+	/// number of threads in the DNP3Manager pool
+	uint32_t numThreads = 2;
+
+	/// number of points of each measurement type in the outstation database
+	uint16_t numPointsPerType = 50;
+
+	/// number of events applied to each outstation per batch
+	uint32_t eventsPerBatch = 50;
+
+	/// offered load per pair in events per second, 0 == send the next batch as soon as the previous one arrives
+	uint32_t eventsPerSecond = 0;
+
+	/// maximum fragment size of master rx / outstation tx
+	uint32_t maxFragSize = 2048;
+
+	BenchMode mode = BenchMode::Unsolicited;
+
+	/// number of batches sent to each pair
+	uint32_t numBatches = 500;
+
+	/// @return a stable identifier used to match results with the baseline
+	std::string Name() const;
+};
+
+/**
+* Measurements of a single scenario
+*/
+struct BenchResult
+{
+	BenchScenario scenario;
+
+	/// number of times the scenario was run, the measurements below are the median of the runs
+	uint32_t numRuns = 1;
+
+	uint64_t numEvents = 0;
+	double seconds = 0;
+	double eventsPerSecond = 0;
+
+	/// time from applying an event on the outstation until the master processes it
+	uint64_t p50LatencyMicros = 0;
+	uint64_t p99LatencyMicros = 0;
+	uint64_t maxLatencyMicros = 0;
+
+	/// user + system CPU time of the process while the scenario ran
+	double cpuSeconds = 0;
+
+	/// resident set size at the end of the scenario and the peak of the process so far
+	uint64_t rssKB = 0;
+	uint64_t maxRssKB = 0;
+};
+
+const char* BenchModeToString(BenchMode mode);
+
+}
+
+#endif
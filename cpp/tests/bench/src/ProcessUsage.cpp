@@ -0,0 +1,116 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "ProcessUsage.h"
+
+#ifdef WIN32
+	#include <windows.h>
+	#include <psapi.h>
+#else
+	#include <sys/resource.h>
+	#include <unistd.h>
+	#include <cstdio>
+#endif
+
+namespace asiodnp3
+{
+
+#ifdef WIN32
+
+namespace
+{
+double ToSeconds(const FILETIME& time)
+{
+	ULARGE_INTEGER value;
+	value.LowPart = time.dwLowDateTime;
+	value.HighPart = time.dwHighDateTime;
+	// 100 ns units
+	return static_cast<double>(value.QuadPart) / 10000000.0;
+}
+}
+
+ProcessUsage ProcessUsage::Get()
+{
+	ProcessUsage usage;
+
+	FILETIME creation, exit, kernel, user;
+	if (GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+	{
+		usage.cpuSeconds = ToSeconds(kernel) + ToSeconds(user);
+	}
+
+	PROCESS_MEMORY_COUNTERS counters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+	{
+		usage.rssKB = counters.WorkingSetSize / 1024;
+		usage.maxRssKB = counters.PeakWorkingSetSize / 1024;
+	}
+
+	return usage;
+}
+
+#else
+
+ProcessUsage ProcessUsage::Get()
+{
+	ProcessUsage usage;
+
+	struct rusage ru;
+	if (getrusage(RUSAGE_SELF, &ru) == 0)
+	{
+		usage.cpuSeconds =
+		    static_cast<double>(ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) +
+		    static_cast<double>(ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) / 1000000.0;
+
+#ifdef __APPLE__
+		// reported in bytes
+		usage.maxRssKB = static_cast<uint64_t>(ru.ru_maxrss) / 1024;
+#else
+		usage.maxRssKB = static_cast<uint64_t>(ru.ru_maxrss);
+#endif
+	}
+
+#ifdef __linux__
+	// the second field of statm is the number of resident pages
+	auto file = fopen("/proc/self/statm", "r");
+	if (file)
+	{
+		unsigned long size = 0;
+		unsigned long resident = 0;
+		if (fscanf(file, "%lu %lu", &size, &resident) == 2)
+		{
+			usage.rssKB = static_cast<uint64_t>(resident) * static_cast<uint64_t>(sysconf(_SC_PAGESIZE)) / 1024;
+		}
+		fclose(file);
+	}
+
+	// the peak is only updated periodically by the kernel
+	if (usage.rssKB > usage.maxRssKB)
+	{
+		usage.maxRssKB = usage.rssKB;
+	}
+#endif
+
+	return usage;
+}
+
+#endif
+
+}
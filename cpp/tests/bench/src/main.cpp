@@ -0,0 +1,434 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "BenchReport.h"
+#include "BenchStackPair.h"
+#include "ProcessUsage.h"
+
+#include <asiodnp3/DNP3Manager.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace asiodnp3;
+using namespace opendnp3;
+
+namespace
+{
+
+const auto ONLINE_TIMEOUT = std::chrono::seconds(10);
+const auto BATCH_TIMEOUT = std::chrono::seconds(10);
+
+struct Options
+{
+	std::string matrix = "sweep";
+	BenchTransport transport = BenchTransport::Loopback;
+	uint32_t numBatches = 500;
+	uint32_t numRuns = 5;
+	uint16_t port = 20000;
+	std::string output;
+	std::string baseline;
+	double tolerance = 0.10;
+	bool failOnRegression = false;
+};
+
+void PrintUsage()
+{
+	std::cout << "usage: dnp3-bench [options]" << std::endl;
+	std::cout << "  --matrix <quick|sweep|full>  scenarios to run (default: sweep)" << std::endl;
+	std::cout << "                               quick: the base scenario in unsolicited and polled modes" << std::endl;
+	std::cout << "                               sweep: quick + each parameter varied independently" << std::endl;
+	std::cout << "                               full:  every combination of the sweep values" << std::endl;
+	std::cout << "  --transport <tcp|loopback>   how the masters and outstations are connected (default: loopback)" << std::endl;
+	std::cout << "                               tcp sockets don't set TCP_NODELAY, so latency includes Nagle / delayed ACK stalls" << std::endl;
+	std::cout << "  --batches <n>                number of batches sent to each pair per scenario (default: 500)" << std::endl;
+	std::cout << "  --runs <n>                   times each scenario is run, the median run is reported (default: 5)" << std::endl;
+	std::cout << "  --port <n>                   first TCP port (default: 20000)" << std::endl;
+	std::cout << "  --output <file>              write the JSON report to a file instead of stdout" << std::endl;
+	std::cout << "  --baseline <file>            compare with a previous report on the same transport, e.g. cpp/tests/bench/baseline.json" << std::endl;
+	std::cout << "  --tolerance <percent>        allowed change before a scenario is flagged as a regression (default: 10)" << std::endl;
+	std::cout << "  --fail-on-regression         exit with a non-zero code if any scenario regressed" << std::endl;
+}
+
+bool ParseOptions(int argc, char* argv[], Options& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg(argv[i]);
+		const bool hasValue = (i + 1) < argc;
+
+		if (arg == "--matrix" && hasValue)
+		{
+			options.matrix = argv[++i];
+			if (options.matrix != "quick" && options.matrix != "sweep" && options.matrix != "full") return false;
+		}
+		else if (arg == "--transport" && hasValue)
+		{
+			const std::string value(argv[++i]);
+			if (value == "tcp") options.transport = BenchTransport::TCP;
+			else if (value == "loopback") options.transport = BenchTransport::Loopback;
+			else return false;
+		}
+		else if (arg == "--batches" && hasValue)
+		{
+			options.numBatches = static_cast<uint32_t>(std::max(1, atoi(argv[++i])));
+		}
+		else if (arg == "--runs" && hasValue)
+		{
+			options.numRuns = static_cast<uint32_t>(std::max(1, atoi(argv[++i])));
+		}
+		else if (arg == "--port" && hasValue)
+		{
+			options.port = static_cast<uint16_t>(atoi(argv[++i]));
+		}
+		else if (arg == "--output" && hasValue)
+		{
+			options.output = argv[++i];
+		}
+		else if (arg == "--baseline" && hasValue)
+		{
+			options.baseline = argv[++i];
+		}
+		else if (arg == "--tolerance" && hasValue)
+		{
+			options.tolerance = atof(argv[++i]) / 100.0;
+		}
+		else if (arg == "--fail-on-regression")
+		{
+			options.failOnRegression = true;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+std::vector<BenchScenario> GetScenarios(const Options& options)
+{
+	BenchScenario base;
+	base.numBatches = options.numBatches;
+
+	const std::vector<uint16_t> pairs = { 1, 10, 50 };
+	const std::vector<uint32_t> threads = { 1, 2, 4 };
+	const std::vector<uint16_t> points = { 10, 50, 500 };
+	const std::vector<uint32_t> batches = { 10, 50, 500 };
+	const std::vector<uint32_t> rates = { 0, 5000 };
+	const std::vector<uint32_t> fragments = { 249, 2048, 4096 };
+	const std::vector<BenchMode> modes = { BenchMode::Unsolicited, BenchMode::Polled };
+
+	std::vector<BenchScenario> scenarios;
+
+	if (options.matrix == "full")
+	{
+		for (auto mode : modes)
+			for (auto numPairs : pairs)
+				for (auto numThreads : threads)
+					for (auto numPoints : points)
+						for (auto batch : batches)
+							for (auto rate : rates)
+								for (auto fragment : fragments)
+								{
+									auto scenario = base;
+									scenario.mode = mode;
+									scenario.numPairs = numPairs;
+									scenario.numThreads = numThreads;
+									scenario.numPointsPerType = numPoints;
+									scenario.eventsPerBatch = batch;
+									scenario.eventsPerSecond = rate;
+									scenario.maxFragSize = fragment;
+									scenarios.push_back(scenario);
+								}
+
+		return scenarios;
+	}
+
+	for (auto mode : modes)
+	{
+		auto modeBase = base;
+		modeBase.mode = mode;
+		scenarios.push_back(modeBase);
+
+		if (options.matrix == "quick") continue;
+
+		// vary one parameter at a time, skipping the value that matches the base scenario
+		auto add = [&](const std::function<void(BenchScenario&)>& modify)
+		{
+			auto scenario = modeBase;
+			modify(scenario);
+			if (scenario.Name() != modeBase.Name())
+			{
+				scenarios.push_back(scenario);
+			}
+		};
+
+		for (auto value : pairs) add([=](BenchScenario & s) { s.numPairs = value; });
+		for (auto value : threads) add([=](BenchScenario & s) { s.numThreads = value; });
+		for (auto value : points) add([=](BenchScenario & s) { s.numPointsPerType = value; });
+		for (auto value : batches) add([=](BenchScenario & s) { s.eventsPerBatch = value; });
+		for (auto value : rates) add([=](BenchScenario & s) { s.eventsPerSecond = value; });
+		for (auto value : fragments) add([=](BenchScenario & s) { s.maxFragSize = value; });
+	}
+
+	return scenarios;
+}
+
+uint64_t GetPercentile(const std::vector<LatencyHistogram>& histograms, double percentile, uint64_t max)
+{
+	uint64_t total = 0;
+	for (auto& histogram : histograms)
+	{
+		total += histogram.Count();
+	}
+
+	if (total == 0) return 0;
+
+	const auto target = std::max<uint64_t>(1, static_cast<uint64_t>((percentile / 100.0) * static_cast<double>(total) + 0.5));
+
+	uint64_t cumulative = 0;
+	for (uint32_t i = 0; i < LatencyHistogram::NUM_BUCKETS; ++i)
+	{
+		for (auto& histogram : histograms)
+		{
+			cumulative += histogram.CountAt(i);
+		}
+
+		if (cumulative >= target)
+		{
+			// the bucket boundary may be above the largest recorded value
+			return std::min(LatencyHistogram::HighestEquivalentValue(i), max);
+		}
+	}
+
+	return 0;
+}
+
+BenchResult Run(const BenchScenario& scenario, const Options& options)
+{
+	DNP3Manager manager(scenario.numThreads);
+
+	std::vector<std::unique_ptr<BenchStackPair>> pairs;
+	for (uint16_t i = 0; i < scenario.numPairs; ++i)
+	{
+		pairs.push_back(std::make_unique<BenchStackPair>(manager, scenario, options.transport, static_cast<uint16_t>(options.port + i)));
+	}
+
+	for (auto& pair : pairs)
+	{
+		if (!pair->WaitForChannelsOnline(ONLINE_TIMEOUT))
+		{
+			throw std::runtime_error("timed out waiting for channels to open");
+		}
+	}
+
+	const auto startUsage = ProcessUsage::Get();
+	const auto start = std::chrono::steady_clock::now();
+
+	for (uint32_t batch = 0; batch < scenario.numBatches; ++batch)
+	{
+		for (auto& pair : pairs)
+		{
+			pair->SendBatch();
+		}
+
+		for (auto& pair : pairs)
+		{
+			if (!pair->WaitForBatch(BATCH_TIMEOUT))
+			{
+				throw std::runtime_error("timed out waiting for events");
+			}
+		}
+
+		if (scenario.eventsPerSecond > 0)
+		{
+			// pace the batches so that each pair is offered the requested rate
+			const auto next = std::chrono::microseconds((static_cast<uint64_t>(batch + 1) * scenario.eventsPerBatch * 1000000) / scenario.eventsPerSecond);
+			std::this_thread::sleep_until(start + next);
+		}
+	}
+
+	const auto elapsed = std::chrono::steady_clock::now() - start;
+	const auto endUsage = ProcessUsage::Get();
+
+	BenchResult result;
+	result.scenario = scenario;
+
+	std::vector<LatencyHistogram> histograms;
+	for (auto& pair : pairs)
+	{
+		result.numEvents += pair->NumSent();
+		histograms.push_back(pair->GetLatency());
+		result.maxLatencyMicros = std::max(result.maxLatencyMicros, histograms.back().Max());
+	}
+
+	result.seconds = std::chrono::duration<double>(elapsed).count();
+	result.eventsPerSecond = (result.seconds > 0) ? (static_cast<double>(result.numEvents) / result.seconds) : 0;
+	result.p50LatencyMicros = GetPercentile(histograms, 50, result.maxLatencyMicros);
+	result.p99LatencyMicros = GetPercentile(histograms, 99, result.maxLatencyMicros);
+	result.cpuSeconds = endUsage.cpuSeconds - startUsage.cpuSeconds;
+	result.rssKB = endUsage.rssKB;
+	result.maxRssKB = endUsage.maxRssKB;
+
+	return result;
+}
+
+/**
+* A single run of a few hundred milliseconds is at the mercy of the scheduler, so each scenario is run
+* several times and the median throughput and latency are reported
+*/
+BenchResult RunMedian(const BenchScenario& scenario, const Options& options)
+{
+	std::vector<BenchResult> runs;
+	for (uint32_t i = 0; i < options.numRuns; ++i)
+	{
+		runs.push_back(Run(scenario, options));
+	}
+
+	const auto middle = runs.size() / 2;
+
+	// the other fields are reported from the run with the median throughput
+	std::nth_element(runs.begin(), runs.begin() + middle, runs.end(), [](const BenchResult & lhs, const BenchResult & rhs)
+	{
+		return lhs.eventsPerSecond < rhs.eventsPerSecond;
+	});
+	auto result = runs[middle];
+
+	auto latency = [&](uint64_t BenchResult::* field)
+	{
+		std::vector<uint64_t> values;
+		for (auto& run : runs) values.push_back(run.*field);
+		std::nth_element(values.begin(), values.begin() + middle, values.end());
+		return values[middle];
+	};
+
+	result.numRuns = static_cast<uint32_t>(runs.size());
+	result.p50LatencyMicros = latency(&BenchResult::p50LatencyMicros);
+	result.p99LatencyMicros = latency(&BenchResult::p99LatencyMicros);
+	result.maxLatencyMicros = latency(&BenchResult::maxLatencyMicros);
+
+	return result;
+}
+
+const char* TransportToString(BenchTransport transport)
+{
+	return (transport == BenchTransport::TCP) ? "tcp" : "loopback";
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		PrintUsage();
+		return -1;
+	}
+
+	Baseline baseline;
+	if (!options.baseline.empty())
+	{
+		std::string error;
+		if (!ReadBaseline(options.baseline, baseline, error))
+		{
+			std::cerr << error << std::endl;
+			return -1;
+		}
+
+		if (baseline.transport != TransportToString(options.transport))
+		{
+			std::cerr << options.baseline << " was measured over " << baseline.transport << ", not " << TransportToString(options.transport) << std::endl;
+			return -1;
+		}
+	}
+
+	const auto scenarios = GetScenarios(options);
+	std::vector<BenchResult> results;
+
+	for (auto& scenario : scenarios)
+	{
+		std::cerr << "[" << (results.size() + 1) << "/" << scenarios.size() << "] " << scenario.Name() << std::flush;
+
+		try
+		{
+			results.push_back(RunMedian(scenario, options));
+		}
+		catch (const std::exception& ex)
+		{
+			std::cerr << " failed: " << ex.what() << std::endl;
+			return -1;
+		}
+
+		const auto& result = results.back();
+		std::cerr << " -> " << static_cast<uint64_t>(result.eventsPerSecond) << " events/sec, p99 " << result.p99LatencyMicros << " us";
+
+		const auto comparison = Compare(result, baseline, options.tolerance);
+		if (comparison.hasBaseline)
+		{
+			std::cerr << " (" << (comparison.throughputChange >= 0 ? "+" : "") << static_cast<int>(100.0 * comparison.throughputChange) << "% vs baseline)";
+			if (comparison.regression)
+			{
+				std::cerr << " REGRESSION";
+			}
+		}
+
+		std::cerr << std::endl;
+	}
+
+	const auto transport = TransportToString(options.transport);
+
+	if (options.output.empty())
+	{
+		WriteReport(std::cout, transport, results, baseline, options.tolerance);
+	}
+	else
+	{
+		std::ofstream file(options.output);
+		if (!file)
+		{
+			std::cerr << "unable to open " << options.output << std::endl;
+			return -1;
+		}
+		WriteReport(file, transport, results, baseline, options.tolerance);
+	}
+
+	size_t numRegressions = 0;
+	for (auto& result : results)
+	{
+		if (Compare(result, baseline, options.tolerance).regression) ++numRegressions;
+	}
+
+	if (numRegressions > 0)
+	{
+		std::cerr << numRegressions << " of " << results.size() << " scenarios regressed by more than " << (100.0 * options.tolerance) << "%" << std::endl;
+	}
+
+	return (options.failOnRegression && numRegressions > 0) ? 1 : 0;
+}
@@ -0,0 +1,188 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <dnp3decode/CaptureDecoder.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "CaptureDecoderTestSuite - " name
+
+namespace
+{
+
+const char* const CAPTURE_FILE = "capture-decoder-test.pcap";
+
+const uint8_t TCP_FIN = 0x01;
+const uint8_t TCP_SYN = 0x02;
+const uint8_t TCP_PSH_ACK = 0x18;
+
+// a single link layer frame
+const std::vector<uint8_t> FRAME = { 0x05, 0x64, 0x05, 0xC0, 0x01, 0x00, 0x00, 0x04, 0xE9, 0x21 };
+
+/**
+* Writes a little endian pcap file of raw IPv4 packets from 10.0.0.1 to 10.0.0.2:20000
+*/
+class PcapWriter
+{
+public:
+
+	PcapWriter()
+	{
+		U32(0xA1B2C3D4).U16(2).U16(4).U32(0).U32(0).U32(65535).U32(101);
+	}
+
+	PcapWriter& Segment(uint16_t sourcePort, uint32_t seq, uint8_t flags, const std::vector<uint8_t>& payload)
+	{
+		const auto length = static_cast<uint16_t>(40 + payload.size());
+
+		U32(1500000000).U32(numPackets++).U32(length).U32(length);
+
+		BE16(0x4500).BE16(length).BE16(0).BE16(0x4000).BE16(0x4006).BE16(0).BE16(0x0A00).BE16(0x0001).BE16(0x0A00).BE16(0x0002);
+		BE16(sourcePort).BE16(20000).BE16(seq >> 16).BE16(seq & 0xFFFF).BE16(0).BE16(0).BE16(0x5000 | flags).BE16(0xFFFF).BE16(0).BE16(0);
+		bytes.insert(bytes.end(), payload.begin(), payload.end());
+
+		return *this;
+	}
+
+	void Write(const char* path)
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+	}
+
+private:
+
+	PcapWriter& U16(uint16_t value)
+	{
+		bytes.push_back(value & 0xFF);
+		bytes.push_back(value >> 8);
+		return *this;
+	}
+
+	PcapWriter& U32(uint32_t value)
+	{
+		return U16(value & 0xFFFF).U16(value >> 16);
+	}
+
+	PcapWriter& BE16(uint16_t value)
+	{
+		bytes.push_back(value >> 8);
+		bytes.push_back(value & 0xFF);
+		return *this;
+	}
+
+	uint32_t numPackets = 0;
+	std::vector<uint8_t> bytes;
+};
+
+class CountingHandler final : public ICaptureHandler
+{
+public:
+
+	virtual void OnLine(const CaptureLine& line) override
+	{
+		++numLines;
+	}
+
+	size_t numLines = 0;
+};
+
+CaptureDecoderStatistics Decode(const PcapWriter& capture)
+{
+	auto copy = capture;
+	copy.Write(CAPTURE_FILE);
+
+	CaptureDecoderConfig config;
+	config.numThreads = 1;
+	config.packetsPerPass = 4;
+
+	CountingHandler handler;
+	CaptureDecoder decoder(config, handler);
+
+	std::error_code ec;
+	const auto stats = decoder.Decode(CAPTURE_FILE, ec);
+	std::remove(CAPTURE_FILE);
+
+	REQUIRE_FALSE(ec);
+	REQUIRE(stats.numLines == handler.numLines);
+	return stats;
+}
+
+}
+
+TEST_CASE(SUITE("StreamsClosedByFinAreReleased"))
+{
+	const uint16_t NUM_CONNECTIONS = 40;
+
+	PcapWriter capture;
+	for (uint16_t i = 0; i < NUM_CONNECTIONS; ++i)
+	{
+		capture.Segment(50000 + i, 1000, TCP_SYN, {}).Segment(50000 + i, 1001, TCP_PSH_ACK | TCP_FIN, FRAME);
+	}
+
+	const auto stats = Decode(capture);
+
+	REQUIRE(stats.numStreams == NUM_CONNECTIONS);
+	REQUIRE(stats.maxActiveStreams < 10);
+	REQUIRE(stats.numPayloadBytes == NUM_CONNECTIONS * FRAME.size());
+	REQUIRE(stats.numLines > 0);
+}
+
+TEST_CASE(SUITE("StreamsReplacedByANewConnectionAreReleased"))
+{
+	const uint16_t NUM_CONNECTIONS = 40;
+
+	// the same 4-tuple is reused with a new initial sequence number, and never closed
+	PcapWriter capture;
+	for (uint16_t i = 0; i < NUM_CONNECTIONS; ++i)
+	{
+		const uint32_t isn = 1000 * (i + 1);
+		capture.Segment(50000, isn, TCP_SYN, {}).Segment(50000, isn + 1, TCP_PSH_ACK, FRAME);
+	}
+
+	const auto stats = Decode(capture);
+
+	REQUIRE(stats.numStreams == NUM_CONNECTIONS);
+	REQUIRE(stats.maxActiveStreams < 10);
+	REQUIRE(stats.numPayloadBytes == NUM_CONNECTIONS * FRAME.size());
+}
+
+TEST_CASE(SUITE("StreamsThatStayOpenAreNotReleased"))
+{
+	const uint16_t NUM_CONNECTIONS = 10;
+
+	PcapWriter capture;
+	for (uint16_t i = 0; i < NUM_CONNECTIONS; ++i)
+	{
+		capture.Segment(50000 + i, 1000, TCP_SYN, {}).Segment(50000 + i, 1001, TCP_PSH_ACK, FRAME);
+	}
+
+	const auto stats = Decode(capture);
+
+	REQUIRE(stats.numStreams == NUM_CONNECTIONS);
+	REQUIRE(stats.maxActiveStreams == NUM_CONNECTIONS);
+}
@@ -0,0 +1,299 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <dnp3decode/CaptureReader.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "CaptureReaderTestSuite - " name
+
+namespace
+{
+
+const uint32_t LINKTYPE_ETHERNET = 1;
+const uint32_t LINKTYPE_RAW = 101;
+
+/**
+* Builds capture files in either byte order
+*/
+class CaptureBuilder
+{
+public:
+
+	explicit CaptureBuilder(bool bigEndian) : bigEndian(bigEndian)
+	{}
+
+	CaptureBuilder& U8(uint8_t value)
+	{
+		bytes.push_back(value);
+		return *this;
+	}
+
+	CaptureBuilder& U16(uint16_t value)
+	{
+		return bigEndian ? U8(value >> 8).U8(value & 0xFF) : U8(value & 0xFF).U8(value >> 8);
+	}
+
+	CaptureBuilder& U32(uint32_t value)
+	{
+		return bigEndian ? U16(value >> 16).U16(value & 0xFFFF) : U16(value & 0xFFFF).U16(value >> 16);
+	}
+
+	CaptureBuilder& Data(const std::vector<uint8_t>& data)
+	{
+		bytes.insert(bytes.end(), data.begin(), data.end());
+		return *this;
+	}
+
+	CaptureBuilder& PcapHeader(uint32_t magic, uint32_t linkType)
+	{
+		return U32(magic).U16(2).U16(4).U32(0).U32(0).U32(65535).U32(linkType);
+	}
+
+	CaptureBuilder& PcapRecord(uint32_t seconds, uint32_t fraction, const std::vector<uint8_t>& data)
+	{
+		return U32(seconds).U32(fraction).U32(static_cast<uint32_t>(data.size())).U32(static_cast<uint32_t>(data.size())).Data(data);
+	}
+
+	CaptureBuilder& SectionHeader()
+	{
+		return U32(0x0A0D0D0A).U32(28).U32(0x1A2B3C4D).U16(1).U16(0).U32(0xFFFFFFFF).U32(0xFFFFFFFF).U32(28);
+	}
+
+	CaptureBuilder& Interface(uint16_t linkType, uint8_t resolution)
+	{
+		// if_tsresol padded to 4 bytes, then opt_endofopt
+		return U32(1).U32(32).U16(linkType).U16(0).U32(65535)
+		       .U16(9).U16(1).U8(resolution).U8(0).U8(0).U8(0)
+		       .U16(0).U16(0)
+		       .U32(32);
+	}
+
+	CaptureBuilder& EnhancedPacket(uint32_t interfaceId, uint64_t timestamp, const std::vector<uint8_t>& data)
+	{
+		const auto padded = (data.size() + 3) & ~static_cast<size_t>(3);
+		const auto length = static_cast<uint32_t>(32 + padded);
+
+		U32(6).U32(length).U32(interfaceId).U32(static_cast<uint32_t>(timestamp >> 32)).U32(static_cast<uint32_t>(timestamp));
+		U32(static_cast<uint32_t>(data.size())).U32(static_cast<uint32_t>(data.size())).Data(data);
+		for (auto i = data.size(); i < padded; ++i)
+		{
+			U8(0);
+		}
+		return U32(length);
+	}
+
+	std::vector<uint8_t> bytes;
+
+private:
+
+	const bool bigEndian;
+};
+
+const std::vector<uint8_t> FIRST = { 0x01, 0x02, 0x03 };
+const std::vector<uint8_t> SECOND = { 0x04, 0x05, 0x06, 0x07, 0x08 };
+
+std::vector<uint8_t> ToVector(const openpal::RSlice& data)
+{
+	return std::vector<uint8_t>(static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + data.Size());
+}
+
+void TestPcap(bool bigEndian, uint32_t magic, uint32_t fraction, int64_t nanoseconds)
+{
+	CaptureBuilder builder(bigEndian);
+	builder.PcapHeader(magic, LINKTYPE_ETHERNET).PcapRecord(1500000000, fraction, FIRST).PcapRecord(1500000001, 0, SECOND);
+
+	CaptureReader reader(builder.bytes.data(), builder.bytes.size());
+	REQUIRE(reader.ReadHeader());
+
+	CapturePacket packet;
+	REQUIRE(reader.Read(packet));
+	REQUIRE(packet.nanoseconds == 1500000000LL * 1000000000LL + nanoseconds);
+	REQUIRE(packet.linkType == LINKTYPE_ETHERNET);
+	REQUIRE(ToVector(packet.data) == FIRST);
+
+	REQUIRE(reader.Read(packet));
+	REQUIRE(packet.nanoseconds == 1500000001LL * 1000000000LL);
+	REQUIRE(ToVector(packet.data) == SECOND);
+
+	REQUIRE_FALSE(reader.Read(packet));
+	REQUIRE_FALSE(reader.IsCorrupt());
+}
+
+void TestPcapNG(bool bigEndian)
+{
+	CaptureBuilder builder(bigEndian);
+	builder.SectionHeader()
+	.Interface(LINKTYPE_ETHERNET, 6)
+	.Interface(LINKTYPE_RAW, 9)
+	.EnhancedPacket(0, 1500000000000123ULL, FIRST)
+	.EnhancedPacket(1, 1500000001000000456ULL, SECOND);
+
+	CaptureReader reader(builder.bytes.data(), builder.bytes.size());
+	REQUIRE(reader.ReadHeader());
+
+	CapturePacket packet;
+	REQUIRE(reader.Read(packet));
+	REQUIRE(packet.nanoseconds == 1500000000000123000LL);
+	REQUIRE(packet.linkType == LINKTYPE_ETHERNET);
+	REQUIRE(ToVector(packet.data) == FIRST);
+
+	REQUIRE(reader.Read(packet));
+	REQUIRE(packet.nanoseconds == 1500000001000000456LL);
+	REQUIRE(packet.linkType == LINKTYPE_RAW);
+	REQUIRE(ToVector(packet.data) == SECOND);
+
+	REQUIRE_FALSE(reader.Read(packet));
+	REQUIRE_FALSE(reader.IsCorrupt());
+}
+
+}
+
+TEST_CASE(SUITE("PcapLittleEndianMicroseconds"))
+{
+	TestPcap(false, 0xA1B2C3D4, 123456, 123456000);
+}
+
+TEST_CASE(SUITE("PcapBigEndianMicroseconds"))
+{
+	TestPcap(true, 0xA1B2C3D4, 123456, 123456000);
+}
+
+TEST_CASE(SUITE("PcapLittleEndianNanoseconds"))
+{
+	TestPcap(false, 0xA1B23C4D, 123456789, 123456789);
+}
+
+TEST_CASE(SUITE("PcapBigEndianNanoseconds"))
+{
+	TestPcap(true, 0xA1B23C4D, 123456789, 123456789);
+}
+
+TEST_CASE(SUITE("PcapNGLittleEndian"))
+{
+	TestPcapNG(false);
+}
+
+TEST_CASE(SUITE("PcapNGBigEndian"))
+{
+	TestPcapNG(true);
+}
+
+TEST_CASE(SUITE("PcapNGSectionsMayChangeTheByteOrder"))
+{
+	CaptureBuilder little(false);
+	little.SectionHeader().Interface(LINKTYPE_ETHERNET, 6).EnhancedPacket(0, 1, FIRST);
+
+	CaptureBuilder big(true);
+	big.SectionHeader().Interface(LINKTYPE_RAW, 6).EnhancedPacket(0, 2, SECOND);
+
+	auto bytes = little.bytes;
+	bytes.insert(bytes.end(), big.bytes.begin(), big.bytes.end());
+
+	CaptureReader reader(bytes.data(), bytes.size());
+	REQUIRE(reader.ReadHeader());
+
+	CapturePacket packet;
+	REQUIRE(reader.Read(packet));
+	REQUIRE(packet.linkType == LINKTYPE_ETHERNET);
+	REQUIRE(ToVector(packet.data) == FIRST);
+
+	REQUIRE(reader.Read(packet));
+	REQUIRE(packet.linkType == LINKTYPE_RAW);
+	REQUIRE(packet.nanoseconds == 2000);
+	REQUIRE(ToVector(packet.data) == SECOND);
+
+	REQUIRE_FALSE(reader.Read(packet));
+	REQUIRE_FALSE(reader.IsCorrupt());
+}
+
+TEST_CASE(SUITE("UnknownFormatIsRejected"))
+{
+	CaptureBuilder builder(false);
+	builder.PcapHeader(0x12345678, LINKTYPE_ETHERNET);
+
+	CaptureReader reader(builder.bytes.data(), builder.bytes.size());
+	REQUIRE_FALSE(reader.ReadHeader());
+}
+
+TEST_CASE(SUITE("TruncatedPcapRecordIsCorrupt"))
+{
+	CaptureBuilder builder(false);
+	builder.PcapHeader(0xA1B2C3D4, LINKTYPE_ETHERNET).PcapRecord(0, 0, FIRST).PcapRecord(0, 0, SECOND);
+	builder.bytes.pop_back();
+
+	CaptureReader reader(builder.bytes.data(), builder.bytes.size());
+	REQUIRE(reader.ReadHeader());
+
+	CapturePacket packet;
+	REQUIRE(reader.Read(packet));
+	REQUIRE_FALSE(reader.Read(packet));
+	REQUIRE(reader.IsCorrupt());
+	REQUIRE_FALSE(reader.Read(packet));
+}
+
+TEST_CASE(SUITE("TruncatedPcapRecordHeaderIsCorrupt"))
+{
+	CaptureBuilder builder(true);
+	builder.PcapHeader(0xA1B2C3D4, LINKTYPE_ETHERNET).PcapRecord(0, 0, FIRST).U32(0);
+
+	CaptureReader reader(builder.bytes.data(), builder.bytes.size());
+	REQUIRE(reader.ReadHeader());
+
+	CapturePacket packet;
+	REQUIRE(reader.Read(packet));
+	REQUIRE_FALSE(reader.Read(packet));
+	REQUIRE(reader.IsCorrupt());
+}
+
+TEST_CASE(SUITE("TruncatedPcapNGBlockIsCorrupt"))
+{
+	CaptureBuilder builder(true);
+	builder.SectionHeader().Interface(LINKTYPE_ETHERNET, 6).EnhancedPacket(0, 0, FIRST).EnhancedPacket(0, 0, SECOND);
+	builder.bytes.resize(builder.bytes.size() - 4);
+
+	CaptureReader reader(builder.bytes.data(), builder.bytes.size());
+	REQUIRE(reader.ReadHeader());
+
+	CapturePacket packet;
+	REQUIRE(reader.Read(packet));
+	REQUIRE_FALSE(reader.Read(packet));
+	REQUIRE(reader.IsCorrupt());
+}
+
+TEST_CASE(SUITE("PcapNGPacketLongerThanItsBlockIsCorrupt"))
+{
+	CaptureBuilder builder(false);
+	builder.SectionHeader().Interface(LINKTYPE_ETHERNET, 6).EnhancedPacket(0, 0, FIRST);
+	// captured length field of the enhanced packet block
+	builder.bytes[28 + 32 + 20] = 0xFF;
+
+	CaptureReader reader(builder.bytes.data(), builder.bytes.size());
+	REQUIRE(reader.ReadHeader());
+
+	CapturePacket packet;
+	REQUIRE_FALSE(reader.Read(packet));
+	REQUIRE(reader.IsCorrupt());
+}
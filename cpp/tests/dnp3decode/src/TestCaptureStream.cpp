@@ -0,0 +1,237 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <dnp3decode/CaptureStream.h>
+
+#include <opendnp3/LogLevels.h>
+
+#include <testlib/BufferHelpers.h>
+
+#include <string>
+#include <vector>
+
+using namespace openpal;
+using namespace opendnp3;
+using namespace testlib;
+
+#define SUITE(name) "CaptureStreamTestSuite - " name
+
+namespace
+{
+
+// two link layer frames back to back
+const std::string FRAMES = "05 64 05 C0 01 00 00 04 E9 21 05 64 05 C0 01 00 00 04 E9 21";
+
+std::vector<std::string> Messages(CaptureStream& stream)
+{
+	stream.Decode();
+
+	std::vector<std::string> messages;
+	for (auto& record : stream.Records())
+	{
+		messages.push_back(record.message);
+	}
+	return messages;
+}
+
+std::vector<std::string> DecodeInOrder()
+{
+	HexSequence frames(FRAMES);
+	CaptureStream stream("reference", levels::ALL);
+	stream.AddTCP(0, 0, 100, true, RSlice());
+	stream.AddTCP(0, 1, 101, false, frames.ToRSlice());
+	return Messages(stream);
+}
+
+}
+
+TEST_CASE(SUITE("SegmentsReceivedOutOfOrderAreDecodedInSequenceOrder"))
+{
+	HexSequence frames(FRAMES);
+	const auto bytes = frames.ToRSlice();
+
+	CaptureStream stream("test", levels::ALL);
+	stream.AddTCP(0, 0, 100, true, RSlice());
+	stream.AddTCP(0, 1, 101 + 13, false, bytes.Skip(13));
+	stream.AddTCP(0, 2, 101 + 4, false, bytes.Skip(4).Take(9));
+
+	REQUIRE_FALSE(stream.HasData());
+
+	stream.AddTCP(0, 3, 101, false, bytes.Take(4));
+
+	REQUIRE(stream.NumReadyBytes() == 20);
+	REQUIRE(stream.numPayloadBytes == 20);
+	REQUIRE(stream.numDuplicateBytes == 0);
+	REQUIRE(stream.numGaps == 0);
+
+	const auto messages = Messages(stream);
+	REQUIRE_FALSE(messages.empty());
+	REQUIRE(messages == DecodeInOrder());
+}
+
+TEST_CASE(SUITE("RetransmittedAndOverlappingBytesAreOnlyDecodedOnce"))
+{
+	HexSequence frames(FRAMES);
+	const auto bytes = frames.ToRSlice();
+
+	CaptureStream stream("test", levels::ALL);
+	stream.AddTCP(0, 0, 100, true, RSlice());
+	stream.AddTCP(0, 1, 101, false, bytes.Take(10));
+	stream.AddTCP(0, 2, 101, false, bytes.Take(10));
+	stream.AddTCP(0, 3, 101 + 5, false, bytes.Skip(5));
+
+	REQUIRE(stream.numPayloadBytes == 20);
+	REQUIRE(stream.numDuplicateBytes == 15);
+	REQUIRE(stream.numGaps == 0);
+	REQUIRE(Messages(stream) == DecodeInOrder());
+}
+
+TEST_CASE(SUITE("OverlappingSegmentsHeldOutOfOrderAreTrimmed"))
+{
+	HexSequence frames(FRAMES);
+	const auto bytes = frames.ToRSlice();
+
+	CaptureStream stream("test", levels::ALL);
+	stream.AddTCP(0, 0, 100, true, RSlice());
+	stream.AddTCP(0, 1, 101 + 6, false, bytes.Skip(6));
+	stream.AddTCP(0, 2, 101 + 3, false, bytes.Skip(3).Take(8));
+	stream.AddTCP(0, 3, 101, false, bytes.Take(3));
+
+	REQUIRE(stream.numPayloadBytes == 20);
+	REQUIRE(stream.numDuplicateBytes == 5);
+	REQUIRE(Messages(stream) == DecodeInOrder());
+}
+
+TEST_CASE(SUITE("SequenceNumbersThatWrapAreReassembled"))
+{
+	HexSequence frames(FRAMES);
+	const auto bytes = frames.ToRSlice();
+
+	CaptureStream stream("test", levels::ALL);
+	stream.AddTCP(0, 0, 0xFFFFFFF8, true, RSlice());
+	stream.AddTCP(0, 1, 0x00000003, false, bytes.Skip(10));
+	stream.AddTCP(0, 2, 0xFFFFFFF9, false, bytes.Take(10));
+
+	REQUIRE(stream.numPayloadBytes == 20);
+	REQUIRE(stream.numDuplicateBytes == 0);
+	REQUIRE(stream.numGaps == 0);
+	REQUIRE(Messages(stream) == DecodeInOrder());
+}
+
+TEST_CASE(SUITE("CaptureStartedAfterTheHandshake"))
+{
+	HexSequence frames(FRAMES);
+
+	CaptureStream stream("test", levels::ALL);
+	stream.AddTCP(0, 0, 5000, false, RSlice());
+
+	REQUIRE_FALSE(stream.HasData());
+
+	stream.AddTCP(0, 1, 5000, false, frames.ToRSlice());
+
+	REQUIRE(stream.numPayloadBytes == 20);
+	REQUIRE(Messages(stream) == DecodeInOrder());
+}
+
+TEST_CASE(SUITE("FlushSkipsHolesAndReportsTheMissingBytes"))
+{
+	HexSequence frames(FRAMES);
+	const auto bytes = frames.ToRSlice();
+
+	CaptureStream stream("test", levels::ALL);
+	stream.AddTCP(1000, 0, 100, true, RSlice());
+	stream.AddTCP(2000, 1, 101, false, bytes.Take(10));
+	stream.AddTCP(3000, 2, 101 + 17, false, bytes.Skip(17));
+
+	REQUIRE(stream.NumReadyBytes() == 10);
+
+	stream.Flush();
+
+	REQUIRE(stream.NumReadyBytes() == 13);
+	REQUIRE(stream.numGaps == 1);
+
+	stream.Decode();
+
+	std::vector<CaptureRecord> warnings;
+	for (auto& record : stream.Records())
+	{
+		if (record.filters == flags::WARN)
+		{
+			warnings.push_back(record);
+		}
+	}
+
+	REQUIRE(warnings.size() == 1);
+	REQUIRE(warnings[0].message.find("missing 7 bytes") == 0);
+	REQUIRE(warnings[0].nanoseconds == 3000);
+	REQUIRE(warnings[0].packet == 2);
+}
+
+TEST_CASE(SUITE("ExpireOnlySkipsHolesOlderThanThePacket"))
+{
+	HexSequence frames(FRAMES);
+	const auto bytes = frames.ToRSlice();
+
+	CaptureStream stream("test", levels::ALL);
+	stream.AddTCP(0, 0, 100, true, RSlice());
+	stream.AddTCP(0, 5, 101 + 10, false, bytes.Skip(10));
+
+	stream.Expire(5);
+	REQUIRE_FALSE(stream.HasData());
+	REQUIRE(stream.numGaps == 0);
+
+	stream.Expire(6);
+	REQUIRE(stream.NumReadyBytes() == 10);
+	REQUIRE(stream.numGaps == 1);
+
+	// the late segment is now behind the stream and discarded
+	stream.AddTCP(0, 7, 101, false, bytes.Take(10));
+	REQUIRE(stream.NumReadyBytes() == 10);
+	REQUIRE(stream.numDuplicateBytes == 10);
+}
+
+TEST_CASE(SUITE("NewConnectionIsDetectedByADifferentInitialSequenceNumber"))
+{
+	CaptureStream stream("test", levels::ALL);
+
+	REQUIRE_FALSE(stream.IsNewConnection(100, true));
+
+	stream.AddTCP(0, 0, 100, true, RSlice());
+
+	REQUIRE_FALSE(stream.IsNewConnection(100, true));
+	REQUIRE_FALSE(stream.IsNewConnection(200, false));
+	REQUIRE(stream.IsNewConnection(200, true));
+}
+
+TEST_CASE(SUITE("DatagramsAreDecodedInCaptureOrder"))
+{
+	HexSequence frames(FRAMES);
+	const auto bytes = frames.ToRSlice();
+
+	CaptureStream stream("test", levels::ALL);
+	stream.AddDatagram(0, 0, bytes.Take(10));
+	stream.AddDatagram(0, 1, RSlice());
+	stream.AddDatagram(0, 2, bytes.Skip(10));
+
+	REQUIRE(stream.NumReadyBytes() == 20);
+	REQUIRE(Messages(stream) == DecodeInOrder());
+}
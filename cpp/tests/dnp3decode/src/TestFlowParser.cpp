@@ -0,0 +1,122 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <dnp3decode/FlowParser.h>
+
+#include <testlib/BufferHelpers.h>
+#include <testlib/HexConversions.h>
+
+#include <string>
+
+using namespace openpal;
+using namespace opendnp3;
+using namespace testlib;
+
+#define SUITE(name) "FlowParserTestSuite - " name
+
+namespace
+{
+
+const uint32_t LINKTYPE_ETHERNET = 1;
+const uint32_t LINKTYPE_RAW = 101;
+
+const std::string ETHERNET = "00 00 00 00 00 00 00 00 00 00 00 00 08 00";
+
+// 10.0.0.1:20000 > 10.0.0.2:50000, seq 0x01020304, PSH/ACK
+const std::string TCP = "4E 20 C3 50 01 02 03 04 00 00 00 00 50 18 FF FF 00 00 00 00";
+
+const std::string PAYLOAD = "05 64 05 C0 01 00 00 04 E9 21";
+
+std::string IPv4(const std::string& totalLength)
+{
+	return "45 00 " + totalLength + " 00 00 40 00 40 06 00 00 0A 00 00 01 0A 00 00 02";
+}
+
+}
+
+TEST_CASE(SUITE("ParsesTCPOverEthernet"))
+{
+	HexSequence packet(ETHERNET + " " + IPv4("00 32") + " " + TCP + " " + PAYLOAD);
+
+	FlowSegment segment;
+	REQUIRE(ParseFlowSegment(LINKTYPE_ETHERNET, packet.ToRSlice(), segment));
+	REQUIRE(segment.key.protocol == PROTOCOL_TCP);
+	REQUIRE(segment.key.ipVersion == 4);
+	REQUIRE(segment.key.sourcePort == 20000);
+	REQUIRE(segment.key.destinationPort == 50000);
+	REQUIRE(segment.seq == 0x01020304);
+	REQUIRE_FALSE(segment.syn);
+	REQUIRE_FALSE(segment.fin);
+	REQUIRE(ToHex(segment.payload) == PAYLOAD);
+	REQUIRE(segment.key.ToString() == "tcp 10.0.0.1:20000 > 10.0.0.2:50000");
+}
+
+TEST_CASE(SUITE("FinAndRstEndTheStream"))
+{
+	// FIN/PSH/ACK, then RST/ACK
+	for (auto flags : { "19", "14" })
+	{
+		const std::string tcp = "4E 20 C3 50 01 02 03 04 00 00 00 00 50 " + std::string(flags) + " FF FF 00 00 00 00";
+		HexSequence packet(IPv4("00 28") + " " + tcp);
+
+		FlowSegment segment;
+		REQUIRE(ParseFlowSegment(LINKTYPE_RAW, packet.ToRSlice(), segment));
+		REQUIRE(segment.fin);
+		REQUIRE(segment.payload.IsEmpty());
+	}
+}
+
+TEST_CASE(SUITE("EthernetPaddingIsRemoved"))
+{
+	HexSequence packet(ETHERNET + " " + IPv4("00 32") + " " + TCP + " " + PAYLOAD + " 00 00 00 00");
+
+	FlowSegment segment;
+	REQUIRE(ParseFlowSegment(LINKTYPE_ETHERNET, packet.ToRSlice(), segment));
+	REQUIRE(ToHex(segment.payload) == PAYLOAD);
+}
+
+TEST_CASE(SUITE("ZeroTotalLengthUsesTheCapturedLength"))
+{
+	// captured on the sending host before TCP segmentation offload filled in the length
+	HexSequence packet(IPv4("00 00") + " " + TCP + " " + PAYLOAD);
+
+	FlowSegment segment;
+	REQUIRE(ParseFlowSegment(LINKTYPE_RAW, packet.ToRSlice(), segment));
+	REQUIRE(segment.key.protocol == PROTOCOL_TCP);
+	REQUIRE(ToHex(segment.payload) == PAYLOAD);
+}
+
+TEST_CASE(SUITE("TotalLengthShorterThanTheHeaderIsRejected"))
+{
+	HexSequence packet(IPv4("00 10") + " " + TCP + " " + PAYLOAD);
+
+	FlowSegment segment;
+	REQUIRE_FALSE(ParseFlowSegment(LINKTYPE_RAW, packet.ToRSlice(), segment));
+}
+
+TEST_CASE(SUITE("FragmentsAreRejected"))
+{
+	HexSequence packet("45 00 00 32 00 00 20 00 40 06 00 00 0A 00 00 01 0A 00 00 02 " + TCP + " " + PAYLOAD);
+
+	FlowSegment segment;
+	REQUIRE_FALSE(ParseFlowSegment(LINKTYPE_RAW, packet.ToRSlice(), segment));
+}
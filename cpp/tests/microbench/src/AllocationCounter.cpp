@@ -0,0 +1,106 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+std::atomic<uint64_t> numAllocations(0);
+std::atomic<uint64_t> numBytes(0);
+
+void* Allocate(std::size_t size)
+{
+	numAllocations.fetch_add(1, std::memory_order_relaxed);
+	numBytes.fetch_add(size, std::memory_order_relaxed);
+	// malloc(0) may legitimately return nullptr, but operator new may not
+	return std::malloc(size == 0 ? 1 : size);
+}
+}
+
+namespace opendnp3
+{
+
+AllocationCount AllocationCount::Get()
+{
+	AllocationCount count;
+	count.allocations = numAllocations.load(std::memory_order_relaxed);
+	count.bytes = numBytes.load(std::memory_order_relaxed);
+	return count;
+}
+
+}
+
+void* operator new(std::size_t size)
+{
+	auto memory = Allocate(size);
+	if (!memory) throw std::bad_alloc();
+	return memory;
+}
+
+void* operator new[](std::size_t size)
+{
+	auto memory = Allocate(size);
+	if (!memory) throw std::bad_alloc();
+	return memory;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	return Allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	return Allocate(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+	std::free(memory);
+}
@@ -0,0 +1,54 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_ALLOCATIONCOUNTER_H
+#define OPENDNP3_ALLOCATIONCOUNTER_H
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+* Totals maintained by the replacement global operator new of this executable.
+*
+* Allocations made inside a shared library are only counted on platforms where the
+* replacement is visible to the library (e.g. ELF), so build with STATICLIBS for exact
+* numbers on Windows.
+*/
+struct AllocationCount
+{
+	uint64_t allocations = 0;
+	uint64_t bytes = 0;
+
+	static AllocationCount Get();
+
+	AllocationCount operator-(const AllocationCount& rhs) const
+	{
+		AllocationCount count;
+		count.allocations = allocations - rhs.allocations;
+		count.bytes = bytes - rhs.bytes;
+		return count;
+	}
+};
+
+}
+
+#endif
@@ -0,0 +1,86 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "CpuAffinity.h"
+
+#if defined(WIN32)
+	#include <windows.h>
+#elif defined(__linux__)
+	#include <sched.h>
+	#include <cerrno>
+#endif
+
+namespace opendnp3
+{
+
+#if defined(WIN32)
+
+bool PinCurrentThread(uint32_t cpu, std::error_code& ec)
+{
+	if (cpu >= sizeof(DWORD_PTR) * 8)
+	{
+		ec = std::make_error_code(std::errc::invalid_argument);
+		return false;
+	}
+
+	if (SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << cpu) == 0)
+	{
+		ec = std::error_code(static_cast<int>(GetLastError()), std::system_category());
+		return false;
+	}
+
+	return true;
+}
+
+#elif defined(__linux__)
+
+bool PinCurrentThread(uint32_t cpu, std::error_code& ec)
+{
+	if (cpu >= CPU_SETSIZE)
+	{
+		ec = std::make_error_code(std::errc::invalid_argument);
+		return false;
+	}
+
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+
+	// pid 0 == the calling thread
+	if (sched_setaffinity(0, sizeof(set), &set) != 0)
+	{
+		ec = std::error_code(errno, std::generic_category());
+		return false;
+	}
+
+	return true;
+}
+
+#else
+
+bool PinCurrentThread(uint32_t, std::error_code& ec)
+{
+	ec = std::make_error_code(std::errc::not_supported);
+	return false;
+}
+
+#endif
+
+}
@@ -0,0 +1,41 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_CPUAFFINITY_H
+#define OPENDNP3_CPUAFFINITY_H
+
+#include <cstdint>
+#include <system_error>
+
+namespace opendnp3
+{
+
+/**
+* Restrict the calling thread to a single CPU so that timings aren't disturbed by migrations
+*
+* @param cpu zero-based index of the CPU
+* @param ec An error code. Set if the platform doesn't support pinning or the CPU doesn't exist
+* @return true if the thread was pinned
+*/
+bool PinCurrentThread(uint32_t cpu, std::error_code& ec);
+
+}
+
+#endif
@@ -0,0 +1,177 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "Microbench.h"
+
+#include <opendnp3/link/CRC.h>
+#include <opendnp3/link/LinkFrame.h>
+#include <opendnp3/link/LinkLayerParser.h>
+#include <opendnp3/link/LinkLayerConstants.h>
+
+#include <openpal/logging/Logger.h>
+
+#include <cstring>
+#include <memory>
+#include <random>
+
+using namespace openpal;
+
+namespace opendnp3
+{
+
+namespace
+{
+
+// size of each simulated read from the channel
+const uint32_t READ_SIZE = 512;
+
+// number of frames in each stream
+const uint32_t NUM_FRAMES = 64;
+
+class CountingFrameSink final : public IFrameSink
+{
+public:
+
+	virtual bool OnFrame(const LinkHeaderFields& header, const RSlice& userdata) override
+	{
+		++numFrames;
+		numBytes += userdata.Size();
+		return true;
+	}
+
+	uint64_t numFrames = 0;
+	uint64_t numBytes = 0;
+};
+
+/**
+* A stream of full unconfirmed user data frames. If noisy, a burst of random bytes precedes
+* every frame and the user data of every 8th frame is damaged so that its block CRC fails.
+*/
+std::vector<uint8_t> FormatStream(bool noisy)
+{
+	std::mt19937 random(0x0D17E5);
+	std::uniform_int_distribution<uint32_t> byte(0, 255);
+	std::uniform_int_distribution<uint32_t> burst(0, 32);
+
+	std::vector<uint8_t> stream;
+	uint8_t payload[LPDU_MAX_USER_DATA_SIZE];
+	uint8_t frame[LPDU_MAX_FRAME_SIZE];
+
+	for (uint32_t i = 0; i < NUM_FRAMES; ++i)
+	{
+		for (uint32_t j = 0; j < sizeof(payload); ++j)
+		{
+			payload[j] = static_cast<uint8_t>(i + j);
+		}
+
+		WSlice dest(frame, sizeof(frame));
+		auto output = LinkFrame::FormatUnconfirmedUserData(dest, true, 1024, 1, payload, sizeof(payload), nullptr);
+		std::vector<uint8_t> bytes(static_cast<const uint8_t*>(output), output + output.Size());
+
+		if (noisy)
+		{
+			const auto numNoise = burst(random);
+			for (uint32_t j = 0; j < numNoise; ++j)
+			{
+				stream.push_back(static_cast<uint8_t>(byte(random)));
+			}
+
+			if ((i % 8) == 7)
+			{
+				bytes[LPDU_HEADER_SIZE] ^= 0xFF;
+			}
+		}
+
+		stream.insert(stream.end(), bytes.begin(), bytes.end());
+	}
+
+	return stream;
+}
+
+MicrobenchFixture CreateCRC(uint32_t size)
+{
+	auto data = std::make_shared<std::vector<uint8_t>>(size);
+	for (uint32_t i = 0; i < size; ++i)
+	{
+		(*data)[i] = static_cast<uint8_t>(i);
+	}
+
+	MicrobenchFixture fixture;
+	fixture.bytesPerOp = size;
+	fixture.run = [data](uint64_t iterations)
+	{
+		uint64_t total = 0;
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			total += CRC::CalcCrc(data->data(), static_cast<uint32_t>(data->size()));
+		}
+		Consume(total);
+	};
+	return fixture;
+}
+
+struct ParserState
+{
+	ParserState(bool noisy) : parser(Logger::Empty()), stream(FormatStream(noisy))
+	{}
+
+	LinkLayerParser parser;
+	CountingFrameSink sink;
+	std::vector<uint8_t> stream;
+};
+
+MicrobenchFixture CreateParser(bool noisy)
+{
+	auto state = std::make_shared<ParserState>(noisy);
+
+	MicrobenchFixture fixture;
+	fixture.bytesPerOp = state->stream.size();
+	fixture.run = [state](uint64_t iterations)
+	{
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			uint32_t position = 0;
+			const auto size = static_cast<uint32_t>(state->stream.size());
+
+			while (position < size)
+			{
+				auto buffer = state->parser.WriteBuff();
+				const auto num = std::min(std::min(buffer.Size(), READ_SIZE), size - position);
+				memcpy(buffer, state->stream.data() + position, num);
+				state->parser.OnRead(num, state->sink);
+				position += num;
+			}
+		}
+		Consume(state->sink.numFrames);
+	};
+	return fixture;
+}
+
+}
+
+void AddLinkBenchmarks(std::vector<Microbench>& benchmarks)
+{
+	benchmarks.push_back(Microbench("crc/16", "CRC of a full link layer block", [] { return CreateCRC(16); }));
+	benchmarks.push_back(Microbench("crc/256", "CRC of a 256 byte buffer", [] { return CreateCRC(256); }));
+	benchmarks.push_back(Microbench("link/parse/clean", "parse 64 full frames delivered in 512 byte reads", [] { return CreateParser(false); }));
+	benchmarks.push_back(Microbench("link/parse/noisy", "parse 64 full frames preceded by line noise, 1 in 8 with a bad CRC", [] { return CreateParser(true); }));
+}
+
+}
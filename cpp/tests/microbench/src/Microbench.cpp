@@ -0,0 +1,109 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "Microbench.h"
+
+#include "AllocationCounter.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace opendnp3
+{
+
+namespace
+{
+std::atomic<uint64_t> sink(0);
+
+// calibration never runs more than this many operations in a single repetition
+const uint64_t MAX_ITERATIONS = 1000000000;
+
+double Time(const MicrobenchFixture& fixture, uint64_t iterations)
+{
+	const auto start = std::chrono::steady_clock::now();
+	fixture.run(iterations);
+	const auto stop = std::chrono::steady_clock::now();
+	return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+}
+}
+
+void Consume(uint64_t value)
+{
+	sink.fetch_add(value, std::memory_order_relaxed);
+}
+
+MicrobenchResult Measure(const Microbench& bench, const MicrobenchOptions& options)
+{
+	const auto fixture = bench.setup();
+	const auto target = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(options.minTime).count());
+
+	// grow the iteration count until a single run reaches the target, which also warms the caches
+	uint64_t iterations = 1;
+	while (iterations < MAX_ITERATIONS)
+	{
+		const auto elapsed = Time(fixture, iterations);
+		if (elapsed >= target) break;
+
+		// aim slightly past the target, but never grow by more than 10x in one step
+		const auto estimate = (elapsed > 0) ? static_cast<uint64_t>(1.2 * iterations * target / elapsed) : (10 * iterations);
+		iterations = std::min(MAX_ITERATIONS, std::max(iterations + 1, std::min(estimate, 10 * iterations)));
+	}
+
+	const auto repetitions = std::max<uint32_t>(1, options.repetitions);
+
+	std::vector<double> samples;
+	samples.reserve(repetitions);
+
+	const auto before = AllocationCount::Get();
+	for (uint32_t i = 0; i < repetitions; ++i)
+	{
+		samples.push_back(Time(fixture, iterations) / iterations);
+	}
+	const auto allocated = AllocationCount::Get() - before;
+
+	std::sort(samples.begin(), samples.end());
+
+	MicrobenchResult result;
+	result.name = bench.name;
+	result.iterations = iterations;
+	result.repetitions = repetitions;
+	result.nsPerOp = (repetitions % 2) ? samples[repetitions / 2] : (samples[repetitions / 2 - 1] + samples[repetitions / 2]) / 2;
+	result.minNsPerOp = samples.front();
+	result.maxNsPerOp = samples.back();
+	result.bytesPerSecond = (result.nsPerOp > 0) ? (fixture.bytesPerOp * 1e9 / result.nsPerOp) : 0;
+
+	const auto numOps = static_cast<double>(iterations) * repetitions;
+	result.allocsPerOp = allocated.allocations / numOps;
+	result.allocBytesPerOp = allocated.bytes / numOps;
+
+	return result;
+}
+
+std::vector<Microbench> GetMicrobenchmarks()
+{
+	std::vector<Microbench> benchmarks;
+	AddLinkBenchmarks(benchmarks);
+	AddTransportBenchmarks(benchmarks);
+	AddParserBenchmarks(benchmarks);
+	AddOutstationBenchmarks(benchmarks);
+	return benchmarks;
+}
+
+}
@@ -0,0 +1,116 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_MICROBENCH_H
+#define OPENDNP3_MICROBENCH_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+* Keeps a value alive so that the compiler can't discard the work that produced it
+*/
+void Consume(uint64_t value);
+
+/**
+* State of a benchmark after its setup has run
+*/
+struct MicrobenchFixture
+{
+	/// perform the operation the requested number of times
+	std::function<void (uint64_t iterations)> run;
+
+	/// bytes processed by one operation, or 0 if the operation isn't byte oriented
+	uint64_t bytesPerOp = 0;
+};
+
+/**
+* A single operation on one component of the stack.
+*
+* The setup is only invoked when the benchmark is selected to run, and its cost
+* (time and allocations) is never attributed to the operation.
+*/
+struct Microbench
+{
+	Microbench(const std::string& name, const std::string& description, const std::function<MicrobenchFixture ()>& setup) :
+		name(name),
+		description(description),
+		setup(setup)
+	{}
+
+	std::string name;
+	std::string description;
+	std::function<MicrobenchFixture ()> setup;
+};
+
+struct MicrobenchOptions
+{
+	/// minimum duration of each timed repetition
+	std::chrono::milliseconds minTime = std::chrono::milliseconds(250);
+
+	/// number of timed repetitions, the median of which is reported
+	uint32_t repetitions = 5;
+};
+
+struct MicrobenchResult
+{
+	std::string name;
+
+	/// operations performed in each repetition
+	uint64_t iterations = 0;
+	uint32_t repetitions = 0;
+
+	double nsPerOp = 0;
+	double minNsPerOp = 0;
+	double maxNsPerOp = 0;
+
+	/// 0 if the benchmark isn't byte oriented
+	double bytesPerSecond = 0;
+
+	/// heap allocations and allocated bytes per operation, averaged over all repetitions
+	double allocsPerOp = 0;
+	double allocBytesPerOp = 0;
+};
+
+/**
+* Calibrate the number of iterations so that a repetition lasts at least options.minTime,
+* then time the requested number of repetitions.
+*/
+MicrobenchResult Measure(const Microbench& bench, const MicrobenchOptions& options);
+
+/**
+* Every benchmark in the suite, grouped by layer in the order they should run
+*/
+std::vector<Microbench> GetMicrobenchmarks();
+
+void AddLinkBenchmarks(std::vector<Microbench>& benchmarks);
+void AddTransportBenchmarks(std::vector<Microbench>& benchmarks);
+void AddParserBenchmarks(std::vector<Microbench>& benchmarks);
+void AddOutstationBenchmarks(std::vector<Microbench>& benchmarks);
+
+}
+
+#endif
@@ -0,0 +1,69 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "MicrobenchFixtures.h"
+
+#include <opendnp3/app/APDUHeader.h>
+#include <opendnp3/app/APDUResponse.h>
+
+using namespace openpal;
+
+namespace opendnp3
+{
+
+void SetValues(Database& db, const DatabaseSizes& sizes, uint16_t stride)
+{
+	for (uint16_t i = 0; i < sizes.numBinary; ++i)
+	{
+		db.Update(Binary((i % 2) == 0), i * stride);
+	}
+
+	for (uint16_t i = 0; i < sizes.numAnalog; ++i)
+	{
+		db.Update(Analog(i * 1.5, 0x01), i * stride);
+	}
+
+	for (uint16_t i = 0; i < sizes.numCounter; ++i)
+	{
+		db.Update(Counter(i * 100, 0x01), i * stride);
+	}
+}
+
+Fragments LoadIntegrity(Database& db, uint32_t fragmentSize)
+{
+	Fragments fragments;
+
+	db.GetStaticSelector().SelectAll(GroupVariation::Group60Var1);
+
+	bool complete = false;
+	while (!complete)
+	{
+		std::vector<uint8_t> buffer(fragmentSize);
+		APDUResponse response(WSlice(buffer.data(), fragmentSize));
+		auto writer = response.GetWriter();
+		complete = db.GetResponseLoader().Load(writer);
+		auto objects = response.ToRSlice().Skip(APDUHeader::RESPONSE_SIZE);
+		fragments.push_back(std::vector<uint8_t>(static_cast<const uint8_t*>(objects), objects + objects.Size()));
+	}
+
+	return fragments;
+}
+
+}
@@ -0,0 +1,94 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_MICROBENCHFIXTURES_H
+#define OPENDNP3_MICROBENCHFIXTURES_H
+
+#include <opendnp3/outstation/Database.h>
+#include <opendnp3/outstation/IEventReceiver.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace opendnp3
+{
+
+typedef std::vector<std::vector<uint8_t>> Fragments;
+
+/**
+* Discards the events produced by a database, so that only the database itself is measured
+*/
+class CountingEventReceiver final : public IEventReceiver
+{
+public:
+
+	virtual void Update(const Event<BinarySpec>& evt) override
+	{
+		++numEvents;
+	}
+	virtual void Update(const Event<DoubleBitBinarySpec>& evt) override
+	{
+		++numEvents;
+	}
+	virtual void Update(const Event<AnalogSpec>& evt) override
+	{
+		++numEvents;
+	}
+	virtual void Update(const Event<CounterSpec>& evt) override
+	{
+		++numEvents;
+	}
+	virtual void Update(const Event<FrozenCounterSpec>& evt) override
+	{
+		++numEvents;
+	}
+	virtual void Update(const Event<BinaryOutputStatusSpec>& evt) override
+	{
+		++numEvents;
+	}
+	virtual void Update(const Event<AnalogOutputStatusSpec>& evt) override
+	{
+		++numEvents;
+	}
+	virtual void Update(const Event<OctetStringSpec>& evt) override
+	{
+		++numEvents;
+	}
+
+	uint64_t numEvents = 0;
+};
+
+/**
+* Give every binary, analog and counter in the database a distinct value
+*
+* @param stride spacing of the virtual indices in discontiguous mode
+*/
+void SetValues(Database& db, const DatabaseSizes& sizes, uint16_t stride = 1);
+
+/**
+* Select all class 0 values and load them into response fragments no larger than fragmentSize
+*
+* @return the object data of each fragment, i.e. without the response header
+*/
+Fragments LoadIntegrity(Database& db, uint32_t fragmentSize);
+
+}
+
+#endif
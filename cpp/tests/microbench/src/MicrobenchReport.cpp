@@ -0,0 +1,114 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "MicrobenchReport.h"
+
+#include <iomanip>
+
+namespace opendnp3
+{
+
+void WriteText(std::ostream& output, const MicrobenchContext& context, const std::vector<MicrobenchResult>& results)
+{
+	output << std::fixed;
+
+	output << context.options.repetitions << " repetitions of at least " << context.options.minTime.count() << " ms";
+	if (context.cpu >= 0)
+	{
+		output << ", pinned to CPU " << context.cpu;
+	}
+	output << std::endl << std::endl;
+
+	output << std::left << std::setw(38) << "benchmark" << std::right
+	       << std::setw(14) << "ns/op"
+	       << std::setw(10) << "+/-"
+	       << std::setw(12) << "MB/s"
+	       << std::setw(12) << "allocs/op"
+	       << std::setw(12) << "bytes/op"
+	       << std::setw(14) << "iterations" << std::endl;
+
+	for (auto& result : results)
+	{
+		// half of the spread between the fastest and slowest repetitions
+		const auto spread = (result.maxNsPerOp - result.minNsPerOp) / 2;
+
+		output << std::left << std::setw(38) << result.name << std::right
+		       << std::setw(14) << std::setprecision(1) << result.nsPerOp
+		       << std::setw(10) << std::setprecision(1) << spread
+		       << std::setw(12) << std::setprecision(1) << (result.bytesPerSecond / 1000000.0)
+		       << std::setw(12) << std::setprecision(2) << result.allocsPerOp
+		       << std::setw(12) << std::setprecision(1) << result.allocBytesPerOp
+		       << std::setw(14) << result.iterations << std::endl;
+	}
+}
+
+void WriteJSON(std::ostream& output, const MicrobenchContext& context, const std::vector<MicrobenchResult>& results)
+{
+	output << std::fixed << std::setprecision(3);
+
+	output << "{" << std::endl;
+	output << "  \"version\": 1," << std::endl;
+	output << "  \"min_time_ms\": " << context.options.minTime.count() << "," << std::endl;
+	output << "  \"repetitions\": " << context.options.repetitions << "," << std::endl;
+	output << "  \"cpu\": " << context.cpu << "," << std::endl;
+	output << "  \"results\": [";
+
+	bool first = true;
+	for (auto& result : results)
+	{
+		output << (first ? "" : ",") << std::endl;
+		first = false;
+
+		output << "    {" << std::endl;
+		output << "      \"name\": \"" << result.name << "\"," << std::endl;
+		output << "      \"iterations\": " << result.iterations << "," << std::endl;
+		output << "      \"ns_per_op\": " << result.nsPerOp << "," << std::endl;
+		output << "      \"min_ns_per_op\": " << result.minNsPerOp << "," << std::endl;
+		output << "      \"max_ns_per_op\": " << result.maxNsPerOp << "," << std::endl;
+		output << "      \"bytes_per_second\": " << result.bytesPerSecond << "," << std::endl;
+		output << "      \"allocs_per_op\": " << result.allocsPerOp << "," << std::endl;
+		output << "      \"alloc_bytes_per_op\": " << result.allocBytesPerOp << std::endl;
+		output << "    }";
+	}
+
+	output << std::endl << "  ]" << std::endl;
+	output << "}" << std::endl;
+}
+
+void WriteCSV(std::ostream& output, const MicrobenchContext& context, const std::vector<MicrobenchResult>& results)
+{
+	output << std::fixed << std::setprecision(3);
+
+	output << "name,iterations,ns_per_op,min_ns_per_op,max_ns_per_op,bytes_per_second,allocs_per_op,alloc_bytes_per_op" << std::endl;
+
+	for (auto& result : results)
+	{
+		output << result.name << ","
+		       << result.iterations << ","
+		       << result.nsPerOp << ","
+		       << result.minNsPerOp << ","
+		       << result.maxNsPerOp << ","
+		       << result.bytesPerSecond << ","
+		       << result.allocsPerOp << ","
+		       << result.allocBytesPerOp << std::endl;
+	}
+}
+
+}
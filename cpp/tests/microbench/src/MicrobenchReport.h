@@ -0,0 +1,54 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_MICROBENCHREPORT_H
+#define OPENDNP3_MICROBENCHREPORT_H
+
+#include "Microbench.h"
+
+#include <ostream>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+* How the benchmarks were run, recorded alongside the results
+*/
+struct MicrobenchContext
+{
+	MicrobenchOptions options;
+
+	/// the CPU the benchmarks were pinned to, or -1 if they weren't
+	int32_t cpu = -1;
+};
+
+/// aligned columns for reading in a terminal
+void WriteText(std::ostream& output, const MicrobenchContext& context, const std::vector<MicrobenchResult>& results);
+
+/// a single JSON document for scripts and regression tracking
+void WriteJSON(std::ostream& output, const MicrobenchContext& context, const std::vector<MicrobenchResult>& results);
+
+/// one header row and one row per benchmark
+void WriteCSV(std::ostream& output, const MicrobenchContext& context, const std::vector<MicrobenchResult>& results);
+
+}
+
+#endif
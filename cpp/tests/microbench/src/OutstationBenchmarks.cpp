@@ -0,0 +1,174 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "Microbench.h"
+#include "MicrobenchFixtures.h"
+
+#include <opendnp3/app/APDUResponse.h>
+#include <opendnp3/outstation/event/ASDUEventWriteHandler.h>
+#include <opendnp3/outstation/event/EventStorage.h>
+
+#include <memory>
+
+using namespace openpal;
+
+namespace opendnp3
+{
+
+namespace
+{
+
+const uint16_t NUM_POINTS = 1000;
+const uint16_t NUM_EVENTS = 100;
+const uint32_t FRAGMENT_SIZE = 2048;
+
+// virtual indices are spread out by this factor in discontiguous mode
+const uint16_t INDEX_STRIDE = 3;
+
+struct DatabaseState
+{
+	DatabaseState(const DatabaseSizes& sizes, IndexMode mode) : db(sizes, receiver, mode, StaticTypeBitField::AllTypes())
+	{
+		if (mode == IndexMode::Discontiguous)
+		{
+			auto view = db.GetConfigView();
+			for (uint16_t i = 0; i < view.binaries.Size(); ++i) view.binaries[i].config.vIndex = i * INDEX_STRIDE;
+			for (uint16_t i = 0; i < view.analogs.Size(); ++i) view.analogs[i].config.vIndex = i * INDEX_STRIDE;
+			for (uint16_t i = 0; i < view.counters.Size(); ++i) view.counters[i].config.vIndex = i * INDEX_STRIDE;
+		}
+	}
+
+	CountingEventReceiver receiver;
+	Database db;
+};
+
+MicrobenchFixture CreateUpdate(IndexMode mode)
+{
+	auto state = std::make_shared<DatabaseState>(DatabaseSizes::AnalogOnly(NUM_POINTS), mode);
+	const uint16_t stride = (mode == IndexMode::Discontiguous) ? INDEX_STRIDE : 1;
+
+	MicrobenchFixture fixture;
+	fixture.run = [state, stride](uint64_t iterations)
+	{
+		// every update changes the value, so each one also produces an event
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			const auto index = static_cast<uint16_t>((i % NUM_POINTS) * stride);
+			state->db.Update(Analog(static_cast<double>(i), 0x01), index);
+		}
+		Consume(state->receiver.numEvents);
+	};
+	return fixture;
+}
+
+struct EventState
+{
+	EventState() : storage(EventBufferConfig::AllTypes(NUM_EVENTS)), buffer(FRAGMENT_SIZE)
+	{}
+
+	// update, select, write and clear a full buffer of analog events
+	uint32_t Cycle(uint64_t value)
+	{
+		for (uint16_t i = 0; i < NUM_EVENTS; ++i)
+		{
+			storage.Update(Event<AnalogSpec>(Analog(static_cast<double>(value + i), 0x01), i, EventClass::EC1, EventAnalogVariation::Group32Var1));
+		}
+
+		storage.SelectByClass(ClassField::AllEventClasses());
+
+		APDUResponse response(WSlice(buffer.data(), FRAGMENT_SIZE));
+		ASDUEventWriteHandler handler(response.GetWriter());
+		storage.Write(handler);
+		storage.ClearWritten();
+
+		return response.ToRSlice().Size();
+	}
+
+	EventStorage storage;
+	std::vector<uint8_t> buffer;
+};
+
+MicrobenchFixture CreateEventCycle()
+{
+	auto state = std::make_shared<EventState>();
+
+	MicrobenchFixture fixture;
+	fixture.bytesPerOp = state->Cycle(0);
+	fixture.run = [state](uint64_t iterations)
+	{
+		uint64_t total = 0;
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			total += state->Cycle(i);
+		}
+		Consume(total);
+	};
+	return fixture;
+}
+
+MicrobenchFixture CreateIntegrityLoad(IndexMode mode)
+{
+	const auto sizes = DatabaseSizes(NUM_POINTS, 0, NUM_POINTS, NUM_POINTS, 0, 0, 0, 0, 0);
+	auto state = std::make_shared<DatabaseState>(sizes, mode);
+	SetValues(state->db, sizes, (mode == IndexMode::Discontiguous) ? INDEX_STRIDE : 1);
+
+	uint64_t size = 0;
+	for (auto& fragment : LoadIntegrity(state->db, FRAGMENT_SIZE))
+	{
+		size += fragment.size();
+	}
+
+	auto buffer = std::make_shared<std::vector<uint8_t>>(FRAGMENT_SIZE);
+
+	MicrobenchFixture fixture;
+	fixture.bytesPerOp = size;
+	fixture.run = [state, buffer](uint64_t iterations)
+	{
+		uint64_t total = 0;
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			state->db.GetStaticSelector().SelectAll(GroupVariation::Group60Var1);
+
+			bool complete = false;
+			while (!complete)
+			{
+				APDUResponse response(WSlice(buffer->data(), FRAGMENT_SIZE));
+				auto writer = response.GetWriter();
+				complete = state->db.GetResponseLoader().Load(writer);
+				total += response.ToRSlice().Size();
+			}
+		}
+		Consume(total);
+	};
+	return fixture;
+}
+
+}
+
+void AddOutstationBenchmarks(std::vector<Microbench>& benchmarks)
+{
+	benchmarks.push_back(Microbench("database/update/contiguous", "update one of 1000 analogs, producing an event", [] { return CreateUpdate(IndexMode::Contiguous); }));
+	benchmarks.push_back(Microbench("database/update/discontiguous", "update one of 1000 analogs by virtual index, producing an event", [] { return CreateUpdate(IndexMode::Discontiguous); }));
+	benchmarks.push_back(Microbench("eventstorage/cycle/100", "update, select, write and clear 100 g32v1 events", [] { return CreateEventCycle(); }));
+	benchmarks.push_back(Microbench("databasebuffers/load/contiguous", "load an integrity response of 1000 each of binary, analog and counter", [] { return CreateIntegrityLoad(IndexMode::Contiguous); }));
+	benchmarks.push_back(Microbench("databasebuffers/load/discontiguous", "as above, with discontiguous virtual indices", [] { return CreateIntegrityLoad(IndexMode::Discontiguous); }));
+}
+
+}
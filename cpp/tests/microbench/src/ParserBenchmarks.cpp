@@ -0,0 +1,196 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "Microbench.h"
+#include "MicrobenchFixtures.h"
+
+#include <opendnp3/app/APDUHeader.h>
+#include <opendnp3/app/APDUResponse.h>
+#include <opendnp3/master/ISOEHandler.h>
+#include <opendnp3/master/MeasurementHandler.h>
+#include <opendnp3/outstation/event/ASDUEventWriteHandler.h>
+#include <opendnp3/outstation/event/EventStorage.h>
+
+#include <openpal/logging/Logger.h>
+
+#include <memory>
+
+using namespace openpal;
+
+namespace opendnp3
+{
+
+namespace
+{
+
+const uint16_t NUM_VALUES = 100;
+const uint32_t FRAGMENT_SIZE = 2048;
+
+/**
+* Visits every value, as an application copying the measurements out of the stack would
+*/
+class CountingSOEHandler final : public ISOEHandler
+{
+public:
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values) override
+	{
+		this->Visit(values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values) override
+	{
+		this->Visit(values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values) override
+	{
+		this->Visit(values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values) override
+	{
+		this->Visit(values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values) override
+	{
+		this->Visit(values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values) override
+	{
+		this->Visit(values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values) override
+	{
+		this->Visit(values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<OctetString>>& values) override
+	{
+		this->Visit(values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<TimeAndInterval>>& values) override
+	{
+		this->Visit(values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryCommandEvent>>& values) override
+	{
+		this->Visit(values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogCommandEvent>>& values) override
+	{
+		this->Visit(values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<SecurityStat>>& values) override
+	{
+		this->Visit(values);
+	}
+	virtual void Process(const HeaderInfo& info, const ICollection<DNPTime>& values) override
+	{
+		numValues += values.Count();
+	}
+
+	uint64_t numValues = 0;
+	uint64_t indexSum = 0;
+
+protected:
+
+	virtual void Start() override {}
+	virtual void End() override {}
+
+private:
+
+	template <class T>
+	void Visit(const ICollection<Indexed<T>>& values)
+	{
+		values.ForeachItem([this](const Indexed<T>& item)
+		{
+			++numValues;
+			indexSum += item.index;
+		});
+	}
+};
+
+// the object data of an integrity response with binaries, analogs and counters
+std::vector<uint8_t> CreateIntegrity()
+{
+	const auto sizes = DatabaseSizes(NUM_VALUES, 0, NUM_VALUES, NUM_VALUES, 0, 0, 0, 0, 0);
+	CountingEventReceiver receiver;
+	Database db(sizes, receiver, IndexMode::Contiguous, StaticTypeBitField::AllTypes());
+	SetValues(db, sizes);
+	return LoadIntegrity(db, FRAGMENT_SIZE).front();
+}
+
+// the object data of an event response with analogs that carry a timestamp
+std::vector<uint8_t> CreateEvents()
+{
+	EventStorage storage(EventBufferConfig::AllTypes(NUM_VALUES));
+	for (uint16_t i = 0; i < NUM_VALUES; ++i)
+	{
+		storage.Update(Event<AnalogSpec>(Analog(i * 1.5, 0x01, DNPTime(1000 + i)), i, EventClass::EC1, EventAnalogVariation::Group32Var3));
+	}
+	storage.SelectByClass(ClassField::AllEventClasses());
+
+	std::vector<uint8_t> buffer(FRAGMENT_SIZE);
+	APDUResponse response(WSlice(buffer.data(), FRAGMENT_SIZE));
+	ASDUEventWriteHandler handler(response.GetWriter());
+	storage.Write(handler);
+
+	auto objects = response.ToRSlice().Skip(APDUHeader::RESPONSE_SIZE);
+	return std::vector<uint8_t>(static_cast<const uint8_t*>(objects), objects + objects.Size());
+}
+
+struct ParseState
+{
+	ParseState(const std::vector<uint8_t>& objects) : logger(Logger::Empty()), objects(objects)
+	{}
+
+	Logger logger;
+	CountingSOEHandler handler;
+	std::vector<uint8_t> objects;
+};
+
+MicrobenchFixture CreateParse(const std::vector<uint8_t>& objects)
+{
+	auto state = std::make_shared<ParseState>(objects);
+
+	MicrobenchFixture fixture;
+	fixture.bytesPerOp = objects.size();
+	fixture.run = [state](uint64_t iterations)
+	{
+		const RSlice objects(state->objects.data(), static_cast<uint32_t>(state->objects.size()));
+		uint64_t failures = 0;
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			if (MeasurementHandler::ProcessMeasurements(objects, state->logger, &state->handler) != ParseResult::OK)
+			{
+				++failures;
+			}
+		}
+		Consume(state->handler.numValues + state->handler.indexSum + failures);
+	};
+	return fixture;
+}
+
+}
+
+void AddParserBenchmarks(std::vector<Microbench>& benchmarks)
+{
+	benchmarks.push_back(Microbench("apdu/parse/integrity", "parse 100 each of g1v2, g30v1 and g20v1 into an SOE handler", [] { return CreateParse(CreateIntegrity()); }));
+	benchmarks.push_back(Microbench("apdu/parse/events", "parse 100 g32v3 events into an SOE handler", [] { return CreateParse(CreateEvents()); }));
+}
+
+}
@@ -0,0 +1,131 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "Microbench.h"
+
+#include <opendnp3/transport/TransportRx.h>
+#include <opendnp3/transport/TransportTx.h>
+
+#include <openpal/logging/Logger.h>
+
+#include <memory>
+
+using namespace openpal;
+
+namespace opendnp3
+{
+
+namespace
+{
+
+const Addresses ADDRESSES(1024, 1);
+
+std::vector<uint8_t> CreateAPDU(uint32_t size)
+{
+	std::vector<uint8_t> apdu(size);
+	for (uint32_t i = 0; i < size; ++i)
+	{
+		apdu[i] = static_cast<uint8_t>(i);
+	}
+	return apdu;
+}
+
+struct TxState
+{
+	TxState(uint32_t size) : tx(Logger::Empty()), apdu(CreateAPDU(size))
+	{}
+
+	TransportTx tx;
+	std::vector<uint8_t> apdu;
+};
+
+MicrobenchFixture CreateTx(uint32_t size)
+{
+	auto state = std::make_shared<TxState>(size);
+
+	MicrobenchFixture fixture;
+	fixture.bytesPerOp = size;
+	fixture.run = [state](uint64_t iterations)
+	{
+		uint64_t total = 0;
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			state->tx.Configure(Message(ADDRESSES, RSlice(state->apdu.data(), static_cast<uint32_t>(state->apdu.size()))));
+			while (state->tx.HasValue())
+			{
+				total += state->tx.GetSegment().Size();
+				state->tx.Advance();
+			}
+		}
+		Consume(total);
+	};
+	return fixture;
+}
+
+struct RxState
+{
+	RxState(uint32_t size) : rx(Logger::Empty(), size)
+	{
+		// capture the segments produced by the transmitter
+		TransportTx tx(Logger::Empty());
+		auto apdu = CreateAPDU(size);
+		tx.Configure(Message(ADDRESSES, RSlice(apdu.data(), size)));
+		while (tx.HasValue())
+		{
+			auto segment = tx.GetSegment();
+			segments.push_back(std::vector<uint8_t>(static_cast<const uint8_t*>(segment), segment + segment.Size()));
+			tx.Advance();
+		}
+	}
+
+	TransportRx rx;
+	std::vector<std::vector<uint8_t>> segments;
+};
+
+MicrobenchFixture CreateRx(uint32_t size)
+{
+	auto state = std::make_shared<RxState>(size);
+
+	MicrobenchFixture fixture;
+	fixture.bytesPerOp = size;
+	fixture.run = [state](uint64_t iterations)
+	{
+		uint64_t total = 0;
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			for (auto& segment : state->segments)
+			{
+				total += state->rx.ProcessReceive(Message(ADDRESSES, RSlice(segment.data(), static_cast<uint32_t>(segment.size())))).payload.Size();
+			}
+		}
+		Consume(total);
+	};
+	return fixture;
+}
+
+}
+
+void AddTransportBenchmarks(std::vector<Microbench>& benchmarks)
+{
+	benchmarks.push_back(Microbench("transport/tx/2048", "segment a 2048 byte APDU", [] { return CreateTx(2048); }));
+	benchmarks.push_back(Microbench("transport/rx/2048", "reassemble a 2048 byte APDU from its segments", [] { return CreateRx(2048); }));
+}
+
+}
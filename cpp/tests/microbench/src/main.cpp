@@ -0,0 +1,207 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "Microbench.h"
+#include "MicrobenchReport.h"
+#include "CpuAffinity.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace opendnp3;
+
+namespace
+{
+
+enum class Format
+{
+	Text,
+	JSON,
+	CSV
+};
+
+struct Options
+{
+	std::vector<std::string> filters;
+	MicrobenchOptions bench;
+	int32_t cpu = -1;
+	Format format = Format::Text;
+	std::string output;
+	bool list = false;
+};
+
+void PrintUsage()
+{
+	std::cout << "usage: dnp3-microbench [options]" << std::endl;
+	std::cout << "  --filter <text>         only run benchmarks whose name contains the text, may be repeated" << std::endl;
+	std::cout << "  --min-time <ms>         minimum duration of each repetition (default: 250)" << std::endl;
+	std::cout << "  --repetitions <n>       timed repetitions per benchmark, the median is reported (default: 5)" << std::endl;
+	std::cout << "  --cpu <n>               pin the benchmark thread to a CPU" << std::endl;
+	std::cout << "  --format <text|json|csv> format of the report (default: text)" << std::endl;
+	std::cout << "  --output <file>         write the report to a file instead of stdout" << std::endl;
+	std::cout << "  --list                  print the name and description of each benchmark and exit" << std::endl;
+}
+
+bool ParseOptions(int argc, char* argv[], Options& options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg(argv[i]);
+		const bool hasValue = (i + 1) < argc;
+
+		if (arg == "--filter" && hasValue)
+		{
+			options.filters.push_back(argv[++i]);
+		}
+		else if (arg == "--min-time" && hasValue)
+		{
+			options.bench.minTime = std::chrono::milliseconds(std::max(1, atoi(argv[++i])));
+		}
+		else if (arg == "--repetitions" && hasValue)
+		{
+			options.bench.repetitions = static_cast<uint32_t>(std::max(1, atoi(argv[++i])));
+		}
+		else if (arg == "--cpu" && hasValue)
+		{
+			options.cpu = atoi(argv[++i]);
+			if (options.cpu < 0) return false;
+		}
+		else if (arg == "--format" && hasValue)
+		{
+			const std::string value(argv[++i]);
+			if (value == "text") options.format = Format::Text;
+			else if (value == "json") options.format = Format::JSON;
+			else if (value == "csv") options.format = Format::CSV;
+			else return false;
+		}
+		else if (arg == "--output" && hasValue)
+		{
+			options.output = argv[++i];
+		}
+		else if (arg == "--list")
+		{
+			options.list = true;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool IsSelected(const Options& options, const Microbench& bench)
+{
+	if (options.filters.empty()) return true;
+
+	for (auto& filter : options.filters)
+	{
+		if (bench.name.find(filter) != std::string::npos) return true;
+	}
+
+	return false;
+}
+
+void WriteReport(std::ostream& output, const Options& options, const std::vector<MicrobenchResult>& results)
+{
+	MicrobenchContext context;
+	context.options = options.bench;
+	context.cpu = options.cpu;
+
+	switch (options.format)
+	{
+	case(Format::JSON):
+		WriteJSON(output, context, results);
+		break;
+	case(Format::CSV):
+		WriteCSV(output, context, results);
+		break;
+	default:
+		WriteText(output, context, results);
+		break;
+	}
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		PrintUsage();
+		return -1;
+	}
+
+	std::vector<Microbench> benchmarks;
+	for (auto& bench : GetMicrobenchmarks())
+	{
+		if (IsSelected(options, bench)) benchmarks.push_back(bench);
+	}
+
+	if (options.list)
+	{
+		for (auto& bench : benchmarks)
+		{
+			std::cout << bench.name << " - " << bench.description << std::endl;
+		}
+		return 0;
+	}
+
+	if (options.cpu >= 0)
+	{
+		std::error_code ec;
+		if (!PinCurrentThread(static_cast<uint32_t>(options.cpu), ec))
+		{
+			std::cerr << "unable to pin to CPU " << options.cpu << ": " << ec.message() << std::endl;
+			return -1;
+		}
+	}
+
+	std::vector<MicrobenchResult> results;
+	for (auto& bench : benchmarks)
+	{
+		std::cerr << "[" << (results.size() + 1) << "/" << benchmarks.size() << "] " << bench.name << std::flush;
+		results.push_back(Measure(bench, options.bench));
+		std::cerr << " -> " << static_cast<uint64_t>(results.back().nsPerOp) << " ns/op" << std::endl;
+	}
+
+	if (options.output.empty())
+	{
+		WriteReport(std::cout, options, results);
+	}
+	else
+	{
+		std::ofstream file(options.output);
+		if (!file)
+		{
+			std::cerr << "unable to open " << options.output << std::endl;
+			return -1;
+		}
+		WriteReport(file, options, results);
+	}
+
+	return 0;
+}
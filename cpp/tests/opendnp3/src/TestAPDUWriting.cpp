@@ -22,6 +22,7 @@
 
 #include <opendnp3/app/APDURequest.h>
 #include <opendnp3/app/APDUResponse.h>
+#include <opendnp3/app/PackedBits.h>
 
 #include <openpal/util/ToHex.h>
 #include <openpal/serialization/Serialization.h>
@@ -293,5 +294,24 @@ TEST_CASE(SUITE("WriteIINRestart"))
 	REQUIRE("C0 02 50 01 00 07 08 03" ==  ToHex(request.ToRSlice()));
 }
 
+TEST_CASE(SUITE("WriteBitfieldFromPackedBits"))
+{
+	APDUResponse response(APDUHelpers::Response());
+	auto writer = response.GetWriter();
+
+	PackedBits bits(20);
+	bits.Set(1, true);
+	bits.Set(2, true);
+	bits.Set(11, true);
+
+	{
+		auto iter = writer.IterateOverSingleBitfield<UInt8>(GroupVariationID(1, 1), QualifierCode::UINT8_START_STOP, 3);
+		iter.Write(true);
+		REQUIRE(iter.Write(bits, 1, 11) == 11);
+	}
+
+	REQUIRE("C0 81 00 00 01 01 00 03 0E 07 08" ==  ToHex(response.ToRSlice()));
+}
+
 
 
@@ -0,0 +1,346 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <opendnp3/objects/Group1.h>
+#include <opendnp3/objects/Group2.h>
+#include <opendnp3/objects/Group3.h>
+#include <opendnp3/objects/Group4.h>
+#include <opendnp3/objects/Group10.h>
+#include <opendnp3/objects/Group11.h>
+#include <opendnp3/objects/Group20.h>
+#include <opendnp3/objects/Group21.h>
+#include <opendnp3/objects/Group22.h>
+#include <opendnp3/objects/Group23.h>
+#include <opendnp3/objects/Group30.h>
+#include <opendnp3/objects/Group32.h>
+#include <opendnp3/objects/Group40.h>
+#include <opendnp3/objects/Group42.h>
+#include <opendnp3/objects/Group50.h>
+#include <opendnp3/outstation/event/EventWriters.h>
+
+#include <openpal/container/StaticBuffer.h>
+
+#include "mocks/APDUHelpers.h"
+
+#include <testlib/HexConversions.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace openpal;
+using namespace opendnp3;
+using namespace testlib;
+
+#define SUITE(name) "BulkSerializationTestSuite - " name
+
+template <class T>
+std::vector<uint16_t> Indices(const std::vector<T>& values)
+{
+	std::vector<uint16_t> indices;
+	for (uint32_t i = 0; i < values.size(); ++i)
+	{
+		indices.push_back(static_cast<uint16_t>(i * 3));
+	}
+	return indices;
+}
+
+template <class T>
+std::string WriteEach(typename openpal::Serializer<T>::WriteFunc write, uint32_t size, const std::vector<T>& values, bool withIndices, uint32_t bufferSize)
+{
+	StaticBuffer<2048> buffer;
+	auto dest = buffer.GetWSlice(bufferSize);
+	auto start = dest;
+
+	const auto indices = Indices(values);
+	const uint32_t sizeWithIndex = withIndices ? size + 2 : size;
+
+	for (uint32_t i = 0; i < values.size() && dest.Size() >= sizeWithIndex; ++i)
+	{
+		if (withIndices) UInt16::WriteBuffer(dest, indices[i]);
+		REQUIRE((*write)(values[i], dest));
+	}
+
+	return ToHex(start.ToRSlice().Take(bufferSize - dest.Size()));
+}
+
+template <class T>
+std::string WriteMany(typename openpal::Serializer<T>::WriteManyFunc writeMany, uint32_t size, const std::vector<T>& values, bool withIndices, uint32_t bufferSize)
+{
+	StaticBuffer<2048> buffer;
+	auto dest = buffer.GetWSlice(bufferSize);
+	auto start = dest;
+
+	const auto indices = Indices(values);
+	const uint32_t count = static_cast<uint32_t>(values.size());
+	const uint32_t num = (*writeMany)(StridedView<T>(values.data()), withIndices ? indices.data() : nullptr, count, dest);
+	const uint32_t sizeWithIndex = withIndices ? size + 2 : size;
+
+	REQUIRE(num == std::min(count, bufferSize / sizeWithIndex));
+	REQUIRE(dest.Size() == bufferSize - num * sizeWithIndex);
+
+	return ToHex(start.ToRSlice().Take(bufferSize - dest.Size()));
+}
+
+// compares the generated WriteTargets kernel byte for byte with the per-value WriteTarget(..), which calls GV::Write(..)
+template <class GV>
+void TestKernel(const std::vector<typename GV::Target>& values)
+{
+	typedef typename GV::Target T;
+
+	for (bool withIndices : { false, true })
+	{
+		const uint32_t whole = 2048;
+
+		// only whole objects are written when the buffer fills
+		const uint32_t partial = (withIndices ? 2 * (GV::Size() + 2) : 2 * GV::Size()) + 1;
+
+		for (uint32_t bufferSize : { whole, partial })
+		{
+			const auto expected = WriteEach<T>(&GV::WriteTarget, GV::Size(), values, withIndices, bufferSize);
+			REQUIRE(WriteMany<T>(&GV::WriteTargets, GV::Size(), values, withIndices, bufferSize) == expected);
+		}
+	}
+}
+
+template <class T>
+void TestKernels(const std::vector<T>&)
+{}
+
+template <class GV, class... Rest>
+void TestKernels(const std::vector<typename GV::Target>& values)
+{
+	TestKernel<GV>(values);
+	TestKernels<Rest...>(values);
+}
+
+TEST_CASE(SUITE("binary kernels match per-value serialization"))
+{
+	std::vector<Binary> values = { Binary(true, 0x01, DNPTime(0xAABBCCDDEEFF)), Binary(false, 0x02, DNPTime(70000)), Binary(true, 0x81, DNPTime(0)) };
+	TestKernels<Group1Var2, Group2Var1, Group2Var2, Group2Var3>(values);
+}
+
+TEST_CASE(SUITE("double-bit binary kernels match per-value serialization"))
+{
+	std::vector<DoubleBitBinary> values =
+	{
+		DoubleBitBinary(DoubleBit::DETERMINED_ON, 0x01, DNPTime(0x010203040506)),
+		DoubleBitBinary(DoubleBit::INDETERMINATE, 0x01, DNPTime(70000)),
+		DoubleBitBinary(DoubleBit::DETERMINED_OFF, 0x04, DNPTime(1))
+	};
+	TestKernels<Group3Var2, Group4Var1, Group4Var2, Group4Var3>(values);
+}
+
+TEST_CASE(SUITE("binary output status kernels match per-value serialization"))
+{
+	std::vector<BinaryOutputStatus> values = { BinaryOutputStatus(true, 0x01, DNPTime(0x010203040506)), BinaryOutputStatus(false, 0x02, DNPTime(9)) };
+	TestKernels<Group10Var2, Group11Var1, Group11Var2>(values);
+}
+
+TEST_CASE(SUITE("counter kernels match per-value serialization"))
+{
+	std::vector<Counter> values = { Counter(0xFFFFFFFF, 0x01, DNPTime(0x010203040506)), Counter(70000, 0x20, DNPTime(7)), Counter(3, 0x01, DNPTime(0)) };
+	TestKernels<Group20Var1, Group20Var2, Group20Var5, Group20Var6>(values);
+	TestKernels<Group22Var1, Group22Var2, Group22Var5, Group22Var6>(values);
+}
+
+TEST_CASE(SUITE("frozen counter kernels match per-value serialization"))
+{
+	std::vector<FrozenCounter> values = { FrozenCounter(0xFFFFFFFF, 0x01, DNPTime(0x010203040506)), FrozenCounter(70000, 0x20, DNPTime(9)), FrozenCounter(3, 0x01, DNPTime(0)) };
+	TestKernels<Group21Var1, Group21Var2, Group21Var5, Group21Var6, Group21Var9, Group21Var10>(values);
+	TestKernels<Group23Var1, Group23Var2, Group23Var5, Group23Var6>(values);
+}
+
+TEST_CASE(SUITE("analog kernels match per-value serialization"))
+{
+	// includes values that overrange the 16-bit, 32-bit and single-precision variations
+	std::vector<Analog> values =
+	{
+		Analog(-1.5, 0x01, DNPTime(0x010203040506)),
+		Analog(100000.0, 0x03, DNPTime(7)),
+		Analog(-5.0e9, 0x01, DNPTime(8)),
+		Analog(3.0e40, 0x01, DNPTime(0))
+	};
+	TestKernels<Group30Var1, Group30Var2, Group30Var3, Group30Var4, Group30Var5, Group30Var6>(values);
+	TestKernels<Group32Var1, Group32Var2, Group32Var3, Group32Var4, Group32Var5, Group32Var6, Group32Var7, Group32Var8>(values);
+}
+
+TEST_CASE(SUITE("analog output status kernels match per-value serialization"))
+{
+	std::vector<AnalogOutputStatus> values =
+	{
+		AnalogOutputStatus(-2.25, 0x01, DNPTime(0x010203040506)),
+		AnalogOutputStatus(40000.0, 0x01, DNPTime(2)),
+		AnalogOutputStatus(1.0e300, 0x01, DNPTime(1))
+	};
+	TestKernels<Group40Var1, Group40Var2, Group40Var3, Group40Var4>(values);
+	TestKernels<Group42Var1, Group42Var2, Group42Var3, Group42Var4, Group42Var5, Group42Var6, Group42Var7, Group42Var8>(values);
+}
+
+TEST_CASE(SUITE("time and interval kernel matches per-value serialization"))
+{
+	std::vector<TimeAndInterval> values = { TimeAndInterval(DNPTime(0x010203040506), 5, IntervalUnits::Seconds), TimeAndInterval(DNPTime(3), 0xFFFFFFFF, IntervalUnits::Days) };
+	TestKernels<Group50Var4>(values);
+}
+
+TEST_CASE(SUITE("serializers without a kernel fall back to per-value writes"))
+{
+	std::vector<Analog> values = { Analog(1.0, 0x01), Analog(2.0, 0x01), Analog(3.0, 0x01) };
+	DNP3Serializer<Analog> serializer(Group30Var5::ID(), Group30Var5::Size(), &Group30Var5::ReadTarget, &Group30Var5::WriteTarget);
+
+	StaticBuffer<2048> buffer;
+	auto dest = buffer.GetWSlice(2 * Group30Var5::Size() + 1);
+	auto start = dest;
+	REQUIRE(serializer.WriteMany(StridedView<Analog>(values.data()), nullptr, 3, dest) == 2);
+	REQUIRE(ToHex(start.ToRSlice().Take(2 * Group30Var5::Size())) == WriteEach<Analog>(&Group30Var5::WriteTarget, Group30Var5::Size(), values, false, 2 * Group30Var5::Size() + 1));
+}
+
+class AnalogEvents : public IEventCollection<Analog>
+{
+
+public:
+
+	explicit AnalogEvents(uint16_t count) : count(count), num(0)
+	{}
+
+	virtual uint16_t WriteSome(IEventWriter<Analog>& handler) override
+	{
+		while (num < count && handler.Write(Analog(num, 0x01, DNPTime(1000 + num)), num * 2))
+		{
+			++num;
+		}
+		return num;
+	}
+
+private:
+
+	uint16_t count;
+	uint16_t num;
+};
+
+std::string WriteAnalogEventsOneByOne(uint16_t count, uint32_t size, bool cto)
+{
+	auto response = APDUHelpers::Response(size);
+	auto writer = response.GetWriter();
+	Group51Var1 time;
+	time.time = DNPTime(1000);
+
+	// the count is written when the iterator goes out of scope
+	{
+		auto iter = cto ?
+		            writer.IterateOverCountWithPrefixAndCTO<UInt16, Analog, Group51Var1>(QualifierCode::UINT16_CNT_UINT16_INDEX, Group32Var3::Inst(), time) :
+		            writer.IterateOverCountWithPrefix<UInt16, Analog>(QualifierCode::UINT16_CNT_UINT16_INDEX, Group32Var1::Inst());
+
+		for (uint16_t i = 0; i < count; ++i)
+		{
+			if (!iter.Write(Analog(i, 0x01, DNPTime(cto ? i : 1000 + i)), i * 2)) break;
+		}
+	}
+
+	return ToHex(response.ToRSlice());
+}
+
+std::string WriteAnalogEventsInBatches(uint16_t count, uint32_t size, bool cto, uint16_t expected)
+{
+	auto response = APDUHelpers::Response(size);
+	auto writer = response.GetWriter();
+
+	AnalogEvents events(count);
+	if (cto)
+	{
+		REQUIRE(EventWriters::WriteWithCTO(DNPTime(1000), writer, events, Group32Var3::Inst()) == expected);
+	}
+	else
+	{
+		REQUIRE(EventWriters::Write(writer, events, Group32Var1::Inst()) == expected);
+	}
+
+	return ToHex(response.ToRSlice());
+}
+
+TEST_CASE(SUITE("events are written in batches with the same encoding"))
+{
+	// more than one batch, with a partial final batch
+	const std::string expected = WriteAnalogEventsOneByOne(75, 2048, false);
+	REQUIRE(WriteAnalogEventsInBatches(75, 2048, false, 75) == expected);
+}
+
+TEST_CASE(SUITE("events stop being accepted when the fragment is full"))
+{
+	// header + 4 byte count/index prefix leaves room for 40 events of 7 bytes
+	const uint32_t size = 4 + 3 + 2 + 40 * 7;
+	const std::string expected = WriteAnalogEventsOneByOne(100, size, false);
+	REQUIRE(WriteAnalogEventsInBatches(100, size, false, 40) == expected);
+}
+
+TEST_CASE(SUITE("events relative to a common time are written in batches"))
+{
+	const std::string expected = WriteAnalogEventsOneByOne(50, 2048, true);
+	REQUIRE(WriteAnalogEventsInBatches(50, 2048, true, 50) == expected);
+}
+
+TEST_CASE(SUITE("kernel throughput"), "[.benchmark]")
+{
+	const uint32_t NUM_VALUES = 1000;
+	const int NUM_ITERATIONS = 20000;
+
+	std::vector<Analog> values;
+	std::vector<uint16_t> indices;
+	for (uint32_t i = 0; i < NUM_VALUES; ++i)
+	{
+		values.push_back(Analog(i * 1.5, 0x01, DNPTime(i)));
+		indices.push_back(static_cast<uint16_t>(i));
+	}
+
+	std::vector<uint8_t> buffer(NUM_VALUES * (Group32Var7::Size() + 2));
+
+	auto measure = [&](const char* name, const DNP3Serializer<Analog>& serializer, bool withIndices, bool bulk)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		for (int n = 0; n < NUM_ITERATIONS; ++n)
+		{
+			WSlice dest(buffer.data(), static_cast<uint32_t>(buffer.size()));
+			if (bulk)
+			{
+				serializer.WriteMany(StridedView<Analog>(values.data()), withIndices ? indices.data() : nullptr, NUM_VALUES, dest);
+			}
+			else
+			{
+				for (uint32_t i = 0; i < NUM_VALUES; ++i)
+				{
+					if (withIndices) UInt16::WriteBuffer(dest, indices[i]);
+					serializer.Write(values[i], dest);
+				}
+			}
+		}
+		const auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() - start).count();
+		std::cout << name << (bulk ? " (bulk): " : " (per-value): ")
+		          << static_cast<uint64_t>((NUM_VALUES * static_cast<double>(NUM_ITERATIONS)) / elapsed) << " values / sec" << std::endl;
+	};
+
+	for (bool bulk : { false, true })
+	{
+		measure("g30v1 static", Group30Var1::Inst(), false, bulk);
+		measure("g30v5 static", Group30Var5::Inst(), false, bulk);
+		measure("g32v7 event", Group32Var7::Inst(), true, bulk);
+	}
+}
@@ -24,8 +24,12 @@
 #include "mocks/DatabaseTestObject.h"
 
 #include <opendnp3/app/QualityMasks.h>
+#include <opendnp3/app/APDUResponse.h>
 
+#include <chrono>
+#include <iostream>
 #include <limits>
+#include <vector>
 
 using namespace std;
 using namespace openpal;
@@ -180,3 +184,307 @@ TEST_CASE(SUITE("CounterLastReportedChange"))
 }
 
 
+
+TEST_CASE(SUITE("BinaryChatterFilterSetsFlagAndSuppressesEvents"))
+{
+	DatabaseTestObject t(DatabaseSizes::BinaryOnly(1));
+	auto view = t.db.GetConfigView();
+	ChatterFilterConfig chatter;
+	chatter.maxEvents = 2;
+	chatter.window = TimeDuration::Seconds(1);
+	chatter.quietPeriod = TimeDuration::Seconds(5);
+	t.db.ConfigureChatterFilter(EventType::Binary, 0, chatter);
+
+	TestBufferForEvent(true, Binary(true), t, t.buffer.binaryEvents);
+	TestBufferForEvent(true, Binary(false), t, t.buffer.binaryEvents);
+
+	// the third event in the window engages the filter and is reported with the chatter flag
+	t.db.Update(Binary(true), 0);
+	REQUIRE(t.buffer.binaryEvents.size() == 1);
+	REQUIRE(t.buffer.binaryEvents.front().value.flags.value == 0xA1); // STATE | CHATTER_FILTER | ONLINE
+	t.buffer.binaryEvents.pop_front();
+	REQUIRE(view.binaries[0].value.flags.value == 0xA1);
+
+	// further changes are suppressed, but the static value follows them
+	t.db.Update(Binary(false), 0);
+	t.db.Update(Binary(true), 0);
+	t.db.Update(Binary(false), 0);
+	REQUIRE(t.buffer.binaryEvents.empty());
+	REQUIRE(view.binaries[0].value.flags.value == 0x21); // CHATTER_FILTER | ONLINE
+
+	// updates without a change are not counted
+	t.db.Update(Binary(false), 0);
+
+	auto stats = t.db.GetChatterStatistics(10);
+	REQUIRE(stats.NumSuppressed(EventType::Binary) == 3);
+	REQUIRE(stats.NumSuppressed(EventType::Analog) == 0);
+	REQUIRE(stats.numFiltered == 1);
+	REQUIRE(t.db.GetChatterResumeTime().milliseconds == 5000);
+}
+
+TEST_CASE(SUITE("ChatterFilterResumesAfterQuietPeriod"))
+{
+	DatabaseTestObject t(DatabaseSizes::BinaryOnly(1));
+	auto view = t.db.GetConfigView();
+	ChatterFilterConfig chatter;
+	chatter.maxEvents = 1;
+	chatter.quietPeriod = TimeDuration::Seconds(5);
+	t.db.ConfigureChatterFilter(EventType::Binary, 0, chatter);
+
+	t.db.Update(Binary(true), 0);
+	t.db.Update(Binary(false), 0);
+	REQUIRE(t.buffer.binaryEvents.size() == 2);
+	t.buffer.binaryEvents.clear();
+
+	t.exe.AddTime(TimeDuration::Seconds(4));
+	t.db.Update(Binary(true), 0);
+	REQUIRE(t.buffer.binaryEvents.empty());
+
+	// the change at 4 seconds restarted the quiet period
+	t.exe.AddTime(TimeDuration::Seconds(1));
+	t.db.ResumeChatterFilters();
+	REQUIRE(t.buffer.binaryEvents.empty());
+	REQUIRE(t.db.GetChatterResumeTime().milliseconds == 9000);
+
+	t.exe.AddTime(TimeDuration::Seconds(4));
+	t.db.ResumeChatterFilters();
+	REQUIRE(t.buffer.binaryEvents.size() == 1);
+	REQUIRE(t.buffer.binaryEvents.front().value.flags.value == 0x81); // STATE | ONLINE
+	REQUIRE(view.binaries[0].value.flags.value == 0x81);
+	REQUIRE(t.db.GetChatterResumeTime().IsMax());
+	REQUIRE(t.db.GetChatterStatistics(0).numFiltered == 0);
+}
+
+TEST_CASE(SUITE("ChatterFilterCountRestartsEachWindow"))
+{
+	DatabaseTestObject t(DatabaseSizes::BinaryOnly(1));
+	ChatterFilterConfig chatter;
+	chatter.maxEvents = 2;
+	chatter.window = TimeDuration::Seconds(1);
+	t.db.ConfigureChatterFilter(EventType::Binary, 0, chatter);
+
+	TestBufferForEvent(true, Binary(true), t, t.buffer.binaryEvents);
+	TestBufferForEvent(true, Binary(false), t, t.buffer.binaryEvents);
+	t.exe.AddTime(TimeDuration::Seconds(1));
+	TestBufferForEvent(true, Binary(true), t, t.buffer.binaryEvents);
+	TestBufferForEvent(true, Binary(false), t, t.buffer.binaryEvents);
+
+	REQUIRE(t.db.GetChatterStatistics(0).numFiltered == 0);
+}
+
+TEST_CASE(SUITE("AnalogChatterFilterSuppressesWithoutFlag"))
+{
+	DatabaseTestObject t(DatabaseSizes::AnalogOnly(1));
+	auto view = t.db.GetConfigView();
+	ChatterFilterConfig chatter;
+	chatter.maxEvents = 1;
+	t.db.ConfigureChatterFilter(EventType::Analog, 0, chatter);
+
+	TestBufferForEvent(true, Analog(1, ToUnderlying(AnalogQuality::ONLINE)), t, t.buffer.analogEvents);
+	TestBufferForEvent(false, Analog(2, ToUnderlying(AnalogQuality::ONLINE)), t, t.buffer.analogEvents);
+	TestBufferForEvent(false, Analog(3, ToUnderlying(AnalogQuality::ONLINE)), t, t.buffer.analogEvents);
+
+	REQUIRE(view.analogs[0].value.flags.value == ToUnderlying(AnalogQuality::ONLINE));
+	REQUIRE(t.db.GetChatterStatistics(0).NumSuppressed(EventType::Analog) == 2);
+}
+
+TEST_CASE(SUITE("TopChatteringPoints"))
+{
+	DatabaseTestObject t(DatabaseSizes::AnalogOnly(3));
+	ChatterFilterConfig chatter;
+	chatter.maxEvents = 1;
+	for (uint16_t i = 0; i < 3; ++i)
+	{
+		t.db.ConfigureChatterFilter(EventType::Analog, i, chatter);
+	}
+
+	for (int i = 0; i < 4; ++i)
+	{
+		t.db.Update(Analog(i), 2);
+	}
+
+	for (int i = 0; i < 2; ++i)
+	{
+		t.db.Update(Analog(i), 0);
+	}
+
+	auto stats = t.db.GetChatterStatistics(1);
+	REQUIRE(stats.topPoints.size() == 1);
+	REQUIRE(stats.topPoints[0].type == EventType::Analog);
+	REQUIRE(stats.topPoints[0].index == 2);
+	REQUIRE(stats.topPoints[0].numSuppressed == 3);
+	REQUIRE(stats.topPoints[0].filtered);
+
+	REQUIRE(t.db.GetChatterStatistics(10).topPoints.size() == 2);
+}
+
+TEST_CASE(SUITE("ChatterFilterOnlyAppliesToConfiguredPoints"))
+{
+	DatabaseTestObject t(DatabaseSizes::AnalogOnly(2));
+	ChatterFilterConfig chatter;
+	chatter.maxEvents = 1;
+	REQUIRE(t.db.ConfigureChatterFilter(EventType::Analog, 1, chatter));
+	REQUIRE_FALSE(t.db.ConfigureChatterFilter(EventType::Analog, 2, chatter));
+	REQUIRE_FALSE(t.db.ConfigureChatterFilter(EventType::Binary, 0, chatter));
+
+	for (int i = 1; i <= 3; ++i)
+	{
+		TestBufferForEvent(true, Analog(i), t, t.buffer.analogEvents);
+	}
+
+	REQUIRE(t.db.GetChatterStatistics(10).topPoints.empty());
+}
+
+namespace
+{
+typedef std::vector<std::vector<uint8_t>> fragments_t;
+
+void ConfigureBinaries(DatabaseTestObject& t, uint16_t offset)
+{
+	auto view = t.db.GetConfigView();
+	for (uint16_t i = 0; i < view.binaries.Size(); ++i)
+	{
+		view.binaries[i].config.clazz = PointClass::Class0;
+		view.binaries[i].config.svariation = StaticBinaryVariation::Group1Var1;
+		view.binaries[i].config.vIndex = i + offset;
+	}
+}
+
+// load all of the selected static values into fragments no larger than size
+fragments_t LoadFragments(Database& db, uint32_t size)
+{
+	fragments_t fragments;
+	bool complete = false;
+
+	while (!complete)
+	{
+		std::vector<uint8_t> buffer(size);
+		APDUResponse response(WSlice(buffer.data(), size));
+		auto writer = response.GetWriter();
+		complete = db.GetResponseLoader().Load(writer);
+		auto slice = response.ToRSlice();
+		fragments.push_back(std::vector<uint8_t>(slice + 4, slice + slice.Size()));
+	}
+
+	return fragments;
+}
+
+// decode g1v1 and g1v2 start-stop headers into the state of each index, -1 if absent, and the number of headers
+std::vector<int> DecodeBinaries(const fragments_t& fragments, uint32_t size, uint32_t& numHeaders)
+{
+	std::vector<int> states(size, -1);
+	numHeaders = 0;
+
+	for (auto& fragment : fragments)
+	{
+		size_t pos = 0;
+		while (pos < fragment.size())
+		{
+			REQUIRE(fragment[pos] == 1);
+			const auto variation = fragment[pos + 1];
+			const bool wide = fragment[pos + 2] == 0x01;
+			pos += 3;
+
+			const uint32_t start = wide ? (fragment[pos] | (fragment[pos + 1] << 8)) : fragment[pos];
+			const uint32_t stop = wide ? (fragment[pos + 2] | (fragment[pos + 3] << 8)) : fragment[pos + 1];
+			pos += wide ? 4 : 2;
+
+			for (uint32_t i = start; i <= stop; ++i)
+			{
+				const auto offset = i - start;
+				REQUIRE(states[i] == -1);
+				states[i] = (variation == 1) ? ((fragment[pos + offset / 8] >> (offset % 8)) & 1) : ((fragment[pos + offset] & 0x80) ? 1 : 0);
+			}
+
+			pos += (variation == 1) ? ((stop - start) / 8 + 1) : (stop - start + 1);
+			++numHeaders;
+		}
+	}
+
+	return states;
+}
+
+bool BinaryState(uint16_t index)
+{
+	return (index % 7) < 3;
+}
+}
+
+TEST_CASE(SUITE("PackedBinariesAreWrittenAroundPromotedValues"))
+{
+	DatabaseTestObject t(DatabaseSizes::BinaryOnly(1000));
+	ConfigureBinaries(t, 0);
+
+	for (uint16_t i = 0; i < 1000; ++i)
+	{
+		t.db.Update(Binary(BinaryState(i), 0x01), i);
+	}
+	t.db.Update(Binary(BinaryState(500), 0x03), 500);
+
+	t.db.GetStaticSelector().SelectAll(GroupVariation::Group1Var0);
+	auto fragments = LoadFragments(t.db, 2048);
+	REQUIRE(fragments.size() == 1);
+
+	uint32_t numHeaders = 0;
+	auto states = DecodeBinaries(fragments, 1000, numHeaders);
+	REQUIRE(numHeaders == 3);
+	for (uint16_t i = 0; i < 1000; ++i)
+	{
+		REQUIRE(states[i] == (BinaryState(i) ? 1 : 0));
+	}
+}
+
+TEST_CASE(SUITE("PackedBinariesContinueInTheNextFragment"))
+{
+	DatabaseTestObject t(DatabaseSizes::BinaryOnly(1000));
+	ConfigureBinaries(t, 0);
+
+	for (uint16_t i = 0; i < 1000; ++i)
+	{
+		t.db.Update(Binary(BinaryState(i), 0x01), i);
+	}
+
+	t.db.GetStaticSelector().SelectAll(GroupVariation::Group1Var0);
+	// 19 bytes of objects in each fragment
+	auto fragments = LoadFragments(t.db, 30);
+	REQUIRE(fragments.size() == 7);
+
+	uint32_t numHeaders = 0;
+	auto states = DecodeBinaries(fragments, 1000, numHeaders);
+	REQUIRE(numHeaders == 7);
+	for (uint16_t i = 0; i < 1000; ++i)
+	{
+		REQUIRE(states[i] == (BinaryState(i) ? 1 : 0));
+	}
+}
+
+TEST_CASE(SUITE("integrity poll of packed and per-point binaries"), "[.benchmark]")
+{
+	const uint16_t NUM_BINARIES = 50000;
+	const int NUM_POLLS = 200;
+
+	// values that are offset from their index are written one point at a time
+	for (uint16_t offset = 0; offset < 2; ++offset)
+	{
+		DatabaseTestObject t(DatabaseSizes::BinaryOnly(NUM_BINARIES), IndexMode::Discontiguous);
+		ConfigureBinaries(t, offset);
+
+		for (uint16_t i = 0; i < NUM_BINARIES; ++i)
+		{
+			t.db.Update(Binary(BinaryState(i), 0x01), i + offset);
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		for (int i = 0; i < NUM_POLLS; ++i)
+		{
+			t.db.GetStaticSelector().SelectAll(GroupVariation::Group1Var0);
+			LoadFragments(t.db, 2048);
+		}
+
+		const auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() - start).count();
+
+		std::cout << (offset ? "per-point: " : "packed: ") << NUM_POLLS << " polls of " << NUM_BINARIES << " binaries in "
+		          << static_cast<uint64_t>(elapsed * 1000) << " ms (" << static_cast<uint64_t>(NUM_POLLS * NUM_BINARIES / elapsed) << " points / sec)" << std::endl;
+	}
+}
@@ -0,0 +1,230 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <opendnp3/app/GroupVariationRecord.h>
+#include <opendnp3/app/parsing/APDUParser.h>
+#include <opendnp3/gen/Attributes.h>
+#include <opendnp3/gen/GroupVariationTable.h>
+#include <opendnp3/objects/Group1.h>
+#include <opendnp3/objects/Group2.h>
+#include <opendnp3/objects/Group12.h>
+#include <opendnp3/objects/Group21.h>
+#include <opendnp3/objects/Group32.h>
+#include <opendnp3/objects/Group43.h>
+#include <opendnp3/objects/Group50.h>
+#include <opendnp3/objects/Group52.h>
+#include <opendnp3/objects/Group120.h>
+#include <opendnp3/objects/Group122.h>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <set>
+#include <vector>
+
+using namespace openpal;
+using namespace opendnp3;
+
+#define SUITE(name) "GroupVariationTableTestSuite - " name
+
+std::vector<GroupVariation> KnownGroupVariations()
+{
+	std::vector<GroupVariation> known;
+	for (uint32_t i = 0; i <= 0xFFFF; ++i)
+	{
+		const auto gv = GroupVariationFromType(static_cast<uint16_t>(i));
+		if (gv != GroupVariation::UNKNOWN)
+		{
+			known.push_back(gv);
+		}
+	}
+	return known;
+}
+
+TEST_CASE(SUITE("every value maps back to its type"))
+{
+	for (uint32_t i = 0; i <= 0xFFFF; ++i)
+	{
+		const auto gv = GroupVariationFromType(static_cast<uint16_t>(i));
+		if (gv != GroupVariation::UNKNOWN)
+		{
+			REQUIRE(GroupVariationToType(gv) == i);
+		}
+	}
+
+	REQUIRE(KnownGroupVariations().size() == 133);
+}
+
+TEST_CASE(SUITE("gaps and unknown groups map to unknown"))
+{
+	REQUIRE(GroupVariationFromType(0x0000) == GroupVariation::UNKNOWN);
+	REQUIRE(GroupVariationFromType(0x0103) == GroupVariation::UNKNOWN);
+	REQUIRE(GroupVariationFromType(0x0D00) == GroupVariation::UNKNOWN);
+	REQUIRE(GroupVariationFromType(0x1403) == GroupVariation::UNKNOWN);
+	REQUIRE(GroupVariationFromType(0xFFFF) == GroupVariation::UNKNOWN);
+	REQUIRE(std::strcmp(GroupVariationToString(GroupVariation::UNKNOWN), "UNKNOWN") == 0);
+}
+
+TEST_CASE(SUITE("entries carry names and attributes"))
+{
+	REQUIRE(std::strcmp(GroupVariationToString(GroupVariation::Group1Var2), "Binary Input - With Flags") == 0);
+
+	REQUIRE(HasFlags(GroupVariation::Group30Var1));
+	REQUIRE_FALSE(HasFlags(GroupVariation::Group30Var3));
+	REQUIRE(HasAbsoluteTime(GroupVariation::Group32Var7));
+	REQUIRE(HasRelativeTime(GroupVariation::Group2Var3));
+	REQUIRE(IsEvent(GroupVariation::Group22Var1));
+	REQUIRE_FALSE(IsEvent(GroupVariation::Group22Var0));
+	REQUIRE_FALSE(IsEvent(GroupVariation::Group20Var1));
+}
+
+template <class GV>
+uint32_t TableSize()
+{
+	return GroupVariationTable::Lookup(GV::ID().group, GV::ID().variation).size;
+}
+
+// parses a single header of the object using a qualifier from each family
+ParseResult ParseWithQualifier(GroupVariation gv, uint8_t qualifierMask)
+{
+	const auto type = GroupVariationToType(gv);
+	std::vector<uint8_t> apdu = { static_cast<uint8_t>(type >> 8), static_cast<uint8_t>(type & 0xFF) };
+
+	switch (qualifierMask)
+	{
+	case(GroupVariationTable::RANGE):
+		apdu.insert(apdu.end(), { QualifierCodeToType(QualifierCode::UINT8_START_STOP), 0x00, 0x00 });
+		break;
+	case(GroupVariationTable::COUNT):
+		apdu.insert(apdu.end(), { QualifierCodeToType(QualifierCode::UINT8_CNT), 0x01 });
+		break;
+	case(GroupVariationTable::COUNT_AND_PREFIX):
+		apdu.insert(apdu.end(), { QualifierCodeToType(QualifierCode::UINT8_CNT_UINT8_INDEX), 0x01 });
+		break;
+	default:
+		apdu.insert(apdu.end(), { QualifierCodeToType(QualifierCode::UINT16_FREE_FORMAT), 0x01, 0x40, 0x00 });
+		break;
+	}
+
+	apdu.resize(apdu.size() + 0x40, 0x00);
+
+	return APDUParser::ParseAndLogAll(RSlice(apdu.data(), static_cast<uint32_t>(apdu.size())), nullptr);
+}
+
+TEST_CASE(SUITE("fixed size column matches the object sizes"))
+{
+	REQUIRE(TableSize<Group1Var2>() == Group1Var2::Size());
+	REQUIRE(TableSize<Group2Var2>() == Group2Var2::Size());
+	REQUIRE(TableSize<Group12Var1>() == Group12Var1::Size());
+	REQUIRE(TableSize<Group21Var10>() == Group21Var10::Size());
+	REQUIRE(TableSize<Group32Var8>() == Group32Var8::Size());
+	REQUIRE(TableSize<Group43Var7>() == Group43Var7::Size());
+	REQUIRE(TableSize<Group50Var4>() == Group50Var4::Size());
+	REQUIRE(TableSize<Group52Var2>() == Group52Var2::Size());
+	REQUIRE(TableSize<Group120Var4>() == Group120Var4::Size());
+	REQUIRE(TableSize<Group122Var2>() == Group122Var2::Size());
+
+	// bitfields and variable sized objects have no fixed size
+	REQUIRE(GroupVariationTable::Lookup(GroupVariation::Group1Var1).size == 0);
+	REQUIRE(GroupVariationTable::Lookup(GroupVariation::Group110Var0).size == 0);
+	REQUIRE(GroupVariationTable::Lookup(GroupVariation::Group120Var1).size == 0);
+}
+
+TEST_CASE(SUITE("qualifier column matches what the parser accepts"))
+{
+	const uint8_t families[] =
+	{
+		GroupVariationTable::RANGE,
+		GroupVariationTable::COUNT,
+		GroupVariationTable::COUNT_AND_PREFIX,
+		GroupVariationTable::FREE_FORMAT
+	};
+
+	for (auto gv : KnownGroupVariations())
+	{
+		for (auto family : families)
+		{
+			const bool supported = (GroupVariationTable::Lookup(gv).qualifiers & family) != 0;
+			const auto result = ParseWithQualifier(gv, family);
+
+			INFO(GroupVariationToString(gv) << " with qualifier family " << static_cast<int>(family));
+			REQUIRE(supported == (result != ParseResult::INVALID_OBJECT_QUALIFIER));
+		}
+	}
+}
+
+TEST_CASE(SUITE("every known object has its own handler slot"))
+{
+	std::set<uint8_t> slots;
+	for (auto gv : KnownGroupVariations())
+	{
+		const auto slot = GroupVariationTable::Lookup(gv).handler;
+		REQUIRE(slot > 0);
+		REQUIRE(slot < GroupVariationTable::NUM_HANDLERS);
+		slots.insert(slot);
+	}
+
+	REQUIRE(slots.size() == KnownGroupVariations().size());
+	REQUIRE(GroupVariationTable::Lookup(GroupVariation::UNKNOWN).handler == 0);
+}
+
+TEST_CASE(SUITE("octet string groups are recognized for any variation"))
+{
+	REQUIRE(GroupVariationRecord::GetRecord(110, 7).enumeration == GroupVariation::Group110Var0);
+	REQUIRE(GroupVariationRecord::GetRecord(111, 255).enumeration == GroupVariation::Group111Var0);
+}
+
+TEST_CASE(SUITE("parse headers of every known object"), "[.benchmark]")
+{
+	const int NUM_ITERATIONS = 20000;
+
+	// an all objects header for every known group/variation
+	std::vector<uint8_t> headers;
+	const auto known = KnownGroupVariations();
+	for (auto gv : known)
+	{
+		const auto type = GroupVariationToType(gv);
+		headers.push_back(static_cast<uint8_t>(type >> 8));
+		headers.push_back(static_cast<uint8_t>(type & 0xFF));
+		headers.push_back(QualifierCodeToType(QualifierCode::ALL_OBJECTS));
+	}
+
+	const RSlice buffer(headers.data(), static_cast<uint32_t>(headers.size()));
+
+	const auto start = std::chrono::steady_clock::now();
+
+	int numFailures = 0;
+	for (int i = 0; i < NUM_ITERATIONS; ++i)
+	{
+		if (APDUParser::ParseAndLogAll(buffer, nullptr) != ParseResult::OK)
+		{
+			++numFailures;
+		}
+	}
+
+	const auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << NUM_ITERATIONS << " x " << known.size() << " headers in " << static_cast<uint64_t>(elapsed * 1000) << " ms ("
+	          << static_cast<uint64_t>(NUM_ITERATIONS * known.size() / elapsed) << " headers / sec)" << std::endl;
+
+	REQUIRE(numFailures == 0);
+}
@@ -0,0 +1,123 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include "opendnp3/LatencyHistogram.h"
+
+using namespace opendnp3;
+
+#define SUITE(name) "LatencyHistogramTestSuite - " name
+
+TEST_CASE(SUITE("empty histogram reports zeros"))
+{
+	LatencyHistogram histogram;
+
+	REQUIRE(histogram.Count() == 0);
+	REQUIRE(histogram.Min() == 0);
+	REQUIRE(histogram.Max() == 0);
+	REQUIRE(histogram.Mean() == 0.0);
+	REQUIRE(histogram.ValueAtPercentile(99.0) == 0);
+}
+
+TEST_CASE(SUITE("small values are counted exactly"))
+{
+	LatencyHistogram histogram;
+
+	for (int64_t i = 1; i <= 10; ++i)
+	{
+		histogram.Record(i);
+	}
+
+	REQUIRE(histogram.Count() == 10);
+	REQUIRE(histogram.Min() == 1);
+	REQUIRE(histogram.Max() == 10);
+	REQUIRE(histogram.Mean() == Approx(5.5));
+	REQUIRE(histogram.ValueAtPercentile(0.0) == 1);
+	REQUIRE(histogram.ValueAtPercentile(50.0) == 5);
+	REQUIRE(histogram.ValueAtPercentile(90.0) == 9);
+	REQUIRE(histogram.ValueAtPercentile(100.0) == 10);
+}
+
+TEST_CASE(SUITE("negative values are recorded as zero"))
+{
+	LatencyHistogram histogram;
+	histogram.Record(-5);
+
+	REQUIRE(histogram.Count() == 1);
+	REQUIRE(histogram.Max() == 0);
+	REQUIRE(histogram.CountAt(0) == 1);
+}
+
+TEST_CASE(SUITE("bucket indices are contiguous and bound the relative error"))
+{
+	uint32_t last = 0;
+	for (uint64_t value = 0; value < 100000; ++value)
+	{
+		const auto index = LatencyHistogram::GetIndex(value);
+		REQUIRE(index < LatencyHistogram::NUM_BUCKETS);
+		REQUIRE((index == last || index == last + 1));
+		last = index;
+
+		const auto highest = LatencyHistogram::HighestEquivalentValue(index);
+		REQUIRE(highest >= value);
+		REQUIRE((highest - value) * LatencyHistogram::SUB_BUCKET_COUNT <= value);
+	}
+}
+
+TEST_CASE(SUITE("large values are clamped to the last bucket"))
+{
+	LatencyHistogram histogram;
+	histogram.Record(INT64_MAX);
+
+	REQUIRE(LatencyHistogram::GetIndex(UINT64_MAX) == LatencyHistogram::NUM_BUCKETS - 1);
+	REQUIRE(histogram.CountAt(LatencyHistogram::NUM_BUCKETS - 1) == 1);
+	REQUIRE(histogram.Max() == static_cast<uint64_t>(INT64_MAX));
+}
+
+TEST_CASE(SUITE("tail percentiles are within the bucket precision"))
+{
+	LatencyHistogram histogram;
+
+	for (int64_t i = 1; i <= 10000; ++i)
+	{
+		histogram.Record(i);
+	}
+
+	const auto p99 = histogram.ValueAtPercentile(99.0);
+	const auto p999 = histogram.ValueAtPercentile(99.9);
+
+	REQUIRE(p99 >= 9900);
+	REQUIRE(p99 <= 9900 + 9900 / LatencyHistogram::SUB_BUCKET_COUNT);
+	REQUIRE(p999 >= 9990);
+	REQUIRE(p999 <= 10000);
+}
+
+TEST_CASE(SUITE("reset discards all values"))
+{
+	LatencyHistogram histogram;
+	histogram.Record(7);
+	histogram.Record(700);
+	histogram.Reset();
+
+	REQUIRE(histogram.Count() == 0);
+	REQUIRE(histogram.CountAt(7) == 0);
+	REQUIRE(histogram.ValueAtPercentile(50.0) == 0);
+}
@@ -707,4 +707,23 @@ TEST_CASE(SUITE("Warm restart fails with empty response"))
 	REQUIRE(queue.responses.size() == 1);
 	REQUIRE(queue.responses[0].summary == TaskCompletion::SUCCESS);
 	REQUIRE(queue.responses[0].restartTime.GetMilliseconds() == (0xBBBB * 1000));
-}
\ No newline at end of file
+}
+
+TEST_CASE(SUITE("records request to response latency"))
+{
+	MasterParams params;
+	params.disableUnsolOnStartup = false;
+	params.unsolClassMask = ClassField::None();
+	MasterTestFixture t(params);
+	t.context->OnLowerLayerUp();
+
+	t.exe->RunMany();
+
+	REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+	t.context->OnTxReady();
+	t.exe->AddTime(TimeDuration::Milliseconds(50));
+	t.SendToMaster(hex::EmptyResponse(0));
+
+	REQUIRE(t.context->latency.requestToResponse.Count() == 1);
+	REQUIRE(t.context->latency.requestToResponse.Max() == 50);
+}
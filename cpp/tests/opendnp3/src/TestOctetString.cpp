@@ -0,0 +1,139 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include "mocks/DatabaseTestObject.h"
+
+#include <opendnp3/app/OctetString.h>
+#include <opendnp3/app/OctetArena.h>
+
+#include <string>
+
+using namespace openpal;
+using namespace opendnp3;
+
+#define SUITE(name) "OctetStringTestSuite - " name
+
+namespace
+{
+const uint8_t* Address(const OctetString& value)
+{
+	return value.ToRSlice();
+}
+
+std::string ToString(const OctetString& value)
+{
+	auto slice = value.ToRSlice();
+	return std::string(reinterpret_cast<const char*>(static_cast<const uint8_t*>(slice)), slice.Size());
+}
+}
+
+TEST_CASE(SUITE("default value is a single zero byte"))
+{
+	OctetString value;
+	REQUIRE(value.Size() == 1);
+	REQUIRE(value.ToRSlice()[0] == 0x00);
+}
+
+TEST_CASE(SUITE("is much smaller than the maximum size"))
+{
+	REQUIRE(sizeof(OctetString) <= 24);
+}
+
+TEST_CASE(SUITE("short values are stored inline"))
+{
+	const auto before = OctetArena::Instance().GetStatistics().numBlocksInUse;
+
+	OctetString value("hello");
+	OctetString copy(value);
+
+	REQUIRE(ToString(copy) == "hello");
+	REQUIRE(Address(copy) != Address(value));
+	REQUIRE(OctetArena::Instance().GetStatistics().numBlocksInUse == before);
+}
+
+TEST_CASE(SUITE("copies of long values share a block"))
+{
+	const auto before = OctetArena::Instance().GetStatistics().numBlocksInUse;
+	const std::string text(100, 'x');
+
+	{
+		OctetString value(text.c_str());
+		OctetString copy(value);
+		OctetString assigned;
+		assigned = copy;
+
+		REQUIRE(ToString(assigned) == text);
+		REQUIRE(Address(copy) == Address(value));
+		REQUIRE(Address(assigned) == Address(value));
+		REQUIRE(OctetArena::Instance().GetStatistics().numBlocksInUse == (before + 1));
+
+		// setting a new value only affects this copy
+		assigned.Set("short");
+		REQUIRE(ToString(assigned) == "short");
+		REQUIRE(ToString(value) == text);
+	}
+
+	REQUIRE(OctetArena::Instance().GetStatistics().numBlocksInUse == before);
+}
+
+TEST_CASE(SUITE("move leaves the default value"))
+{
+	const std::string text(50, 'y');
+	OctetString value(text.c_str());
+	const auto address = Address(value);
+
+	OctetString moved(std::move(value));
+	REQUIRE(Address(moved) == address);
+	REQUIRE(value.Size() == 1);
+}
+
+TEST_CASE(SUITE("can be set from its own contents"))
+{
+	const std::string text(200, 'z');
+	OctetString value(text.c_str());
+
+	REQUIRE(value.Set(value.ToRSlice().Skip(190)));
+	REQUIRE(ToString(value) == std::string(10, 'z'));
+}
+
+TEST_CASE(SUITE("oversized values are truncated"))
+{
+	const std::string text(300, 'a');
+	OctetString value;
+	REQUIRE_FALSE(value.Set(RSlice(reinterpret_cast<const uint8_t*>(text.data()), static_cast<uint32_t>(text.size()))));
+	REQUIRE(value.Size() == 255);
+	REQUIRE(ToString(value) == std::string(255, 'a'));
+}
+
+TEST_CASE(SUITE("database value and event share storage"))
+{
+	DatabaseTestObject t(DatabaseSizes::OctetStringOnly(1));
+	auto view = t.db.GetConfigView();
+	view.octetStrings[0].config.clazz = PointClass::Class1;
+
+	const std::string text(64, 'b');
+	t.db.Update(OctetString(text.c_str()), 0);
+
+	REQUIRE(t.buffer.octetStringEvents.size() == 1);
+	REQUIRE(Address(t.buffer.octetStringEvents.front().value) == Address(view.octetStrings[0].value));
+	REQUIRE(Address(view.octetStrings[0].event.lastEvent) == Address(view.octetStrings[0].value));
+}
@@ -0,0 +1,189 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include "mocks/OutstationTestObject.h"
+
+#include <dnp3mocks/APDUHexBuilders.h>
+
+using namespace std;
+using namespace opendnp3;
+using namespace openpal;
+
+#define SUITE(name) "OutstationCompactEncodingTestSuite - " name
+
+OutstationConfig CompactConfig()
+{
+	OutstationConfig config;
+	config.params.compactEncoding = true;
+	config.eventBufferConfig = EventBufferConfig::AllTypes(10);
+	return config;
+}
+
+TEST_CASE(SUITE("analogs with nominal flags and 16-bit values use g30v4"))
+{
+	OutstationTestObject t(CompactConfig(), DatabaseSizes::AnalogOnly(2));
+	t.LowerLayerUp();
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Analog(1, 0x01), 0);
+		db.Update(Analog(-2, 0x01), 1);
+	});
+
+	t.SendToOutstation("C0 01 3C 01 06"); // Read class 0
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 82 00 1E 04 00 00 01 01 00 FE FF");
+
+	const auto& stats = t.context.GetCompactionStatistics();
+	REQUIRE(stats.numStaticHeaders == 1);
+	REQUIRE(stats.numStaticBytesSaved == 6);
+}
+
+TEST_CASE(SUITE("the widest value in a header run selects the variation for the whole run"))
+{
+	OutstationTestObject t(CompactConfig(), DatabaseSizes::AnalogOnly(2));
+	t.LowerLayerUp();
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Analog(70000, 0x01), 0);
+		db.Update(Analog(1, 0x01), 1);
+	});
+
+	t.SendToOutstation("C0 01 3C 01 06"); // Read class 0
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 82 00 1E 03 00 00 01 70 11 01 00 01 00 00 00");
+}
+
+TEST_CASE(SUITE("fractional values keep the configured variation"))
+{
+	OutstationTestObject t(CompactConfig(), DatabaseSizes::AnalogOnly(1));
+
+	{
+		auto view = t.context.GetConfigView();
+		view.analogs[0].config.svariation = StaticAnalogVariation::Group30Var5;
+	}
+
+	t.LowerLayerUp();
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Analog(0.5, 0x01), 0);
+	});
+
+	t.SendToOutstation("C0 01 3C 01 06"); // Read class 0
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 82 00 1E 05 00 00 00 01 00 00 00 3F");
+	REQUIRE(t.context.GetCompactionStatistics().numStaticBytesSaved == 0);
+}
+
+TEST_CASE(SUITE("explicitly requested variations are honored"))
+{
+	OutstationTestObject t(CompactConfig(), DatabaseSizes::AnalogOnly(1));
+	t.LowerLayerUp();
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Analog(1, 0x01), 0);
+	});
+
+	t.SendToOutstation("C0 01 1E 01 06"); // Read g30v1
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 82 00 1E 01 00 00 00 01 01 00 00 00");
+	REQUIRE(t.context.GetCompactionStatistics().numStaticHeaders == 0);
+}
+
+TEST_CASE(SUITE("binaries with nominal flags are packed and promoted as a run"))
+{
+	OutstationTestObject t(CompactConfig(), DatabaseSizes::BinaryOnly(3));
+	t.LowerLayerUp();
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 0);
+		db.Update(Binary(false, 0x01), 1);
+		db.Update(Binary(true, 0x01), 2);
+	});
+
+	t.SendToOutstation("C0 01 3C 01 06"); // Read class 0
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 82 00 01 01 00 00 02 05");
+	t.OnTxReady();
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(false, 0x03), 1);
+	});
+
+	// one header with flags instead of splitting the run around the restart flag
+	t.SendToOutstation("C1 01 3C 01 06"); // Read class 0
+	REQUIRE(t.lower->PopWriteAsHex() == "C1 81 82 00 01 02 00 00 02 81 03 81");
+}
+
+TEST_CASE(SUITE("qualifier is selected from the indices of each header"))
+{
+	OutstationConfig config = CompactConfig();
+	config.params.indexMode = IndexMode::Discontiguous;
+	OutstationTestObject t(config, DatabaseSizes::CounterOnly(2));
+
+	{
+		auto view = t.context.GetConfigView();
+		view.counters[0].config.vIndex = 1;
+		view.counters[1].config.vIndex = 300;
+	}
+
+	t.LowerLayerUp();
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Counter(7, 0x01), 1);
+		db.Update(Counter(8, 0x01), 300);
+	});
+
+	t.SendToOutstation("C0 01 3C 01 06"); // Read class 0
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 82 00 14 06 00 01 01 07 00 14 06 01 2C 01 2C 01 08 00");
+
+	// 2 x 3 bytes per counter, and 2 bytes of qualifier in the first header
+	REQUIRE(t.context.GetCompactionStatistics().numStaticBytesSaved == 8);
+}
+
+TEST_CASE(SUITE("events use the narrowest variation that keeps their time"))
+{
+	OutstationTestObject t(CompactConfig(), DatabaseSizes::CounterOnly(2));
+
+	{
+		auto view = t.context.GetConfigView();
+		view.counters[0].config.clazz = PointClass::Class1;
+		view.counters[1].config.clazz = PointClass::Class1;
+		view.counters[1].config.evariation = EventCounterVariation::Group22Var5;
+	}
+
+	t.LowerLayerUp();
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Counter(5, 0x01), 0);
+		db.Update(Counter(6, 0x01, DNPTime(0)), 1);
+	});
+
+	t.SendToOutstation(hex::ClassPoll(0, PointClass::Class1));
+	REQUIRE(t.lower->PopWriteAsHex() == "E0 81 80 00 16 02 28 01 00 00 00 01 05 00 16 06 28 01 00 01 00 01 06 00 00 00 00 00 00 00");
+
+	const auto& stats = t.context.GetCompactionStatistics();
+	REQUIRE(stats.numEvents == 2);
+	REQUIRE(stats.numEventBytesSaved == 4);
+}
@@ -518,3 +518,58 @@ TEST_CASE(SUITE("reports octet string events w/ different sizes in separate head
 
 
 
+
+TEST_CASE(SUITE("records event and confirm latency when events are confirmed"))
+{
+	OutstationConfig config;
+	config.eventBufferConfig = EventBufferConfig::AllTypes(10);
+	OutstationTestObject t(config, DatabaseSizes::BinaryOnly(1));
+	t.LowerLayerUp();
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 0);
+	});
+
+	t.AdvanceTime(TimeDuration::Milliseconds(100));
+
+	t.SendToOutstation(hex::ClassPoll(0, PointClass::Class1));
+	REQUIRE(t.lower->PopWriteAsHex() == "E0 81 80 00 02 01 28 01 00 00 00 81");
+	t.OnTxReady();
+
+	t.AdvanceTime(TimeDuration::Milliseconds(20));
+	t.SendToOutstation(hex::SolicitedConfirm(0));
+
+	const auto& latency = t.context.GetLatencyStatistics();
+	REQUIRE(latency.eventToTransmit.Count() == 1);
+	REQUIRE(latency.eventToTransmit.Max() == 100);
+	REQUIRE(latency.confirmRoundTrip.Count() == 1);
+	REQUIRE(latency.confirmRoundTrip.Max() == 20);
+}
+
+TEST_CASE(SUITE("ChatterFilterResumesOnTimer"))
+{
+	OutstationConfig config;
+	config.eventBufferConfig = EventBufferConfig::AllTypes(10);
+	OutstationTestObject t(config, DatabaseSizes::BinaryOnly(1));
+
+	ChatterFilterConfig chatter;
+	chatter.maxEvents = 1;
+	chatter.quietPeriod = TimeDuration::Seconds(5);
+	t.context.ConfigureChatterFilter(EventType::Binary, 0, chatter);
+
+	t.LowerLayerUp();
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true), 0);
+		db.Update(Binary(false), 0);
+	});
+
+	REQUIRE(t.context.GetChatterStatistics(0).numFiltered == 1);
+	REQUIRE(t.NumPendingTimers() == 1);
+
+	REQUIRE(t.AdvanceTime(TimeDuration::Seconds(5)) == 1);
+	REQUIRE(t.context.GetChatterStatistics(0).numFiltered == 0);
+	REQUIRE(t.NumPendingTimers() == 0);
+}
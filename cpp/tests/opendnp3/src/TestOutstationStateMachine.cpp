@@ -71,3 +71,50 @@ TEST_CASE(SUITE("Responds to non-READ request while waiting for unsolicited conf
 
 }
 
+
+TEST_CASE(SUITE("Processes a solicited confirm and the next request received before the response is transmitted"))
+{
+	OutstationConfig config;
+	config.eventBufferConfig = EventBufferConfig::AllTypes(10);
+	OutstationTestObject t(config, DatabaseSizes::BinaryOnly(1));
+	t.LowerLayerUp();
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 0);
+	});
+
+	t.SendToOutstation(hex::ClassPoll(0, PointClass::Class1));
+	REQUIRE(t.lower->PopWriteAsHex() == "E0 81 80 00 02 01 28 01 00 00 00 81");
+
+	// the master confirms and polls again before the lower layer reports the response as sent
+	t.SendToOutstation(hex::SolicitedConfirm(0));
+	t.SendToOutstation(hex::ClassPoll(1, PointClass::Class1));
+	REQUIRE(t.lower->NumWrites() == 0);
+
+	// the confirm clears the event, then the poll is answered without waiting for the confirm timeout
+	t.OnTxReady();
+	REQUIRE(t.lower->PopWriteAsHex() == "C1 81 80 00");
+}
+
+TEST_CASE(SUITE("Processes an unsolicited confirm and the next request received before the response is transmitted"))
+{
+	OutstationConfig config;
+	config.params.allowUnsolicited = true;
+	OutstationTestObject t(config, DatabaseSizes::AnalogOnly(1));
+	t.LowerLayerUp();
+
+	REQUIRE(t.lower->PopWriteAsHex() == hex::NullUnsolicited(0, IINField(IINBit::DEVICE_RESTART)));
+
+	t.SendToOutstation(hex::UnsolConfirm(0));
+	t.SendToOutstation(hex::ClassPoll(0, PointClass::Class1));
+	REQUIRE(t.lower->NumWrites() == 0);
+
+	t.OnTxReady();
+	REQUIRE(t.lower->PopWriteAsHex() == "C0 81 80 00");
+	t.OnTxReady();
+
+	// the null unsolicited response was confirmed, so it isn't retried
+	t.AdvanceTime(TimeDuration::Seconds(10));
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+}
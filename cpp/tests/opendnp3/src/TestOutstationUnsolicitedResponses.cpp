@@ -375,5 +375,146 @@ TEST_CASE(SUITE("UnsolEnableDisableFailure"))
 	REQUIRE(t.lower->PopWriteAsHex() ==  "C0 81 80 01"); //FUNC_NOT_SUPPORTED
 }
 
+TEST_CASE(SUITE("UnsolHoldTimeCoalescesEvents"))
+{
+	OutstationConfig cfg;
+	cfg.params.allowUnsolicited = true;
+	cfg.params.unsolClassMask = ClassField::AllEventClasses();
+	cfg.params.unsolClass1Trigger = UnsolicitedTrigger(TimeDuration::Seconds(5), 0);
+	cfg.eventBufferConfig = EventBufferConfig(5);
+	OutstationTestObject t(cfg, DatabaseSizes::BinaryOnly(2));
+
+	t.LowerLayerUp();
+	REQUIRE(t.lower->PopWriteAsHex() == hex::NullUnsolicited(0));
+	t.OnTxReady();
+	t.SendToOutstation(hex::UnsolConfirm(0));
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 0);
+	});
+
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+	REQUIRE(t.AdvanceTime(TimeDuration::Seconds(4)) == 0);
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 1);
+	});
 
+	REQUIRE(t.lower->PopWriteAsHex() == "");
 
+	// the hold time is measured from the first event
+	REQUIRE(t.AdvanceTime(TimeDuration::Seconds(1)) == 1);
+	REQUIRE(t.lower->PopWriteAsHex() == "F1 82 80 00 02 01 28 02 00 00 00 81 01 00 81");
+	t.OnTxReady();
+	t.SendToOutstation(hex::UnsolConfirm(1));
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+
+	const auto& stats = t.context.GetUnsolicitedStatistics();
+	REQUIRE(stats.numFragments == 1);
+	REQUIRE(stats.numEvents == 2);
+	REQUIRE(stats.numHoldTimeExpired == 1);
+	REQUIRE(stats.numEventThresholdReached == 0);
+	REQUIRE(stats.eventsPerFragment.Max() == 2);
+}
+
+TEST_CASE(SUITE("UnsolEventThresholdEndsHoldTime"))
+{
+	OutstationConfig cfg;
+	cfg.params.allowUnsolicited = true;
+	cfg.params.unsolClassMask = ClassField::AllEventClasses();
+	cfg.params.unsolClass1Trigger = UnsolicitedTrigger(TimeDuration::Seconds(5), 2);
+	cfg.eventBufferConfig = EventBufferConfig(5);
+	OutstationTestObject t(cfg, DatabaseSizes::BinaryOnly(2));
+
+	t.LowerLayerUp();
+	REQUIRE(t.lower->PopWriteAsHex() == hex::NullUnsolicited(0));
+	t.OnTxReady();
+	t.SendToOutstation(hex::UnsolConfirm(0));
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 0);
+	});
+
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+	REQUIRE(t.NumPendingTimers() == 1);
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 1);
+	});
+
+	REQUIRE(t.lower->PopWriteAsHex() == "F1 82 80 00 02 01 28 02 00 00 00 81 01 00 81");
+	t.OnTxReady();
+	t.SendToOutstation(hex::UnsolConfirm(1));
+
+	// the hold timer was canceled
+	REQUIRE(t.NumPendingTimers() == 0);
+	REQUIRE(t.context.GetUnsolicitedStatistics().numEventThresholdReached == 1);
+}
+
+TEST_CASE(SUITE("UnsolEventsDuringConfirmStartNewHoldTime"))
+{
+	OutstationConfig cfg;
+	cfg.params.allowUnsolicited = true;
+	cfg.params.unsolClassMask = ClassField::AllEventClasses();
+	cfg.params.unsolClass1Trigger = UnsolicitedTrigger(TimeDuration::Seconds(5), 0);
+	cfg.eventBufferConfig = EventBufferConfig(5);
+	OutstationTestObject t(cfg, DatabaseSizes::BinaryOnly(2));
+
+	t.LowerLayerUp();
+	REQUIRE(t.lower->PopWriteAsHex() == hex::NullUnsolicited(0));
+	t.OnTxReady();
+	t.SendToOutstation(hex::UnsolConfirm(0));
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 0);
+	});
+
+	REQUIRE(t.AdvanceTime(TimeDuration::Seconds(5)) == 1);
+	REQUIRE(t.lower->PopWriteAsHex() == "F1 82 80 00 02 01 28 01 00 00 00 81");
+	t.OnTxReady();
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 1);
+	});
+
+	t.SendToOutstation(hex::UnsolConfirm(1));
+	REQUIRE(t.lower->PopWriteAsHex() == "");
+
+	REQUIRE(t.AdvanceTime(TimeDuration::Seconds(5)) == 1);
+	REQUIRE(t.lower->PopWriteAsHex() == "F2 82 80 00 02 01 28 01 00 01 00 81");
+}
+
+TEST_CASE(SUITE("UnsolRetryIsNotHeld"))
+{
+	OutstationConfig cfg;
+	cfg.params.allowUnsolicited = true;
+	cfg.params.unsolClassMask = ClassField::AllEventClasses();
+	cfg.params.unsolClass1Trigger = UnsolicitedTrigger(TimeDuration::Seconds(5), 0);
+	cfg.eventBufferConfig = EventBufferConfig(5);
+	OutstationTestObject t(cfg, DatabaseSizes::BinaryOnly(1));
+
+	t.LowerLayerUp();
+	REQUIRE(t.lower->PopWriteAsHex() == hex::NullUnsolicited(0));
+	t.OnTxReady();
+	t.SendToOutstation(hex::UnsolConfirm(0));
+
+	t.Transaction([](IUpdateHandler & db)
+	{
+		db.Update(Binary(true, 0x01), 0);
+	});
+
+	REQUIRE(t.AdvanceTime(TimeDuration::Seconds(5)) == 1);
+	REQUIRE(t.lower->PopWriteAsHex() == "F1 82 80 00 02 01 28 01 00 00 00 81");
+	t.OnTxReady();
+
+	// confirm timeout, the events are retried immediately
+	REQUIRE(t.AdvanceToNextTimer());
+	REQUIRE(t.lower->PopWriteAsHex() == "F2 82 80 00 02 01 28 01 00 00 00 81");
+	REQUIRE(t.context.GetUnsolicitedStatistics().numFragments == 2);
+}
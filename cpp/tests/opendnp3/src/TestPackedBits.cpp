@@ -0,0 +1,118 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <opendnp3/app/PackedBits.h>
+
+#include <cstring>
+
+using namespace opendnp3;
+
+#define SUITE(name) "PackedBitsTestSuite - " name
+
+TEST_CASE(SUITE("bits are initially clear"))
+{
+	PackedBits bits(100);
+	REQUIRE(bits.Size() == 100);
+
+	for (uint32_t i = 0; i < bits.Size(); ++i)
+	{
+		REQUIRE_FALSE(bits.Get(i));
+	}
+}
+
+TEST_CASE(SUITE("counts runs across word boundaries"))
+{
+	PackedBits bits(200);
+
+	for (uint32_t i = 10; i < 150; ++i)
+	{
+		bits.Set(i, true);
+	}
+
+	REQUIRE(bits.CountOnes(0, 200) == 0);
+	REQUIRE(bits.CountOnes(10, 200) == 140);
+	REQUIRE(bits.CountOnes(63, 200) == 87);
+	REQUIRE(bits.CountOnes(64, 200) == 86);
+	REQUIRE(bits.CountOnes(10, 70) == 70);
+	REQUIRE(bits.CountOnes(149, 200) == 1);
+}
+
+TEST_CASE(SUITE("counts a run that ends at the last bit"))
+{
+	PackedBits bits(128);
+
+	for (uint32_t i = 0; i < 128; ++i)
+	{
+		bits.Set(i, true);
+	}
+
+	REQUIRE(bits.CountOnes(0, 1000) == 128);
+	REQUIRE(bits.CountOnes(100, 1000) == 28);
+}
+
+TEST_CASE(SUITE("clears ranges of bits"))
+{
+	PackedBits bits(200);
+
+	for (uint32_t i = 0; i < 200; ++i)
+	{
+		bits.Set(i, true);
+	}
+
+	bits.Clear(5, 130);
+
+	REQUIRE(bits.CountOnes(0, 200) == 5);
+	REQUIRE(bits.CountOnes(135, 200) == 65);
+	REQUIRE_FALSE(bits.Get(5));
+	REQUIRE_FALSE(bits.Get(134));
+}
+
+TEST_CASE(SUITE("copies from unaligned offsets least significant bit first"))
+{
+	PackedBits bits(200);
+
+	// every third bit is set
+	for (uint32_t i = 0; i < 200; i += 3)
+	{
+		bits.Set(i, true);
+	}
+
+	for (uint32_t offset = 0; offset < 70; ++offset)
+	{
+		const uint32_t count = 130 - offset;
+		uint8_t dest[20];
+		memset(dest, 0xFF, sizeof(dest));
+
+		bits.CopyTo(offset, count, dest);
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			const bool bit = (dest[i / 8] & (1 << (i % 8))) != 0;
+			REQUIRE(bit == bits.Get(offset + i));
+		}
+
+		// unused bits of the last byte are clear and nothing after it is written
+		const auto numBytes = (count + 7) / 8;
+		REQUIRE((dest[numBytes - 1] >> (((count - 1) % 8) + 1)) == 0);
+		REQUIRE(dest[numBytes] == 0xFF);
+	}
+}
@@ -26,6 +26,8 @@
 #include <opendnp3/outstation/Event.h>
 #include <opendnp3/outstation/Database.h>
 
+#include <testlib/MockExecutor.h>
+
 namespace opendnp3
 {
 
@@ -90,12 +92,12 @@ public:
 
 	DatabaseTestObject(const DatabaseSizes& dbSizes, IndexMode mode = IndexMode::Contiguous, StaticTypeBitField allowedClass0 = StaticTypeBitField::AllTypes()) :
 		buffer(),
-		db(dbSizes, buffer, mode, allowedClass0)
+		db(dbSizes, buffer, mode, allowedClass0, &exe)
 	{
 
 	}
 
-
+	testlib::MockExecutor exe;
 	MockEventBuffer buffer;
 	Database db;
 };
@@ -0,0 +1,141 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <openpal/logging/LogArguments.h>
+#include <openpal/logging/LogMacros.h>
+#include <openpal/logging/Logger.h>
+
+#include <cstdio>
+#include <string>
+
+using namespace openpal;
+
+using namespace std;
+
+#define SUITE(name) "LogArguments - " name
+
+enum class TestEnum : uint8_t
+{
+	Value = 7
+};
+
+template <typename... Args>
+std::string RoundTrip(const char* format, const Args& ... args)
+{
+	uint8_t buffer[MAX_LOG_ARGS_SIZE];
+	auto encoded = LogArguments::Encode(WSlice(buffer, MAX_LOG_ARGS_SIZE), args...);
+	std::string output;
+	LogArguments::Render(format, encoded, output);
+	return output;
+}
+
+template <typename... Args>
+std::string Format(const char* format, const Args& ... args)
+{
+	char buffer[256];
+	snprintf(buffer, sizeof(buffer), format, args...);
+	return std::string(buffer);
+}
+
+class MockBinaryHandler final : public ILogHandler
+{
+public:
+
+	virtual void Log(const LogEntry& entry) override
+	{
+		text.push_back(entry.message);
+	}
+
+	virtual void LogBinary(const BinaryLogEntry& entry) override
+	{
+		std::string output;
+		if (entry.IsHex())
+		{
+			output = "hex: " + std::to_string(entry.payload.Size());
+		}
+		else
+		{
+			LogArguments::Render(entry.format, entry.payload, output);
+		}
+		binary.push_back(output);
+	}
+
+	virtual bool IsBinary() const override
+	{
+		return true;
+	}
+
+	std::vector<std::string> text;
+	std::vector<std::string> binary;
+};
+
+TEST_CASE(SUITE("Renders integers exactly like snprintf"))
+{
+	const char* format = "FIR: %i FIN: %i SEQ: %u [0x%02x] %03u,%03u %d %ld %llu";
+	const int16_t negative = -5;
+	REQUIRE(RoundTrip(format, 1, 0, 15u, 0xAB, 30, 1, negative, -123456789L, 18446744073709551615ull) ==
+	        Format(format, 1, 0, 15u, 0xAB, 30, 1, negative, -123456789L, 18446744073709551615ull));
+}
+
+TEST_CASE(SUITE("Unsigned conversions of negative values wrap at native width"))
+{
+	REQUIRE(RoundTrip("%u %x", -1, static_cast<int8_t>(-1)) == Format("%u %x", -1, 0xFFu));
+}
+
+TEST_CASE(SUITE("Renders strings, floats, chars and enums"))
+{
+	const char* format = "FUNC: %s value: %.3f g: %g c: %c e: %d %%";
+	REQUIRE(RoundTrip(format, "READ", 3.14159, 2.5f, 'x', TestEnum::Value) == Format(format, "READ", 3.14159, 2.5, 'x', 7));
+}
+
+TEST_CASE(SUITE("Missing or mismatched arguments render as placeholders"))
+{
+	REQUIRE(RoundTrip("%d and %d", 1) == "1 and <?>");
+	REQUIRE(RoundTrip("%s", 1) == "<?>");
+}
+
+TEST_CASE(SUITE("Arguments that do not fit are omitted"))
+{
+	const std::string large(200, 'a');
+	REQUIRE(RoundTrip("%d %s %d", 1, large.c_str(), 2) == "1 <?> <?>");
+}
+
+TEST_CASE(SUITE("Format macros bypass formatting for binary handlers"))
+{
+	auto handler = std::make_shared<MockBinaryHandler>();
+	Logger logger(handler, "test", ~0);
+
+	REQUIRE(logger.IsBinary());
+
+	FORMAT_LOG_BLOCK(logger, 0x01, "SEQ: %u FUNC: %s", 4, "CONFIRM");
+	SIMPLE_LOG_BLOCK(logger, 0x01, "plain text");
+
+	uint8_t bytes[] = { 0x05, 0x64, 0x05, 0xC0 };
+	RSlice slice(bytes, sizeof(bytes));
+	FORMAT_HEX_BLOCK(logger, 0x01, slice, 10, 18);
+
+	REQUIRE(handler->binary.size() == 2);
+	REQUIRE(handler->binary[0] == "SEQ: 4 FUNC: CONFIRM");
+	REQUIRE(handler->binary[1] == "hex: 4");
+	REQUIRE(handler->text.size() == 1);
+	REQUIRE(handler->text[0] == "plain text");
+}
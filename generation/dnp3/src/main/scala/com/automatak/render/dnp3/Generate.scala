@@ -4,7 +4,7 @@ import java.nio.file.FileSystems
 
 import com.automatak.render.dnp3.enums.generators.{CSharpEnumGenerator, CppEnumGenerator, JavaEnumGenerator}
 import com.automatak.render.dnp3.enums.groups.{CSharpEnumGroup, DNPCppEnumGroup}
-import com.automatak.render.dnp3.objects.generators.{AttributeGenerator, GroupVariationFileGenerator}
+import com.automatak.render.dnp3.objects.generators.{AttributeGenerator, GroupVariationFileGenerator, GroupVariationTableGenerator}
 
 object Generate {
 
@@ -19,6 +19,9 @@ object Generate {
     // generate the C++ dnp3 enums
     CppEnumGenerator(DNPCppEnumGroup.enums, "opendnp3", "opendnp3/gen/%s", dnp3GenHeaderPath, dnp3GenImplPath)
 
+    // generate the dense group/variation table and the GroupVariation conversions
+    GroupVariationTableGenerator("opendnp3", dnp3GenHeaderPath, dnp3GenImplPath)
+
     // generate the C++ variation attribute lookups
     AttributeGenerator.writeAttributes("opendnp3", dnp3GenHeaderPath, dnp3GenImplPath)
 
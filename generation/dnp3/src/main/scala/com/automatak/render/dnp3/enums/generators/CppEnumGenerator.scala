@@ -39,7 +39,7 @@ object CppEnumGenerator {
         def inc = quoted(String.format(incFormatString, headerName(cfg.model)))
         def lines = license ++ space ++ Iterator(include(inc)) ++ space ++ namespace(cppNamespace)(funcs)
 
-        if(cfg.conversions || cfg.stringConv)
+        if((cfg.conversions || cfg.stringConv) && !cfg.externalImpl)
         {
           writeTo(implPath(cfg.model))(lines)
           println("Wrote: " + implPath(cfg.model))
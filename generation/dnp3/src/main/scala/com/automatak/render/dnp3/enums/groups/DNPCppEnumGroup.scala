@@ -6,7 +6,10 @@ import com.automatak.render.dnp3.enums._
 
 object DNPCppEnumGroup {
 
-  def enums : List[EnumConfig] = List(fullEnums, simpleEnums, stringOnlyEnums).flatten
+  def enums : List[EnumConfig] = List(fullEnums, tableEnums, simpleEnums, stringOnlyEnums).flatten
+
+  // conversions are rendered by GroupVariationTableGenerator
+  private def tableEnums = List(EnumConfig(GroupVariationEnum(), true, true, true))
 
   private def fullEnums = List(
     FunctionCode(),
@@ -14,7 +17,6 @@ object DNPCppEnumGroup {
     LinkFunction(),
     IntervalUnit(),
     ControlCode(),
-    GroupVariationEnum(),
     DoubleBit(),
     CommandStatus(),
     HMACType(),
@@ -6,7 +6,6 @@ import com.automatak.render._
 import com.automatak.render.cpp._
 import com.automatak.render.LicenseHeader
 import com.automatak.render.cpp.CppIndentation
-import com.automatak.render.dnp3.objects.{FieldAttribute, ObjectGroup, GroupVariation}
 
 
 object AttributeGenerator {
@@ -19,27 +18,15 @@ object AttributeGenerator {
     val headerPath = inc.resolve(String.format("%s.h", name))
     val implPath = impl.resolve(String.format("%s.cpp", name))
 
-    trait HasAttribute {
-      def signature : String
-      def matches(gv: GroupVariation) : Boolean
-    }
-
-    case class HasFieldAttrib(signature: String, attr: FieldAttribute.Value) extends HasAttribute {
-      def matches(gv: GroupVariation) : Boolean = gv.attributes.contains(attr)
-    }
+    case class HasAttribute(signature: String, attr: GroupVariationTableGenerator.Attribute)
 
-    object EventAttribute extends HasAttribute {
-      def signature = "bool IsEvent(GroupVariation gv)";
-      def matches(gv: GroupVariation) : Boolean = {
-         gv.parent.isEventGroup && gv.variation != 0
-      }
-    }
+    val table = GroupVariationTableGenerator.attributes.map(a => (a.name, a)).toMap
 
     val attributes : List[HasAttribute] = List(
-      HasFieldAttrib("bool HasAbsoluteTime(GroupVariation gv)", FieldAttribute.IsTimeUTC),
-      HasFieldAttrib("bool HasRelativeTime(GroupVariation gv)", FieldAttribute.IsTimeRel),
-      HasFieldAttrib("bool HasFlags(GroupVariation gv)", FieldAttribute.IsFlags),
-      EventAttribute
+      HasAttribute("bool HasAbsoluteTime(GroupVariation gv)", table("ABSOLUTE_TIME")),
+      HasAttribute("bool HasRelativeTime(GroupVariation gv)", table("RELATIVE_TIME")),
+      HasAttribute("bool HasFlags(GroupVariation gv)", table("FLAGS")),
+      HasAttribute("bool IsEvent(GroupVariation gv)", table("EVENT"))
     )
 
     def license = commented(LicenseHeader())
@@ -58,32 +45,15 @@ object AttributeGenerator {
     def writeImpl() {
       def license = commented(LicenseHeader())
 
-      def cases(attr: HasAttribute) : Iterator[String] = ObjectGroup.all.map(og => getCases(og, attr)).flatten.iterator
-
-      def getCases(og: ObjectGroup, attr: HasAttribute) : List[String] = og.objects.flatMap(gv => getCase(gv, attr)).flatten
-
-      def getCase(gv: GroupVariation, attr: HasAttribute) : Option[Iterator[String]] = {
-        if(attr.matches(gv))
-        {
-            Some(Iterator("case(GroupVariation::%s):".format(gv.name)) ++ indent {
-              Iterator("return true;")
-            })
-        }
-        else None
-      }
-
       def measImpl(attr: HasAttribute) : Iterator[String] = Iterator(attr.signature) ++ bracket {
-        Iterator(String.format("switch(gv)")) ++ bracket {
-          cases(attr) ++
-          Iterator("default:") ++ indent {
-            Iterator("return false;")
-          }
-        }
+        Iterator("return (GroupVariationTable::Lookup(gv).attributes & GroupVariationTable::%s) != 0;".format(attr.attr.name))
       }
 
       def impls : Iterator[String] = attributes.flatMap(x => measImpl(x)).iterator
 
-      def lines = license ++ space ++ Iterator(include(quoted("opendnp3/gen/Attributes.h"))) ++ space ++ namespace(cppNamespace) {
+      def includes = Iterator(include(quoted("opendnp3/gen/Attributes.h")), include(quoted("opendnp3/gen/GroupVariationTable.h")))
+
+      def lines = license ++ space ++ includes ++ space ++ namespace(cppNamespace) {
         impls
       }
 
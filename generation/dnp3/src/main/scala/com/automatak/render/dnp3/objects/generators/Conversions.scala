@@ -16,6 +16,8 @@ object ConversionHeaders {
   val factory = quoted("opendnp3/app/MeasurementFactory.h")
   val serializer = quoted("opendnp3/app/DNP3Serializer.h")
   val conversions = quoted("opendnp3/app/WriteConversions.h")
+  val stridedView = bracketed("openpal/container/StridedView.h")
+  val serialization = bracketed("openpal/serialization/Serialization.h")
 
   val cppIncludes = List(factory, conversions)
 }
@@ -28,14 +30,20 @@ trait Conversion extends FixedSize {
   def includeSpecTypedef = false
   def spec : String = target + "Spec"
 
+  // generate a WriteTargets kernel that serializes a run of values in one pass
+  def bulkWrite = false
+
   def convHeaderIncludes : List[String]
-  def convImplIncludes : List[String] = cppIncludes
+  def convImplIncludes : List[String] = if(bulkWrite) cppIncludes ++ List(serialization) else cppIncludes
 
   // override things from GroupVariation w/ additional material
 
   override def headerLines(implicit i : Indentation) : Iterator[String] = super.headerLines ++ space ++ convHeaderLines
   override def implLines(implicit i : Indentation): Iterator[String] = super.implLines ++ space ++ convImplLines(this)
-  override def headerIncludes : List[String] = super.headerIncludes ++ (serializer :: convHeaderIncludes)
+  override def headerIncludes : List[String] = {
+    val bulk = if(bulkWrite) List(stridedView) else Nil
+    super.headerIncludes ++ bulk ++ (serializer :: convHeaderIncludes)
+  }
   override def implIncludes : List[String] = super.implIncludes ++ convImplIncludes
 
   def specTypedef : Iterator[String] = if(includeSpecTypedef) Iterator("typedef %s Spec;".format(spec)) else Iterator.empty
@@ -45,14 +53,19 @@ trait Conversion extends FixedSize {
     Iterator("typedef %s Target;".format(target)) ++ specTypedef ++
     Iterator(
       "static bool ReadTarget(openpal::RSlice&, %s&);".format(target),
-      "static bool WriteTarget(const %s&, openpal::WSlice&);".format(target),
-      serializerInstance
-    )
+      "static bool WriteTarget(const %s&, openpal::WSlice&);".format(target)
+    ) ++ bulkHeaderLines ++ Iterator(serializerInstance)
+  }
+
+  private def bulkHeaderLines : Iterator[String] = {
+    if(bulkWrite) Iterator("static uint32_t WriteTargets(const openpal::StridedView<%s>&, const uint16_t*, uint32_t, openpal::WSlice&);".format(target))
+    else Iterator.empty
   }
 
   def serializerInstance : String  = {
       val serializerType = "DNP3Serializer<%s>".format(target)
-      "static %s Inst() { return %s(ID(), Size(), &ReadTarget, &WriteTarget); }".format(serializerType, serializerType)
+      val bulk = if(bulkWrite) ", &WriteTargets" else ""
+      "static %s Inst() { return %s(ID(), Size(), &ReadTarget, &WriteTarget%s); }".format(serializerType, serializerType, bulk)
   }
 
 
@@ -80,7 +93,44 @@ trait Conversion extends FixedSize {
       }
     }
 
-    readFunc ++ space ++ writeFunc
+    // computes how many values fit up front, then writes each field at a fixed offset without checking the remaining space
+    def writeTargetsFunc = {
+
+      def fieldWrites : Iterator[String] = {
+        fs.fields.foldLeft((0, List.empty[String])) { case ((offset, lines), f) =>
+          val dest = if(offset == 0) "dest" else "dest + %d".format(offset)
+          val line = "%s::Write(%s, gv.%s);".format(FixedSizeHelpers.getCppFieldTypeParser(f.typ), dest, f.name)
+          (offset + f.typ.numBytes, line :: lines)
+        }._2.reverse.iterator
+      }
+
+      Iterator("uint32_t %s::WriteTargets(const openpal::StridedView<%s>& values, const uint16_t* indices, uint32_t count, openpal::WSlice& buff)".format(fs.name, target)) ++ bracket {
+        Iterator(
+          "const uint32_t size = indices ? Size() + static_cast<uint32_t>(UInt16::SIZE) : Size();",
+          "const uint32_t num = (count < (buff.Size() / size)) ? count : (buff.Size() / size);",
+          "uint8_t* dest = buff;",
+          "for(uint32_t i = 0; i < num; ++i)"
+        ) ++ bracket {
+          Iterator("if(indices)") ++ bracket {
+            Iterator(
+              "UInt16::Write(dest, indices[i]);",
+              "dest += UInt16::SIZE;"
+            )
+          } ++
+          Iterator("const auto gv = Convert%s::Apply(values[i]);".format(fs.name)) ++
+          fieldWrites ++
+          Iterator("dest += Size();")
+        } ++
+        Iterator(
+          "buff.Advance(num * size);",
+          "return num;"
+        )
+      }
+    }
+
+    val bulk = if(bulkWrite) space ++ writeTargetsFunc else Iterator.empty
+
+    readFunc ++ space ++ writeFunc ++ bulk
   }
 
 }
@@ -90,30 +140,35 @@ trait Conversion extends FixedSize {
 trait ConversionToBinary extends Conversion {
   def target = "Binary"
   override def includeSpecTypedef = true
+  override def bulkWrite = true
   def convHeaderIncludes = List(measurementTypeSpecs)
 }
 
 trait ConversionToDoubleBitBinary extends Conversion {
   def target = "DoubleBitBinary"
   override def includeSpecTypedef = true
+  override def bulkWrite = true
   def convHeaderIncludes = List(measurementTypeSpecs)
 }
 
 trait ConversionToAnalog extends Conversion {
   def target = "Analog"
   override def includeSpecTypedef = true
+  override def bulkWrite = true
   def convHeaderIncludes = List(measurementTypeSpecs)
 }
 
 trait ConversionToCounter extends Conversion {
   def target = "Counter"
   override def includeSpecTypedef = true
+  override def bulkWrite = true
   def convHeaderIncludes = List(measurementTypeSpecs)
 }
 
 trait ConversionToFrozenCounter extends Conversion {
   def target = "FrozenCounter"
   override def includeSpecTypedef = true
+  override def bulkWrite = true
   def convHeaderIncludes = List(measurementTypeSpecs)
 }
 
@@ -121,12 +176,14 @@ trait ConversionToFrozenCounter extends Conversion {
 trait ConversionToBinaryOutputStatus extends Conversion {
   def target = "BinaryOutputStatus"
   override def includeSpecTypedef = true
+  override def bulkWrite = true
   def convHeaderIncludes = List(measurementTypeSpecs)
 }
 
 trait ConversionToAnalogOutputStatus extends Conversion {
   def target = "AnalogOutputStatus"
   override def includeSpecTypedef = true
+  override def bulkWrite = true
   def convHeaderIncludes = List(measurementTypeSpecs)
 }
 
@@ -158,6 +215,7 @@ trait ConversionToAnalogOutputDouble64 extends Conversion {
 trait ConversionToTimeAndInterval extends Conversion {
   def target = "TimeAndInterval"
   override def includeSpecTypedef = true
+  override def bulkWrite = true
   def convHeaderIncludes = List(measurementTypeSpecs)
 }
 
@@ -0,0 +1,211 @@
+package com.automatak.render.dnp3.objects.generators
+
+import java.nio.file.Path
+
+import com.automatak.render._
+import com.automatak.render.cpp._
+import com.automatak.render.dnp3.objects._
+import com.automatak.render.dnp3.objects.groups.{Group110AnyVar, Group111AnyVar}
+
+/**
+ * Renders a dense group/variation table and the GroupVariation enum conversions that use it.
+ *
+ * Groups index a 256 entry row table, and each row is a contiguous run of entries indexed by variation,
+ * so a lookup is a couple of indexed loads instead of a switch over every known object.
+ *
+ * Each entry also carries the fixed object size, the qualifier families the parser accepts for the object,
+ * and a dense handler slot that the parsers and the outstation use to index their dispatch tables.
+ */
+object GroupVariationTableGenerator {
+
+  implicit val indent = CppIndentation()
+
+  case class Attribute(name: String, mask: Int, matches: GroupVariation => Boolean)
+
+  val attributes = List(
+    Attribute("ABSOLUTE_TIME", 0x01, gv => gv.attributes.contains(FieldAttribute.IsTimeUTC)),
+    Attribute("RELATIVE_TIME", 0x02, gv => gv.attributes.contains(FieldAttribute.IsTimeRel)),
+    Attribute("FLAGS", 0x04, gv => gv.attributes.contains(FieldAttribute.IsFlags)),
+    Attribute("EVENT", 0x08, gv => gv.parent.isEventGroup && gv.variation != 0)
+  )
+
+  case class Qualifier(name: String, mask: Int, matches: GroupVariation => Boolean)
+
+  private def isCommand(gv: GroupVariation) : Boolean = gv match {
+    case _ : ConversionToCROB | _ : ConversionToAnalogOutputInt16 | _ : ConversionToAnalogOutputInt32 |
+         _ : ConversionToAnalogOutputFloat32 | _ : ConversionToAnalogOutputDouble64 => true
+    case _ => false
+  }
+
+  // qualifier families that may carry object data for each object
+  val qualifiers = List(
+    Qualifier("RANGE", 0x01, {
+      case _ : SingleBitfield | _ : DoubleBitfield => true
+      case c : Conversion => !c.parent.isEventGroup && !isCommand(c)
+      case gv => gv == Group110AnyVar
+    }),
+    Qualifier("COUNT", 0x02, {
+      case _ : Conversion => false
+      case _ : FixedSize => true
+      case _ => false
+    }),
+    Qualifier("COUNT_AND_PREFIX", 0x04, {
+      case c : Conversion => c.parent.isEventGroup || isCommand(c) || c.isInstanceOf[ConversionToTimeAndInterval]
+      case gv => gv == Group111AnyVar
+    }),
+    Qualifier("FREE_FORMAT", 0x08, gv => gv.isInstanceOf[AuthVariableSize])
+  )
+
+  private val name = "GroupVariationTable"
+
+  private case class Row(group: Int, offset: Int, count: Int)
+
+  private def groups : List[ObjectGroup] = ObjectGroup.all.sortBy(_.group)
+
+  // the first entry is the unknown value, followed by a run of entries for each group
+  private def rows : List[Row] = {
+    groups.foldLeft((1, List.empty[Row])) { case ((offset, acc), og) =>
+      val count = og.objects.map(_.variation.toInt).max + 1
+      (offset + count, Row(og.group, offset, count) :: acc)
+    }._2.reverse
+  }
+
+  private def entries : List[Option[GroupVariation]] = None :: groups.flatMap { og =>
+    val count = og.objects.map(_.variation.toInt).max + 1
+    (0 until count).map(v => og.objects.find(_.variation == v)).toList
+  }
+
+  // slot 0 is reserved for unknown objects, known objects are numbered in table order
+  private def handlers : Map[GroupVariation, Int] = entries.flatten.zipWithIndex.map { case (gv, i) => (gv, i + 1) }.toMap
+
+  private def numHandlers : Int = handlers.size + 1
+
+  private def hex(i: Int) : String = "0x%02X".format(i)
+
+  private def attributeMask(gv: GroupVariation) : String = {
+    val mask = attributes.filter(_.matches(gv)).map(_.mask).sum
+    hex(mask)
+  }
+
+  private def qualifierMask(gv: GroupVariation) : String = {
+    val mask = qualifiers.filter(_.matches(gv)).map(_.mask).sum
+    hex(mask)
+  }
+
+  private def size(gv: GroupVariation) : Int = gv match {
+    case fs : FixedSize => fs.size
+    case _ => 0
+  }
+
+  private def entry(slots: Map[GroupVariation, Int])(e: Option[GroupVariation]) : String = e match {
+    case Some(gv) => "{ GroupVariation::%s, %d, %s, %s, %d, %s },".format(gv.name, size(gv), attributeMask(gv), qualifierMask(gv), slots(gv), quoted(gv.fullDesc))
+    case None => "{ GroupVariation::UNKNOWN, 0, 0x00, 0x00, 0, %s },".format(quoted("UNKNOWN"))
+  }
+
+  def apply(cppNamespace: String, inc: Path, impl: Path): Unit = {
+
+    val headerPath = inc.resolve(String.format("%s.h", name))
+    val implPath = impl.resolve(String.format("%s.cpp", name))
+    val enumImplPath = impl.resolve("GroupVariation.cpp")
+
+    def license = commented(LicenseHeader())
+
+    def writeHeader() {
+
+      def includes : Iterator[String] = cstdint ++ space ++ Iterator(include(quoted("opendnp3/gen/GroupVariation.h")))
+
+      def info : Iterator[String] = Iterator("/**", "  Properties of a known group/variation", "*/") ++ struct("GroupVariationInfo") {
+        Iterator(
+          "GroupVariation enumeration;",
+          "uint16_t size;",
+          "uint8_t attributes;",
+          "uint8_t qualifiers;",
+          "uint8_t handler;",
+          "char const* name;"
+        )
+      }
+
+      def table : Iterator[String] = Iterator("/**", "  Dense lookup of group/variation properties", "*/", "class %s".format(name)) ++ bracketSemiColon {
+        Iterator("public:") ++ space ++ indent {
+          attributes.map(a => "static const uint8_t %s = %s;".format(a.name, hex(a.mask))).iterator ++ space ++
+          qualifiers.map(q => "static const uint8_t %s = %s;".format(q.name, hex(q.mask))).iterator ++ space ++
+          Iterator("static const uint8_t NUM_HANDLERS = %d;".format(numHandlers)) ++ space ++
+          Iterator("static const GroupVariationInfo& Lookup(uint8_t group, uint8_t variation)") ++ bracket {
+            Iterator(
+              "const Row& row = rows[groups[group]];",
+              "return entries[(variation < row.count) ? (row.offset + variation) : 0];"
+            )
+          } ++ space ++
+          Iterator("static const GroupVariationInfo& Lookup(GroupVariation gv)") ++ bracket {
+            Iterator(
+              "const auto value = GroupVariationToType(gv);",
+              "return Lookup(static_cast<uint8_t>(value >> 8), static_cast<uint8_t>(value & 0xFF));"
+            )
+          }
+        } ++ space ++
+        Iterator("private:") ++ space ++ indent {
+          Iterator("struct Row") ++ bracketSemiColon {
+            Iterator("uint16_t offset;", "uint16_t count;")
+          } ++ space ++
+          Iterator(
+            "static const uint8_t groups[256];",
+            "static const Row rows[%d];".format(rows.size + 1),
+            "static const GroupVariationInfo entries[%d];".format(entries.size)
+          )
+        }
+      }
+
+      def lines = license ++ space ++ includeGuards(name)(includes ++ space ++ namespace(cppNamespace)(info ++ space ++ table))
+
+      writeTo(headerPath)(lines)
+      println("Wrote: " + headerPath)
+    }
+
+    def writeImpl() {
+
+      def groupRows : Iterator[String] = {
+        val index = rows.zipWithIndex.map { case (r, i) => (r.group, i + 1) }.toMap
+        (0 until 256).map(g => index.getOrElse(g, 0)).grouped(16).map(_.mkString("", ", ", ",")).toIterator
+      }
+
+      def rowLines : Iterator[String] = {
+        val all = "{ 0, 0 }, // unknown groups" :: rows.map(r => "{ %d, %d }, // group %d".format(r.offset, r.count, r.group))
+        all.iterator
+      }
+
+      def lines = license ++ space ++ Iterator(include(quoted("opendnp3/gen/%s.h".format(name)))) ++ space ++ namespace(cppNamespace) {
+        Iterator("const uint8_t %s::groups[256] =".format(name)) ++ bracketSemiColon(groupRows) ++ space ++
+        Iterator("const %s::Row %s::rows[%d] =".format(name, name, rows.size + 1)) ++ bracketSemiColon(rowLines) ++ space ++
+        Iterator("const GroupVariationInfo %s::entries[%d] =".format(name, entries.size)) ++ bracketSemiColon(entries.map(entry(handlers)).iterator)
+      }
+
+      writeTo(implPath)(lines)
+      println("Wrote: " + implPath)
+    }
+
+    def writeEnumImpl() {
+
+      def lines = license ++ space ++
+        Iterator(include(quoted("opendnp3/gen/GroupVariation.h")), include(quoted("opendnp3/gen/%s.h".format(name)))) ++ space ++
+        namespace(cppNamespace) {
+          Iterator("uint16_t GroupVariationToType(GroupVariation arg)") ++ bracket {
+            Iterator("return static_cast<uint16_t>(arg);")
+          } ++
+          Iterator("GroupVariation GroupVariationFromType(uint16_t arg)") ++ bracket {
+            Iterator("return %s::Lookup(static_cast<uint8_t>(arg >> 8), static_cast<uint8_t>(arg & 0xFF)).enumeration;".format(name))
+          } ++
+          Iterator("char const* GroupVariationToString(GroupVariation arg)") ++ bracket {
+            Iterator("return %s::Lookup(arg).name;".format(name))
+          }
+        }
+
+      writeTo(enumImplPath)(lines)
+      println("Wrote: " + enumImplPath)
+    }
+
+    writeHeader()
+    writeImpl()
+    writeEnumImpl()
+  }
+
+}
@@ -2,5 +2,6 @@ package com.automatak.render.cpp
 
 import com.automatak.render.EnumModel
 
-case class EnumConfig(model: EnumModel, conversions: Boolean, stringConv: Boolean)
+// if externalImpl is set, only the header is rendered and the conversions are implemented by another generator
+case class EnumConfig(model: EnumModel, conversions: Boolean, stringConv: Boolean, externalImpl: Boolean = false)
 
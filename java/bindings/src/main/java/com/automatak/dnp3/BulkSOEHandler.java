@@ -0,0 +1,47 @@
+/**
+ * Copyright 2013-2016 Automatak, LLC
+ *
+ * Licensed to Automatak, LLC (www.automatak.com) under one or more
+ * contributor license agreements. See the NOTICE file distributed with this
+ * work for additional information regarding copyright ownership. Automatak, LLC
+ * licenses this file to you under the Apache License Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0.html
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package com.automatak.dnp3;
+
+/**
+ * Opt-in alternative to {@link SOEHandler} that receives every value of an object header in a single call.
+ *
+ * Values are delivered as a columnar {@link MeasurementBatch} that reads directly from memory shared with the
+ * native stack, so no objects are created per value and only one call crosses JNI per header.
+ *
+ * start() / end() will be called before / after any calls to process.
+ */
+public interface BulkSOEHandler {
+
+    /**
+     * Start a processing an ASDU
+     */
+    void start();
+
+    /**
+     * End a processing an ASDU
+     */
+    void end();
+
+    /**
+     * Process all the values of a header
+     * @param info information about the header from which the values came
+     * @param batch the values, only valid for the duration of this call
+     */
+    void process(HeaderInfo info, MeasurementBatch batch);
+}
@@ -53,6 +53,18 @@ public interface Channel {
      */
     Master addMaster(String loggerId, SOEHandler handler, MasterApplication application, MasterStackConfig config) throws DNP3Exception;
 
+    /**
+     * Adds a master to the channel that delivers measurements in bulk, one call and no per-value objects per header
+     *
+     * @param loggerId name of the logger that will be assigned to this stack
+     * @param handler where batches of measurements will be sent as they are received from the outstation
+     * @param application  master application instance
+     * @param config configuration information for the master stack
+     * @return reference to the created master
+     * @throws DNP3Exception if any error occurs while creating the master
+     */
+    Master addMaster(String loggerId, BulkSOEHandler handler, MasterApplication application, MasterStackConfig config) throws DNP3Exception;
+
     /**
      * Adds an outstation to the channel
      *
@@ -18,6 +18,7 @@
  */
 package com.automatak.dnp3;
 
+import com.automatak.dnp3.enums.DoubleBit;
 import com.automatak.dnp3.enums.EventMode;
 
 /**
@@ -130,4 +131,74 @@ public interface Database
      */
     void update(AnalogOutputStatus value, int index, EventMode mode);
 
+    /**
+     * Update a batch of values in the database. All of the arrays must have the same length.
+     * @param indices index of each measurement
+     * @param values value of each measurement
+     * @param flags quality flags of each measurement
+     * @param times timestamp of each measurement
+     * @param mode EventMode to use for every measurement
+     */
+    void updateBinaryInputs(int[] indices, boolean[] values, byte[] flags, long[] times, EventMode mode);
+
+    /**
+     * Update a batch of values in the database. All of the arrays must have the same length.
+     * @param indices index of each measurement
+     * @param values value of each measurement
+     * @param flags quality flags of each measurement
+     * @param times timestamp of each measurement
+     * @param mode EventMode to use for every measurement
+     */
+    void updateDoubleBitBinaryInputs(int[] indices, DoubleBit[] values, byte[] flags, long[] times, EventMode mode);
+
+    /**
+     * Update a batch of values in the database. All of the arrays must have the same length.
+     * @param indices index of each measurement
+     * @param values value of each measurement
+     * @param flags quality flags of each measurement
+     * @param times timestamp of each measurement
+     * @param mode EventMode to use for every measurement
+     */
+    void updateAnalogInputs(int[] indices, double[] values, byte[] flags, long[] times, EventMode mode);
+
+    /**
+     * Update a batch of values in the database. All of the arrays must have the same length.
+     * @param indices index of each measurement
+     * @param values value of each measurement
+     * @param flags quality flags of each measurement
+     * @param times timestamp of each measurement
+     * @param mode EventMode to use for every measurement
+     */
+    void updateCounters(int[] indices, long[] values, byte[] flags, long[] times, EventMode mode);
+
+    /**
+     * Update a batch of values in the database. All of the arrays must have the same length.
+     * @param indices index of each measurement
+     * @param values value of each measurement
+     * @param flags quality flags of each measurement
+     * @param times timestamp of each measurement
+     * @param mode EventMode to use for every measurement
+     */
+    void updateFrozenCounters(int[] indices, long[] values, byte[] flags, long[] times, EventMode mode);
+
+    /**
+     * Update a batch of values in the database. All of the arrays must have the same length.
+     * @param indices index of each measurement
+     * @param values value of each measurement
+     * @param flags quality flags of each measurement
+     * @param times timestamp of each measurement
+     * @param mode EventMode to use for every measurement
+     */
+    void updateBinaryOutputStatuses(int[] indices, boolean[] values, byte[] flags, long[] times, EventMode mode);
+
+    /**
+     * Update a batch of values in the database. All of the arrays must have the same length.
+     * @param indices index of each measurement
+     * @param values value of each measurement
+     * @param flags quality flags of each measurement
+     * @param times timestamp of each measurement
+     * @param mode EventMode to use for every measurement
+     */
+    void updateAnalogOutputStatuses(int[] indices, double[] values, byte[] flags, long[] times, EventMode mode);
+
 }
@@ -0,0 +1,103 @@
+/**
+ * Copyright 2013-2016 Automatak, LLC
+ *
+ * Licensed to Automatak, LLC (www.automatak.com) under one or more
+ * contributor license agreements. See the NOTICE file distributed with this
+ * work for additional information regarding copyright ownership. Automatak, LLC
+ * licenses this file to you under the Apache License Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0.html
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package com.automatak.dnp3;
+
+import com.automatak.dnp3.enums.DoubleBit;
+
+/**
+ * A read-only view of the values of one object header, stored as columns of indices, values, flags and timestamps.
+ *
+ * The view reads directly from a buffer that is reused for every header. It must not be retained or accessed
+ * after {@link BulkSOEHandler#process} returns; copy out anything that is needed later.
+ */
+public interface MeasurementBatch
+{
+    /**
+     * The type of measurement in a batch, which determines how the value column is interpreted
+     */
+    enum Type
+    {
+        /** value is 0 or 1 */
+        BINARY_INPUT,
+        /** value is the {@link DoubleBit} type */
+        DOUBLE_BIT_BINARY_INPUT,
+        ANALOG_INPUT,
+        /** value is an unsigned 32-bit count */
+        COUNTER,
+        /** value is an unsigned 32-bit count */
+        FROZEN_COUNTER,
+        /** value is 0 or 1 */
+        BINARY_OUTPUT_STATUS,
+        ANALOG_OUTPUT_STATUS,
+        /** only the timestamp column is valid, e.g. common time-of-occurrence headers */
+        DNP_TIME
+    }
+
+    /**
+     * @return the type of every value in the batch
+     */
+    Type getType();
+
+    /**
+     * @return the number of values in the batch
+     */
+    int size();
+
+    /**
+     * @param i position in the batch, 0 to size() - 1
+     * @return the point index of the value
+     */
+    int getIndex(int i);
+
+    /**
+     * @param i position in the batch, 0 to size() - 1
+     * @return the value as a double, exact for every type
+     */
+    double getValue(int i);
+
+    /**
+     * @param i position in the batch, 0 to size() - 1
+     * @return the value of a binary type
+     */
+    boolean getBoolean(int i);
+
+    /**
+     * @param i position in the batch, 0 to size() - 1
+     * @return the value of a counter type
+     */
+    long getCount(int i);
+
+    /**
+     * @param i position in the batch, 0 to size() - 1
+     * @return the value of a double-bit binary
+     */
+    DoubleBit getDoubleBit(int i);
+
+    /**
+     * @param i position in the batch, 0 to size() - 1
+     * @return the flags (quality) of the value
+     */
+    byte getFlags(int i);
+
+    /**
+     * @param i position in the batch, 0 to size() - 1
+     * @return the timestamp of the value in milliseconds since the epoch, see {@link HeaderInfo#tsmode}
+     */
+    long getTime(int i);
+}
@@ -18,6 +18,7 @@
  */
 package com.automatak.dnp3;
 
+import com.automatak.dnp3.enums.DoubleBit;
 import com.automatak.dnp3.enums.EventMode;
 
 import java.util.ArrayList;
@@ -109,5 +110,80 @@ public class OutstationChangeSet implements Database, ChangeSet {
         updates.add((Database db) -> db.update(update, index, mode));
     }
 
+    @Override
+    public void updateBinaryInputs(int[] indices, boolean[] values, byte[] flags, long[] times, EventMode mode) {
+        checkLengths(indices.length, values.length, flags.length, times.length);
+        final int[] i = indices.clone();
+        final boolean[] v = values.clone();
+        final byte[] f = flags.clone();
+        final long[] t = times.clone();
+        updates.add((Database db) -> db.updateBinaryInputs(i, v, f, t, mode));
+    }
+
+    @Override
+    public void updateDoubleBitBinaryInputs(int[] indices, DoubleBit[] values, byte[] flags, long[] times, EventMode mode) {
+        checkLengths(indices.length, values.length, flags.length, times.length);
+        final int[] i = indices.clone();
+        final DoubleBit[] v = values.clone();
+        final byte[] f = flags.clone();
+        final long[] t = times.clone();
+        updates.add((Database db) -> db.updateDoubleBitBinaryInputs(i, v, f, t, mode));
+    }
+
+    @Override
+    public void updateAnalogInputs(int[] indices, double[] values, byte[] flags, long[] times, EventMode mode) {
+        checkLengths(indices.length, values.length, flags.length, times.length);
+        final int[] i = indices.clone();
+        final double[] v = values.clone();
+        final byte[] f = flags.clone();
+        final long[] t = times.clone();
+        updates.add((Database db) -> db.updateAnalogInputs(i, v, f, t, mode));
+    }
+
+    @Override
+    public void updateCounters(int[] indices, long[] values, byte[] flags, long[] times, EventMode mode) {
+        checkLengths(indices.length, values.length, flags.length, times.length);
+        final int[] i = indices.clone();
+        final long[] v = values.clone();
+        final byte[] f = flags.clone();
+        final long[] t = times.clone();
+        updates.add((Database db) -> db.updateCounters(i, v, f, t, mode));
+    }
+
+    @Override
+    public void updateFrozenCounters(int[] indices, long[] values, byte[] flags, long[] times, EventMode mode) {
+        checkLengths(indices.length, values.length, flags.length, times.length);
+        final int[] i = indices.clone();
+        final long[] v = values.clone();
+        final byte[] f = flags.clone();
+        final long[] t = times.clone();
+        updates.add((Database db) -> db.updateFrozenCounters(i, v, f, t, mode));
+    }
+
+    @Override
+    public void updateBinaryOutputStatuses(int[] indices, boolean[] values, byte[] flags, long[] times, EventMode mode) {
+        checkLengths(indices.length, values.length, flags.length, times.length);
+        final int[] i = indices.clone();
+        final boolean[] v = values.clone();
+        final byte[] f = flags.clone();
+        final long[] t = times.clone();
+        updates.add((Database db) -> db.updateBinaryOutputStatuses(i, v, f, t, mode));
+    }
+
+    @Override
+    public void updateAnalogOutputStatuses(int[] indices, double[] values, byte[] flags, long[] times, EventMode mode) {
+        checkLengths(indices.length, values.length, flags.length, times.length);
+        final int[] i = indices.clone();
+        final double[] v = values.clone();
+        final byte[] f = flags.clone();
+        final long[] t = times.clone();
+        updates.add((Database db) -> db.updateAnalogOutputStatuses(i, v, f, t, mode));
+    }
+
+    private static void checkLengths(int indices, int values, int flags, int times) {
+        if (values != indices || flags != indices || times != indices) {
+            throw new IllegalArgumentException(String.format("array lengths differ, indices: %d values: %d flags: %d times: %d", indices, values, flags, times));
+        }
+    }
 
 }
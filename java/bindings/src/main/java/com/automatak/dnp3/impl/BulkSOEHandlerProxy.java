@@ -0,0 +1,74 @@
+/**
+ * Copyright 2013-2016 Automatak, LLC
+ *
+ * Licensed to Automatak, LLC (www.automatak.com) under one or more
+ * contributor license agreements. See the NOTICE file distributed with this
+ * work for additional information regarding copyright ownership. Automatak, LLC
+ * licenses this file to you under the Apache License Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0.html
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package com.automatak.dnp3.impl;
+
+import com.automatak.dnp3.BulkSOEHandler;
+import com.automatak.dnp3.HeaderInfo;
+import com.automatak.dnp3.enums.GroupVariation;
+import com.automatak.dnp3.enums.QualifierCode;
+import com.automatak.dnp3.enums.TimestampMode;
+
+import java.nio.ByteBuffer;
+
+/**
+ * Target of the upcalls from the native BulkSOEHandlerAdapter.
+ *
+ * The header fields arrive as primitives and are converted here so that each header costs a single JNI call.
+ */
+public final class BulkSOEHandlerProxy
+{
+    private final BulkSOEHandler handler;
+    private final MeasurementBatchImpl batch = new MeasurementBatchImpl();
+
+    BulkSOEHandlerProxy(BulkSOEHandler handler)
+    {
+        this.handler = handler;
+    }
+
+    private void start()
+    {
+        handler.start();
+    }
+
+    private void end()
+    {
+        handler.end();
+    }
+
+    // called when the native buffer grows, the previous buffer is released after this returns
+    private void setBuffer(ByteBuffer buffer, int capacity)
+    {
+        batch.setBuffer(buffer, capacity);
+    }
+
+    private void process(int gv, int qualifier, int tsmode, boolean isEvent, boolean flagsValid, int headerIndex, int type, int count)
+    {
+        final HeaderInfo info = new HeaderInfo(
+                GroupVariation.fromType(gv),
+                QualifierCode.fromType(qualifier),
+                TimestampMode.fromType(tsmode),
+                isEvent,
+                flagsValid,
+                headerIndex
+        );
+
+        batch.reset(type, count);
+        handler.process(info, batch);
+    }
+}
@@ -20,6 +20,7 @@ package com.automatak.dnp3.impl;
 
 
 import com.automatak.dnp3.*;
+import com.automatak.dnp3.enums.DoubleBit;
 import com.automatak.dnp3.enums.EventMode;
 
 class ChangeSetImpl implements Database {
@@ -122,6 +123,68 @@ class ChangeSetImpl implements Database {
         this.update_ao_status_native(this.nativePointer, value.value, value.quality, value.timestamp, index, mode.toType());
     }
 
+    @Override
+    public void updateBinaryInputs(int[] indices, boolean[] values, byte[] flags, long[] times, EventMode mode)
+    {
+        checkLengths(indices.length, values.length, flags.length, times.length);
+        this.update_binaries_native(this.nativePointer, indices, values, flags, times, mode.toType());
+    }
+
+    @Override
+    public void updateDoubleBitBinaryInputs(int[] indices, DoubleBit[] values, byte[] flags, long[] times, EventMode mode)
+    {
+        checkLengths(indices.length, values.length, flags.length, times.length);
+        final byte[] types = new byte[values.length];
+        for(int i = 0; i < values.length; ++i)
+        {
+            types[i] = (byte) values[i].toType();
+        }
+        this.update_double_binaries_native(this.nativePointer, indices, types, flags, times, mode.toType());
+    }
+
+    @Override
+    public void updateAnalogInputs(int[] indices, double[] values, byte[] flags, long[] times, EventMode mode)
+    {
+        checkLengths(indices.length, values.length, flags.length, times.length);
+        this.update_analogs_native(this.nativePointer, indices, values, flags, times, mode.toType());
+    }
+
+    @Override
+    public void updateCounters(int[] indices, long[] values, byte[] flags, long[] times, EventMode mode)
+    {
+        checkLengths(indices.length, values.length, flags.length, times.length);
+        this.update_counters_native(this.nativePointer, indices, values, flags, times, mode.toType());
+    }
+
+    @Override
+    public void updateFrozenCounters(int[] indices, long[] values, byte[] flags, long[] times, EventMode mode)
+    {
+        checkLengths(indices.length, values.length, flags.length, times.length);
+        this.update_frozen_counters_native(this.nativePointer, indices, values, flags, times, mode.toType());
+    }
+
+    @Override
+    public void updateBinaryOutputStatuses(int[] indices, boolean[] values, byte[] flags, long[] times, EventMode mode)
+    {
+        checkLengths(indices.length, values.length, flags.length, times.length);
+        this.update_bo_statuses_native(this.nativePointer, indices, values, flags, times, mode.toType());
+    }
+
+    @Override
+    public void updateAnalogOutputStatuses(int[] indices, double[] values, byte[] flags, long[] times, EventMode mode)
+    {
+        checkLengths(indices.length, values.length, flags.length, times.length);
+        this.update_ao_statuses_native(this.nativePointer, indices, values, flags, times, mode.toType());
+    }
+
+    private static void checkLengths(int indices, int values, int flags, int times)
+    {
+        if(values != indices || flags != indices || times != indices)
+        {
+            throw new IllegalArgumentException(String.format("array lengths differ, indices: %d values: %d flags: %d times: %d", indices, values, flags, times));
+        }
+    }
+
     private native long create_instance_native();
     private native void destroy_instance_native(long nativePointer);
 
@@ -132,4 +195,12 @@ class ChangeSetImpl implements Database {
     private native void update_frozen_counter_native(long nativePointer, long value, byte flags, long time, int index, int mode);
     private native void update_bo_status_native(long nativePointer, boolean value, byte flags, long time, int index, int mode);
     private native void update_ao_status_native(long nativePointer, double value, byte flags, long time, int index, int mode);
+
+    private native void update_binaries_native(long nativePointer, int[] indices, boolean[] values, byte[] flags, long[] times, int mode);
+    private native void update_double_binaries_native(long nativePointer, int[] indices, byte[] values, byte[] flags, long[] times, int mode);
+    private native void update_analogs_native(long nativePointer, int[] indices, double[] values, byte[] flags, long[] times, int mode);
+    private native void update_counters_native(long nativePointer, int[] indices, long[] values, byte[] flags, long[] times, int mode);
+    private native void update_frozen_counters_native(long nativePointer, int[] indices, long[] values, byte[] flags, long[] times, int mode);
+    private native void update_bo_statuses_native(long nativePointer, int[] indices, boolean[] values, byte[] flags, long[] times, int mode);
+    private native void update_ao_statuses_native(long nativePointer, int[] indices, double[] values, byte[] flags, long[] times, int mode);
 }
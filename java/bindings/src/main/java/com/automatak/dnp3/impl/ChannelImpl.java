@@ -62,6 +62,19 @@ class ChannelImpl implements Channel {
         return new MasterImpl(ret);
     }
 
+    @Override
+    public synchronized Master addMaster(String id, BulkSOEHandler handler, MasterApplication application, MasterStackConfig config) throws DNP3Exception
+    {
+        long ret = get_native_bulk_master(nativePointer, id, new BulkSOEHandlerProxy(handler), application, config);
+
+        if(ret == 0)
+        {
+            throw new DNP3Exception("Unable to create master");
+        }
+
+        return new MasterImpl(ret);
+    }
+
     @Override
     public synchronized Outstation addOutstation(String id, CommandHandler commandHandler, OutstationApplication application, OutstationStackConfig config) throws DNP3Exception
     {
@@ -86,5 +99,6 @@ class ChannelImpl implements Channel {
     private native void shutdown_native(long nativePointer);
     private native void destroy_native(long nativePointer);
     private native long get_native_master(long nativePointer, String id, SOEHandler handler, MasterApplication application, MasterStackConfig config);
+    private native long get_native_bulk_master(long nativePointer, String id, BulkSOEHandlerProxy handler, MasterApplication application, MasterStackConfig config);
     private native long get_native_outstation(long nativePointer, String id, CommandHandler commandHandler, OutstationApplication application, OutstationStackConfig config);
 }
@@ -0,0 +1,120 @@
+/**
+ * Copyright 2013-2016 Automatak, LLC
+ *
+ * Licensed to Automatak, LLC (www.automatak.com) under one or more
+ * contributor license agreements. See the NOTICE file distributed with this
+ * work for additional information regarding copyright ownership. Automatak, LLC
+ * licenses this file to you under the Apache License Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0.html
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package com.automatak.dnp3.impl;
+
+import com.automatak.dnp3.MeasurementBatch;
+import com.automatak.dnp3.enums.DoubleBit;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+/**
+ * Reads the columns that the native BulkSOEHandlerAdapter writes into a buffer with room for 'capacity' values:
+ *
+ * [times: 8 * capacity][values: 8 * capacity][indices: 2 * capacity][flags: capacity]
+ */
+final class MeasurementBatchImpl implements MeasurementBatch
+{
+    private static final Type[] types = Type.values();
+
+    private ByteBuffer buffer = ByteBuffer.allocateDirect(0);
+    private int valuesOffset = 0;
+    private int indicesOffset = 0;
+    private int flagsOffset = 0;
+
+    private Type type = Type.BINARY_INPUT;
+    private int count = 0;
+
+    void setBuffer(ByteBuffer buffer, int capacity)
+    {
+        this.buffer = buffer.order(ByteOrder.nativeOrder());
+        this.valuesOffset = 8 * capacity;
+        this.indicesOffset = 16 * capacity;
+        this.flagsOffset = 18 * capacity;
+    }
+
+    void reset(int type, int count)
+    {
+        this.type = types[type];
+        this.count = count;
+    }
+
+    @Override
+    public Type getType()
+    {
+        return type;
+    }
+
+    @Override
+    public int size()
+    {
+        return count;
+    }
+
+    @Override
+    public int getIndex(int i)
+    {
+        return buffer.getShort(indicesOffset + 2 * check(i)) & 0xFFFF;
+    }
+
+    @Override
+    public double getValue(int i)
+    {
+        return buffer.getDouble(valuesOffset + 8 * check(i));
+    }
+
+    @Override
+    public boolean getBoolean(int i)
+    {
+        return getValue(i) != 0;
+    }
+
+    @Override
+    public long getCount(int i)
+    {
+        return (long) getValue(i);
+    }
+
+    @Override
+    public DoubleBit getDoubleBit(int i)
+    {
+        return DoubleBit.fromType((int) getValue(i));
+    }
+
+    @Override
+    public byte getFlags(int i)
+    {
+        return buffer.get(flagsOffset + check(i));
+    }
+
+    @Override
+    public long getTime(int i)
+    {
+        return buffer.getLong(8 * check(i));
+    }
+
+    private int check(int i)
+    {
+        if(i < 0 || i >= count)
+        {
+            throw new IndexOutOfBoundsException(String.format("%d is not within a batch of size %d", i, count));
+        }
+        return i;
+    }
+}
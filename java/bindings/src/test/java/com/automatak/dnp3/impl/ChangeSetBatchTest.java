@@ -0,0 +1,77 @@
+package com.automatak.dnp3.impl;
+
+/**
+ * Copyright 2013-2016 Automatak, LLC
+ *
+ * Licensed to Automatak, LLC (www.automatak.com) under one or more
+ * contributor license agreements. See the NOTICE file distributed with this
+ * work for additional information regarding copyright ownership. Automatak, LLC
+ * licenses this file to you under the Apache License Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0.html
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+import com.automatak.dnp3.Database;
+import com.automatak.dnp3.OutstationChangeSet;
+import com.automatak.dnp3.enums.EventMode;
+import junit.framework.TestCase;
+import org.junit.Test;
+
+public class ChangeSetBatchTest extends TestCase {
+
+    static void assertRejectsMismatchedLengths(Database db)
+    {
+        try {
+            db.updateAnalogInputs(new int[2], new double[2], new byte[2], new long[1], EventMode.Force);
+            fail("mismatched array lengths were accepted");
+        }
+        catch(IllegalArgumentException ex) {
+        }
+    }
+
+    @Test
+    public void testOutstationChangeSetRejectsMismatchedLengths() {
+        assertRejectsMismatchedLengths(new OutstationChangeSet());
+    }
+
+    @Test
+    public void testChangeSetImplRejectsMismatchedLengths() {
+        // the manager loads the native library that ChangeSetImpl depends on
+        DNP3ManagerIntegrationTest.withManager(1, manager -> assertRejectsMismatchedLengths(new ChangeSetImpl()));
+    }
+
+    @Test
+    public void testOutstationChangeSetCopiesBatches() {
+
+        final int[] indices = { 3 };
+        final double[] values = { 4.0 };
+        final byte[] flags = { 0x01 };
+        final long[] times = { 0 };
+
+        final OutstationChangeSet set = new OutstationChangeSet();
+        set.updateAnalogInputs(indices, values, flags, times, EventMode.Force);
+
+        // changes made after the batch was added must not be applied
+        indices[0] = 7;
+        values[0] = 8.0;
+
+        final OutstationChangeSet recorded = new OutstationChangeSet() {
+            @Override
+            public void updateAnalogInputs(int[] i, double[] v, byte[] f, long[] t, EventMode mode) {
+                assertEquals(3, i[0]);
+                assertEquals(4.0, v[0], 0.0);
+                assertEquals(EventMode.Force, mode);
+            }
+        };
+
+        set.apply(recorded);
+    }
+}
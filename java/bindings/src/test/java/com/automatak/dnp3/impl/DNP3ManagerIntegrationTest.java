@@ -36,6 +36,7 @@ public class DNP3ManagerIntegrationTest extends TestCase {
     static final int NUM_ITERATIONS = 10;
     static final int EVENTS_PER_ITERATION = 50;
     static final int START_PORT = 20000;
+    static final int LARGE_HEADER_SIZE = 500;
 
     static final int NUM_THREADS_IN_POOL = 4;
     static final Duration TIMEOUT = Duration.ofSeconds(10);
@@ -53,13 +54,55 @@ public class DNP3ManagerIntegrationTest extends TestCase {
     
     @Test
     public void testEventOrdering() {
+        runEventOrdering(START_PORT, false);
+    }
+
+    @Test
+    public void testEventOrderingWithBulkHandler() {
+        runEventOrdering(START_PORT + NUM_STACKS, true);
+    }
+
+    @Test
+    public void testBulkHandlerWithLargeHeaders() {
+
+        // headers that outgrow the initial native buffer make the adapter hand Java a new one
+        withManager(NUM_THREADS_IN_POOL, manager -> {
+
+            StackPair pair = new StackPair(manager, START_PORT + 2*NUM_STACKS, LARGE_HEADER_SIZE, LARGE_HEADER_SIZE, true);
+
+            pair.waitForChannelsOpen(TIMEOUT);
+
+            for(int i = 0; i < NUM_ITERATIONS; ++i) {
+                pair.sendBinaryValues(((i + 1) * LARGE_HEADER_SIZE) / NUM_ITERATIONS);
+                pair.awaitSentValues(TIMEOUT);
+            }
+        });
+    }
+
+    @Test
+    public void testEventOrderingWithBatches() {
+
+        withManager(NUM_THREADS_IN_POOL, manager -> {
+
+            StackPair pair = new StackPair(manager, START_PORT + 2*NUM_STACKS + 1, NUM_POINTS_PER_EVENT_TYPE, EVENTS_PER_ITERATION);
+
+            pair.waitForChannelsOpen(TIMEOUT);
+
+            for(int i = 0; i < NUM_ITERATIONS; ++i) {
+                pair.sendBatchValues();
+                pair.awaitSentValues(TIMEOUT);
+            }
+        });
+    }
+
+    static void runEventOrdering(int startPort, boolean bulk) {
 
         List<StackPair> stacks = new ArrayList<>();
 
         withManager(NUM_THREADS_IN_POOL, manager ->  {
 
             for(int i = 0; i < NUM_STACKS; ++i) {
-                StackPair pair = new StackPair(manager, START_PORT+i, NUM_POINTS_PER_EVENT_TYPE, EVENTS_PER_ITERATION);
+                StackPair pair = new StackPair(manager, startPort+i, NUM_POINTS_PER_EVENT_TYPE, EVENTS_PER_ITERATION, bulk);
                 stacks.add(pair);
             }
 
@@ -77,7 +120,7 @@ public class DNP3ManagerIntegrationTest extends TestCase {
             final long TOTAL_EVENTS = NUM_STACKS*NUM_ITERATIONS*EVENTS_PER_ITERATION;
             final long RATE = (TOTAL_EVENTS * 1000)/ ELASPED_MS;
 
-            System.out.println(String.format("%d events in %d ms == %d events/sec", TOTAL_EVENTS, ELASPED_MS, RATE));
+            System.out.println(String.format("%d events in %d ms == %d events/sec%s", TOTAL_EVENTS, ELASPED_MS, RATE, bulk ? " (bulk)" : ""));
         });
 
     }
@@ -0,0 +1,323 @@
+/**
+ * Copyright 2013-2016 Automatak, LLC
+ *
+ * Licensed to Automatak, LLC (www.automatak.com) under one or more
+ * contributor license agreements. See the NOTICE file distributed with this
+ * work for additional information regarding copyright ownership. Automatak, LLC
+ * licenses this file to you under the Apache License Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0.html
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package com.automatak.dnp3.impl;
+
+import com.automatak.dnp3.*;
+import com.automatak.dnp3.enums.ChannelState;
+import com.automatak.dnp3.enums.ServerAcceptMode;
+import com.automatak.dnp3.impl.mocks.BlockingChannelListener;
+import com.automatak.dnp3.impl.mocks.NullLogHandler;
+import com.automatak.dnp3.mock.DefaultMasterApplication;
+import com.automatak.dnp3.mock.DefaultOutstationApplication;
+import com.automatak.dnp3.mock.SuccessCommandHandler;
+import org.junit.Assume;
+import org.junit.Test;
+
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+import java.time.Duration;
+import java.util.function.Function;
+
+/**
+ * Compares how quickly a master delivers integrity polls to a SOEHandler and to a BulkSOEHandler,
+ * and how much garbage each creates on the callback thread.
+ *
+ * Disabled by default, run with: mvn test -Dtest=SOEHandlerBenchmark -Ddnp3.benchmark=true
+ */
+public class SOEHandlerBenchmark {
+
+    static final int NUM_POINTS_PER_TYPE = 300;
+    static final int NUM_VALUES_PER_POLL = 7 * NUM_POINTS_PER_TYPE;
+    static final int WARMUP_POLLS = 200;
+    static final int MEASURED_POLLS = 1000;
+    static final int ROUNDS = 5;
+    static final int START_PORT = 20100;
+    static final Duration TIMEOUT = Duration.ofSeconds(10);
+
+    /**
+     * Counts the values and the bytes allocated by the callback thread between start() and end()
+     */
+    static class Meter {
+
+        private static final java.lang.management.ThreadMXBean threads = ManagementFactory.getThreadMXBean();
+
+        private long startBytes = 0;
+        private long values = 0;
+        private long bytes = 0;
+
+        static long allocatedBytes()
+        {
+            if(threads instanceof com.sun.management.ThreadMXBean)
+            {
+                return ((com.sun.management.ThreadMXBean) threads).getThreadAllocatedBytes(Thread.currentThread().getId());
+            }
+            return 0;
+        }
+
+        void start()
+        {
+            this.startBytes = allocatedBytes();
+        }
+
+        synchronized void add(int count)
+        {
+            this.values += count;
+        }
+
+        synchronized void end()
+        {
+            this.bytes += allocatedBytes() - this.startBytes;
+            this.notifyAll();
+        }
+
+        synchronized void reset()
+        {
+            this.values = 0;
+            this.bytes = 0;
+        }
+
+        synchronized long getBytes()
+        {
+            return this.bytes;
+        }
+
+        synchronized void await(long count, Duration duration) throws InterruptedException
+        {
+            final long deadline = System.currentTimeMillis() + duration.toMillis();
+            while(this.values < count)
+            {
+                final long remaining = deadline - System.currentTimeMillis();
+                if(remaining <= 0)
+                {
+                    throw new RuntimeException(String.format("Only received %d of %d values within timeout", this.values, count));
+                }
+                this.wait(remaining);
+            }
+        }
+    }
+
+    /**
+     * Touches every value the way an application would, through the object API
+     */
+    static class CountingSOEHandler implements SOEHandler {
+
+        final Meter meter = new Meter();
+        double sum = 0;
+
+        private <T extends Measurement> void count(Iterable<IndexedValue<T>> values)
+        {
+            int count = 0;
+            for(IndexedValue<T> value : values)
+            {
+                sum += value.index + value.value.quality;
+                ++count;
+            }
+            meter.add(count);
+        }
+
+        @Override
+        public void start() { meter.start(); }
+
+        @Override
+        public void end() { meter.end(); }
+
+        @Override
+        public void processBI(HeaderInfo info, Iterable<IndexedValue<BinaryInput>> values) { count(values); }
+
+        @Override
+        public void processDBI(HeaderInfo info, Iterable<IndexedValue<DoubleBitBinaryInput>> values) { count(values); }
+
+        @Override
+        public void processAI(HeaderInfo info, Iterable<IndexedValue<AnalogInput>> values) { count(values); }
+
+        @Override
+        public void processC(HeaderInfo info, Iterable<IndexedValue<Counter>> values) { count(values); }
+
+        @Override
+        public void processFC(HeaderInfo info, Iterable<IndexedValue<FrozenCounter>> values) { count(values); }
+
+        @Override
+        public void processBOS(HeaderInfo info, Iterable<IndexedValue<BinaryOutputStatus>> values) { count(values); }
+
+        @Override
+        public void processAOS(HeaderInfo info, Iterable<IndexedValue<AnalogOutputStatus>> values) { count(values); }
+
+        @Override
+        public void processDNPTime(HeaderInfo info, Iterable<DNPTime> values) {}
+    }
+
+    /**
+     * Touches the same fields through the batch API
+     */
+    static class CountingBulkSOEHandler implements BulkSOEHandler {
+
+        final Meter meter = new Meter();
+        double sum = 0;
+
+        @Override
+        public void start() { meter.start(); }
+
+        @Override
+        public void end() { meter.end(); }
+
+        @Override
+        public void process(HeaderInfo info, MeasurementBatch batch)
+        {
+            if(batch.getType() == MeasurementBatch.Type.DNP_TIME)
+            {
+                return;
+            }
+
+            for(int i = 0; i < batch.size(); ++i)
+            {
+                sum += batch.getIndex(i) + batch.getFlags(i);
+            }
+            meter.add(batch.size());
+        }
+    }
+
+    static long totalCollections()
+    {
+        long total = 0;
+        for(GarbageCollectorMXBean bean : ManagementFactory.getGarbageCollectorMXBeans())
+        {
+            total += Math.max(0, bean.getCollectionCount());
+        }
+        return total;
+    }
+
+    static class Sample {
+        double pollsPerSecond;
+        double bytesPerValue;
+        long collections;
+    }
+
+    static Sample measure(Master master, Meter meter, int polls) throws InterruptedException
+    {
+        meter.reset();
+        final long collections = totalCollections();
+        final long start = System.nanoTime();
+
+        for(int i = 1; i <= polls; ++i)
+        {
+            master.scan(Header.getIntegrity());
+            meter.await((long) i * NUM_VALUES_PER_POLL, TIMEOUT);
+        }
+
+        final Sample sample = new Sample();
+        sample.pollsPerSecond = polls / ((System.nanoTime() - start) / 1e9);
+        sample.bytesPerValue = meter.getBytes() / ((double) polls * NUM_VALUES_PER_POLL);
+        sample.collections = totalCollections() - collections;
+        return sample;
+    }
+
+    static void run(String name, int port, Function<Channel, Master> addMaster, Meter meter) throws Exception
+    {
+        final DNP3Manager manager = DNP3ManagerFactory.createManager(1, new NullLogHandler());
+
+        try {
+
+            final BlockingChannelListener clientListener = new BlockingChannelListener();
+            final BlockingChannelListener serverListener = new BlockingChannelListener();
+
+            final Channel client = manager.addTCPClient(
+                    String.format("client:%d", port), LogLevels.ERROR | LogLevels.WARNING, ChannelRetry.getDefault(), "127.0.0.1", "127.0.0.1", port, clientListener);
+
+            final Channel server = manager.addTCPServer(
+                    String.format("server:%d", port), LogLevels.ERROR | LogLevels.WARNING, ServerAcceptMode.CloseExisting, "127.0.0.1", port, serverListener);
+
+            final Outstation outstation = server.addOutstation(
+                    String.format("outstation:%d", port),
+                    SuccessCommandHandler.getInstance(),
+                    DefaultOutstationApplication.getInstance(),
+                    new OutstationStackConfig(DatabaseConfig.allValues(NUM_POINTS_PER_TYPE), EventBufferConfig.allTypes(0)));
+
+            final Master master = addMaster.apply(client);
+
+            outstation.enable();
+            master.enable();
+
+            clientListener.waitFor(ChannelState.OPEN, TIMEOUT);
+            serverListener.waitFor(ChannelState.OPEN, TIMEOUT);
+
+            measure(master, meter, WARMUP_POLLS);
+
+            final double[] rates = new double[ROUNDS];
+            double bytesPerValue = 0;
+            long collections = 0;
+
+            for(int i = 0; i < ROUNDS; ++i)
+            {
+                final Sample sample = measure(master, meter, MEASURED_POLLS);
+                rates[i] = sample.pollsPerSecond;
+                bytesPerValue += sample.bytesPerValue / ROUNDS;
+                collections += sample.collections;
+            }
+
+            double mean = 0;
+            for(double rate : rates) mean += rate / ROUNDS;
+            double variance = 0;
+            for(double rate : rates) variance += (rate - mean) * (rate - mean) / ROUNDS;
+            final double sd = Math.sqrt(variance);
+
+            System.out.println(String.format(
+                    "%-16s %8.1f +/- %6.1f polls/sec %12.0f values/sec %10.1f bytes/value %6d GCs",
+                    name, mean, sd, mean * NUM_VALUES_PER_POLL, bytesPerValue, collections
+            ));
+        }
+        finally {
+            manager.shutdown();
+        }
+    }
+
+    static MasterStackConfig getMasterStackConfig()
+    {
+        final MasterStackConfig config = new MasterStackConfig();
+        config.master.startupIntegrityClassMask = ClassField.none();
+        config.master.unsolClassMask = ClassField.none();
+        return config;
+    }
+
+    @Test
+    public void compareHandlers() throws Exception
+    {
+        Assume.assumeTrue(Boolean.getBoolean("dnp3.benchmark"));
+
+        final CountingSOEHandler objects = new CountingSOEHandler();
+        final CountingBulkSOEHandler bulk = new CountingBulkSOEHandler();
+
+        run("SOEHandler", START_PORT, channel -> {
+            try {
+                return channel.addMaster("master", objects, DefaultMasterApplication.getInstance(), getMasterStackConfig());
+            }
+            catch(DNP3Exception ex) {
+                throw new RuntimeException(ex);
+            }
+        }, objects.meter);
+
+        run("BulkSOEHandler", START_PORT + 1, channel -> {
+            try {
+                return channel.addMaster("master", bulk, DefaultMasterApplication.getInstance(), getMasterStackConfig());
+            }
+            catch(DNP3Exception ex) {
+                throw new RuntimeException(ex);
+            }
+        }, bulk.meter);
+    }
+}
@@ -0,0 +1,94 @@
+/**
+ * Copyright 2013-2016 Automatak, LLC
+ *
+ * Licensed to Automatak, LLC (www.automatak.com) under one or more
+ * contributor license agreements. See the NOTICE file distributed with this
+ * work for additional information regarding copyright ownership. Automatak, LLC
+ * licenses this file to you under the Apache License Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0.html
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+package com.automatak.dnp3.impl.mocks;
+
+import com.automatak.dnp3.*;
+
+import java.time.Duration;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.LinkedBlockingQueue;
+import java.util.concurrent.TimeUnit;
+
+public class QueuedBulkSOEHandler implements BulkSOEHandler {
+
+    final LinkedBlockingQueue<List<ExpectedValue>> items = new LinkedBlockingQueue<>();
+    List<ExpectedValue> temp = null;
+
+    public List<ExpectedValue> waitForValues(Duration duration)
+    {
+        try
+        {
+            return items.poll(duration.toMillis(), TimeUnit.MILLISECONDS);
+        }
+        catch(InterruptedException ex)
+        {
+            throw new RuntimeException(ex);
+        }
+    }
+
+    @Override
+    public void start()
+    {
+        this.temp = new ArrayList<>();
+    }
+
+    @Override
+    public void end()
+    {
+        this.items.add(this.temp);
+        this.temp = null;
+    }
+
+    @Override
+    public void process(HeaderInfo info, MeasurementBatch batch)
+    {
+        for(int i = 0; i < batch.size(); ++i)
+        {
+            final int index = batch.getIndex(i);
+
+            switch(batch.getType())
+            {
+                case BINARY_INPUT:
+                    this.temp.add(new ExpectedValue(batch.getBoolean(i) ? 1 : 0, index, ExpectedValue.Type.BinaryType));
+                    break;
+                case DOUBLE_BIT_BINARY_INPUT:
+                    this.temp.add(new ExpectedValue(batch.getDoubleBit(i).toType(), index, ExpectedValue.Type.DoubleBinaryType));
+                    break;
+                case ANALOG_INPUT:
+                    this.temp.add(new ExpectedValue((long) batch.getValue(i), index, ExpectedValue.Type.AnalogType));
+                    break;
+                case COUNTER:
+                    this.temp.add(new ExpectedValue(batch.getCount(i), index, ExpectedValue.Type.CounterType));
+                    break;
+                case FROZEN_COUNTER:
+                    this.temp.add(new ExpectedValue(batch.getCount(i), index, ExpectedValue.Type.FrozenCounterType));
+                    break;
+                case BINARY_OUTPUT_STATUS:
+                    this.temp.add(new ExpectedValue(batch.getBoolean(i) ? 1 : 0, index, ExpectedValue.Type.BOStatusType));
+                    break;
+                case ANALOG_OUTPUT_STATUS:
+                    this.temp.add(new ExpectedValue((long) batch.getValue(i), index, ExpectedValue.Type.AOStatusType));
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+}
@@ -71,9 +71,15 @@ public class StackPair {
     }
 
     public StackPair(DNP3Manager manager, int port, int numPointsPerType, int eventsPerIteration)
+    {
+        this(manager, port, numPointsPerType, eventsPerIteration, false);
+    }
+
+    public StackPair(DNP3Manager manager, int port, int numPointsPerType, int eventsPerIteration, boolean bulk)
     {
         this.NUM_POINTS_PER_TYPE = numPointsPerType;
         this.EVENTS_PER_ITERATION = eventsPerIteration;
+        this.bulk = bulk;
 
         try {
 
@@ -94,11 +100,17 @@ public class StackPair {
                     port,
                     serverListener);
 
-            this.master = client.addMaster(
-                    String.format("master:%d", port),
-                    this.soeHandler,
-                    DefaultMasterApplication.getInstance(),
-                    getMasterStackConfig());
+            this.master = bulk ?
+                    client.addMaster(
+                        String.format("master:%d", port),
+                        this.bulkSOEHandler,
+                        DefaultMasterApplication.getInstance(),
+                        getMasterStackConfig()) :
+                    client.addMaster(
+                        String.format("master:%d", port),
+                        this.soeHandler,
+                        DefaultMasterApplication.getInstance(),
+                        getMasterStackConfig());
 
             this.outstation = server.addOutstation(
                     String.format("outstation:%d", port),
@@ -138,11 +150,126 @@ public class StackPair {
         return this.EVENTS_PER_ITERATION;
     }
 
+    // transmit random values of every type through the array based batch methods, one batch per type
+    public int sendBatchValues()
+    {
+        final OutstationChangeSet set = new OutstationChangeSet();
+        final int count = this.EVENTS_PER_ITERATION / ExpectedValue.ALL_TYPES.length;
+
+        final int[] indices = new int[count];
+        final byte[] flags = new byte[count];
+        final long[] times = new long[count];
+
+        for(int i = 0; i < count; ++i)
+        {
+            flags[i] = 0x01;
+        }
+
+        for(ExpectedValue.Type type : ExpectedValue.ALL_TYPES)
+        {
+            for(int i = 0; i < count; ++i)
+            {
+                indices[i] = random.nextInt(NUM_POINTS_PER_TYPE);
+            }
+
+            switch(type)
+            {
+                case BinaryType: {
+                    boolean[] values = new boolean[count];
+                    for(int i = 0; i < count; ++i) {
+                        values[i] = random.nextBoolean();
+                        this.sentValues.add(new ExpectedValue(new BinaryInput(values[i], flags[i], times[i]), indices[i]));
+                    }
+                    set.updateBinaryInputs(indices, values, flags, times, EventMode.Force);
+                    break;
+                }
+                case DoubleBinaryType: {
+                    DoubleBit[] values = new DoubleBit[count];
+                    for(int i = 0; i < count; ++i) {
+                        values[i] = getRandomElement(DoubleBit.values());
+                        this.sentValues.add(new ExpectedValue(new DoubleBitBinaryInput(values[i], flags[i], times[i]), indices[i]));
+                    }
+                    set.updateDoubleBitBinaryInputs(indices, values, flags, times, EventMode.Force);
+                    break;
+                }
+                case CounterType: {
+                    long[] values = new long[count];
+                    for(int i = 0; i < count; ++i) {
+                        values[i] = random.nextInt(65535);
+                        this.sentValues.add(new ExpectedValue(new Counter(values[i], flags[i], times[i]), indices[i]));
+                    }
+                    set.updateCounters(indices, values, flags, times, EventMode.Force);
+                    break;
+                }
+                case FrozenCounterType: {
+                    long[] values = new long[count];
+                    for(int i = 0; i < count; ++i) {
+                        values[i] = random.nextInt(65535);
+                        this.sentValues.add(new ExpectedValue(new FrozenCounter(values[i], flags[i], times[i]), indices[i]));
+                    }
+                    set.updateFrozenCounters(indices, values, flags, times, EventMode.Force);
+                    break;
+                }
+                case AnalogType: {
+                    double[] values = new double[count];
+                    for(int i = 0; i < count; ++i) {
+                        values[i] = random.nextInt(65535);
+                        this.sentValues.add(new ExpectedValue(new AnalogInput(values[i], flags[i], times[i]), indices[i]));
+                    }
+                    set.updateAnalogInputs(indices, values, flags, times, EventMode.Force);
+                    break;
+                }
+                case BOStatusType: {
+                    boolean[] values = new boolean[count];
+                    for(int i = 0; i < count; ++i) {
+                        values[i] = random.nextBoolean();
+                        this.sentValues.add(new ExpectedValue(new BinaryOutputStatus(values[i], flags[i], times[i]), indices[i]));
+                    }
+                    set.updateBinaryOutputStatuses(indices, values, flags, times, EventMode.Force);
+                    break;
+                }
+                case AOStatusType: {
+                    double[] values = new double[count];
+                    for(int i = 0; i < count; ++i) {
+                        values[i] = random.nextInt(65535);
+                        this.sentValues.add(new ExpectedValue(new AnalogOutputStatus(values[i], flags[i], times[i]), indices[i]));
+                    }
+                    set.updateAnalogOutputStatuses(indices, values, flags, times, EventMode.Force);
+                    break;
+                }
+                default:
+                    throw new RuntimeException("unknown type: " + type);
+            }
+        }
+
+        this.outstation.apply(set);
+
+        return count * ExpectedValue.ALL_TYPES.length;
+    }
+
+    // transmit a run of binary events that the master receives as a single header
+    public int sendBinaryValues(int count)
+    {
+        final OutstationChangeSet set = new OutstationChangeSet();
+
+        for(int i = 0; i < count; ++i)
+        {
+            final int index = i % NUM_POINTS_PER_TYPE;
+            BinaryInput v = new BinaryInput(random.nextBoolean(), (byte) 0x01, 0);
+            set.update(v, index, EventMode.Force);
+            this.sentValues.add(new ExpectedValue(v, index));
+        }
+
+        this.outstation.apply(set);
+
+        return count;
+    }
+
     public void awaitSentValues(Duration duration)
     {
         final int total = sentValues.size();
 
-        List<ExpectedValue> receivedValues = soeHandler.waitForValues(duration);
+        List<ExpectedValue> receivedValues = bulk ? bulkSOEHandler.waitForValues(duration) : soeHandler.waitForValues(duration);
 
         if(receivedValues == null)
         {
@@ -229,6 +356,8 @@ public class StackPair {
     final BlockingChannelListener clientListener = new BlockingChannelListener();
     final BlockingChannelListener serverListener = new BlockingChannelListener();
     final QueuedSOEHandler soeHandler = new QueuedSOEHandler();
+    final QueuedBulkSOEHandler bulkSOEHandler = new QueuedBulkSOEHandler();
+    final boolean bulk;
     final Queue<ExpectedValue> sentValues = new ArrayDeque<>();
     final Random random = new Random(0);
 
@@ -4,6 +4,7 @@ import java.util.concurrent.CompletableFuture
 
 import com.automatak.dnp3._
 import com.automatak.dnp3.enums._
+import com.automatak.dnp3.impl.BulkSOEHandlerProxy
 
 /// a cache for class names
 object Classes {
@@ -124,7 +125,8 @@ object Classes {
     ClassConfig(classOf[LinkLayerStatistics], Set(Features.Constructors)),
     ClassConfig(classOf[TransportStatistics], Set(Features.Constructors)),
     ClassConfig(classOf[StackStatistics], Set(Features.Constructors)),
-    ClassConfig(classOf[IPEndpoint], Set(Features.Fields))
+    ClassConfig(classOf[IPEndpoint], Set(Features.Fields)),
+    ClassConfig(classOf[BulkSOEHandlerProxy], Set(Features.Methods))
   )
 
 
@@ -0,0 +1,163 @@
+/**
+ * Copyright 2013 Automatak, LLC
+ *
+ * Licensed to Automatak, LLC (www.automatak.com) under one or more
+ * contributor license agreements. See the NOTICE file distributed with this
+ * work for additional information regarding copyright ownership. Automatak, LLC
+ * licenses this file to you under the Apache License Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0.html
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#include "BulkSOEHandlerAdapter.h"
+
+#include "../jni/JCache.h"
+
+#include <algorithm>
+
+using namespace opendnp3;
+
+namespace
+{
+// bytes per value across all four columns
+const uint32_t BYTES_PER_VALUE = sizeof(int64_t) + sizeof(double) + sizeof(uint16_t) + sizeof(uint8_t);
+
+// smallest buffer ever allocated, enough for a typical event response without growing
+const uint32_t MIN_CAPACITY = 256;
+}
+
+void BulkSOEHandlerAdapter::Start()
+{
+	jni::JCache::BulkSOEHandlerProxy.start(JNI::GetEnv(), proxy);
+}
+
+void BulkSOEHandlerAdapter::End()
+{
+	jni::JCache::BulkSOEHandlerProxy.end(JNI::GetEnv(), proxy);
+}
+
+template <class T, class GetValue>
+void BulkSOEHandlerAdapter::Process(const HeaderInfo& info, const ICollection<Indexed<T>>& values, BatchType type, const GetValue& getValue)
+{
+	const auto env = JNI::GetEnv();
+	const auto count = static_cast<uint32_t>(values.Count());
+
+	this->Reserve(env, count);
+
+	uint32_t i = 0;
+	auto add = [&](const Indexed<T>& meas)
+	{
+		this->timeColumn[i] = meas.value.time;
+		this->valueColumn[i] = getValue(meas.value);
+		this->indexColumn[i] = meas.index;
+		this->flagColumn[i] = meas.value.flags.value;
+		++i;
+	};
+
+	values.ForeachItem(add);
+
+	this->Upcall(env, info, type, i);
+}
+
+void BulkSOEHandlerAdapter::Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values)
+{
+	this->Process(info, values, BatchType::BinaryInput, [](const Binary & value) -> double { return value.value ? 1 : 0; });
+}
+
+void BulkSOEHandlerAdapter::Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values)
+{
+	this->Process(info, values, BatchType::DoubleBitBinaryInput, [](const DoubleBitBinary & value) -> double { return DoubleBitToType(value.value); });
+}
+
+void BulkSOEHandlerAdapter::Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values)
+{
+	this->Process(info, values, BatchType::AnalogInput, [](const Analog & value) -> double { return value.value; });
+}
+
+void BulkSOEHandlerAdapter::Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values)
+{
+	this->Process(info, values, BatchType::Counter, [](const Counter & value) -> double { return value.value; });
+}
+
+void BulkSOEHandlerAdapter::Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values)
+{
+	this->Process(info, values, BatchType::FrozenCounter, [](const FrozenCounter & value) -> double { return value.value; });
+}
+
+void BulkSOEHandlerAdapter::Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values)
+{
+	this->Process(info, values, BatchType::BinaryOutputStatus, [](const BinaryOutputStatus & value) -> double { return value.value ? 1 : 0; });
+}
+
+void BulkSOEHandlerAdapter::Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values)
+{
+	this->Process(info, values, BatchType::AnalogOutputStatus, [](const AnalogOutputStatus & value) -> double { return value.value; });
+}
+
+void BulkSOEHandlerAdapter::Process(const HeaderInfo& info, const ICollection<DNPTime>& values)
+{
+	const auto env = JNI::GetEnv();
+	const auto count = static_cast<uint32_t>(values.Count());
+
+	this->Reserve(env, count);
+
+	uint32_t i = 0;
+	auto add = [&](const DNPTime & value)
+	{
+		this->timeColumn[i] = value;
+		this->valueColumn[i] = 0;
+		this->indexColumn[i] = 0;
+		this->flagColumn[i] = 0;
+		++i;
+	};
+
+	values.ForeachItem(add);
+
+	this->Upcall(env, info, BatchType::DNPTime, i);
+}
+
+void BulkSOEHandlerAdapter::Reserve(JNIEnv* env, uint32_t count)
+{
+	if (count <= this->capacity)
+	{
+		return;
+	}
+
+	const auto newCapacity = std::max(std::max(count, 2 * this->capacity), MIN_CAPACITY);
+	std::unique_ptr<uint8_t[]> newBuffer(new uint8_t[newCapacity * BYTES_PER_VALUE]);
+
+	LocalRef<jobject> jbuffer(env, env->NewDirectByteBuffer(newBuffer.get(), static_cast<jlong>(newCapacity) * BYTES_PER_VALUE));
+	jni::JCache::BulkSOEHandlerProxy.setBuffer(env, proxy, jbuffer, static_cast<jint>(newCapacity));
+
+	this->buffer = std::move(newBuffer);
+	this->capacity = newCapacity;
+
+	// the 8-byte columns come first so that every column is naturally aligned
+	this->timeColumn = reinterpret_cast<int64_t*>(this->buffer.get());
+	this->valueColumn = reinterpret_cast<double*>(this->buffer.get() + 8 * newCapacity);
+	this->indexColumn = reinterpret_cast<uint16_t*>(this->buffer.get() + 16 * newCapacity);
+	this->flagColumn = this->buffer.get() + 18 * newCapacity;
+}
+
+void BulkSOEHandlerAdapter::Upcall(JNIEnv* env, const HeaderInfo& info, BatchType type, uint32_t count)
+{
+	jni::JCache::BulkSOEHandlerProxy.process(
+	    env,
+	    proxy,
+	    GroupVariationToType(info.gv),
+	    QualifierCodeToType(info.qualifier),
+	    static_cast<jint>(info.tsmode),
+	    info.isEventVariation,
+	    info.flagsValid,
+	    info.headerIndex,
+	    static_cast<jint>(type),
+	    static_cast<jint>(count)
+	);
+}
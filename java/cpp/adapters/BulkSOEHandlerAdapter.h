@@ -0,0 +1,90 @@
+/**
+ * Copyright 2013 Automatak, LLC
+ *
+ * Licensed to Automatak, LLC (www.automatak.com) under one or more
+ * contributor license agreements. See the NOTICE file distributed with this
+ * work for additional information regarding copyright ownership. Automatak, LLC
+ * licenses this file to you under the Apache License Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0.html
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef OPENDNP3_BULKSOEHANDLERADAPTER_H
+#define OPENDNP3_BULKSOEHANDLERADAPTER_H
+
+#include <opendnp3/master/ISOEHandler.h>
+
+#include "GlobalRef.h"
+#include "LocalRef.h"
+
+#include <memory>
+
+/**
+* Delivers each header to a Java BulkSOEHandler as columns in a direct ByteBuffer shared with Java,
+* with a single upcall per header and no Java objects created per value.
+*/
+class BulkSOEHandlerAdapter final : public opendnp3::ISOEHandler
+{
+public:
+
+	BulkSOEHandlerAdapter(jobject proxy) : proxy(proxy) {}
+
+	virtual void Start() override;
+	virtual void End() override;
+
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::Binary>>& values) override;
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::DoubleBitBinary>>& values) override;
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::Analog>>& values) override;
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::Counter>>& values) override;
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::FrozenCounter>>& values) override;
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::BinaryOutputStatus>>& values) override;
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::AnalogOutputStatus>>& values) override;
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::OctetString>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::TimeAndInterval>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::BinaryCommandEvent>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::AnalogCommandEvent>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<opendnp3::SecurityStat>>& values) override {}
+	virtual void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::DNPTime>& values) override;
+
+private:
+
+	// ordinals of MeasurementBatch.Type in the Java bindings
+	enum class BatchType : jint
+	{
+		BinaryInput = 0,
+		DoubleBitBinaryInput = 1,
+		AnalogInput = 2,
+		Counter = 3,
+		FrozenCounter = 4,
+		BinaryOutputStatus = 5,
+		AnalogOutputStatus = 6,
+		DNPTime = 7
+	};
+
+	template <class T, class GetValue>
+	void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::Indexed<T>>& values, BatchType type, const GetValue& getValue);
+
+	// make room for at least count values, handing any new buffer to Java before the old one is released
+	void Reserve(JNIEnv* env, uint32_t count);
+
+	void Upcall(JNIEnv* env, const opendnp3::HeaderInfo& info, BatchType type, uint32_t count);
+
+	GlobalRef proxy;
+
+	// layout shared with MeasurementBatchImpl: [times][values][indices][flags]
+	std::unique_ptr<uint8_t[]> buffer;
+	uint32_t capacity = 0;
+	int64_t* timeColumn = nullptr;
+	double* valueColumn = nullptr;
+	uint16_t* indexColumn = nullptr;
+	uint8_t* flagColumn = nullptr;
+};
+
+#endif
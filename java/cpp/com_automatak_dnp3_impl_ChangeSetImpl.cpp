@@ -20,9 +20,89 @@
 
 #include "asiodnp3/UpdateBuilder.h"
 
+#include "adapters/LocalRef.h"
+
+#include <string>
+#include <vector>
+
 using namespace opendnp3;
 using namespace asiodnp3;
 
+namespace
+{
+
+void ThrowNew(JNIEnv* env, const char* className, const std::string& message)
+{
+	// if the class can't be found, FindClass has already left an exception pending
+	LocalRef<jclass> clazz(env, env->FindClass(className));
+	if (clazz)
+	{
+		env->ThrowNew(clazz, message.c_str());
+	}
+}
+
+/// Copy a batch out of the Java arrays and add it to the builder as a single update
+template <class T, class V, class Converter>
+void UpdateBatch(JNIEnv* env, jlong native, jintArray indices, jarray values, jbyteArray flags, jlongArray times, jint mode, const Converter& convert)
+{
+	const auto count = env->GetArrayLength(indices);
+	const auto numValues = env->GetArrayLength(values);
+	const auto numFlags = env->GetArrayLength(flags);
+	const auto numTimes = env->GetArrayLength(times);
+
+	// the loop below reads all four arrays up to count
+	if (numValues != count || numFlags != count || numTimes != count)
+	{
+		ThrowNew(
+		    env,
+		    "java/lang/IllegalArgumentException",
+		    "array lengths differ, indices: " + std::to_string(count) + " values: " + std::to_string(numValues) +
+		    " flags: " + std::to_string(numFlags) + " times: " + std::to_string(numTimes)
+		);
+		return;
+	}
+
+	std::vector<Indexed<T>> batch;
+	batch.reserve(count);
+
+	// no other JNI calls are allowed until the arrays are released
+	const auto pIndices = static_cast<jint*>(env->GetPrimitiveArrayCritical(indices, nullptr));
+	const auto pValues = static_cast<V*>(env->GetPrimitiveArrayCritical(values, nullptr));
+	const auto pFlags = static_cast<jbyte*>(env->GetPrimitiveArrayCritical(flags, nullptr));
+	const auto pTimes = static_cast<jlong*>(env->GetPrimitiveArrayCritical(times, nullptr));
+
+	const bool pinned = pIndices && pValues && pFlags && pTimes;
+
+	if (pinned)
+	{
+		for (jsize i = 0; i < count; ++i)
+		{
+			batch.push_back(WithIndex(convert(pValues[i], pFlags[i], DNPTime(pTimes[i])), static_cast<uint16_t>(pIndices[i])));
+		}
+	}
+
+	// read only, so nothing needs to be copied back
+	if (pTimes) env->ReleasePrimitiveArrayCritical(times, pTimes, JNI_ABORT);
+	if (pFlags) env->ReleasePrimitiveArrayCritical(flags, pFlags, JNI_ABORT);
+	if (pValues) env->ReleasePrimitiveArrayCritical(values, pValues, JNI_ABORT);
+	if (pIndices) env->ReleasePrimitiveArrayCritical(indices, pIndices, JNI_ABORT);
+
+	if (!pinned)
+	{
+		// the VM normally leaves an OutOfMemoryError pending, but the spec doesn't require it
+		if (!env->ExceptionCheck())
+		{
+			ThrowNew(env, "java/lang/OutOfMemoryError", "unable to access the batch arrays");
+		}
+		return;
+	}
+
+	const auto changes = (UpdateBuilder*) native;
+	changes->Update(std::move(batch), static_cast<EventMode>(mode));
+}
+
+}
+
 JNIEXPORT jlong JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_create_1instance_1native
 (JNIEnv* env, jobject)
 {
@@ -88,3 +168,65 @@ JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_update_1ao_1st
 	changes->Update(AnalogOutputStatus(value, flags, DNPTime(time)), static_cast<uint16_t>(index), static_cast<EventMode>(mode));
 }
 
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_update_1binaries_1native
+(JNIEnv* env, jobject, jlong native, jintArray indices, jbooleanArray values, jbyteArray flags, jlongArray times, jint mode)
+{
+	UpdateBatch<Binary, jboolean>(env, native, indices, values, flags, times, mode, [](jboolean value, jbyte flags, DNPTime time)
+	{
+		return Binary(!!value, flags, time);
+	});
+}
+
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_update_1double_1binaries_1native
+(JNIEnv* env, jobject, jlong native, jintArray indices, jbyteArray values, jbyteArray flags, jlongArray times, jint mode)
+{
+	UpdateBatch<DoubleBitBinary, jbyte>(env, native, indices, values, flags, times, mode, [](jbyte value, jbyte flags, DNPTime time)
+	{
+		return DoubleBitBinary(static_cast<DoubleBit>(value), flags, time);
+	});
+}
+
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_update_1analogs_1native
+(JNIEnv* env, jobject, jlong native, jintArray indices, jdoubleArray values, jbyteArray flags, jlongArray times, jint mode)
+{
+	UpdateBatch<Analog, jdouble>(env, native, indices, values, flags, times, mode, [](jdouble value, jbyte flags, DNPTime time)
+	{
+		return Analog(value, flags, time);
+	});
+}
+
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_update_1counters_1native
+(JNIEnv* env, jobject, jlong native, jintArray indices, jlongArray values, jbyteArray flags, jlongArray times, jint mode)
+{
+	UpdateBatch<Counter, jlong>(env, native, indices, values, flags, times, mode, [](jlong value, jbyte flags, DNPTime time)
+	{
+		return Counter(static_cast<uint32_t>(value), flags, time);
+	});
+}
+
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_update_1frozen_1counters_1native
+(JNIEnv* env, jobject, jlong native, jintArray indices, jlongArray values, jbyteArray flags, jlongArray times, jint mode)
+{
+	UpdateBatch<FrozenCounter, jlong>(env, native, indices, values, flags, times, mode, [](jlong value, jbyte flags, DNPTime time)
+	{
+		return FrozenCounter(static_cast<uint32_t>(value), flags, time);
+	});
+}
+
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_update_1bo_1statuses_1native
+(JNIEnv* env, jobject, jlong native, jintArray indices, jbooleanArray values, jbyteArray flags, jlongArray times, jint mode)
+{
+	UpdateBatch<BinaryOutputStatus, jboolean>(env, native, indices, values, flags, times, mode, [](jboolean value, jbyte flags, DNPTime time)
+	{
+		return BinaryOutputStatus(!!value, flags, time);
+	});
+}
+
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_update_1ao_1statuses_1native
+(JNIEnv* env, jobject, jlong native, jintArray indices, jdoubleArray values, jbyteArray flags, jlongArray times, jint mode)
+{
+	UpdateBatch<AnalogOutputStatus, jdouble>(env, native, indices, values, flags, times, mode, [](jdouble value, jbyte flags, DNPTime time)
+	{
+		return AnalogOutputStatus(value, flags, time);
+	});
+}
@@ -79,6 +79,62 @@ JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_update_1bo_1st
 JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_update_1ao_1status_1native
   (JNIEnv *, jobject, jlong, jdouble, jbyte, jlong, jint, jint);
 
+/*
+ * Class:     com_automatak_dnp3_impl_ChangeSetImpl
+ * Method:    update_binaries_native
+ * Signature: (J[I[Z[B[JI)V
+ */
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_update_1binaries_1native
+  (JNIEnv *, jobject, jlong, jintArray, jbooleanArray, jbyteArray, jlongArray, jint);
+
+/*
+ * Class:     com_automatak_dnp3_impl_ChangeSetImpl
+ * Method:    update_double_binaries_native
+ * Signature: (J[I[B[B[JI)V
+ */
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_update_1double_1binaries_1native
+  (JNIEnv *, jobject, jlong, jintArray, jbyteArray, jbyteArray, jlongArray, jint);
+
+/*
+ * Class:     com_automatak_dnp3_impl_ChangeSetImpl
+ * Method:    update_analogs_native
+ * Signature: (J[I[D[B[JI)V
+ */
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_update_1analogs_1native
+  (JNIEnv *, jobject, jlong, jintArray, jdoubleArray, jbyteArray, jlongArray, jint);
+
+/*
+ * Class:     com_automatak_dnp3_impl_ChangeSetImpl
+ * Method:    update_counters_native
+ * Signature: (J[I[J[B[JI)V
+ */
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_update_1counters_1native
+  (JNIEnv *, jobject, jlong, jintArray, jlongArray, jbyteArray, jlongArray, jint);
+
+/*
+ * Class:     com_automatak_dnp3_impl_ChangeSetImpl
+ * Method:    update_frozen_counters_native
+ * Signature: (J[I[J[B[JI)V
+ */
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_update_1frozen_1counters_1native
+  (JNIEnv *, jobject, jlong, jintArray, jlongArray, jbyteArray, jlongArray, jint);
+
+/*
+ * Class:     com_automatak_dnp3_impl_ChangeSetImpl
+ * Method:    update_bo_statuses_native
+ * Signature: (J[I[Z[B[JI)V
+ */
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_update_1bo_1statuses_1native
+  (JNIEnv *, jobject, jlong, jintArray, jbooleanArray, jbyteArray, jlongArray, jint);
+
+/*
+ * Class:     com_automatak_dnp3_impl_ChangeSetImpl
+ * Method:    update_ao_statuses_native
+ * Signature: (J[I[D[B[JI)V
+ */
+JNIEXPORT void JNICALL Java_com_automatak_dnp3_impl_ChangeSetImpl_update_1ao_1statuses_1native
+  (JNIEnv *, jobject, jlong, jintArray, jdoubleArray, jbyteArray, jlongArray, jint);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,7 @@
 
 #include "adapters/ConfigReader.h"
 #include "adapters/SOEHandlerAdapter.h"
+#include "adapters/BulkSOEHandlerAdapter.h"
 #include "adapters/MasterApplicationAdapter.h"
 #include "adapters/OutstationApplicationAdapter.h"
 #include "adapters/CommandHandlerAdapter.h"
@@ -101,6 +102,22 @@ JNIEXPORT jlong JNICALL Java_com_automatak_dnp3_impl_ChannelImpl_get_1native_1ma
 	return stack ? (jlong) new std::shared_ptr<IMaster>(stack) : 0;
 }
 
+JNIEXPORT jlong JNICALL Java_com_automatak_dnp3_impl_ChannelImpl_get_1native_1bulk_1master
+(JNIEnv* env, jobject, jlong native, jstring jid, jobject handler, jobject application, jobject jconfig)
+{
+	const auto channel = (std::shared_ptr<IChannel>*) native;
+
+	auto config = ConfigReader::ConvertMasterStackConfig(env, jconfig);
+	auto soeAdapter = std::make_shared<BulkSOEHandlerAdapter>(handler);
+	auto appAdapter = std::make_shared<MasterApplicationAdapter>(application);
+
+	CString id(env, jid);
+
+	auto stack = (*channel)->AddMaster(id.str(), soeAdapter, appAdapter, config);
+
+	return stack ? (jlong) new std::shared_ptr<IMaster>(stack) : 0;
+}
+
 JNIEXPORT jlong JNICALL Java_com_automatak_dnp3_impl_ChannelImpl_get_1native_1outstation
 (JNIEnv* env, jobject, jlong native, jstring jid, jobject commandHandler, jobject application, jobject jconfig)
 {
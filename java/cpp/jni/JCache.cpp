@@ -37,6 +37,7 @@ namespace jni
     cache::BinaryInput JCache::BinaryInput;
     cache::BinaryOutputStatus JCache::BinaryOutputStatus;
     cache::BinaryOutputStatusConfig JCache::BinaryOutputStatusConfig;
+    cache::BulkSOEHandlerProxy JCache::BulkSOEHandlerProxy;
     cache::ChannelListener JCache::ChannelListener;
     cache::ChannelState JCache::ChannelState;
     cache::ChannelStatistics JCache::ChannelStatistics;
@@ -134,6 +135,7 @@ namespace jni
         && BinaryInput.init(env)
         && BinaryOutputStatus.init(env)
         && BinaryOutputStatusConfig.init(env)
+        && BulkSOEHandlerProxy.init(env)
         && ChannelListener.init(env)
         && ChannelState.init(env)
         && ChannelStatistics.init(env)
@@ -233,6 +235,7 @@ namespace jni
         BinaryInput.cleanup(env);
         BinaryOutputStatus.cleanup(env);
         BinaryOutputStatusConfig.cleanup(env);
+        BulkSOEHandlerProxy.cleanup(env);
         ChannelListener.cleanup(env);
         ChannelState.cleanup(env);
         ChannelStatistics.cleanup(env);
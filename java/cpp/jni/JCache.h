@@ -38,6 +38,7 @@
 #include "JNIBinaryInput.h"
 #include "JNIBinaryOutputStatus.h"
 #include "JNIBinaryOutputStatusConfig.h"
+#include "JNIBulkSOEHandlerProxy.h"
 #include "JNIChannelListener.h"
 #include "JNIChannelState.h"
 #include "JNIChannelStatistics.h"
@@ -140,6 +141,7 @@ namespace jni
         static cache::BinaryInput BinaryInput;
         static cache::BinaryOutputStatus BinaryOutputStatus;
         static cache::BinaryOutputStatusConfig BinaryOutputStatusConfig;
+        static cache::BulkSOEHandlerProxy BulkSOEHandlerProxy;
         static cache::ChannelListener ChannelListener;
         static cache::ChannelState ChannelState;
         static cache::ChannelStatistics ChannelStatistics;
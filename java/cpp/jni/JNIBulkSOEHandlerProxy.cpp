@@ -0,0 +1,73 @@
+//
+//  _   _         ______    _ _ _   _             _ _ _
+// | \ | |       |  ____|  | (_) | (_)           | | | |
+// |  \| | ___   | |__   __| |_| |_ _ _ __   __ _| | | |
+// | . ` |/ _ \  |  __| / _` | | __| | '_ \ / _` | | | |
+// | |\  | (_) | | |___| (_| | | |_| | | | | (_| |_|_|_|
+// |_| \_|\___/  |______\__,_|_|\__|_|_| |_|\__, (_|_|_)
+//                                           __/ |
+//                                          |___/
+// 
+// This file is auto-generated. Do not edit manually
+// 
+// Copyright 2016 Automatak LLC
+// 
+// Automatak LLC (www.automatak.com) licenses this file
+// to you under the the Apache License Version 2.0 (the "License"):
+// 
+// http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "JNIBulkSOEHandlerProxy.h"
+
+namespace jni
+{
+    namespace cache
+    {
+        bool BulkSOEHandlerProxy::init(JNIEnv* env)
+        {
+            auto clazzTemp = env->FindClass("Lcom/automatak/dnp3/impl/BulkSOEHandlerProxy;");
+            this->clazz = (jclass) env->NewGlobalRef(clazzTemp);
+            env->DeleteLocalRef(clazzTemp);
+
+            this->endMethod = env->GetMethodID(this->clazz, "end", "()V");
+            if(!this->endMethod) return false;
+
+            this->processMethod = env->GetMethodID(this->clazz, "process", "(IIIZZIII)V");
+            if(!this->processMethod) return false;
+
+            this->setBufferMethod = env->GetMethodID(this->clazz, "setBuffer", "(Ljava/nio/ByteBuffer;I)V");
+            if(!this->setBufferMethod) return false;
+
+            this->startMethod = env->GetMethodID(this->clazz, "start", "()V");
+            if(!this->startMethod) return false;
+
+            return true;
+        }
+
+        void BulkSOEHandlerProxy::cleanup(JNIEnv* env)
+        {
+            env->DeleteGlobalRef(this->clazz);
+        }
+
+        void BulkSOEHandlerProxy::end(JNIEnv* env, jobject instance)
+        {
+            env->CallVoidMethod(instance, this->endMethod);
+        }
+
+        void BulkSOEHandlerProxy::process(JNIEnv* env, jobject instance, jint arg0, jint arg1, jint arg2, jboolean arg3, jboolean arg4, jint arg5, jint arg6, jint arg7)
+        {
+            env->CallVoidMethod(instance, this->processMethod, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+        }
+
+        void BulkSOEHandlerProxy::setBuffer(JNIEnv* env, jobject instance, jobject arg0, jint arg1)
+        {
+            env->CallVoidMethod(instance, this->setBufferMethod, arg0, arg1);
+        }
+
+        void BulkSOEHandlerProxy::start(JNIEnv* env, jobject instance)
+        {
+            env->CallVoidMethod(instance, this->startMethod);
+        }
+    }
+}
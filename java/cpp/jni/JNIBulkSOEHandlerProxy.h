@@ -0,0 +1,62 @@
+//
+//  _   _         ______    _ _ _   _             _ _ _
+// | \ | |       |  ____|  | (_) | (_)           | | | |
+// |  \| | ___   | |__   __| |_| |_ _ _ __   __ _| | | |
+// | . ` |/ _ \  |  __| / _` | | __| | '_ \ / _` | | | |
+// | |\  | (_) | | |___| (_| | | |_| | | | | (_| |_|_|_|
+// |_| \_|\___/  |______\__,_|_|\__|_|_| |_|\__, (_|_|_)
+//                                           __/ |
+//                                          |___/
+// 
+// This file is auto-generated. Do not edit manually
+// 
+// Copyright 2016 Automatak LLC
+// 
+// Automatak LLC (www.automatak.com) licenses this file
+// to you under the the Apache License Version 2.0 (the "License"):
+// 
+// http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef OPENDNP3JAVA_JNIBULKSOEHANDLERPROXY_H
+#define OPENDNP3JAVA_JNIBULKSOEHANDLERPROXY_H
+
+#include <jni.h>
+
+#include "../adapters/LocalRef.h"
+
+namespace jni
+{
+    struct JCache;
+
+    namespace cache
+    {
+        class BulkSOEHandlerProxy
+        {
+            friend struct jni::JCache;
+
+            bool init(JNIEnv* env);
+            void cleanup(JNIEnv* env);
+
+            public:
+
+            // methods
+            void end(JNIEnv* env, jobject instance);
+            void process(JNIEnv* env, jobject instance, jint arg0, jint arg1, jint arg2, jboolean arg3, jboolean arg4, jint arg5, jint arg6, jint arg7);
+            void setBuffer(JNIEnv* env, jobject instance, jobject arg0, jint arg1);
+            void start(JNIEnv* env, jobject instance);
+
+            private:
+
+            jclass clazz = nullptr;
+
+            // method ids
+            jmethodID endMethod = nullptr;
+            jmethodID processMethod = nullptr;
+            jmethodID setBufferMethod = nullptr;
+            jmethodID startMethod = nullptr;
+        };
+    }
+}
+
+#endif